@@ -0,0 +1,977 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Aes
+ *
+ * AES blok şifreleyicisinin iki kipi:
+ *
+ *  -> AesCtr: Sayaç kipi (NIST SP 800-38A). 16 baytlık sayaç
+ *     bloğu şifrelenip veri ile xor işleminden geçirilir,
+ *     sayaç her blokta büyük uçlu olarak bir artırılır
+ *  -> AesGcm: Galois/Sayaç kipi (NIST SP 800-38D). Sayaç
+ *     kipi ile şifreleme yapılır, şifreli metin ve ek veri
+ *     (aad) üzerinden 16 baytlık doğrulama etiketi üretilir
+ *
+ * Anahtar 16, 24 ya da 32 bayt olabilir (AES-128/192/256).
+ * Aynı anahtar ile aynı nonce iki farklı mesajda kullanılırsa
+ * anahtar akışı tekrar eder. Bu yüzden her mesaj için farklı
+ * bir nonce set_nonce ile verilmelidir. İki kipin de çerçeve
+ * arayüzünde her çerçeve için tuz ve sıra numarasından yeni
+ * nonce üretilir; AesCtr nonce değerini, AesGcm ise nonce
+ * ile etiketi çerçeve sonunda taşır
+ */
+
+// Include
+#include <array>
+#include <atomic>
+#include <random>
+#include <cstring>
+#include <algorithm>
+
+#include <core/algorithm.hpp>
+#include <cipher/aes/aeskernel.hpp>
+#include <cipher/aes/ghashkernel.hpp>
+
+// Namespace
+namespace cipher::block
+{
+    // Using Namespace
+    using namespace core::algorithm;
+
+    // Class
+    class AesCtr final : public Algorithm
+    {
+        public:
+            static constexpr std::size_t _SIZE_BLOCK = aeskernel::_SIZE_BLOCK; // byte
+            static constexpr std::size_t _SIZE_NONCE = aeskernel::_SIZE_BLOCK; // byte
+            static constexpr std::size_t _SIZE_SEAL = 12; // byte
+
+            using nonce_t = std::array<uint8_t, _SIZE_NONCE>;
+
+        private:
+            aeskernel::KeySchedule m_schedule;
+            nonce_t m_nonce {};
+
+            uint32_t m_salt { 0 };
+            std::atomic<uint64_t> m_sequence { 0 };
+
+        private:
+            nonce_t next_nonce() noexcept;
+            bool apply(const nonce_t& ar_nonce, uint8_t* ar_data, std::size_t ar_len, const uint64_t ar_block) const noexcept;
+
+        public:
+            explicit AesCtr(
+                const std::string& ar_name,
+                const std::string& ar_key,
+                const nonce_t& ar_nonce = {}
+            );
+
+            virtual ~AesCtr();
+
+            virtual bool has_error() const noexcept override;
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const override;
+
+            inline void set_nonce(const nonce_t& ar_nonce) noexcept;
+            inline const nonce_t& get_nonce() const noexcept;
+
+            using Algorithm::encrypt;
+            using Algorithm::decrypt;
+
+            virtual bool encrypt(std::string& ar_text) noexcept override;
+            virtual bool decrypt(std::string& ar_text) noexcept override;
+
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+
+            bool apply(uint8_t* ar_data, std::size_t ar_len, const uint64_t ar_block = 0) const noexcept;
+
+            virtual std::size_t get_seal_size() const noexcept override;
+            virtual bool seal(const Frame& ar_frame, std::byte* ar_trailer) noexcept override;
+            virtual bool open(const Frame& ar_frame, const std::byte* ar_trailer) noexcept override;
+    };
+
+    // Class
+    class AesGcm final : public Algorithm
+    {
+        public:
+            static constexpr std::size_t _SIZE_BLOCK = aeskernel::_SIZE_BLOCK; // byte
+            static constexpr std::size_t _SIZE_NONCE = 12; // byte
+            static constexpr std::size_t _SIZE_TAG = 16; // byte
+            static constexpr std::size_t _SIZE_SEAL = _SIZE_NONCE + _SIZE_TAG; // byte
+
+            using nonce_t = std::array<uint8_t, _SIZE_NONCE>;
+            using tag_t = std::array<uint8_t, _SIZE_TAG>;
+
+        private:
+            aeskernel::KeySchedule m_schedule;
+            ghashkernel::GhashKey m_ghash;
+            nonce_t m_nonce {};
+
+            uint32_t m_salt { 0 };
+            std::atomic<uint64_t> m_sequence { 0 };
+
+        private:
+            void ghash(uint8_t* ar_state, const uint8_t* ar_data, const std::size_t ar_len) const noexcept;
+            void compute_tag(const nonce_t& ar_nonce, const uint8_t* ar_aad, const std::size_t ar_aad_len, const uint8_t* ar_data, const std::size_t ar_len, tag_t& ar_tag) const noexcept;
+            static void counter_block(const nonce_t& ar_nonce, uint8_t* ar_block, const uint32_t ar_counter) noexcept;
+
+        public:
+            explicit AesGcm(
+                const std::string& ar_name,
+                const std::string& ar_key,
+                const nonce_t& ar_nonce = {}
+            );
+
+            virtual ~AesGcm();
+
+            virtual bool has_error() const noexcept override;
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const override;
+
+            inline void set_nonce(const nonce_t& ar_nonce) noexcept;
+            inline const nonce_t& get_nonce() const noexcept;
+
+            nonce_t next_nonce() noexcept;
+
+            bool seal(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, tag_t& ar_tag) const noexcept;
+            bool open(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, const tag_t& ar_tag) const noexcept;
+
+            bool seal(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, const nonce_t& ar_nonce, tag_t& ar_tag) const noexcept;
+            bool open(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, const nonce_t& ar_nonce, const tag_t& ar_tag) const noexcept;
+
+            using Algorithm::encrypt;
+            using Algorithm::decrypt;
+
+            virtual bool encrypt(std::string& ar_text) noexcept override;
+            virtual bool decrypt(std::string& ar_text) noexcept override;
+
+            virtual bool has_buffer() const noexcept override;
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+
+            virtual std::size_t get_seal_size() const noexcept override;
+            virtual bool seal(const Frame& ar_frame, std::byte* ar_trailer) noexcept override;
+            virtual bool open(const Frame& ar_frame, const std::byte* ar_trailer) noexcept override;
+    };
+
+    /**
+     * @brief AesCtr
+     *
+     * Sınıfın kurucu yapısıdır. Bir isim, anahtar ve isteğe
+     * bağlı olarak başlangıç sayaç bloğu alır. Anahtar 16, 24
+     * ya da 32 bayt değilse algoritma hatalı kabul edilir.
+     * Çerçeve sayaç blokları için tuz ve sıra numarasının
+     * başlangıcı rastgele seçilir
+     *
+     * @param string& Name
+     * @param string& Key
+     * @param nonce_t& Nonce
+     */
+    AesCtr::AesCtr(
+        const std::string& ar_name,
+        const std::string& ar_key,
+        const nonce_t& ar_nonce
+    )
+    :   Algorithm(ar_name, ar_key),
+        m_nonce(ar_nonce)
+    {
+        std::random_device tm_random;
+        this->m_salt = tm_random();
+        this->m_sequence.store((static_cast<uint64_t>(tm_random()) << 32) | tm_random(), std::memory_order_relaxed);
+
+        aeskernel::expand_key(reinterpret_cast<const uint8_t*>(this->get_key().data()), this->get_key().size(), this->m_schedule);
+    }
+
+    /**
+     * @brief ~AesCtr
+     *
+     * Tur anahtarları yıkım sırasında sıfırlanır
+     */
+    AesCtr::~AesCtr()
+    {
+        std::fill(std::begin(this->m_schedule.m_keys), std::end(this->m_schedule.m_keys), 0u);
+        this->m_schedule.m_rounds = 0;
+    }
+
+    /**
+     * @brief Has Error
+     *
+     * Temel kontrollere ek olarak anahtarın
+     * genişletilmiş olmasını bekler
+     *
+     * @return bool
+     */
+    bool AesCtr::has_error() const noexcept
+    {
+        return Algorithm::has_error() || this->m_schedule.m_rounds == 0;
+    }
+
+    /**
+     * @brief Clone
+     *
+     * Aynı isim, sayaç bloğu ile verilen anahtarı kullanan yeni
+     * AesCtr oluşturur. Kopyanın çerçeve tuzu ve sıra numarası
+     * yeniden rastgele seçilir, kaynak ile paylaşılmaz
+     *
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> AesCtr::clone(
+        const std::string& ar_key
+    ) const
+    {
+        return std::make_unique<AesCtr>(this->get_name(), ar_key, this->m_nonce);
+    }
+
+    /**
+     * @brief Next Nonce
+     *
+     * Tuz (4 bayt) ve bir artan sıra numarasından (8 bayt,
+     * büyük uçlu) çerçeve için yeni bir sayaç bloğu üretir,
+     * son 32 bit blok sayacıdır ve sıfırdan başlar. Birden
+     * çok iş parçacığından aynı anda çağrılabilir
+     *
+     * @return nonce_t
+     */
+    AesCtr::nonce_t AesCtr::next_nonce() noexcept
+    {
+        nonce_t tm_nonce {};
+        const uint64_t tm_sequence = this->m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        aeskernel::store_be32(tm_nonce.data(), this->m_salt);
+        ghashkernel::store_be64(tm_nonce.data() + 4, tm_sequence);
+
+        return tm_nonce;
+    }
+
+    /**
+     * @brief Set Nonce
+     *
+     * Sonraki işlemler için başlangıç sayaç bloğunu değiştirir
+     *
+     * @param nonce_t& Nonce
+     */
+    void AesCtr::set_nonce(
+        const nonce_t& ar_nonce
+    ) noexcept
+    {
+        this->m_nonce = ar_nonce;
+    }
+
+    /**
+     * @brief Get Nonce
+     *
+     * @return const nonce_t&
+     */
+    const AesCtr::nonce_t& AesCtr::get_nonce() const noexcept
+    {
+        return this->m_nonce;
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Sayaç bloğunun tamamı 128 bitlik büyük uçlu sayı olarak
+     * artar. Çekirdek sadece son 32 biti artırdığından veri,
+     * son 32 bitin taştığı noktalarda bölünür ve üst bitlere
+     * elde eklenir. Blok konumu verilirse sayaç o kadar
+     * ilerletilerek başlanır; böylece verinin herhangi bir
+     * parçası diğerlerinden bağımsız şifrelenebilir
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint64_t Block
+     * @return bool
+     */
+    bool AesCtr::apply(
+        uint8_t* ar_data,
+        std::size_t ar_len,
+        const uint64_t ar_block
+    ) const noexcept
+    {
+        return this->apply(this->m_nonce, ar_data, ar_len, ar_block);
+    }
+
+    /**
+     * @brief Apply (Nonce)
+     *
+     * Verilen başlangıç sayaç bloğu ile çalışır, örneğin
+     * sayaç bloğu değişmez. Çerçeve yolu bu şekilde aynı
+     * anda birden çok iş parçacığından çağrılabilir
+     *
+     * @param nonce_t& Nonce
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint64_t Block
+     * @return bool
+     */
+    bool AesCtr::apply(
+        const nonce_t& ar_nonce,
+        uint8_t* ar_data,
+        std::size_t ar_len,
+        const uint64_t ar_block
+    ) const noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        nonce_t tm_counter = ar_nonce;
+
+        // SEEK: ADD BLOCK OFFSET TO THE 128-BIT BIG ENDIAN COUNTER
+        uint64_t tm_carry = ar_block;
+        for(std::size_t tm_count = _SIZE_NONCE; tm_count-- > 0 && tm_carry;)
+        {
+            tm_carry += tm_counter[tm_count];
+            tm_counter[tm_count] = static_cast<uint8_t>(tm_carry);
+            tm_carry >>= 8;
+        }
+
+        while( ar_len )
+        {
+            const uint64_t tm_blocks = (uint64_t{ 1 } << 32) - aeskernel::load_be32(tm_counter.data() + 12);
+            const uint64_t tm_room = tm_blocks * _SIZE_BLOCK;
+            const std::size_t tm_chunk = tm_room < ar_len ? static_cast<std::size_t>(tm_room) : ar_len;
+
+            aeskernel::apply(this->m_schedule, tm_counter.data(), ar_data, tm_chunk);
+            ar_data += tm_chunk;
+            ar_len -= tm_chunk;
+
+            // LOW 32 BITS WRAPPED, CARRY INTO THE UPPER 96 BITS
+            std::fill(tm_counter.begin() + 12, tm_counter.end(), 0u);
+            for(std::size_t tm_count = 12; tm_count-- > 0 && ++tm_counter[tm_count] == 0;) {}
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Encrypt
+     *
+     * Verilen metni geçerli sayaç bloğu ile şifreler
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool AesCtr::encrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        return this->apply(reinterpret_cast<uint8_t*>(ar_text.data()), ar_text.size());
+    }
+
+    /**
+     * @brief Decrypt
+     *
+     * Sayaç kipinde şifre çözme şifreleme ile aynı işlemdir
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool AesCtr::decrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        return this->encrypt(ar_text);
+    }
+
+    /**
+     * @brief Encrypt (Buffer)
+     *
+     * Verilen alanı kopyalamadan yerinde şifreler
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool AesCtr::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->apply(reinterpret_cast<uint8_t*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     *
+     * Şifreleme ile aynı işlemdir
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool AesCtr::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->encrypt(ar_data, ar_len);
+    }
+
+    /**
+     * @brief Get Seal Size
+     *
+     * Çerçeve sonuna eklenen nonce boyutu (sayaç
+     * bloğunun blok sayacı olmayan ilk 12 baytı)
+     *
+     * @return size_t
+     */
+    std::size_t AesCtr::get_seal_size() const noexcept
+    {
+        return _SIZE_SEAL;
+    }
+
+    /**
+     * @brief Seal (Frame)
+     *
+     * Çerçevenin veri bölümünü yeni bir sayaç bloğu ile
+     * şifreler, sayaç bloğunun ilk 12 baytı verilen kuyruk
+     * alanına yazılır. Başlık şifrelenmez ve doğrulanmaz
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool AesCtr::seal(
+        const Frame& ar_frame,
+        std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        const nonce_t tm_nonce = this->next_nonce();
+        if( !this->apply(tm_nonce, reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload, 0) )
+            return false;
+
+        std::memcpy(ar_trailer, tm_nonce.data(), _SIZE_SEAL);
+        return true;
+    }
+
+    /**
+     * @brief Open (Frame)
+     *
+     * Kuyruktaki 12 bayt ve sıfır blok sayacı ile sayaç
+     * bloğunu kurar, veri bölümünü yerinde çözer
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool AesCtr::open(
+        const Frame& ar_frame,
+        const std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        nonce_t tm_nonce {};
+        std::memcpy(tm_nonce.data(), ar_trailer, _SIZE_SEAL);
+
+        return this->apply(tm_nonce, reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload, 0);
+    }
+
+    /**
+     * @brief AesGcm
+     *
+     * Sınıfın kurucu yapısıdır. Bir isim, anahtar ve isteğe
+     * bağlı olarak 12 baytlık nonce alır. Anahtar genişletilir
+     * ve GHASH anahtarı H = E(K, 0^128) hazırlanır. Çerçeve
+     * nonce değerleri için tuz ve sıra numarasının başlangıcı
+     * rastgele seçilir
+     *
+     * @param string& Name
+     * @param string& Key
+     * @param nonce_t& Nonce
+     */
+    AesGcm::AesGcm(
+        const std::string& ar_name,
+        const std::string& ar_key,
+        const nonce_t& ar_nonce
+    )
+    :   Algorithm(ar_name, ar_key),
+        m_nonce(ar_nonce)
+    {
+        std::random_device tm_random;
+        this->m_salt = tm_random();
+        this->m_sequence.store((static_cast<uint64_t>(tm_random()) << 32) | tm_random(), std::memory_order_relaxed);
+
+        if( !aeskernel::expand_key(reinterpret_cast<const uint8_t*>(this->get_key().data()), this->get_key().size(), this->m_schedule) )
+            return;
+
+        // H = E(K, 0): KEY STREAM OF A ZERO COUNTER OVER ZERO DATA
+        uint8_t tm_zero[_SIZE_BLOCK] {};
+        uint8_t tm_h[_SIZE_BLOCK] {};
+        aeskernel::apply(this->m_schedule, tm_zero, tm_h, _SIZE_BLOCK);
+
+        ghashkernel::init(tm_h, this->m_ghash);
+        std::fill(std::begin(tm_h), std::end(tm_h), 0u);
+    }
+
+    /**
+     * @brief ~AesGcm
+     *
+     * Tur anahtarları ve GHASH anahtarı yıkım
+     * sırasında sıfırlanır
+     */
+    AesGcm::~AesGcm()
+    {
+        std::fill(std::begin(this->m_schedule.m_keys), std::end(this->m_schedule.m_keys), 0u);
+        this->m_schedule.m_rounds = 0;
+        this->m_ghash = ghashkernel::GhashKey {};
+    }
+
+    /**
+     * @brief Has Error
+     *
+     * Temel kontrollere ek olarak anahtarın
+     * genişletilmiş olmasını bekler
+     *
+     * @return bool
+     */
+    bool AesGcm::has_error() const noexcept
+    {
+        return Algorithm::has_error() || this->m_schedule.m_rounds == 0;
+    }
+
+    /**
+     * @brief Clone
+     *
+     * Aynı isim ve nonce ile verilen anahtarı kullanan yeni
+     * AesGcm oluşturur
+     *
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> AesGcm::clone(
+        const std::string& ar_key
+    ) const
+    {
+        return std::make_unique<AesGcm>(this->get_name(), ar_key, this->m_nonce);
+    }
+
+    /**
+     * @brief Set Nonce
+     *
+     * Sonraki işlemler için nonce değerini değiştirir
+     *
+     * @param nonce_t& Nonce
+     */
+    void AesGcm::set_nonce(
+        const nonce_t& ar_nonce
+    ) noexcept
+    {
+        this->m_nonce = ar_nonce;
+    }
+
+    /**
+     * @brief Get Nonce
+     *
+     * @return const nonce_t&
+     */
+    const AesGcm::nonce_t& AesGcm::get_nonce() const noexcept
+    {
+        return this->m_nonce;
+    }
+
+    /**
+     * @brief Next Nonce
+     *
+     * Tuz (4 bayt) ve bir artan sıra numarasından (8 bayt,
+     * büyük uçlu) çerçeve için yeni bir nonce üretir. Birden
+     * çok iş parçacığından aynı anda çağrılabilir
+     *
+     * @return nonce_t
+     */
+    AesGcm::nonce_t AesGcm::next_nonce() noexcept
+    {
+        nonce_t tm_nonce {};
+        const uint64_t tm_sequence = this->m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        aeskernel::store_be32(tm_nonce.data(), this->m_salt);
+        ghashkernel::store_be64(tm_nonce.data() + 4, tm_sequence);
+
+        return tm_nonce;
+    }
+
+    /**
+     * @brief Counter Block
+     *
+     * Nonce || sayaç (büyük uçlu 32 bit) bloğunu oluşturur.
+     * Sayaç 1 olan blok J0 olarak adlandırılır
+     *
+     * @param nonce_t& Nonce
+     * @param uint8_t* Block
+     * @param uint32_t Counter
+     */
+    void AesGcm::counter_block(
+        const nonce_t& ar_nonce,
+        uint8_t* ar_block,
+        const uint32_t ar_counter
+    ) noexcept
+    {
+        std::copy(ar_nonce.begin(), ar_nonce.end(), ar_block);
+        aeskernel::store_be32(ar_block + _SIZE_NONCE, ar_counter);
+    }
+
+    /**
+     * @brief Ghash
+     *
+     * Veriyi GHASH durumuna ekler. Son eksik blok
+     * sıfır ile tamamlanır
+     *
+     * @param uint8_t* State
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    void AesGcm::ghash(
+        uint8_t* ar_state,
+        const uint8_t* ar_data,
+        const std::size_t ar_len
+    ) const noexcept
+    {
+        const std::size_t tm_full = ar_len - (ar_len % _SIZE_BLOCK);
+        ghashkernel::apply(this->m_ghash, ar_state, ar_data, tm_full);
+
+        if( tm_full != ar_len )
+        {
+            uint8_t tm_block[_SIZE_BLOCK] {};
+            std::copy(ar_data + tm_full, ar_data + ar_len, tm_block);
+            ghashkernel::apply(this->m_ghash, ar_state, tm_block, _SIZE_BLOCK);
+        }
+    }
+
+    /**
+     * @brief Compute Tag
+     *
+     * T = E(K, J0) ^ GHASH(A || 0* || C || 0* || len(A) || len(C))
+     *
+     * @param nonce_t& Nonce
+     * @param uint8_t* Aad
+     * @param size_t Aad Length
+     * @param uint8_t* Ciphertext
+     * @param size_t Length
+     * @param tag_t& Tag
+     */
+    void AesGcm::compute_tag(
+        const nonce_t& ar_nonce,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const uint8_t* ar_data,
+        const std::size_t ar_len,
+        tag_t& ar_tag
+    ) const noexcept
+    {
+        uint8_t tm_state[_SIZE_BLOCK] {};
+        this->ghash(tm_state, ar_aad, ar_aad_len);
+        this->ghash(tm_state, ar_data, ar_len);
+
+        uint8_t tm_lengths[_SIZE_BLOCK];
+        ghashkernel::store_be64(tm_lengths, static_cast<uint64_t>(ar_aad_len) * 8);
+        ghashkernel::store_be64(tm_lengths + 8, static_cast<uint64_t>(ar_len) * 8);
+        ghashkernel::apply(this->m_ghash, tm_state, tm_lengths, _SIZE_BLOCK);
+
+        uint8_t tm_j0[_SIZE_BLOCK];
+        counter_block(ar_nonce, tm_j0, 1);
+        aeskernel::apply(this->m_schedule, tm_j0, tm_state, _SIZE_BLOCK);
+
+        std::copy(std::begin(tm_state), std::end(tm_state), ar_tag.begin());
+    }
+
+    /**
+     * @brief Seal
+     *
+     * Veriyi sınıfın nonce değeri ile yerinde şifreler ve ek
+     * veri ile birlikte doğrulama etiketini üretir
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* Aad
+     * @param size_t Aad Length
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool AesGcm::seal(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        tag_t& ar_tag
+    ) const noexcept
+    {
+        return this->seal(ar_data, ar_len, ar_aad, ar_aad_len, this->m_nonce, ar_tag);
+    }
+
+    /**
+     * @brief Open
+     *
+     * Sınıfın nonce değeri ile etiketi doğrular ve
+     * veriyi yerinde çözer
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* Aad
+     * @param size_t Aad Length
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool AesGcm::open(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const tag_t& ar_tag
+    ) const noexcept
+    {
+        return this->open(ar_data, ar_len, ar_aad, ar_aad_len, this->m_nonce, ar_tag);
+    }
+
+    /**
+     * @brief Seal (Nonce)
+     *
+     * Veriyi verilen nonce ile yerinde şifreler ve ek
+     * veri ile birlikte doğrulama etiketini üretir
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* Aad
+     * @param size_t Aad Length
+     * @param nonce_t& Nonce
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool AesGcm::seal(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const nonce_t& ar_nonce,
+        tag_t& ar_tag
+    ) const noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        uint8_t tm_counter[_SIZE_BLOCK];
+        counter_block(ar_nonce, tm_counter, 2);
+        aeskernel::apply(this->m_schedule, tm_counter, ar_data, ar_len);
+
+        this->compute_tag(ar_nonce, ar_aad, ar_aad_len, ar_data, ar_len, ar_tag);
+        return true;
+    }
+
+    /**
+     * @brief Open (Nonce)
+     *
+     * Önce etiket şifreli metin üzerinden doğrulanır,
+     * karşılaştırma sabit zamanlıdır. Etiket tutmazsa veri
+     * değiştirilmeden false döner, tutarsa yerinde çözülür
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* Aad
+     * @param size_t Aad Length
+     * @param nonce_t& Nonce
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool AesGcm::open(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const nonce_t& ar_nonce,
+        const tag_t& ar_tag
+    ) const noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        tag_t tm_expect {};
+        this->compute_tag(ar_nonce, ar_aad, ar_aad_len, ar_data, ar_len, tm_expect);
+
+        uint8_t tm_diff = 0;
+        for(std::size_t tm_count = 0; tm_count < _SIZE_TAG; ++tm_count)
+            tm_diff |= static_cast<uint8_t>(tm_expect[tm_count] ^ ar_tag[tm_count]);
+
+        if( tm_diff != 0 )
+            return false;
+
+        uint8_t tm_counter[_SIZE_BLOCK];
+        counter_block(ar_nonce, tm_counter, 2);
+        aeskernel::apply(this->m_schedule, tm_counter, ar_data, ar_len);
+        return true;
+    }
+
+    /**
+     * @brief Encrypt
+     *
+     * Metni şifreler ve sonuna 16 baytlık etiketi ekler
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool AesGcm::encrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        tag_t tm_tag {};
+        if( !this->seal(reinterpret_cast<uint8_t*>(ar_text.data()), ar_text.size(), nullptr, 0, tm_tag) )
+            return false;
+
+        ar_text.append(reinterpret_cast<const char*>(tm_tag.data()), tm_tag.size());
+        return true;
+    }
+
+    /**
+     * @brief Decrypt
+     *
+     * Metnin sonundaki etiketi ayırır, doğrular ve şifreyi
+     * çözer. Etiket tutmazsa metin değiştirilmez
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool AesGcm::decrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        if( ar_text.size() < _SIZE_TAG )
+            return false;
+
+        const std::size_t tm_len = ar_text.size() - _SIZE_TAG;
+
+        tag_t tm_tag {};
+        std::copy(ar_text.begin() + tm_len, ar_text.end(), tm_tag.begin());
+
+        if( !this->open(reinterpret_cast<uint8_t*>(ar_text.data()), tm_len, nullptr, 0, tm_tag) )
+            return false;
+
+        ar_text.resize(tm_len);
+        return true;
+    }
+
+    /**
+     * @brief Has Buffer
+     *
+     * Etiket için yer gerektiğinden boyutu değiştirmeyen
+     * tampon arayüzü desteklenmez
+     *
+     * @return bool
+     */
+    bool AesGcm::has_buffer() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief Encrypt (Buffer)
+     *
+     * Etiket için alan olmadığından yerinde arayüz
+     * desteklenmez (has_buffer false), veri değişmeden
+     * false döner; seal kullanılmalıdır
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool AesGcm::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        (void)ar_data; (void)ar_len;
+        return false;
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     *
+     * Etiket için alan olmadığından yerinde arayüz
+     * desteklenmez (has_buffer false), veri değişmeden
+     * false döner; open kullanılmalıdır
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool AesGcm::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        (void)ar_data; (void)ar_len;
+        return false;
+    }
+
+    /**
+     * @brief Get Seal Size
+     *
+     * Çerçeve sonuna eklenen nonce ve etiket boyutu
+     *
+     * @return size_t
+     */
+    std::size_t AesGcm::get_seal_size() const noexcept
+    {
+        return _SIZE_SEAL;
+    }
+
+    /**
+     * @brief Seal (Frame)
+     *
+     * Çerçevenin veri bölümünü yeni bir nonce ile şifreler,
+     * başlığı ek veri olarak doğrular. Nonce ve etiket
+     * verilen kuyruk alanına yazılır
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool AesGcm::seal(
+        const Frame& ar_frame,
+        std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        const nonce_t tm_nonce = this->next_nonce();
+        tag_t tm_tag;
+
+        if( !this->seal(reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload,
+            reinterpret_cast<const uint8_t*>(ar_frame.m_data), ar_frame.m_header, tm_nonce, tm_tag) )
+            return false;
+
+        std::memcpy(ar_trailer, tm_nonce.data(), _SIZE_NONCE);
+        std::memcpy(ar_trailer + _SIZE_NONCE, tm_tag.data(), _SIZE_TAG);
+        return true;
+    }
+
+    /**
+     * @brief Open (Frame)
+     *
+     * Kuyruktaki nonce ve etiket ile başlığı ve veri
+     * bölümünü doğrular, veri bölümünü yerinde çözer
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool AesGcm::open(
+        const Frame& ar_frame,
+        const std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        nonce_t tm_nonce;
+        tag_t tm_tag;
+        std::memcpy(tm_nonce.data(), ar_trailer, _SIZE_NONCE);
+        std::memcpy(tm_tag.data(), ar_trailer + _SIZE_NONCE, _SIZE_TAG);
+
+        return this->open(reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload,
+            reinterpret_cast<const uint8_t*>(ar_frame.m_data), ar_frame.m_header, tm_nonce, tm_tag);
+    }
+}
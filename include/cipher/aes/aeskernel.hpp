@@ -0,0 +1,527 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Aes Kernel (Aes Çekirdeği)
+ *
+ * AES (FIPS-197) anahtar genişletme ve sayaç (CTR) kipinde
+ * anahtar akışı üreten çekirdekler. Destekleyen x86-64
+ * işlemcilerde AES-NI komutları ile aynı anda 8 blok işlenir.
+ * Desteklemeyen sistemlerde tablo kullanmayan, bu sayede
+ * veri ya da anahtara göre bellek erişimi değişmeyen (sabit
+ * zamanlı) yazılımsal yol kullanılır. S-kutusu değeri, 8 bayt
+ * aynı anda olacak şekilde GF(2^8) üzerinde tersi alınıp afin
+ * dönüşümden geçirilerek hesaplanır. Hangi yolun kullanılacağı
+ * ilk çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __AES_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __AES_X86__ 0
+#endif
+
+// Namespace
+namespace cipher::block::aeskernel
+{
+    // Limit
+    static constexpr std::size_t _SIZE_BLOCK = 16; // byte
+    static constexpr std::size_t _MAX_ROUNDS = 14;
+    static constexpr std::size_t _SIZE_SCHEDULE = _SIZE_BLOCK * (_MAX_ROUNDS + 1); // byte
+
+    static constexpr std::size_t _SIZE_KEY_128 = 16; // byte
+    static constexpr std::size_t _SIZE_KEY_192 = 24; // byte
+    static constexpr std::size_t _SIZE_KEY_256 = 32; // byte
+
+    // Struct
+    struct KeySchedule
+    {
+        alignas(16) uint8_t m_keys[_SIZE_SCHEDULE] {};
+        std::size_t m_rounds { 0 };
+    };
+
+    // Type Definition
+    using ctr_fn_t = void (*)(const KeySchedule&, const uint8_t*, uint8_t*, std::size_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        portable = 0,
+        aesni
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AES | core::platform::_CPU_SSE41, kernel_t::aesni },
+        { core::platform::_CPU_NULL, kernel_t::portable }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] ctr_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] void apply(const KeySchedule& ar_schedule, const uint8_t* ar_counter, uint8_t* ar_data, const std::size_t ar_len) noexcept;
+
+    /**
+     * @brief Xtime (8 Byte)
+     *
+     * 8 baytın her birini GF(2^8) üzerinde x ile çarpar
+     *
+     * @param uint64_t Bytes
+     * @return uint64_t
+     */
+    static inline constexpr uint64_t xtime8(const uint64_t ar_value) noexcept
+    {
+        return ((ar_value & 0x7F7F7F7F7F7F7F7Full) << 1) ^ (((ar_value >> 7) & 0x0101010101010101ull) * 0x1B);
+    }
+
+    /**
+     * @brief Multiply (8 Byte)
+     *
+     * 8 bayt çiftini GF(2^8) üzerinde dallanma olmadan çarpar
+     *
+     * @param uint64_t A
+     * @param uint64_t B
+     * @return uint64_t
+     */
+    static inline constexpr uint64_t gmul8(uint64_t ar_a, const uint64_t ar_b) noexcept
+    {
+        uint64_t tm_result = 0;
+        for(int tm_bit = 0; tm_bit < 8; ++tm_bit)
+        {
+            tm_result ^= ar_a & (((ar_b >> tm_bit) & 0x0101010101010101ull) * 0xFF);
+            ar_a = xtime8(ar_a);
+        }
+        return tm_result;
+    }
+
+    /**
+     * @brief Rotate Left (8 Byte)
+     *
+     * 8 baytın her birini kendi içinde sola döndürür
+     *
+     * @param uint64_t Bytes
+     * @param int Count
+     * @return uint64_t
+     */
+    static inline constexpr uint64_t rotl8(const uint64_t ar_value, const int ar_count) noexcept
+    {
+        const uint64_t tm_high = ((0xFFull << ar_count) & 0xFF) * 0x0101010101010101ull;
+        const uint64_t tm_low = (0xFFull >> (8 - ar_count)) * 0x0101010101010101ull;
+        return ((ar_value << ar_count) & tm_high) | ((ar_value >> (8 - ar_count)) & tm_low);
+    }
+
+    /**
+     * @brief Sub Bytes (8 Byte)
+     *
+     * S-kutusunu tablo kullanmadan 8 bayta uygular. Ters eleman
+     * x^254 ile 4 çarpma ve 7 kare alma ile bulunur, ardından
+     * afin dönüşüm yapılır. 0 değeri kendiliğinden 0'a gider
+     *
+     * @param uint64_t Bytes
+     * @return uint64_t
+     */
+    static inline constexpr uint64_t sub8(const uint64_t ar_value) noexcept
+    {
+        const uint64_t tm_x2 = gmul8(ar_value, ar_value);
+        const uint64_t tm_x3 = gmul8(tm_x2, ar_value);
+        const uint64_t tm_x6 = gmul8(tm_x3, tm_x3);
+        const uint64_t tm_x12 = gmul8(tm_x6, tm_x6);
+        const uint64_t tm_x15 = gmul8(tm_x12, tm_x3);
+        const uint64_t tm_x30 = gmul8(tm_x15, tm_x15);
+        const uint64_t tm_x60 = gmul8(tm_x30, tm_x30);
+        const uint64_t tm_x120 = gmul8(tm_x60, tm_x60);
+        const uint64_t tm_x240 = gmul8(tm_x120, tm_x120);
+        const uint64_t tm_x252 = gmul8(tm_x240, tm_x12);
+        const uint64_t tm_inv = gmul8(tm_x252, tm_x2);
+
+        return tm_inv ^ rotl8(tm_inv, 1) ^ rotl8(tm_inv, 2) ^ rotl8(tm_inv, 3) ^ rotl8(tm_inv, 4) ^ 0x6363636363636363ull;
+    }
+
+    /**
+     * @brief Sub Block
+     *
+     * 16 baytlık duruma S-kutusunu uygular
+     *
+     * @param uint8_t* State
+     */
+    static inline void sub_block(uint8_t* ar_state) noexcept
+    {
+        uint64_t tm_word[2];
+        std::memcpy(tm_word, ar_state, sizeof(tm_word));
+        tm_word[0] = sub8(tm_word[0]);
+        tm_word[1] = sub8(tm_word[1]);
+        std::memcpy(ar_state, tm_word, sizeof(tm_word));
+    }
+
+    /**
+     * @brief Expand Key
+     *
+     * FIPS-197 bölüm 5.2'ye göre 16, 24 ya da 32 baytlık
+     * anahtardan tur anahtarlarını üretir. Başka uzunlukta
+     * anahtar için false döner
+     *
+     * @param uint8_t* Key
+     * @param size_t Length
+     * @param KeySchedule& Schedule
+     * @return bool
+     */
+    [[maybe_unused]]
+    static inline bool expand_key(
+        const uint8_t* ar_key,
+        const std::size_t ar_len,
+        KeySchedule& ar_schedule
+    ) noexcept
+    {
+        if( ar_len != _SIZE_KEY_128 && ar_len != _SIZE_KEY_192 && ar_len != _SIZE_KEY_256 )
+            return false;
+
+        const std::size_t tm_nk = ar_len / 4;
+        ar_schedule.m_rounds = tm_nk + 6;
+
+        const std::size_t tm_words = 4 * (ar_schedule.m_rounds + 1);
+        uint8_t* tm_w = ar_schedule.m_keys;
+        std::memcpy(tm_w, ar_key, ar_len);
+
+        uint8_t tm_rcon = 0x01;
+        for(std::size_t tm_index = tm_nk; tm_index < tm_words; ++tm_index)
+        {
+            uint8_t tm_temp[8] {};
+            std::memcpy(tm_temp, tm_w + (tm_index - 1) * 4, 4);
+
+            if( tm_index % tm_nk == 0 )
+            {
+                // ROTWORD + SUBWORD + RCON
+                std::rotate(tm_temp, tm_temp + 1, tm_temp + 4);
+
+                uint64_t tm_word = 0;
+                std::memcpy(&tm_word, tm_temp, sizeof(tm_word));
+                tm_word = sub8(tm_word);
+                std::memcpy(tm_temp, &tm_word, sizeof(tm_word));
+
+                tm_temp[0] ^= tm_rcon;
+                tm_rcon = static_cast<uint8_t>(xtime8(tm_rcon));
+            }
+            else if( tm_nk > 6 && tm_index % tm_nk == 4 )
+            {
+                uint64_t tm_word = 0;
+                std::memcpy(&tm_word, tm_temp, sizeof(tm_word));
+                tm_word = sub8(tm_word);
+                std::memcpy(tm_temp, &tm_word, sizeof(tm_word));
+            }
+
+            for(std::size_t tm_byte = 0; tm_byte < 4; ++tm_byte)
+                tm_w[tm_index * 4 + tm_byte] = tm_w[(tm_index - tm_nk) * 4 + tm_byte] ^ tm_temp[tm_byte];
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Encrypt Block
+     *
+     * Tek bloğu yazılımsal yol ile şifreler. Bayt
+     * konumuna ya da değerine bağlı bellek erişimi yoktur
+     *
+     * @param KeySchedule& Schedule
+     * @param uint8_t* In
+     * @param uint8_t* Out
+     */
+    static inline void encrypt_block(
+        const KeySchedule& ar_schedule,
+        const uint8_t* ar_in,
+        uint8_t* ar_out
+    ) noexcept
+    {
+        uint8_t tm_state[_SIZE_BLOCK];
+        for(std::size_t tm_count = 0; tm_count < _SIZE_BLOCK; ++tm_count)
+            tm_state[tm_count] = ar_in[tm_count] ^ ar_schedule.m_keys[tm_count];
+
+        for(std::size_t tm_round = 1; tm_round <= ar_schedule.m_rounds; ++tm_round)
+        {
+            sub_block(tm_state);
+
+            // SHIFT ROWS: ROW r MOVES LEFT BY r COLUMNS
+            uint8_t tm_shift[_SIZE_BLOCK];
+            for(std::size_t tm_col = 0; tm_col < 4; ++tm_col)
+                for(std::size_t tm_row = 0; tm_row < 4; ++tm_row)
+                    tm_shift[tm_col * 4 + tm_row] = tm_state[((tm_col + tm_row) % 4) * 4 + tm_row];
+
+            // MIX COLUMNS EXCEPT THE LAST ROUND
+            if( tm_round != ar_schedule.m_rounds )
+            {
+                for(std::size_t tm_col = 0; tm_col < 4; ++tm_col)
+                {
+                    const uint8_t* tm_a = tm_shift + tm_col * 4;
+                    uint8_t tm_b[4];
+                    for(std::size_t tm_row = 0; tm_row < 4; ++tm_row)
+                        tm_b[tm_row] = static_cast<uint8_t>(xtime8(tm_a[tm_row]));
+
+                    for(std::size_t tm_row = 0; tm_row < 4; ++tm_row)
+                        tm_state[tm_col * 4 + tm_row] = tm_b[tm_row] ^ tm_a[(tm_row + 1) % 4] ^ tm_b[(tm_row + 1) % 4]
+                            ^ tm_a[(tm_row + 2) % 4] ^ tm_a[(tm_row + 3) % 4];
+                }
+            }
+            else
+                std::memcpy(tm_state, tm_shift, _SIZE_BLOCK);
+
+            const uint8_t* tm_key = ar_schedule.m_keys + tm_round * _SIZE_BLOCK;
+            for(std::size_t tm_count = 0; tm_count < _SIZE_BLOCK; ++tm_count)
+                tm_state[tm_count] ^= tm_key[tm_count];
+        }
+
+        std::memcpy(ar_out, tm_state, _SIZE_BLOCK);
+    }
+
+    /**
+     * @brief Load BE32
+     *
+     * @param uint8_t* Data
+     * @return uint32_t
+     */
+    static inline uint32_t load_be32(const uint8_t* ar_data) noexcept
+    {
+        return (static_cast<uint32_t>(ar_data[0]) << 24) | (static_cast<uint32_t>(ar_data[1]) << 16)
+            | (static_cast<uint32_t>(ar_data[2]) << 8) | static_cast<uint32_t>(ar_data[3]);
+    }
+
+    /**
+     * @brief Store BE32
+     *
+     * @param uint8_t* Data
+     * @param uint32_t Value
+     */
+    static inline void store_be32(uint8_t* ar_data, const uint32_t ar_value) noexcept
+    {
+        ar_data[0] = static_cast<uint8_t>(ar_value >> 24);
+        ar_data[1] = static_cast<uint8_t>(ar_value >> 16);
+        ar_data[2] = static_cast<uint8_t>(ar_value >> 8);
+        ar_data[3] = static_cast<uint8_t>(ar_value);
+    }
+
+    /**
+     * @brief Kernel Portable
+     *
+     * Sayaç bloğunu blok blok şifreleyip veriye uygular.
+     * Sayacın son 4 baytı büyük uçlu (big endian) olarak
+     * artırılır (GCM inc32), üst baytlar değişmez
+     *
+     * @param KeySchedule& Schedule
+     * @param uint8_t* Counter
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    static inline void kernel_portable(
+        const KeySchedule& ar_schedule,
+        const uint8_t* ar_counter,
+        uint8_t* ar_data,
+        std::size_t ar_len
+    ) noexcept
+    {
+        uint8_t tm_block[_SIZE_BLOCK];
+        uint8_t tm_stream[_SIZE_BLOCK];
+        std::memcpy(tm_block, ar_counter, _SIZE_BLOCK);
+        uint32_t tm_counter = load_be32(ar_counter + 12);
+
+        while( ar_len )
+        {
+            store_be32(tm_block + 12, tm_counter++);
+            encrypt_block(ar_schedule, tm_block, tm_stream);
+
+            const std::size_t tm_chunk = std::min(ar_len, _SIZE_BLOCK);
+            for(std::size_t tm_count = 0; tm_count < tm_chunk; ++tm_count)
+                ar_data[tm_count] ^= tm_stream[tm_count];
+
+            ar_data += tm_chunk;
+            ar_len -= tm_chunk;
+        }
+
+        std::memset(tm_stream, 0, sizeof(tm_stream));
+    }
+
+    #if __AES_X86__
+        /**
+         * @brief Kernel AES-NI
+         *
+         * Döngü başına 8 sayaç bloğu aynı anda tur komutlarından
+         * geçirilir, böylece komut gecikmesi bloklar arasında
+         * gizlenir. Kalan tam bloklar tek tek, son eksik blok
+         * geçici alan üzerinden işlenir
+         *
+         * @param KeySchedule& Schedule
+         * @param uint8_t* Counter
+         * @param uint8_t* Data
+         * @param size_t Length
+         */
+        __attribute__((target("aes,sse4.1")))
+        static inline void kernel_aesni(
+            const KeySchedule& ar_schedule,
+            const uint8_t* ar_counter,
+            uint8_t* ar_data,
+            std::size_t ar_len
+        ) noexcept
+        {
+            const std::size_t tm_rounds = ar_schedule.m_rounds;
+
+            __m128i tm_key[_MAX_ROUNDS + 1];
+            for(std::size_t tm_round = 0; tm_round <= tm_rounds; ++tm_round)
+                tm_key[tm_round] = _mm_load_si128(reinterpret_cast<const __m128i*>(ar_schedule.m_keys + tm_round * _SIZE_BLOCK));
+
+            const __m128i tm_base = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_counter));
+            uint32_t tm_counter = load_be32(ar_counter + 12);
+
+            while( ar_len >= 8 * _SIZE_BLOCK )
+            {
+                __m128i tm_block[8];
+                for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+                {
+                    const int tm_value = static_cast<int>(__builtin_bswap32(tm_counter + static_cast<uint32_t>(tm_lane)));
+                    tm_block[tm_lane] = _mm_xor_si128(_mm_insert_epi32(tm_base, tm_value, 3), tm_key[0]);
+                }
+
+                for(std::size_t tm_round = 1; tm_round < tm_rounds; ++tm_round)
+                    for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+                        tm_block[tm_lane] = _mm_aesenc_si128(tm_block[tm_lane], tm_key[tm_round]);
+
+                for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+                {
+                    auto* tm_ptr = reinterpret_cast<__m128i*>(ar_data + tm_lane * _SIZE_BLOCK);
+                    const __m128i tm_stream = _mm_aesenclast_si128(tm_block[tm_lane], tm_key[tm_rounds]);
+                    _mm_storeu_si128(tm_ptr, _mm_xor_si128(_mm_loadu_si128(tm_ptr), tm_stream));
+                }
+
+                tm_counter += 8;
+                ar_data += 8 * _SIZE_BLOCK;
+                ar_len -= 8 * _SIZE_BLOCK;
+            }
+
+            while( ar_len )
+            {
+                __m128i tm_block = _mm_xor_si128(_mm_insert_epi32(tm_base, static_cast<int>(__builtin_bswap32(tm_counter++)), 3), tm_key[0]);
+                for(std::size_t tm_round = 1; tm_round < tm_rounds; ++tm_round)
+                    tm_block = _mm_aesenc_si128(tm_block, tm_key[tm_round]);
+                tm_block = _mm_aesenclast_si128(tm_block, tm_key[tm_rounds]);
+
+                if( ar_len >= _SIZE_BLOCK )
+                {
+                    auto* tm_ptr = reinterpret_cast<__m128i*>(ar_data);
+                    _mm_storeu_si128(tm_ptr, _mm_xor_si128(_mm_loadu_si128(tm_ptr), tm_block));
+
+                    ar_data += _SIZE_BLOCK;
+                    ar_len -= _SIZE_BLOCK;
+                    continue;
+                }
+
+                alignas(16) uint8_t tm_stream[_SIZE_BLOCK];
+                _mm_store_si128(reinterpret_cast<__m128i*>(tm_stream), tm_block);
+                for(std::size_t tm_count = 0; tm_count < ar_len; ++tm_count)
+                    ar_data[tm_count] ^= tm_stream[tm_count];
+
+                ar_len = 0;
+            }
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemci AES-NI destekliyorsa onu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa yazılımsal yol döner
+     *
+     * @param kernel_t Kernel
+     * @return ctr_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    ctr_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_portable;
+
+        switch( ar_kernel )
+        {
+            #if __AES_X86__
+                case kernel_t::aesni: return &kernel_aesni;
+            #endif
+            case kernel_t::portable:
+            default:
+                return &kernel_portable;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Sayaç bloğundan başlayarak üretilen anahtar akışını
+     * seçilen çekirdek üzerinden veriye uygular
+     *
+     * @param KeySchedule& Schedule
+     * @param uint8_t* Counter
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    [[maybe_unused]]
+    void apply(
+        const KeySchedule& ar_schedule,
+        const uint8_t* ar_counter,
+        uint8_t* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static const ctr_fn_t ss_fn = get_function(get_kernel());
+        ss_fn(ar_schedule, ar_counter, ar_data, ar_len);
+    }
+}
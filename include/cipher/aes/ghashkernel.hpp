@@ -0,0 +1,415 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Ghash Kernel (Ghash Çekirdeği)
+ *
+ * GCM kipinin doğrulama etiketi için kullanılan GF(2^128)
+ * üzerindeki GHASH fonksiyonu. Destekleyen x86-64 işlemcilerde
+ * PCLMULQDQ (elde taşımayan çarpma) ile 4 blok H^4..H^1
+ * kuvvetleri ile çarpılıp tek indirgeme ile birleştirilir.
+ * Desteklemeyen sistemlerde bit bit, dallanma olmadan çalışan
+ * (sabit zamanlı) yazılımsal yol kullanılır. Hangi yolun
+ * kullanılacağı ilk çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __GHASH_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __GHASH_X86__ 0
+#endif
+
+// Namespace
+namespace cipher::block::ghashkernel
+{
+    // Limit
+    static constexpr std::size_t _SIZE_BLOCK = 16; // byte
+    static constexpr std::size_t _SIZE_POWER = 4;
+
+    // Struct
+    struct GhashKey
+    {
+        uint64_t m_high { 0 };
+        uint64_t m_low { 0 };
+        alignas(16) uint8_t m_power[_SIZE_POWER][_SIZE_BLOCK] {};
+    };
+
+    // Type Definition
+    using ghash_fn_t = void (*)(const GhashKey&, uint8_t*, const uint8_t*, std::size_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        portable = 0,
+        pclmul
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_PCLMUL | core::platform::_CPU_SSSE3, kernel_t::pclmul },
+        { core::platform::_CPU_NULL, kernel_t::portable }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] ghash_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] void apply(const GhashKey& ar_key, uint8_t* ar_state, const uint8_t* ar_data, const std::size_t ar_len) noexcept;
+
+    /**
+     * @brief Load BE64
+     *
+     * @param uint8_t* Data
+     * @return uint64_t
+     */
+    static inline uint64_t load_be64(const uint8_t* ar_data) noexcept
+    {
+        uint64_t tm_value = 0;
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+            tm_value = (tm_value << 8) | ar_data[tm_count];
+        return tm_value;
+    }
+
+    /**
+     * @brief Store BE64
+     *
+     * @param uint8_t* Data
+     * @param uint64_t Value
+     */
+    static inline void store_be64(uint8_t* ar_data, uint64_t ar_value) noexcept
+    {
+        for(std::size_t tm_count = 8; tm_count-- > 0; ar_value >>= 8)
+            ar_data[tm_count] = static_cast<uint8_t>(ar_value);
+    }
+
+    /**
+     * @brief Multiply
+     *
+     * NIST SP 800-38D algoritma 1 ile X * H çarpımı. Her bit
+     * için maske kullanıldığından veri ya da anahtara bağlı
+     * dallanma yoktur
+     *
+     * @param uint64_t& X High
+     * @param uint64_t& X Low
+     * @param uint64_t H High
+     * @param uint64_t H Low
+     */
+    static inline void multiply(
+        uint64_t& ar_high,
+        uint64_t& ar_low,
+        uint64_t ar_h_high,
+        uint64_t ar_h_low
+    ) noexcept
+    {
+        uint64_t tm_high = 0;
+        uint64_t tm_low = 0;
+
+        for(int tm_bit = 0; tm_bit < 128; ++tm_bit)
+        {
+            const uint64_t tm_word = tm_bit < 64 ? ar_high : ar_low;
+            const uint64_t tm_mask = 0 - ((tm_word >> (63 - (tm_bit & 63))) & 1);
+            tm_high ^= ar_h_high & tm_mask;
+            tm_low ^= ar_h_low & tm_mask;
+
+            // V >> 1, REDUCE WITH R = 11100001 || 0^120
+            const uint64_t tm_carry = 0 - (ar_h_low & 1);
+            ar_h_low = (ar_h_low >> 1) | (ar_h_high << 63);
+            ar_h_high = (ar_h_high >> 1) ^ (0xE100000000000000ull & tm_carry);
+        }
+
+        ar_high = tm_high;
+        ar_low = tm_low;
+    }
+
+    /**
+     * @brief Init
+     *
+     * H değerinden anahtarı hazırlar. Vektör yol için H^1..H^4
+     * kuvvetleri bayt sırası ters çevrilmiş olarak saklanır
+     *
+     * @param uint8_t* H
+     * @param GhashKey& Key
+     */
+    [[maybe_unused]]
+    static inline void init(
+        const uint8_t* ar_h,
+        GhashKey& ar_key
+    ) noexcept
+    {
+        ar_key.m_high = load_be64(ar_h);
+        ar_key.m_low = load_be64(ar_h + 8);
+
+        uint64_t tm_high = ar_key.m_high;
+        uint64_t tm_low = ar_key.m_low;
+
+        for(std::size_t tm_power = 0; tm_power < _SIZE_POWER; ++tm_power)
+        {
+            uint8_t tm_block[_SIZE_BLOCK];
+            store_be64(tm_block, tm_high);
+            store_be64(tm_block + 8, tm_low);
+            std::reverse_copy(tm_block, tm_block + _SIZE_BLOCK, ar_key.m_power[tm_power]);
+
+            multiply(tm_high, tm_low, ar_key.m_high, ar_key.m_low);
+        }
+    }
+
+    /**
+     * @brief Kernel Portable
+     *
+     * Her 16 baytlık blok duruma eklenir ve H ile çarpılır.
+     * Uzunluk blok boyunun katı olmalıdır
+     *
+     * @param GhashKey& Key
+     * @param uint8_t* State
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    static inline void kernel_portable(
+        const GhashKey& ar_key,
+        uint8_t* ar_state,
+        const uint8_t* ar_data,
+        std::size_t ar_len
+    ) noexcept
+    {
+        uint64_t tm_high = load_be64(ar_state);
+        uint64_t tm_low = load_be64(ar_state + 8);
+
+        for(; ar_len >= _SIZE_BLOCK; ar_data += _SIZE_BLOCK, ar_len -= _SIZE_BLOCK)
+        {
+            tm_high ^= load_be64(ar_data);
+            tm_low ^= load_be64(ar_data + 8);
+            multiply(tm_high, tm_low, ar_key.m_high, ar_key.m_low);
+        }
+
+        store_be64(ar_state, tm_high);
+        store_be64(ar_state + 8, tm_low);
+    }
+
+    #if __GHASH_X86__
+        /**
+         * @brief Multiply Wide
+         *
+         * İki 128 bitlik değerin indirgenmemiş 256 bitlik
+         * çarpımını 4 elde taşımayan çarpma ile bulur
+         *
+         * @param __m128i A
+         * @param __m128i B
+         * @param __m128i& Low
+         * @param __m128i& High
+         */
+        __attribute__((target("pclmul,sse2")))
+        static inline void multiply_wide(const __m128i ar_a, const __m128i ar_b, __m128i& ar_low, __m128i& ar_high) noexcept
+        {
+            const __m128i tm_low = _mm_clmulepi64_si128(ar_a, ar_b, 0x00);
+            const __m128i tm_mid = _mm_xor_si128(_mm_clmulepi64_si128(ar_a, ar_b, 0x10), _mm_clmulepi64_si128(ar_a, ar_b, 0x01));
+            const __m128i tm_high = _mm_clmulepi64_si128(ar_a, ar_b, 0x11);
+
+            ar_low = _mm_xor_si128(tm_low, _mm_slli_si128(tm_mid, 8));
+            ar_high = _mm_xor_si128(tm_high, _mm_srli_si128(tm_mid, 8));
+        }
+
+        /**
+         * @brief Reduce
+         *
+         * Bit sırası yansıtılmış 256 bitlik çarpımı bir bit sola
+         * kaydırıp x^128 + x^7 + x^2 + x + 1 ile indirger
+         *
+         * @param __m128i Low
+         * @param __m128i High
+         * @return __m128i
+         */
+        __attribute__((target("pclmul,sse2")))
+        static inline __m128i reduce(__m128i ar_low, __m128i ar_high) noexcept
+        {
+            // SHIFT THE 256-BIT PRODUCT LEFT BY ONE
+            __m128i tm_carry_low = _mm_srli_epi32(ar_low, 31);
+            __m128i tm_carry_high = _mm_srli_epi32(ar_high, 31);
+            ar_low = _mm_slli_epi32(ar_low, 1);
+            ar_high = _mm_slli_epi32(ar_high, 1);
+
+            const __m128i tm_cross = _mm_srli_si128(tm_carry_low, 12);
+            tm_carry_high = _mm_slli_si128(tm_carry_high, 4);
+            tm_carry_low = _mm_slli_si128(tm_carry_low, 4);
+            ar_low = _mm_or_si128(ar_low, tm_carry_low);
+            ar_high = _mm_or_si128(_mm_or_si128(ar_high, tm_carry_high), tm_cross);
+
+            // FIRST PHASE
+            __m128i tm_fold = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(ar_low, 31), _mm_slli_epi32(ar_low, 30)), _mm_slli_epi32(ar_low, 25));
+            const __m128i tm_rest = _mm_srli_si128(tm_fold, 4);
+            tm_fold = _mm_slli_si128(tm_fold, 12);
+            ar_low = _mm_xor_si128(ar_low, tm_fold);
+
+            // SECOND PHASE
+            __m128i tm_sum = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(ar_low, 1), _mm_srli_epi32(ar_low, 2)), _mm_srli_epi32(ar_low, 7));
+            tm_sum = _mm_xor_si128(tm_sum, tm_rest);
+            ar_low = _mm_xor_si128(ar_low, tm_sum);
+
+            return _mm_xor_si128(ar_high, ar_low);
+        }
+
+        /**
+         * @brief Kernel PCLMUL
+         *
+         * Döngü başına 4 blok işlenir: (Y ^ X0)·H^4 ^ X1·H^3 ^
+         * X2·H^2 ^ X3·H çarpımları toplanır ve tek seferde
+         * indirgenir. Kalan bloklar tek tek işlenir. Uzunluk
+         * blok boyunun katı olmalıdır
+         *
+         * @param GhashKey& Key
+         * @param uint8_t* State
+         * @param uint8_t* Data
+         * @param size_t Length
+         */
+        __attribute__((target("pclmul,ssse3")))
+        static inline void kernel_pclmul(
+            const GhashKey& ar_key,
+            uint8_t* ar_state,
+            const uint8_t* ar_data,
+            std::size_t ar_len
+        ) noexcept
+        {
+            const __m128i tm_reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+            __m128i tm_power[_SIZE_POWER];
+            for(std::size_t tm_count = 0; tm_count < _SIZE_POWER; ++tm_count)
+                tm_power[tm_count] = _mm_load_si128(reinterpret_cast<const __m128i*>(ar_key.m_power[tm_count]));
+
+            __m128i tm_state = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_state)), tm_reverse);
+
+            while( ar_len >= _SIZE_POWER * _SIZE_BLOCK )
+            {
+                __m128i tm_low = _mm_setzero_si128();
+                __m128i tm_high = _mm_setzero_si128();
+
+                for(std::size_t tm_count = 0; tm_count < _SIZE_POWER; ++tm_count)
+                {
+                    __m128i tm_block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_data + tm_count * _SIZE_BLOCK)), tm_reverse);
+                    if( tm_count == 0 )
+                        tm_block = _mm_xor_si128(tm_block, tm_state);
+
+                    __m128i tm_part_low, tm_part_high;
+                    multiply_wide(tm_block, tm_power[_SIZE_POWER - 1 - tm_count], tm_part_low, tm_part_high);
+                    tm_low = _mm_xor_si128(tm_low, tm_part_low);
+                    tm_high = _mm_xor_si128(tm_high, tm_part_high);
+                }
+
+                tm_state = reduce(tm_low, tm_high);
+                ar_data += _SIZE_POWER * _SIZE_BLOCK;
+                ar_len -= _SIZE_POWER * _SIZE_BLOCK;
+            }
+
+            for(; ar_len >= _SIZE_BLOCK; ar_data += _SIZE_BLOCK, ar_len -= _SIZE_BLOCK)
+            {
+                const __m128i tm_block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_data)), tm_reverse);
+
+                __m128i tm_low, tm_high;
+                multiply_wide(_mm_xor_si128(tm_state, tm_block), tm_power[0], tm_low, tm_high);
+                tm_state = reduce(tm_low, tm_high);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(ar_state), _mm_shuffle_epi8(tm_state, tm_reverse));
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemci PCLMULQDQ destekliyorsa onu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa yazılımsal yol döner
+     *
+     * @param kernel_t Kernel
+     * @return ghash_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    ghash_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_portable;
+
+        switch( ar_kernel )
+        {
+            #if __GHASH_X86__
+                case kernel_t::pclmul: return &kernel_pclmul;
+            #endif
+            case kernel_t::portable:
+            default:
+                return &kernel_portable;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Blokları seçilen çekirdek üzerinden GHASH durumuna ekler
+     *
+     * @param GhashKey& Key
+     * @param uint8_t* State
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    [[maybe_unused]]
+    void apply(
+        const GhashKey& ar_key,
+        uint8_t* ar_state,
+        const uint8_t* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static const ghash_fn_t ss_fn = get_function(get_kernel());
+        ss_fn(ar_key, ar_state, ar_data, ar_len);
+    }
+}
@@ -0,0 +1,492 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * ChaCha20
+ *
+ * RFC 8439'da tanımlanan akış şifreleyicisi. 32 baytlık
+ * anahtar, 12 baytlık nonce ve 32 bitlik blok sayacından
+ * oluşan durum ile 64 baytlık anahtar akışı blokları üretilir
+ * ve veri bu akış ile xor işleminden geçirilir.
+ *
+ * Aynı anahtar ile aynı nonce iki farklı mesajda kullanılırsa
+ * anahtar akışı tekrar eder. Bu yüzden her mesaj için farklı
+ * bir nonce set_nonce ile verilmelidir
+ *
+ * Çerçeve (Frame) yolunda nonce her mesaj için örneğe ait
+ * rastgele 4 baytlık tuz ile rastgele başlayan 8 baytlık
+ * sıra numarasından üretilir ve çerçeve sonuna yazılır;
+ * aynı anahtar ile gönderilen çerçeveler anahtar akışını
+ * paylaşmaz. Doğrulama yapılmaz, kuyrukta etiket yoktur
+ */
+
+// Include
+#include <array>
+#include <atomic>
+#include <random>
+#include <cstring>
+#include <algorithm>
+
+#include <core/algorithm.hpp>
+#include <cipher/chacha20/chachakernel.hpp>
+#include <cipher/chacha20/chachamulti.hpp>
+
+// Namespace
+namespace cipher::stream
+{
+    // Using Namespace
+    using namespace core::algorithm;
+
+    // Class
+    class ChaCha20 final : public Algorithm
+    {
+        public:
+            static constexpr std::size_t _SIZE_KEY = 32; // byte
+            static constexpr std::size_t _SIZE_NONCE = 12; // byte
+            static constexpr std::size_t _SIZE_BLOCK = chachakernel::_SIZE_BLOCK; // byte
+            static constexpr std::size_t _SIZE_SEAL = _SIZE_NONCE; // byte
+
+            static constexpr uint32_t _DEF_COUNTER = 1;
+
+            using nonce_t = std::array<uint8_t, _SIZE_NONCE>;
+            using state_t = std::array<uint32_t, chachakernel::_SIZE_STATE>;
+
+        private:
+            state_t m_state {};
+            nonce_t m_nonce {};
+            uint32_t m_counter { _DEF_COUNTER };
+
+            uint32_t m_salt { 0 };
+            std::atomic<uint64_t> m_sequence { 0 };
+
+        private:
+            void setup() noexcept;
+
+            static inline void store_le64(uint8_t* ar_data, const uint64_t ar_value) noexcept;
+            nonce_t next_nonce() noexcept;
+            bool apply(const nonce_t& ar_nonce, unsigned char* ar_data, const std::size_t ar_len) const noexcept;
+
+        public:
+            explicit ChaCha20(
+                const std::string& ar_name,
+                const std::string& ar_key,
+                const nonce_t& ar_nonce = {},
+                const uint32_t ar_counter = _DEF_COUNTER
+            );
+
+            virtual ~ChaCha20();
+
+            virtual bool has_error() const noexcept override;
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const override;
+
+            void set_nonce(const nonce_t& ar_nonce, const uint32_t ar_counter = _DEF_COUNTER) noexcept;
+            inline const nonce_t& get_nonce() const noexcept;
+            inline uint32_t get_counter() const noexcept;
+
+            using Algorithm::encrypt;
+            using Algorithm::decrypt;
+
+            virtual bool encrypt(std::string& ar_text) noexcept override;
+            virtual bool decrypt(std::string& ar_text) noexcept override;
+
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+
+            bool apply(unsigned char* ar_data, const std::size_t ar_len, const uint64_t ar_block = 0) const noexcept;
+            chachamulti::Job make_job(unsigned char* ar_data, const std::size_t ar_len) const noexcept;
+
+            virtual std::size_t get_seal_size() const noexcept override;
+            virtual bool seal(const Frame& ar_frame, std::byte* ar_trailer) noexcept override;
+            virtual bool open(const Frame& ar_frame, const std::byte* ar_trailer) noexcept override;
+    };
+
+    /**
+     * @brief ChaCha20
+     *
+     * Sınıfın kurucu yapısıdır. Bir isim, 32 baytlık anahtar,
+     * isteğe bağlı olarak nonce ve başlangıç blok sayacı alır.
+     * Anahtar 32 bayt değilse algoritma hatalı kabul edilir.
+     * Çerçeve nonce değerleri için tuz ve sıra numarasının
+     * başlangıcı rastgele seçilir
+     *
+     * @param string& Name
+     * @param string& Key
+     * @param nonce_t& Nonce
+     * @param uint32_t Counter
+     */
+    ChaCha20::ChaCha20(
+        const std::string& ar_name,
+        const std::string& ar_key,
+        const nonce_t& ar_nonce,
+        const uint32_t ar_counter
+    )
+    :   Algorithm(ar_name, ar_key),
+        m_nonce(ar_nonce),
+        m_counter(ar_counter)
+    {
+        std::random_device tm_random;
+        this->m_salt = tm_random();
+        this->m_sequence.store((static_cast<uint64_t>(tm_random()) << 32) | tm_random(), std::memory_order_relaxed);
+
+        this->setup();
+    }
+
+    /**
+     * @brief ~ChaCha20
+     *
+     * Durumda anahtar kelimeleri bulunduğundan
+     * yıkım sırasında durum sıfırlanır
+     */
+    ChaCha20::~ChaCha20()
+    {
+        std::fill(this->m_state.begin(), this->m_state.end(), 0u);
+        std::fill(this->m_nonce.begin(), this->m_nonce.end(), 0u);
+    }
+
+    /**
+     * @brief Setup
+     *
+     * Anahtar, nonce ve sayaç ile durumu hazırlar
+     */
+    void ChaCha20::setup() noexcept
+    {
+        if( this->has_error() )
+            return;
+
+        chachakernel::init_state(
+            this->m_state.data(),
+            reinterpret_cast<const uint8_t*>(this->get_key().data()),
+            this->m_nonce.data(),
+            this->m_counter
+        );
+    }
+
+    /**
+     * @brief Has Error
+     *
+     * Temel kontrollere ek olarak anahtarın tam olarak
+     * 32 bayt olmasını bekler
+     *
+     * @return bool
+     */
+    bool ChaCha20::has_error() const noexcept
+    {
+        return Algorithm::has_error() || this->get_key().size() != _SIZE_KEY;
+    }
+
+    /**
+     * @brief Clone
+     *
+     * Aynı isim, nonce ve blok sayacı ile verilen anahtarı kullanan yeni
+     * ChaCha20 oluşturur. Kopyanın çerçeve tuzu ve sıra numarası
+     * yeniden rastgele seçilir, kaynak ile paylaşılmaz
+     *
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> ChaCha20::clone(
+        const std::string& ar_key
+    ) const
+    {
+        return std::make_unique<ChaCha20>(this->get_name(), ar_key, this->m_nonce, this->m_counter);
+    }
+
+    /**
+     * @brief Store LE64
+     *
+     * @param uint8_t* Data
+     * @param uint64_t Value
+     */
+    void ChaCha20::store_le64(
+        uint8_t* ar_data,
+        const uint64_t ar_value
+    ) noexcept
+    {
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+            ar_data[tm_count] = static_cast<uint8_t>(ar_value >> (8 * tm_count));
+    }
+
+    /**
+     * @brief Next Nonce
+     *
+     * Tuz (4 bayt) ve bir artan sıra numarasından (8 bayt,
+     * küçük uçlu) çerçeve için yeni bir nonce üretir. Birden
+     * çok iş parçacığından aynı anda çağrılabilir
+     *
+     * @return nonce_t
+     */
+    ChaCha20::nonce_t ChaCha20::next_nonce() noexcept
+    {
+        nonce_t tm_nonce {};
+        const uint64_t tm_sequence = this->m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        for(std::size_t tm_count = 0; tm_count < 4; ++tm_count)
+            tm_nonce[tm_count] = static_cast<uint8_t>(this->m_salt >> (8 * tm_count));
+        store_le64(tm_nonce.data() + 4, tm_sequence);
+
+        return tm_nonce;
+    }
+
+    /**
+     * @brief Set Nonce
+     *
+     * Sonraki şifreleme işlemleri için nonce ve başlangıç
+     * blok sayacını değiştirir. Her mesaj için farklı nonce
+     * verilmelidir
+     *
+     * @param nonce_t& Nonce
+     * @param uint32_t Counter
+     */
+    void ChaCha20::set_nonce(
+        const nonce_t& ar_nonce,
+        const uint32_t ar_counter
+    ) noexcept
+    {
+        this->m_nonce = ar_nonce;
+        this->m_counter = ar_counter;
+        this->setup();
+    }
+
+    /**
+     * @brief Get Nonce
+     *
+     * @return const nonce_t&
+     */
+    const ChaCha20::nonce_t& ChaCha20::get_nonce() const noexcept
+    {
+        return this->m_nonce;
+    }
+
+    /**
+     * @brief Get Counter
+     *
+     * @return uint32_t
+     */
+    uint32_t ChaCha20::get_counter() const noexcept
+    {
+        return this->m_counter;
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Geçerli durum ile üretilen anahtar akışını veriye
+     * uygular. Blok sayacı çağrı içinde ilerler, durum
+     * değişmez; aynı nonce ile tekrar çağrı aynı akışı verir.
+     * Blok konumu verilirse sayaç o kadar ileriden başlar
+     * (mod 2^32), verinin parçaları bağımsız işlenebilir
+     *
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @param uint64_t Block
+     * @return bool
+     */
+    bool ChaCha20::apply(
+        unsigned char* ar_data,
+        const std::size_t ar_len,
+        const uint64_t ar_block
+    ) const noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        if( ar_block == 0 )
+        {
+            chachakernel::apply(this->m_state.data(), ar_data, ar_len);
+            return true;
+        }
+
+        // SEEK: MOVE BLOCK COUNTER ON A COPY
+        state_t tm_state = this->m_state;
+        tm_state[chachakernel::_POS_COUNTER] += static_cast<uint32_t>(ar_block);
+
+        chachakernel::apply(tm_state.data(), ar_data, ar_len);
+        std::fill(tm_state.begin(), tm_state.end(), 0u);
+        return true;
+    }
+
+    /**
+     * @brief Apply (Nonce)
+     *
+     * Örneğin durumuna dokunmadan verilen nonce ve başlangıç
+     * blok sayacı ile yığında geçici durum kurar, anahtar
+     * akışını veriye uygular. Çerçeve yolu bu şekilde aynı anda
+     * birden çok iş parçacığından çağrılabilir
+     *
+     * @param nonce_t& Nonce
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool ChaCha20::apply(
+        const nonce_t& ar_nonce,
+        unsigned char* ar_data,
+        const std::size_t ar_len
+    ) const noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        state_t tm_state;
+        chachakernel::init_state(tm_state.data(), reinterpret_cast<const uint8_t*>(this->get_key().data()), ar_nonce.data(), this->m_counter);
+
+        chachakernel::apply(tm_state.data(), ar_data, ar_len);
+        std::fill(tm_state.begin(), tm_state.end(), 0u);
+        return true;
+    }
+
+    /**
+     * @brief Make Job
+     *
+     * Geçerli durum ile çoklu tampon şifrelemesine verilecek
+     * işi oluşturur. Farklı oturumların nesnelerinden alınan
+     * işler tek chachamulti::apply çağrısında birlikte
+     * şifrelenebilir. Algoritma hatalı ise boş iş döner ve
+     * veri değişmeden kalır
+     *
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @return chachamulti::Job
+     */
+    chachamulti::Job ChaCha20::make_job(
+        unsigned char* ar_data,
+        const std::size_t ar_len
+    ) const noexcept
+    {
+        chachamulti::Job tm_job;
+        if( this->has_error() )
+            return tm_job;
+
+        std::copy(this->m_state.begin(), this->m_state.end(), tm_job.m_state);
+        tm_job.m_data = ar_data;
+        tm_job.m_len = ar_len;
+        return tm_job;
+    }
+
+    /**
+     * @brief Encrypt
+     *
+     * Verilen metni geçerli nonce ile şifreler
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool ChaCha20::encrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        return this->apply(reinterpret_cast<unsigned char*>(ar_text.data()), ar_text.size());
+    }
+
+    /**
+     * @brief Decrypt
+     *
+     * Akış şifreleyicisi olduğundan şifre çözme
+     * şifreleme ile aynı işlemdir
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool ChaCha20::decrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        return this->encrypt(ar_text);
+    }
+
+    /**
+     * @brief Encrypt (Buffer)
+     *
+     * Verilen alanı kopyalamadan yerinde şifreler
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool ChaCha20::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->apply(reinterpret_cast<unsigned char*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     *
+     * Şifreleme ile aynı işlemdir
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool ChaCha20::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->encrypt(ar_data, ar_len);
+    }
+
+    /**
+     * @brief Get Seal Size
+     *
+     * Çerçeve sonuna eklenen nonce boyutu
+     *
+     * @return size_t
+     */
+    std::size_t ChaCha20::get_seal_size() const noexcept
+    {
+        return _SIZE_SEAL;
+    }
+
+    /**
+     * @brief Seal (Frame)
+     *
+     * Çerçevenin veri bölümünü yeni bir nonce ile şifreler,
+     * nonce verilen kuyruk alanına yazılır. Başlık şifrelenmez
+     * ve doğrulanmaz
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool ChaCha20::seal(
+        const Frame& ar_frame,
+        std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        const nonce_t tm_nonce = this->next_nonce();
+        if( !this->apply(tm_nonce, reinterpret_cast<unsigned char*>(ar_frame.body()), ar_frame.m_payload) )
+            return false;
+
+        std::memcpy(ar_trailer, tm_nonce.data(), _SIZE_NONCE);
+        return true;
+    }
+
+    /**
+     * @brief Open (Frame)
+     *
+     * Kuyruktaki nonce ile veri bölümünü yerinde çözer
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool ChaCha20::open(
+        const Frame& ar_frame,
+        const std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        nonce_t tm_nonce;
+        std::memcpy(tm_nonce.data(), ar_trailer, _SIZE_NONCE);
+
+        return this->apply(tm_nonce, reinterpret_cast<unsigned char*>(ar_frame.body()), ar_frame.m_payload);
+    }
+}
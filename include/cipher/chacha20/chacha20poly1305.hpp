@@ -0,0 +1,553 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * ChaCha20-Poly1305
+ *
+ * RFC 8439 bölüm 2.8'de tanımlanan doğrulamalı şifreleme
+ * (AEAD). Her nonce için ChaCha20'nin 0. bloğundan tek
+ * kullanımlık Poly1305 anahtarı üretilir, veri 1. bloktan
+ * itibaren şifrelenir. Etiket; ek veri (AAD), şifreli metin
+ * ve ikisinin uzunlukları üzerinden hesaplanır
+ *
+ * Şifreleme ve etiket tek geçişte yapılır: veri önbellekte
+ * kalacak boyutta parçalara bölünür, her parça önce şifrelenip
+ * hemen ardından Poly1305'e verilir. Şifre çözmede sıra tersidir;
+ * etiket tutmazsa çözülen alan sıfırlanır. Poly1305 anahtarının
+ * çıktığı 0. blok, verinin ilk blokları ile aynı çekirdek
+ * geçişinde üretilir; kısa sohbet mesajlarında anahtar akışının
+ * tamamı tek vektör geçişinden çıkar
+ *
+ * Çerçeve (Frame) yolunda nonce her mesaj için örneğe ait
+ * rastgele 4 baytlık tuz ile rastgele başlayan 8 baytlık
+ * sıra numarasından üretilir ve etiket ile birlikte çerçeve
+ * sonuna yazılır. Başlık ek veri olarak doğrulanır
+ */
+
+// Include
+#include <array>
+#include <atomic>
+#include <random>
+#include <cstring>
+#include <algorithm>
+
+#include <core/algorithm.hpp>
+#include <cipher/chacha20/chachakernel.hpp>
+#include <cipher/poly1305/poly1305.hpp>
+
+// Namespace
+namespace cipher::stream
+{
+    // Using Namespace
+    using namespace core::algorithm;
+
+    // Class
+    class ChaCha20Poly1305 final : public Algorithm
+    {
+        public:
+            static constexpr std::size_t _SIZE_KEY = 32; // byte
+            static constexpr std::size_t _SIZE_NONCE = 12; // byte
+            static constexpr std::size_t _SIZE_TAG = cipher::mac::Poly1305::_SIZE_TAG; // byte
+            static constexpr std::size_t _SIZE_SEAL = _SIZE_NONCE + _SIZE_TAG; // byte
+            static constexpr std::size_t _SIZE_CHUNK = 64 * chachakernel::_SIZE_BLOCK; // byte
+
+            static constexpr uint64_t _MAX_LEN_DATA = (uint64_t{1} << 32) * chachakernel::_SIZE_BLOCK - chachakernel::_SIZE_BLOCK; // byte
+
+            using nonce_t = std::array<uint8_t, _SIZE_NONCE>;
+            using tag_t = std::array<uint8_t, _SIZE_TAG>;
+            using state_t = std::array<uint32_t, chachakernel::_SIZE_STATE>;
+
+        private:
+            uint32_t m_salt { 0 };
+            std::atomic<uint64_t> m_sequence { 0 };
+
+        private:
+            static inline void store_le64(uint8_t* ar_data, const uint64_t ar_value) noexcept;
+
+            std::size_t begin(const nonce_t& ar_nonce, const std::size_t ar_len, state_t& ar_state, unsigned char* ar_stream) const noexcept;
+            static void finish(cipher::mac::Poly1305& ar_mac, const std::size_t ar_aad_len, const std::size_t ar_len, uint8_t* ar_tag) noexcept;
+
+        public:
+            explicit ChaCha20Poly1305(
+                const std::string& ar_name,
+                const std::string& ar_key
+            );
+
+            virtual ~ChaCha20Poly1305() = default;
+
+            virtual bool has_error() const noexcept override;
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const override;
+
+            nonce_t next_nonce() noexcept;
+
+            bool seal(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, const nonce_t& ar_nonce, tag_t& ar_tag) const noexcept;
+            bool open(uint8_t* ar_data, const std::size_t ar_len, const uint8_t* ar_aad, const std::size_t ar_aad_len, const nonce_t& ar_nonce, const tag_t& ar_tag) const noexcept;
+
+            using Algorithm::encrypt;
+            using Algorithm::decrypt;
+
+            virtual bool encrypt(std::string& ar_text) noexcept override;
+            virtual bool decrypt(std::string& ar_text) noexcept override;
+
+            virtual bool has_buffer() const noexcept override;
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+
+            virtual std::size_t get_seal_size() const noexcept override;
+            virtual bool seal(const Frame& ar_frame, std::byte* ar_trailer) noexcept override;
+            virtual bool open(const Frame& ar_frame, const std::byte* ar_trailer) noexcept override;
+    };
+
+    /**
+     * @brief ChaCha20Poly1305
+     *
+     * Sınıfın kurucu yapısıdır. Bir isim ve 32 baytlık anahtar
+     * alır. Çerçeve nonce değerleri için tuz ve sıra numarasının
+     * başlangıcı rastgele seçilir; aynı anahtarı paylaşan iki
+     * uç birbirinin nonce değerini tekrar etmez
+     *
+     * @param string& Name
+     * @param string& Key
+     */
+    ChaCha20Poly1305::ChaCha20Poly1305(
+        const std::string& ar_name,
+        const std::string& ar_key
+    )
+    :   Algorithm(ar_name, ar_key)
+    {
+        std::random_device tm_random;
+        this->m_salt = tm_random();
+        this->m_sequence.store((static_cast<uint64_t>(tm_random()) << 32) | tm_random(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Store LE64
+     *
+     * @param uint8_t* Data
+     * @param uint64_t Value
+     */
+    void ChaCha20Poly1305::store_le64(
+        uint8_t* ar_data,
+        const uint64_t ar_value
+    ) noexcept
+    {
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+            ar_data[tm_count] = static_cast<uint8_t>(ar_value >> (8 * tm_count));
+    }
+
+    /**
+     * @brief Has Error
+     *
+     * Temel kontrollere ek olarak anahtarın tam olarak
+     * 32 bayt olmasını bekler
+     *
+     * @return bool
+     */
+    bool ChaCha20Poly1305::has_error() const noexcept
+    {
+        return Algorithm::has_error() || this->get_key().size() != _SIZE_KEY;
+    }
+
+    /**
+     * @brief Clone
+     *
+     * Aynı isim ile verilen anahtarı kullanan yeni
+     * ChaCha20Poly1305 oluşturur
+     *
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> ChaCha20Poly1305::clone(
+        const std::string& ar_key
+    ) const
+    {
+        return std::make_unique<ChaCha20Poly1305>(this->get_name(), ar_key);
+    }
+
+    /**
+     * @brief Next Nonce
+     *
+     * Tuz (4 bayt) ve bir artan sıra numarasından (8 bayt,
+     * küçük uçlu) yeni bir nonce üretir. Birden çok iş
+     * parçacığından aynı anda çağrılabilir
+     *
+     * @return nonce_t
+     */
+    ChaCha20Poly1305::nonce_t ChaCha20Poly1305::next_nonce() noexcept
+    {
+        nonce_t tm_nonce {};
+        const uint64_t tm_sequence = this->m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        for(std::size_t tm_count = 0; tm_count < 4; ++tm_count)
+            tm_nonce[tm_count] = static_cast<uint8_t>(this->m_salt >> (8 * tm_count));
+        store_le64(tm_nonce.data() + 4, tm_sequence);
+
+        return tm_nonce;
+    }
+
+    /**
+     * @brief Begin
+     *
+     * Nonce için yığında ChaCha20 durumu kurar ve 0. bloktan
+     * başlayan anahtar akışını tek çekirdek geçişinde verilen
+     * alana üretir. İlk 32 bayt Poly1305 anahtarı, 1. bloktan
+     * sonrası verinin başı için akıştır. Veri 0. bloktan uzunsa
+     * çekirdeğin bir geçişte ürettiği kadar blok üretilir, bu
+     * tek bloğu ayrıca üretmekten pahalı değildir. Akışın
+     * kapsadığı veri uzunluğu döner; durum kalan veri için
+     * sıradaki bloğa ayarlanır
+     *
+     * @param nonce_t& Nonce
+     * @param size_t Length
+     * @param state_t& State
+     * @param unsigned char* Stream
+     * @return size_t
+     */
+    std::size_t ChaCha20Poly1305::begin(
+        const nonce_t& ar_nonce,
+        const std::size_t ar_len,
+        state_t& ar_state,
+        unsigned char* ar_stream
+    ) const noexcept
+    {
+        chachakernel::init_state(ar_state.data(), reinterpret_cast<const uint8_t*>(this->get_key().data()), ar_nonce.data(), 0);
+
+        const std::size_t tm_batch = ar_len ? std::min(chachakernel::get_batch(), chachakernel::_SIZE_BATCH_MAX) : chachakernel::_SIZE_BLOCK;
+
+        std::memset(ar_stream, 0, tm_batch);
+        chachakernel::apply(ar_state.data(), ar_stream, tm_batch);
+
+        ar_state[chachakernel::_POS_COUNTER] = static_cast<uint32_t>(tm_batch / chachakernel::_SIZE_BLOCK);
+        return std::min(ar_len, tm_batch - chachakernel::_SIZE_BLOCK);
+    }
+
+    /**
+     * @brief Finish
+     *
+     * Şifreli metni 16 bayta tamamlar, ek veri ve şifreli
+     * metin uzunluklarını (küçük uçlu 64 bit) ekleyip
+     * etiketi üretir
+     *
+     * @param Poly1305& Mac
+     * @param size_t AAD Length
+     * @param size_t Length
+     * @param uint8_t* Tag
+     */
+    void ChaCha20Poly1305::finish(
+        cipher::mac::Poly1305& ar_mac,
+        const std::size_t ar_aad_len,
+        const std::size_t ar_len,
+        uint8_t* ar_tag
+    ) noexcept
+    {
+        uint8_t tm_lengths[16];
+        store_le64(tm_lengths, ar_aad_len);
+        store_le64(tm_lengths + 8, ar_len);
+
+        ar_mac.pad();
+        ar_mac.update(tm_lengths, sizeof(tm_lengths));
+        ar_mac.finish(ar_tag);
+    }
+
+    /**
+     * @brief Seal
+     *
+     * Veriyi yerinde şifreler ve etiketi üretir. Veri parça
+     * parça işlenir; her parça şifrelendikten hemen sonra,
+     * henüz önbellekte iken Poly1305'e verilir. Nesne durumu
+     * değişmediğinden aynı anda çağrılabilir
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* AAD
+     * @param size_t AAD Length
+     * @param nonce_t& Nonce
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool ChaCha20Poly1305::seal(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const nonce_t& ar_nonce,
+        tag_t& ar_tag
+    ) const noexcept
+    {
+        if( this->has_error() || ar_len > _MAX_LEN_DATA )
+            return false;
+
+        state_t tm_state;
+        alignas(32) unsigned char tm_stream[chachakernel::_SIZE_BATCH_MAX];
+        const std::size_t tm_head = this->begin(ar_nonce, ar_len, tm_state, tm_stream);
+
+        cipher::mac::Poly1305 tm_mac(tm_stream);
+
+        tm_mac.update(ar_aad, ar_aad_len);
+        tm_mac.pad();
+
+        // HEAD FROM THE KEY BLOCK BATCH
+        xorkernel::apply(ar_data, tm_stream + chachakernel::_SIZE_BLOCK, tm_head);
+        tm_mac.update(ar_data, tm_head);
+        std::memset(tm_stream, 0, sizeof(tm_stream));
+
+        // ENCRYPT CHUNK, THEN AUTHENTICATE IT WHILE HOT
+        for(std::size_t tm_offset = tm_head; tm_offset < ar_len; tm_offset += _SIZE_CHUNK)
+        {
+            const std::size_t tm_chunk = std::min(_SIZE_CHUNK, ar_len - tm_offset);
+
+            chachakernel::apply(tm_state.data(), ar_data + tm_offset, tm_chunk);
+            tm_mac.update(ar_data + tm_offset, tm_chunk);
+
+            tm_state[chachakernel::_POS_COUNTER] += static_cast<uint32_t>(_SIZE_CHUNK / chachakernel::_SIZE_BLOCK);
+        }
+
+        finish(tm_mac, ar_aad_len, ar_len, ar_tag.data());
+        std::fill(tm_state.begin(), tm_state.end(), 0u);
+        return true;
+    }
+
+    /**
+     * @brief Open
+     *
+     * Etiketi doğrularken veriyi yerinde çözer. Her parça
+     * önce Poly1305'e verilir, ardından çözülür. Etiket
+     * tutmazsa doğrulanmamış düz metin dışarı sızmasın diye
+     * alan sıfırlanır ve false döner
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint8_t* AAD
+     * @param size_t AAD Length
+     * @param nonce_t& Nonce
+     * @param tag_t& Tag
+     * @return bool
+     */
+    bool ChaCha20Poly1305::open(
+        uint8_t* ar_data,
+        const std::size_t ar_len,
+        const uint8_t* ar_aad,
+        const std::size_t ar_aad_len,
+        const nonce_t& ar_nonce,
+        const tag_t& ar_tag
+    ) const noexcept
+    {
+        if( this->has_error() || ar_len > _MAX_LEN_DATA )
+            return false;
+
+        state_t tm_state;
+        alignas(32) unsigned char tm_stream[chachakernel::_SIZE_BATCH_MAX];
+        const std::size_t tm_head = this->begin(ar_nonce, ar_len, tm_state, tm_stream);
+
+        cipher::mac::Poly1305 tm_mac(tm_stream);
+
+        tm_mac.update(ar_aad, ar_aad_len);
+        tm_mac.pad();
+
+        // HEAD FROM THE KEY BLOCK BATCH
+        tm_mac.update(ar_data, tm_head);
+        xorkernel::apply(ar_data, tm_stream + chachakernel::_SIZE_BLOCK, tm_head);
+        std::memset(tm_stream, 0, sizeof(tm_stream));
+
+        // AUTHENTICATE CHUNK, THEN DECRYPT IT WHILE HOT
+        for(std::size_t tm_offset = tm_head; tm_offset < ar_len; tm_offset += _SIZE_CHUNK)
+        {
+            const std::size_t tm_chunk = std::min(_SIZE_CHUNK, ar_len - tm_offset);
+
+            tm_mac.update(ar_data + tm_offset, tm_chunk);
+            chachakernel::apply(tm_state.data(), ar_data + tm_offset, tm_chunk);
+
+            tm_state[chachakernel::_POS_COUNTER] += static_cast<uint32_t>(_SIZE_CHUNK / chachakernel::_SIZE_BLOCK);
+        }
+
+        tag_t tm_tag;
+        finish(tm_mac, ar_aad_len, ar_len, tm_tag.data());
+        std::fill(tm_state.begin(), tm_state.end(), 0u);
+
+        if( !cipher::mac::Poly1305::verify(tm_tag.data(), ar_tag.data()) )
+        {
+            std::memset(ar_data, 0, ar_len);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Encrypt
+     *
+     * Metni yeni bir nonce ile şifreler. Sonuç
+     * nonce + şifreli metin + etiket olarak metne yazılır
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool ChaCha20Poly1305::encrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        if( this->has_error() )
+            return false;
+
+        const nonce_t tm_nonce = this->next_nonce();
+        tag_t tm_tag;
+
+        if( !this->seal(reinterpret_cast<uint8_t*>(ar_text.data()), ar_text.size(), nullptr, 0, tm_nonce, tm_tag) )
+            return false;
+
+        ar_text.insert(ar_text.begin(), tm_nonce.begin(), tm_nonce.end());
+        ar_text.append(tm_tag.begin(), tm_tag.end());
+        return true;
+    }
+
+    /**
+     * @brief Decrypt
+     *
+     * Nonce + şifreli metin + etiket biçimindeki metni
+     * doğrular ve çözer. Etiket tutmazsa metin değişmez
+     *
+     * @param string& Text
+     * @return bool
+     */
+    bool ChaCha20Poly1305::decrypt(
+        std::string& ar_text
+    ) noexcept
+    {
+        if( this->has_error() || ar_text.size() < _SIZE_SEAL )
+            return false;
+
+        nonce_t tm_nonce;
+        tag_t tm_tag;
+        std::memcpy(tm_nonce.data(), ar_text.data(), _SIZE_NONCE);
+        std::memcpy(tm_tag.data(), ar_text.data() + ar_text.size() - _SIZE_TAG, _SIZE_TAG);
+
+        std::string tm_body = ar_text.substr(_SIZE_NONCE, ar_text.size() - _SIZE_SEAL);
+        if( !this->open(reinterpret_cast<uint8_t*>(tm_body.data()), tm_body.size(), nullptr, 0, tm_nonce, tm_tag) )
+            return false;
+
+        ar_text.swap(tm_body);
+        return true;
+    }
+
+    /**
+     * @brief Has Buffer
+     *
+     * Etiket için yer gerektiğinden boyutu değiştirmeyen
+     * tampon arayüzü desteklenmez
+     *
+     * @return bool
+     */
+    bool ChaCha20Poly1305::has_buffer() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     * @brief Encrypt (Buffer)
+     *
+     * Desteklenmez, veri değişmeden her zaman false döner.
+     * has_buffer false olduğundan çağıran bunu şifreleme
+     * hatasından ayırt edebilir; çerçeve yolu seal ile çalışır
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool ChaCha20Poly1305::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        (void)ar_data; (void)ar_len;
+        return false;
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     *
+     * Desteklenmez, veri değişmeden her zaman false döner;
+     * çerçeve yolu open ile çalışır
+     *
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool ChaCha20Poly1305::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        (void)ar_data; (void)ar_len;
+        return false;
+    }
+
+    /**
+     * @brief Get Seal Size
+     *
+     * Çerçeve sonuna eklenen nonce ve etiket boyutu
+     *
+     * @return size_t
+     */
+    std::size_t ChaCha20Poly1305::get_seal_size() const noexcept
+    {
+        return _SIZE_SEAL;
+    }
+
+    /**
+     * @brief Seal (Frame)
+     *
+     * Çerçevenin veri bölümünü yeni bir nonce ile şifreler,
+     * başlığı ek veri olarak doğrular. Nonce ve etiket
+     * verilen kuyruk alanına yazılır
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool ChaCha20Poly1305::seal(
+        const Frame& ar_frame,
+        std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        const nonce_t tm_nonce = this->next_nonce();
+        tag_t tm_tag;
+
+        if( !this->seal(reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload,
+            reinterpret_cast<const uint8_t*>(ar_frame.m_data), ar_frame.m_header, tm_nonce, tm_tag) )
+            return false;
+
+        std::memcpy(ar_trailer, tm_nonce.data(), _SIZE_NONCE);
+        std::memcpy(ar_trailer + _SIZE_NONCE, tm_tag.data(), _SIZE_TAG);
+        return true;
+    }
+
+    /**
+     * @brief Open (Frame)
+     *
+     * Kuyruktaki nonce ve etiket ile başlığı ve veri
+     * bölümünü doğrular, veri bölümünü yerinde çözer
+     *
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool ChaCha20Poly1305::open(
+        const Frame& ar_frame,
+        const std::byte* ar_trailer
+    ) noexcept
+    {
+        if( ar_frame.m_data == nullptr || ar_trailer == nullptr )
+            return false;
+
+        nonce_t tm_nonce;
+        tag_t tm_tag;
+        std::memcpy(tm_nonce.data(), ar_trailer, _SIZE_NONCE);
+        std::memcpy(tm_tag.data(), ar_trailer + _SIZE_NONCE, _SIZE_TAG);
+
+        return this->open(reinterpret_cast<uint8_t*>(ar_frame.body()), ar_frame.m_payload,
+            reinterpret_cast<const uint8_t*>(ar_frame.m_data), ar_frame.m_header, tm_nonce, tm_tag);
+    }
+}
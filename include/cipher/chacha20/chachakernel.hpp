@@ -0,0 +1,610 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * ChaCha Kernel (ChaCha Çekirdeği)
+ *
+ * ChaCha20 blok fonksiyonu ile anahtar akışı üretip veriyi
+ * xor işleminden geçiren çekirdekler. Destekleyen x86-64
+ * işlemcilerde AVX2 ile 8, SSE2 ile 4 blok aynı anda
+ * hesaplanır; her vektör kaydının her şeridi ayrı bir bloğun
+ * aynı kelimesini tutar. Desteklemeyen sistemlerde bloklar
+ * tek tek yazılımsal yol ile hesaplanır. Hangi yolun
+ * kullanılacağı ilk çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <core/cpu.hpp>
+
+#include <cipher/xor/xorkernel.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __CHACHA20_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __CHACHA20_X86__ 0
+#endif
+
+// Namespace
+namespace cipher::stream::chachakernel
+{
+    // Limit
+    static constexpr std::size_t _SIZE_STATE = 16; // word
+    static constexpr std::size_t _SIZE_BLOCK = 64; // byte
+    static constexpr std::size_t _POS_COUNTER = 12; // word
+    static constexpr std::size_t _SIZE_BATCH_MAX = 8 * _SIZE_BLOCK; // byte
+
+    // Type Definition
+    using chacha_fn_t = void (*)(const uint32_t*, unsigned char*, std::size_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        scalar = 0,
+        sse2,
+        avx2
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AVX2, kernel_t::avx2 },
+        { core::platform::_CPU_SSE2, kernel_t::sse2 },
+        { core::platform::_CPU_NULL, kernel_t::scalar }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] chacha_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::size_t get_batch() noexcept;
+    [[maybe_unused]] void apply(const uint32_t* ar_state, unsigned char* ar_data, const std::size_t ar_len) noexcept;
+
+    /**
+     * @brief Load LE32
+     *
+     * Küçük uçlu (little endian) 4 baytı kelimeye çevirir
+     *
+     * @param uint8_t* Data
+     * @return uint32_t
+     */
+    static inline uint32_t load_le32(const uint8_t* ar_data) noexcept
+    {
+        return static_cast<uint32_t>(ar_data[0])
+            | (static_cast<uint32_t>(ar_data[1]) << 8)
+            | (static_cast<uint32_t>(ar_data[2]) << 16)
+            | (static_cast<uint32_t>(ar_data[3]) << 24);
+    }
+
+    /**
+     * @brief Init State
+     *
+     * Durumu RFC 8439 bölüm 2.3'e göre hazırlar:
+     * 4 sabit kelime, 8 anahtar kelimesi, blok sayacı
+     * ve 3 nonce kelimesi. Nesneye bağlı olmadığından
+     * yığında (stack) geçici durum kurmak için de kullanılır
+     *
+     * @param uint32_t* State
+     * @param uint8_t* Key
+     * @param uint8_t* Nonce
+     * @param uint32_t Counter
+     */
+    static inline void init_state(
+        uint32_t* ar_state,
+        const uint8_t* ar_key,
+        const uint8_t* ar_nonce,
+        const uint32_t ar_counter
+    ) noexcept
+    {
+        // "expand 32-byte k"
+        ar_state[0] = 0x61707865;
+        ar_state[1] = 0x3320646e;
+        ar_state[2] = 0x79622d32;
+        ar_state[3] = 0x6b206574;
+
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+            ar_state[4 + tm_count] = load_le32(ar_key + tm_count * 4);
+
+        ar_state[_POS_COUNTER] = ar_counter;
+        for(std::size_t tm_count = 0; tm_count < 3; ++tm_count)
+            ar_state[13 + tm_count] = load_le32(ar_nonce + tm_count * 4);
+    }
+
+    /**
+     * @brief Rotate Left
+     *
+     * @param uint32_t Value
+     * @param int Count
+     * @return uint32_t
+     */
+    static inline constexpr uint32_t rotl(const uint32_t ar_value, const int ar_count) noexcept
+    {
+        return (ar_value << ar_count) | (ar_value >> (32 - ar_count));
+    }
+
+    /**
+     * @brief Quarter Round
+     *
+     * RFC 8439 bölüm 2.1'deki çeyrek tur işlemi
+     *
+     * @param uint32_t* State
+     * @param size_t A
+     * @param size_t B
+     * @param size_t C
+     * @param size_t D
+     */
+    static inline void quarter_round(
+        uint32_t* ar_x,
+        const std::size_t ar_a,
+        const std::size_t ar_b,
+        const std::size_t ar_c,
+        const std::size_t ar_d
+    ) noexcept
+    {
+        ar_x[ar_a] += ar_x[ar_b]; ar_x[ar_d] = rotl(ar_x[ar_d] ^ ar_x[ar_a], 16);
+        ar_x[ar_c] += ar_x[ar_d]; ar_x[ar_b] = rotl(ar_x[ar_b] ^ ar_x[ar_c], 12);
+        ar_x[ar_a] += ar_x[ar_b]; ar_x[ar_d] = rotl(ar_x[ar_d] ^ ar_x[ar_a], 8);
+        ar_x[ar_c] += ar_x[ar_d]; ar_x[ar_b] = rotl(ar_x[ar_b] ^ ar_x[ar_c], 7);
+    }
+
+    /**
+     * @brief Block
+     *
+     * Verilen sayaç ile tek bir 64 baytlık anahtar akışı
+     * bloğu üretir. Kelimeler küçük uçlu (little endian)
+     * olarak yazılır
+     *
+     * @param uint32_t* State
+     * @param uint32_t Counter
+     * @param unsigned char* Out
+     */
+    static inline void block(
+        const uint32_t* ar_state,
+        const uint32_t ar_counter,
+        unsigned char* ar_out
+    ) noexcept
+    {
+        uint32_t tm_x[_SIZE_STATE];
+        std::copy(ar_state, ar_state + _SIZE_STATE, tm_x);
+        tm_x[_POS_COUNTER] = ar_counter;
+
+        // 20 ROUNDS: 10 x (COLUMN + DIAGONAL)
+        for(int tm_round = 0; tm_round < 10; ++tm_round)
+        {
+            quarter_round(tm_x, 0, 4,  8, 12);
+            quarter_round(tm_x, 1, 5,  9, 13);
+            quarter_round(tm_x, 2, 6, 10, 14);
+            quarter_round(tm_x, 3, 7, 11, 15);
+
+            quarter_round(tm_x, 0, 5, 10, 15);
+            quarter_round(tm_x, 1, 6, 11, 12);
+            quarter_round(tm_x, 2, 7,  8, 13);
+            quarter_round(tm_x, 3, 4,  9, 14);
+        }
+
+        for(std::size_t tm_count = 0; tm_count < _SIZE_STATE; ++tm_count)
+        {
+            const uint32_t tm_word = tm_x[tm_count] + (tm_count == _POS_COUNTER ? ar_counter : ar_state[tm_count]);
+            ar_out[tm_count * 4 + 0] = static_cast<unsigned char>(tm_word);
+            ar_out[tm_count * 4 + 1] = static_cast<unsigned char>(tm_word >> 8);
+            ar_out[tm_count * 4 + 2] = static_cast<unsigned char>(tm_word >> 16);
+            ar_out[tm_count * 4 + 3] = static_cast<unsigned char>(tm_word >> 24);
+        }
+    }
+
+    /**
+     * @brief Kernel Scalar
+     *
+     * Blokları tek tek üretip veriyi xor işleminden geçirir.
+     * Son blok eksik ise sadece gereken kadarı kullanılır
+     *
+     * @param uint32_t* State
+     * @param unsigned char* Data
+     * @param size_t Length
+     */
+    static inline void kernel_scalar(
+        const uint32_t* ar_state,
+        unsigned char* ar_data,
+        std::size_t ar_len
+    ) noexcept
+    {
+        unsigned char tm_stream[_SIZE_BLOCK];
+        uint32_t tm_counter = ar_state[_POS_COUNTER];
+
+        while( ar_len )
+        {
+            block(ar_state, tm_counter++, tm_stream);
+
+            const std::size_t tm_chunk = std::min(ar_len, _SIZE_BLOCK);
+            xorkernel::kernel_scalar(ar_data, tm_stream, tm_chunk);
+
+            ar_data += tm_chunk;
+            ar_len -= tm_chunk;
+        }
+
+        std::memset(tm_stream, 0, sizeof(tm_stream));
+    }
+
+    #if __CHACHA20_X86__
+        /**
+         * @brief Rotate Left SSE2
+         *
+         * @tparam int Count
+         * @param __m128i Value
+         * @return __m128i
+         */
+        template<int Count>
+        __attribute__((target("sse2")))
+        static inline __m128i rotl_sse2(const __m128i ar_value) noexcept
+        {
+            if constexpr( Count == 16 )
+                return _mm_shufflehi_epi16(_mm_shufflelo_epi16(ar_value, 0xB1), 0xB1);
+            else
+                return _mm_or_si128(_mm_slli_epi32(ar_value, Count), _mm_srli_epi32(ar_value, 32 - Count));
+        }
+
+        /**
+         * @brief Quarter Round SSE2
+         *
+         * @param __m128i& A
+         * @param __m128i& B
+         * @param __m128i& C
+         * @param __m128i& D
+         */
+        __attribute__((target("sse2")))
+        static inline void quarter_round_sse2(__m128i& ar_a, __m128i& ar_b, __m128i& ar_c, __m128i& ar_d) noexcept
+        {
+            ar_a = _mm_add_epi32(ar_a, ar_b); ar_d = rotl_sse2<16>(_mm_xor_si128(ar_d, ar_a));
+            ar_c = _mm_add_epi32(ar_c, ar_d); ar_b = rotl_sse2<12>(_mm_xor_si128(ar_b, ar_c));
+            ar_a = _mm_add_epi32(ar_a, ar_b); ar_d = rotl_sse2<8>(_mm_xor_si128(ar_d, ar_a));
+            ar_c = _mm_add_epi32(ar_c, ar_d); ar_b = rotl_sse2<7>(_mm_xor_si128(ar_b, ar_c));
+        }
+
+        /**
+         * @brief Kernel SSE2
+         *
+         * Her turda 4 blok (256 bayt) hesaplanır. Şeritler
+         * devrik (transpose) edilerek her bloğun 16 baytlık
+         * parçaları sırası ile veriye uygulanır. Kalan kısım
+         * yazılımsal yol ile tamamlanır
+         *
+         * @param uint32_t* State
+         * @param unsigned char* Data
+         * @param size_t Length
+         */
+        __attribute__((target("sse2")))
+        static inline void kernel_sse2(
+            const uint32_t* ar_state,
+            unsigned char* ar_data,
+            std::size_t ar_len
+        ) noexcept
+        {
+            uint32_t tm_state[_SIZE_STATE];
+            std::copy(ar_state, ar_state + _SIZE_STATE, tm_state);
+
+            while( ar_len >= 4 * _SIZE_BLOCK )
+            {
+                const __m128i tm_counter = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(tm_state[_POS_COUNTER])), _mm_set_epi32(3, 2, 1, 0));
+
+                __m128i tm_x[_SIZE_STATE];
+                for(std::size_t tm_count = 0; tm_count < _SIZE_STATE; ++tm_count)
+                    tm_x[tm_count] = _mm_set1_epi32(static_cast<int>(tm_state[tm_count]));
+                tm_x[_POS_COUNTER] = tm_counter;
+
+                for(int tm_round = 0; tm_round < 10; ++tm_round)
+                {
+                    quarter_round_sse2(tm_x[0], tm_x[4], tm_x[8], tm_x[12]);
+                    quarter_round_sse2(tm_x[1], tm_x[5], tm_x[9], tm_x[13]);
+                    quarter_round_sse2(tm_x[2], tm_x[6], tm_x[10], tm_x[14]);
+                    quarter_round_sse2(tm_x[3], tm_x[7], tm_x[11], tm_x[15]);
+
+                    quarter_round_sse2(tm_x[0], tm_x[5], tm_x[10], tm_x[15]);
+                    quarter_round_sse2(tm_x[1], tm_x[6], tm_x[11], tm_x[12]);
+                    quarter_round_sse2(tm_x[2], tm_x[7], tm_x[8], tm_x[13]);
+                    quarter_round_sse2(tm_x[3], tm_x[4], tm_x[9], tm_x[14]);
+                }
+
+                for(std::size_t tm_count = 0; tm_count < _SIZE_STATE; ++tm_count)
+                {
+                    const __m128i tm_input = tm_count == _POS_COUNTER ? tm_counter : _mm_set1_epi32(static_cast<int>(tm_state[tm_count]));
+                    tm_x[tm_count] = _mm_add_epi32(tm_x[tm_count], tm_input);
+                }
+
+                // TRANSPOSE 4 WORDS x 4 BLOCKS, XOR 16 BYTES PER BLOCK
+                for(std::size_t tm_group = 0; tm_group < 4; ++tm_group)
+                {
+                    const __m128i* tm_word = tm_x + tm_group * 4;
+
+                    const __m128i tm_ab_lo = _mm_unpacklo_epi32(tm_word[0], tm_word[1]);
+                    const __m128i tm_cd_lo = _mm_unpacklo_epi32(tm_word[2], tm_word[3]);
+                    const __m128i tm_ab_hi = _mm_unpackhi_epi32(tm_word[0], tm_word[1]);
+                    const __m128i tm_cd_hi = _mm_unpackhi_epi32(tm_word[2], tm_word[3]);
+
+                    const __m128i tm_block[4] =
+                    {
+                        _mm_unpacklo_epi64(tm_ab_lo, tm_cd_lo),
+                        _mm_unpackhi_epi64(tm_ab_lo, tm_cd_lo),
+                        _mm_unpacklo_epi64(tm_ab_hi, tm_cd_hi),
+                        _mm_unpackhi_epi64(tm_ab_hi, tm_cd_hi)
+                    };
+
+                    for(std::size_t tm_index = 0; tm_index < 4; ++tm_index)
+                    {
+                        auto* tm_ptr = reinterpret_cast<__m128i*>(ar_data + tm_index * _SIZE_BLOCK + tm_group * 16);
+                        _mm_storeu_si128(tm_ptr, _mm_xor_si128(_mm_loadu_si128(tm_ptr), tm_block[tm_index]));
+                    }
+                }
+
+                tm_state[_POS_COUNTER] += 4;
+                ar_data += 4 * _SIZE_BLOCK;
+                ar_len -= 4 * _SIZE_BLOCK;
+            }
+
+            kernel_scalar(tm_state, ar_data, ar_len);
+        }
+
+        /**
+         * @brief Rotate Left AVX2
+         *
+         * 16 ve 8 bitlik döndürmeler bayt karıştırma ile,
+         * diğerleri kaydırma ile yapılır
+         *
+         * @tparam int Count
+         * @param __m256i Value
+         * @return __m256i
+         */
+        template<int Count>
+        __attribute__((target("avx2")))
+        static inline __m256i rotl_avx2(const __m256i ar_value) noexcept
+        {
+            if constexpr( Count == 16 )
+                return _mm256_shuffle_epi8(ar_value, _mm256_setr_epi8(
+                    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                    2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+            else if constexpr( Count == 8 )
+                return _mm256_shuffle_epi8(ar_value, _mm256_setr_epi8(
+                    3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+                    3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14));
+            else
+                return _mm256_or_si256(_mm256_slli_epi32(ar_value, Count), _mm256_srli_epi32(ar_value, 32 - Count));
+        }
+
+        /**
+         * @brief Quarter Round AVX2
+         *
+         * @param __m256i& A
+         * @param __m256i& B
+         * @param __m256i& C
+         * @param __m256i& D
+         */
+        __attribute__((target("avx2")))
+        static inline void quarter_round_avx2(__m256i& ar_a, __m256i& ar_b, __m256i& ar_c, __m256i& ar_d) noexcept
+        {
+            ar_a = _mm256_add_epi32(ar_a, ar_b); ar_d = rotl_avx2<16>(_mm256_xor_si256(ar_d, ar_a));
+            ar_c = _mm256_add_epi32(ar_c, ar_d); ar_b = rotl_avx2<12>(_mm256_xor_si256(ar_b, ar_c));
+            ar_a = _mm256_add_epi32(ar_a, ar_b); ar_d = rotl_avx2<8>(_mm256_xor_si256(ar_d, ar_a));
+            ar_c = _mm256_add_epi32(ar_c, ar_d); ar_b = rotl_avx2<7>(_mm256_xor_si256(ar_b, ar_c));
+        }
+
+        /**
+         * @brief Kernel AVX2
+         *
+         * Her turda 8 blok (512 bayt) hesaplanır. 128 bitlik
+         * yarılar içinde devrik işlemi yapılır, yarılar
+         * birleştirilerek her bloğun 32 baytlık parçaları
+         * veriye uygulanır. Kalan kısım SSE2 çekirdeği ile
+         * tamamlanır
+         *
+         * @param uint32_t* State
+         * @param unsigned char* Data
+         * @param size_t Length
+         */
+        __attribute__((target("avx2")))
+        static inline void kernel_avx2(
+            const uint32_t* ar_state,
+            unsigned char* ar_data,
+            std::size_t ar_len
+        ) noexcept
+        {
+            uint32_t tm_state[_SIZE_STATE];
+            std::copy(ar_state, ar_state + _SIZE_STATE, tm_state);
+
+            while( ar_len >= 8 * _SIZE_BLOCK )
+            {
+                const __m256i tm_counter = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(tm_state[_POS_COUNTER])), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+                __m256i tm_x[_SIZE_STATE];
+                for(std::size_t tm_count = 0; tm_count < _SIZE_STATE; ++tm_count)
+                    tm_x[tm_count] = _mm256_set1_epi32(static_cast<int>(tm_state[tm_count]));
+                tm_x[_POS_COUNTER] = tm_counter;
+
+                for(int tm_round = 0; tm_round < 10; ++tm_round)
+                {
+                    quarter_round_avx2(tm_x[0], tm_x[4], tm_x[8], tm_x[12]);
+                    quarter_round_avx2(tm_x[1], tm_x[5], tm_x[9], tm_x[13]);
+                    quarter_round_avx2(tm_x[2], tm_x[6], tm_x[10], tm_x[14]);
+                    quarter_round_avx2(tm_x[3], tm_x[7], tm_x[11], tm_x[15]);
+
+                    quarter_round_avx2(tm_x[0], tm_x[5], tm_x[10], tm_x[15]);
+                    quarter_round_avx2(tm_x[1], tm_x[6], tm_x[11], tm_x[12]);
+                    quarter_round_avx2(tm_x[2], tm_x[7], tm_x[8], tm_x[13]);
+                    quarter_round_avx2(tm_x[3], tm_x[4], tm_x[9], tm_x[14]);
+                }
+
+                for(std::size_t tm_count = 0; tm_count < _SIZE_STATE; ++tm_count)
+                {
+                    const __m256i tm_input = tm_count == _POS_COUNTER ? tm_counter : _mm256_set1_epi32(static_cast<int>(tm_state[tm_count]));
+                    tm_x[tm_count] = _mm256_add_epi32(tm_x[tm_count], tm_input);
+                }
+
+                // TRANSPOSE INSIDE 128-BIT HALVES: LOW HALF BLOCKS 0-3, HIGH HALF BLOCKS 4-7
+                __m256i tm_block[4][4];
+                for(std::size_t tm_group = 0; tm_group < 4; ++tm_group)
+                {
+                    const __m256i* tm_word = tm_x + tm_group * 4;
+
+                    const __m256i tm_ab_lo = _mm256_unpacklo_epi32(tm_word[0], tm_word[1]);
+                    const __m256i tm_cd_lo = _mm256_unpacklo_epi32(tm_word[2], tm_word[3]);
+                    const __m256i tm_ab_hi = _mm256_unpackhi_epi32(tm_word[0], tm_word[1]);
+                    const __m256i tm_cd_hi = _mm256_unpackhi_epi32(tm_word[2], tm_word[3]);
+
+                    tm_block[tm_group][0] = _mm256_unpacklo_epi64(tm_ab_lo, tm_cd_lo);
+                    tm_block[tm_group][1] = _mm256_unpackhi_epi64(tm_ab_lo, tm_cd_lo);
+                    tm_block[tm_group][2] = _mm256_unpacklo_epi64(tm_ab_hi, tm_cd_hi);
+                    tm_block[tm_group][3] = _mm256_unpackhi_epi64(tm_ab_hi, tm_cd_hi);
+                }
+
+                // JOIN GROUP PAIRS INTO 32 BYTES PER BLOCK
+                for(std::size_t tm_index = 0; tm_index < 4; ++tm_index)
+                {
+                    const __m256i tm_out[4] =
+                    {
+                        _mm256_permute2x128_si256(tm_block[0][tm_index], tm_block[1][tm_index], 0x20),
+                        _mm256_permute2x128_si256(tm_block[2][tm_index], tm_block[3][tm_index], 0x20),
+                        _mm256_permute2x128_si256(tm_block[0][tm_index], tm_block[1][tm_index], 0x31),
+                        _mm256_permute2x128_si256(tm_block[2][tm_index], tm_block[3][tm_index], 0x31)
+                    };
+
+                    unsigned char* const tm_ptr[4] =
+                    {
+                        ar_data + tm_index * _SIZE_BLOCK,
+                        ar_data + tm_index * _SIZE_BLOCK + 32,
+                        ar_data + (tm_index + 4) * _SIZE_BLOCK,
+                        ar_data + (tm_index + 4) * _SIZE_BLOCK + 32
+                    };
+
+                    for(std::size_t tm_part = 0; tm_part < 4; ++tm_part)
+                    {
+                        auto* tm_vec = reinterpret_cast<__m256i*>(tm_ptr[tm_part]);
+                        _mm256_storeu_si256(tm_vec, _mm256_xor_si256(_mm256_loadu_si256(tm_vec), tm_out[tm_part]));
+                    }
+                }
+
+                tm_state[_POS_COUNTER] += 8;
+                ar_data += 8 * _SIZE_BLOCK;
+                ar_len -= 8 * _SIZE_BLOCK;
+            }
+
+            kernel_sse2(tm_state, ar_data, ar_len);
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemcinin desteklediği en geniş çekirdeği seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa yazılımsal yol döner
+     *
+     * @param kernel_t Kernel
+     * @return chacha_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    chacha_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_scalar;
+
+        switch( ar_kernel )
+        {
+            #if __CHACHA20_X86__
+                case kernel_t::avx2: return &kernel_avx2;
+                case kernel_t::sse2: return &kernel_sse2;
+            #endif
+            case kernel_t::scalar:
+            default:
+                return &kernel_scalar;
+        }
+    }
+
+    /**
+     * @brief Get Batch
+     *
+     * Kullanılan çekirdeğin tek geçişte ürettiği anahtar akışı
+     * boyutu. Bu kadar blok, tek bloğun yazılımsal yoldan
+     * üretilmesinden çok daha pahalı değildir
+     *
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t get_batch() noexcept
+    {
+        switch( get_kernel() )
+        {
+            case kernel_t::avx2: return 8 * _SIZE_BLOCK;
+            case kernel_t::sse2: return 4 * _SIZE_BLOCK;
+            case kernel_t::scalar:
+            default:
+                return _SIZE_BLOCK;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Verilen durum (anahtar, sayaç, nonce) ile üretilen
+     * anahtar akışını seçilen çekirdek üzerinden veriye uygular
+     *
+     * @param uint32_t* State
+     * @param unsigned char* Data
+     * @param size_t Length
+     */
+    [[maybe_unused]]
+    void apply(
+        const uint32_t* ar_state,
+        unsigned char* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static const chacha_fn_t ss_fn = get_function(get_kernel());
+        ss_fn(ar_state, ar_data, ar_len);
+    }
+}
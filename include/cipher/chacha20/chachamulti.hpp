@@ -0,0 +1,340 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * ChaCha Multi (Çoklu Tampon ChaCha20)
+ *
+ * Birbirinden bağımsız (farklı anahtar, nonce ve tampon)
+ * işleri aynı anda şifreler. Tek akışlı çekirdek kısa
+ * mesajlarda vektör genişliğini dolduramaz; 100 baytlık bir
+ * mesaj 2 blok olduğu için tek tek hesaplanır. Burada her
+ * AVX2 şeridine ayrı bir iş verilir ve her turda 8 farklı işin
+ * birer bloğu birlikte hesaplanır. Biten işin şeridine
+ * sıradaki iş alınır; kuyruk boşaldığında az sayıda uzun iş
+ * kalırsa bunlar tek akışlı çekirdek ile tamamlanır
+ *
+ * Desteklemeyen sistemlerde işler sıra ile tek akışlı
+ * çekirdekten geçirilir. Hangi yolun kullanılacağı ilk
+ * çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <cipher/chacha20/chachakernel.hpp>
+
+// Namespace
+namespace cipher::stream::chachamulti
+{
+    // Limit
+    static constexpr std::size_t _SIZE_LANE = 8;
+    static constexpr std::size_t _MIN_LANE_ACTIVE = 3;
+
+    // Struct
+    struct Job
+    {
+        uint32_t m_state[chachakernel::_SIZE_STATE] {};
+        unsigned char* m_data { nullptr };
+        std::size_t m_len { 0 };
+    };
+
+    // Type Definition
+    using multi_fn_t = void (*)(Job*, std::size_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        serial = 0,
+        avx2
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AVX2, kernel_t::avx2 },
+        { core::platform::_CPU_NULL, kernel_t::serial }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] multi_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] void apply(Job* ar_jobs, const std::size_t ar_count) noexcept;
+
+    /**
+     * @brief Make Job
+     *
+     * Anahtar, nonce ve başlangıç sayacı ile durumu
+     * hazırlayıp yerinde şifrelenecek tampon ile iş oluşturur
+     *
+     * @param uint8_t* Key
+     * @param uint8_t* Nonce
+     * @param uint32_t Counter
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @return Job
+     */
+    static inline Job make_job(
+        const uint8_t* ar_key,
+        const uint8_t* ar_nonce,
+        const uint32_t ar_counter,
+        unsigned char* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        Job tm_job;
+        chachakernel::init_state(tm_job.m_state, ar_key, ar_nonce, ar_counter);
+        tm_job.m_data = ar_data;
+        tm_job.m_len = ar_len;
+        return tm_job;
+    }
+
+    /**
+     * @brief Kernel Serial
+     *
+     * İşleri sıra ile tek akışlı çekirdekten geçirir
+     *
+     * @param Job* Jobs
+     * @param size_t Count
+     */
+    static inline void kernel_serial(
+        Job* ar_jobs,
+        const std::size_t ar_count
+    ) noexcept
+    {
+        for(std::size_t tm_count = 0; tm_count < ar_count; ++tm_count)
+            chachakernel::apply(ar_jobs[tm_count].m_state, ar_jobs[tm_count].m_data, ar_jobs[tm_count].m_len);
+    }
+
+    #if __CHACHA20_X86__
+        /**
+         * @brief Kernel AVX2
+         *
+         * Durumlar şerit başına bir sütun olacak şekilde
+         * (16 kelime x 8 şerit) tutulur. Her turda 8 şeridin
+         * birer bloğu hesaplanır, devrik işlemi ile her şeridin
+         * 64 baytlık anahtar akışı ayrılır ve kendi tamponuna
+         * uygulanır. Şerit işi bitince sıradaki iş alınır.
+         * Kuyruk boşalıp etkin şerit sayısı _MIN_LANE_ACTIVE
+         * altına inerse kalan işler tek akışlı çekirdeğe verilir
+         *
+         * @param Job* Jobs
+         * @param size_t Count
+         */
+        __attribute__((target("avx2")))
+        static inline void kernel_avx2(
+            Job* ar_jobs,
+            const std::size_t ar_count
+        ) noexcept
+        {
+            alignas(32) uint32_t tm_soa[chachakernel::_SIZE_STATE][_SIZE_LANE] {};
+            alignas(32) unsigned char tm_stream[_SIZE_LANE][chachakernel::_SIZE_BLOCK];
+
+            Job* tm_lane[_SIZE_LANE] {};
+            std::size_t tm_pos[_SIZE_LANE] {};
+            std::size_t tm_next = 0;
+            std::size_t tm_active = 0;
+
+            // BIND NEXT NON EMPTY JOB TO LANE
+            auto tm_refill = [&](const std::size_t ar_lane) noexcept
+            {
+                while( tm_next < ar_count && ar_jobs[tm_next].m_len == 0 )
+                    ++tm_next;
+
+                if( tm_next == ar_count )
+                {
+                    tm_lane[ar_lane] = nullptr;
+                    return;
+                }
+
+                Job& tm_job = ar_jobs[tm_next++];
+                for(std::size_t tm_word = 0; tm_word < chachakernel::_SIZE_STATE; ++tm_word)
+                    tm_soa[tm_word][ar_lane] = tm_job.m_state[tm_word];
+
+                tm_lane[ar_lane] = &tm_job;
+                tm_pos[ar_lane] = 0;
+                ++tm_active;
+            };
+
+            for(std::size_t tm_count = 0; tm_count < _SIZE_LANE; ++tm_count)
+                tm_refill(tm_count);
+
+            while( tm_active >= _MIN_LANE_ACTIVE || (tm_active && tm_next < ar_count) )
+            {
+                __m256i tm_x[chachakernel::_SIZE_STATE];
+                for(std::size_t tm_word = 0; tm_word < chachakernel::_SIZE_STATE; ++tm_word)
+                    tm_x[tm_word] = _mm256_load_si256(reinterpret_cast<const __m256i*>(tm_soa[tm_word]));
+
+                for(int tm_round = 0; tm_round < 10; ++tm_round)
+                {
+                    chachakernel::quarter_round_avx2(tm_x[0], tm_x[4], tm_x[8], tm_x[12]);
+                    chachakernel::quarter_round_avx2(tm_x[1], tm_x[5], tm_x[9], tm_x[13]);
+                    chachakernel::quarter_round_avx2(tm_x[2], tm_x[6], tm_x[10], tm_x[14]);
+                    chachakernel::quarter_round_avx2(tm_x[3], tm_x[7], tm_x[11], tm_x[15]);
+
+                    chachakernel::quarter_round_avx2(tm_x[0], tm_x[5], tm_x[10], tm_x[15]);
+                    chachakernel::quarter_round_avx2(tm_x[1], tm_x[6], tm_x[11], tm_x[12]);
+                    chachakernel::quarter_round_avx2(tm_x[2], tm_x[7], tm_x[8], tm_x[13]);
+                    chachakernel::quarter_round_avx2(tm_x[3], tm_x[4], tm_x[9], tm_x[14]);
+                }
+
+                for(std::size_t tm_word = 0; tm_word < chachakernel::_SIZE_STATE; ++tm_word)
+                    tm_x[tm_word] = _mm256_add_epi32(tm_x[tm_word], _mm256_load_si256(reinterpret_cast<const __m256i*>(tm_soa[tm_word])));
+
+                // TRANSPOSE INSIDE 128-BIT HALVES: LOW HALF LANES 0-3, HIGH HALF LANES 4-7
+                __m256i tm_block[4][4];
+                for(std::size_t tm_group = 0; tm_group < 4; ++tm_group)
+                {
+                    const __m256i* tm_word = tm_x + tm_group * 4;
+
+                    const __m256i tm_ab_lo = _mm256_unpacklo_epi32(tm_word[0], tm_word[1]);
+                    const __m256i tm_cd_lo = _mm256_unpacklo_epi32(tm_word[2], tm_word[3]);
+                    const __m256i tm_ab_hi = _mm256_unpackhi_epi32(tm_word[0], tm_word[1]);
+                    const __m256i tm_cd_hi = _mm256_unpackhi_epi32(tm_word[2], tm_word[3]);
+
+                    tm_block[tm_group][0] = _mm256_unpacklo_epi64(tm_ab_lo, tm_cd_lo);
+                    tm_block[tm_group][1] = _mm256_unpackhi_epi64(tm_ab_lo, tm_cd_lo);
+                    tm_block[tm_group][2] = _mm256_unpacklo_epi64(tm_ab_hi, tm_cd_hi);
+                    tm_block[tm_group][3] = _mm256_unpackhi_epi64(tm_ab_hi, tm_cd_hi);
+                }
+
+                for(std::size_t tm_index = 0; tm_index < 4; ++tm_index)
+                {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(tm_stream[tm_index]), _mm256_permute2x128_si256(tm_block[0][tm_index], tm_block[1][tm_index], 0x20));
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(tm_stream[tm_index] + 32), _mm256_permute2x128_si256(tm_block[2][tm_index], tm_block[3][tm_index], 0x20));
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(tm_stream[tm_index + 4]), _mm256_permute2x128_si256(tm_block[0][tm_index], tm_block[1][tm_index], 0x31));
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(tm_stream[tm_index + 4] + 32), _mm256_permute2x128_si256(tm_block[2][tm_index], tm_block[3][tm_index], 0x31));
+                }
+
+                // APPLY PER LANE, ADVANCE COUNTER, REFILL FINISHED LANES
+                for(std::size_t tm_count = 0; tm_count < _SIZE_LANE; ++tm_count)
+                {
+                    Job* tm_job = tm_lane[tm_count];
+                    if( tm_job == nullptr )
+                        continue;
+
+                    const std::size_t tm_chunk = std::min(tm_job->m_len - tm_pos[tm_count], chachakernel::_SIZE_BLOCK);
+                    xorkernel::kernel_avx2(tm_job->m_data + tm_pos[tm_count], tm_stream[tm_count], tm_chunk);
+
+                    tm_pos[tm_count] += tm_chunk;
+                    ++tm_soa[chachakernel::_POS_COUNTER][tm_count];
+
+                    if( tm_pos[tm_count] == tm_job->m_len )
+                    {
+                        --tm_active;
+                        tm_refill(tm_count);
+                    }
+                }
+            }
+
+            // FEW LONG JOBS LEFT, SINGLE STREAM KERNEL FILLS THE WIDTH BETTER
+            for(std::size_t tm_count = 0; tm_count < _SIZE_LANE; ++tm_count)
+            {
+                Job* tm_job = tm_lane[tm_count];
+                if( tm_job == nullptr )
+                    continue;
+
+                uint32_t tm_state[chachakernel::_SIZE_STATE];
+                std::copy(tm_job->m_state, tm_job->m_state + chachakernel::_SIZE_STATE, tm_state);
+                tm_state[chachakernel::_POS_COUNTER] = tm_soa[chachakernel::_POS_COUNTER][tm_count];
+
+                chachakernel::apply(tm_state, tm_job->m_data + tm_pos[tm_count], tm_job->m_len - tm_pos[tm_count]);
+            }
+
+            std::memset(tm_stream, 0, sizeof(tm_stream));
+            std::memset(tm_soa, 0, sizeof(tm_soa));
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemci AVX2 destekliyorsa şeritli yolu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa sıralı yol döner
+     *
+     * @param kernel_t Kernel
+     * @return multi_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    multi_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_serial;
+
+        switch( ar_kernel )
+        {
+            #if __CHACHA20_X86__
+                case kernel_t::avx2: return &kernel_avx2;
+            #endif
+            case kernel_t::serial:
+            default:
+                return &kernel_serial;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * İşlerin tamamını seçilen çekirdek üzerinden yerinde
+     * şifreler. İşlerin durumu değişmez
+     *
+     * @param Job* Jobs
+     * @param size_t Count
+     */
+    [[maybe_unused]]
+    void apply(
+        Job* ar_jobs,
+        const std::size_t ar_count
+    ) noexcept
+    {
+        static const multi_fn_t ss_fn = get_function(get_kernel());
+        ss_fn(ar_jobs, ar_count);
+    }
+}
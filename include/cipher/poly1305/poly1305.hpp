@@ -0,0 +1,267 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Poly1305
+ *
+ * RFC 8439'da tanımlanan tek kullanımlık doğrulama kodu
+ * (one-time authenticator). 32 baytlık anahtarın ilk yarısı
+ * r çarpanı, ikinci yarısı sona eklenen s değeridir. Veri
+ * parça parça update ile verilebilir; tam bloklar seçilen
+ * çekirdek ile işlenir, eksik kalan baytlar bir sonraki
+ * çağrıya kadar tamponda bekler
+ *
+ * Aynı anahtar iki farklı mesaj için kullanılmamalıdır.
+ * ChaCha20-Poly1305 her nonce için yeni anahtar üretir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <algorithm>
+
+#include <cipher/poly1305/polykernel.hpp>
+
+// Namespace
+namespace cipher::mac
+{
+    // Class
+    class Poly1305 final
+    {
+        public:
+            static constexpr std::size_t _SIZE_KEY = 32; // byte
+            static constexpr std::size_t _SIZE_TAG = 16; // byte
+            static constexpr std::size_t _SIZE_BLOCK = polykernel::_SIZE_BLOCK; // byte
+
+            using tag_t = std::array<uint8_t, _SIZE_TAG>;
+
+        private:
+            polykernel::PolyKey m_key {};
+            uint32_t m_state[polykernel::_SIZE_LIMB] {};
+            uint32_t m_pad[4] {};
+            uint8_t m_buffer[_SIZE_BLOCK] {};
+            std::size_t m_leftover { 0 };
+
+        public:
+            explicit Poly1305(const uint8_t* ar_key) noexcept;
+            ~Poly1305();
+
+            Poly1305(const Poly1305&) = delete;
+            Poly1305& operator=(const Poly1305&) = delete;
+
+            void update(const uint8_t* ar_data, std::size_t ar_len) noexcept;
+            void pad() noexcept;
+            void finish(uint8_t* ar_tag) noexcept;
+
+            static bool verify(const uint8_t* ar_left, const uint8_t* ar_right) noexcept;
+    };
+
+    /**
+     * @brief Poly1305
+     *
+     * 32 baytlık tek kullanımlık anahtar ile akümülatörü
+     * sıfırdan başlatır
+     *
+     * @param uint8_t* Key
+     */
+    Poly1305::Poly1305(
+        const uint8_t* ar_key
+    ) noexcept
+    {
+        polykernel::init(ar_key, this->m_key);
+
+        for(std::size_t tm_count = 0; tm_count < 4; ++tm_count)
+            this->m_pad[tm_count] = polykernel::load_le32(ar_key + 16 + tm_count * 4);
+    }
+
+    /**
+     * @brief ~Poly1305
+     *
+     * Anahtar ve ara değerler yıkımda sıfırlanır. Bayt bayt
+     * volatile yazmak yerine memset kullanılır, derleyicinin
+     * bu yazmaları ölü kabul edip silmemesi için ardından
+     * bellek bariyeri konur. Hesaplanmamış kuvvetler zaten
+     * sıfırdır
+     */
+    Poly1305::~Poly1305()
+    {
+        std::memset(this->m_key.m_power, 0, this->m_key.m_count * sizeof(this->m_key.m_power[0]));
+        std::memset(this->m_state, 0, sizeof(this->m_state));
+        std::memset(this->m_pad, 0, sizeof(this->m_pad));
+        std::memset(this->m_buffer, 0, sizeof(this->m_buffer));
+
+        #if defined(__GNUC__) || defined(__clang__)
+            __asm__ __volatile__("" : : "r"(this) : "memory");
+        #else
+            volatile uint8_t* tm_ptr = reinterpret_cast<volatile uint8_t*>(this);
+            for(std::size_t tm_count = 0; tm_count < sizeof(*this); ++tm_count)
+                tm_ptr[tm_count] = 0;
+        #endif
+    }
+
+    /**
+     * @brief Update
+     *
+     * Veriyi akümülatöre ekler. Önce tamponda bekleyen blok
+     * tamamlanır, sonra tam bloklar tek çağrı ile çekirdeğe
+     * verilir, artan kısım tampona alınır
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    void Poly1305::update(
+        const uint8_t* ar_data,
+        std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_len == 0 )
+            return;
+
+        // COMPLETE PENDING BLOCK
+        if( this->m_leftover )
+        {
+            const std::size_t tm_want = std::min(_SIZE_BLOCK - this->m_leftover, ar_len);
+            std::memcpy(this->m_buffer + this->m_leftover, ar_data, tm_want);
+
+            this->m_leftover += tm_want;
+            ar_data += tm_want;
+            ar_len -= tm_want;
+
+            if( this->m_leftover < _SIZE_BLOCK )
+                return;
+
+            polykernel::apply(this->m_key, this->m_state, this->m_buffer, _SIZE_BLOCK);
+            this->m_leftover = 0;
+        }
+
+        // FULL BLOCKS
+        const std::size_t tm_full = ar_len & ~(_SIZE_BLOCK - 1);
+        if( tm_full )
+        {
+            polykernel::apply(this->m_key, this->m_state, ar_data, tm_full);
+            ar_data += tm_full;
+            ar_len -= tm_full;
+        }
+
+        // KEEP REST
+        if( ar_len )
+        {
+            std::memcpy(this->m_buffer, ar_data, ar_len);
+            this->m_leftover = ar_len;
+        }
+    }
+
+    /**
+     * @brief Pad
+     *
+     * Bekleyen eksik blok varsa sıfırlar ile 16 bayta
+     * tamamlar. AEAD yapısında ek veri ve şifreli metin
+     * ayrı ayrı 16 bayta hizalanır
+     */
+    void Poly1305::pad() noexcept
+    {
+        if( !this->m_leftover )
+            return;
+
+        std::memset(this->m_buffer + this->m_leftover, 0, _SIZE_BLOCK - this->m_leftover);
+        polykernel::apply(this->m_key, this->m_state, this->m_buffer, _SIZE_BLOCK);
+        this->m_leftover = 0;
+    }
+
+    /**
+     * @brief Finish
+     *
+     * Eksik son blok 1 baytı ile kapatılıp işlenir, akümülatör
+     * tam indirgenir (mod 2^130-5), s eklenir ve 16 baytlık
+     * etiket küçük uçlu olarak yazılır. Seçimler dallanma
+     * olmadan maske ile yapılır
+     *
+     * @param uint8_t* Tag
+     */
+    void Poly1305::finish(
+        uint8_t* ar_tag
+    ) noexcept
+    {
+        using polykernel::_MASK_LIMB;
+
+        // LAST PARTIAL BLOCK WITHOUT HIBIT
+        if( this->m_leftover )
+        {
+            this->m_buffer[this->m_leftover] = 1;
+            std::memset(this->m_buffer + this->m_leftover + 1, 0, _SIZE_BLOCK - this->m_leftover - 1);
+            polykernel::kernel_scalar(this->m_key, this->m_state, this->m_buffer, _SIZE_BLOCK, 0);
+            this->m_leftover = 0;
+        }
+
+        uint32_t tm_h0 = this->m_state[0], tm_h1 = this->m_state[1], tm_h2 = this->m_state[2], tm_h3 = this->m_state[3], tm_h4 = this->m_state[4];
+
+        // FULL CARRY
+        uint32_t tm_carry = tm_h1 >> 26; tm_h1 &= _MASK_LIMB;
+        tm_h2 += tm_carry; tm_carry = tm_h2 >> 26; tm_h2 &= _MASK_LIMB;
+        tm_h3 += tm_carry; tm_carry = tm_h3 >> 26; tm_h3 &= _MASK_LIMB;
+        tm_h4 += tm_carry; tm_carry = tm_h4 >> 26; tm_h4 &= _MASK_LIMB;
+        tm_h0 += tm_carry * 5; tm_carry = tm_h0 >> 26; tm_h0 &= _MASK_LIMB;
+        tm_h1 += tm_carry;
+
+        // G = H + 5 - 2^130
+        uint32_t tm_g0 = tm_h0 + 5; tm_carry = tm_g0 >> 26; tm_g0 &= _MASK_LIMB;
+        uint32_t tm_g1 = tm_h1 + tm_carry; tm_carry = tm_g1 >> 26; tm_g1 &= _MASK_LIMB;
+        uint32_t tm_g2 = tm_h2 + tm_carry; tm_carry = tm_g2 >> 26; tm_g2 &= _MASK_LIMB;
+        uint32_t tm_g3 = tm_h3 + tm_carry; tm_carry = tm_g3 >> 26; tm_g3 &= _MASK_LIMB;
+        uint32_t tm_g4 = tm_h4 + tm_carry - (1u << 26);
+
+        // SELECT H IF G BORROWED, OTHERWISE G
+        uint32_t tm_mask = (tm_g4 >> 31) - 1;
+        tm_g0 &= tm_mask; tm_g1 &= tm_mask; tm_g2 &= tm_mask; tm_g3 &= tm_mask; tm_g4 &= tm_mask;
+        tm_mask = ~tm_mask;
+        tm_h0 = (tm_h0 & tm_mask) | tm_g0;
+        tm_h1 = (tm_h1 & tm_mask) | tm_g1;
+        tm_h2 = (tm_h2 & tm_mask) | tm_g2;
+        tm_h3 = (tm_h3 & tm_mask) | tm_g3;
+        tm_h4 = (tm_h4 & tm_mask) | tm_g4;
+
+        // 2^128 RANGE AS 4 WORDS
+        const uint32_t tm_word[4] =
+        {
+            tm_h0 | (tm_h1 << 26),
+            (tm_h1 >> 6) | (tm_h2 << 20),
+            (tm_h2 >> 12) | (tm_h3 << 14),
+            (tm_h3 >> 18) | (tm_h4 << 8)
+        };
+
+        // TAG = H + S (MOD 2^128)
+        uint64_t tm_sum = 0;
+        for(std::size_t tm_count = 0; tm_count < 4; ++tm_count)
+        {
+            tm_sum = static_cast<uint64_t>(tm_word[tm_count]) + this->m_pad[tm_count] + (tm_sum >> 32);
+            ar_tag[tm_count * 4 + 0] = static_cast<uint8_t>(tm_sum);
+            ar_tag[tm_count * 4 + 1] = static_cast<uint8_t>(tm_sum >> 8);
+            ar_tag[tm_count * 4 + 2] = static_cast<uint8_t>(tm_sum >> 16);
+            ar_tag[tm_count * 4 + 3] = static_cast<uint8_t>(tm_sum >> 24);
+        }
+    }
+
+    /**
+     * @brief Verify
+     *
+     * İki etiketi sabit zamanda karşılaştırır; ilk farklı
+     * baytta erken çıkmadığından süre etiketi sızdırmaz
+     *
+     * @param uint8_t* Left
+     * @param uint8_t* Right
+     * @return bool
+     */
+    bool Poly1305::verify(
+        const uint8_t* ar_left,
+        const uint8_t* ar_right
+    ) noexcept
+    {
+        uint8_t tm_diff = 0;
+        for(std::size_t tm_count = 0; tm_count < _SIZE_TAG; ++tm_count)
+            tm_diff |= ar_left[tm_count] ^ ar_right[tm_count];
+
+        return tm_diff == 0;
+    }
+}
@@ -0,0 +1,523 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Poly Kernel (Poly1305 Çekirdeği)
+ *
+ * Poly1305 doğrulama kodunun 2^130-5 modülünde yapılan
+ * çarpma-toplama adımları. Akümülatör ve anahtar 26 bitlik
+ * 5 parçada (limb) tutulur; böylece çarpımlar 64 bite sığar.
+ * Destekleyen x86-64 işlemcilerde AVX2 ile 4 blok aynı anda
+ * işlenir: her şerit ayrı bir blok dizisini r^4 ile çarpar,
+ * sonda şeritler r^4, r^3, r^2, r ile çarpılıp toplanır.
+ * Desteklemeyen sistemlerde bloklar tek tek işlenir. Hangi
+ * yolun kullanılacağı ilk çağrıda çalışma zamanında belirlenir
+ *
+ * r^2, r^3 ve r^4 sadece vektör yolunu kullanacak kadar uzun
+ * veri geldiğinde hesaplanır; kısa sohbet mesajları için
+ * anahtar kurulumu tek kırpma işleminden ibarettir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __POLY1305_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __POLY1305_X86__ 0
+#endif
+
+// Namespace
+namespace cipher::mac::polykernel
+{
+    // Limit
+    static constexpr std::size_t _SIZE_BLOCK = 16; // byte
+    static constexpr std::size_t _SIZE_LIMB = 5;
+    static constexpr std::size_t _SIZE_POWER = 4;
+    static constexpr std::size_t _SIZE_VECTOR_MIN = 2 * _SIZE_POWER * _SIZE_BLOCK; // byte
+
+    static constexpr uint32_t _MASK_LIMB = 0x3ffffff;
+    static constexpr uint32_t _FLAG_HIBIT = 1u << 24;
+
+    // Struct
+    struct PolyKey
+    {
+        uint32_t m_power[_SIZE_POWER][_SIZE_LIMB] {};
+        std::size_t m_count { 0 };
+    };
+
+    // Type Definition
+    using poly_fn_t = void (*)(const PolyKey&, uint32_t*, const uint8_t*, std::size_t, uint32_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        scalar = 0,
+        avx2
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AVX2, kernel_t::avx2 },
+        { core::platform::_CPU_NULL, kernel_t::scalar }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] poly_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] void power(PolyKey& ar_key) noexcept;
+    [[maybe_unused]] void apply(PolyKey& ar_key, uint32_t* ar_state, const uint8_t* ar_data, const std::size_t ar_len) noexcept;
+
+    /**
+     * @brief Load LE32
+     *
+     * @param uint8_t* Data
+     * @return uint32_t
+     */
+    static inline uint32_t load_le32(const uint8_t* ar_data) noexcept
+    {
+        return static_cast<uint32_t>(ar_data[0])
+            | (static_cast<uint32_t>(ar_data[1]) << 8)
+            | (static_cast<uint32_t>(ar_data[2]) << 16)
+            | (static_cast<uint32_t>(ar_data[3]) << 24);
+    }
+
+    /**
+     * @brief Load Block
+     *
+     * 16 baytlık bloğu 26 bitlik 5 parçaya böler ve
+     * 2^128 bitini (hibit) ekler. Son eksik blok için
+     * hibit verilmez, 1 baytı blok içine yazılır
+     *
+     * @param uint8_t* Data
+     * @param uint32_t Hibit
+     * @param uint32_t* Limb
+     */
+    static inline void load_block(
+        const uint8_t* ar_data,
+        const uint32_t ar_hibit,
+        uint32_t* ar_limb
+    ) noexcept
+    {
+        ar_limb[0] = (load_le32(ar_data + 0)) & _MASK_LIMB;
+        ar_limb[1] = (load_le32(ar_data + 3) >> 2) & _MASK_LIMB;
+        ar_limb[2] = (load_le32(ar_data + 6) >> 4) & _MASK_LIMB;
+        ar_limb[3] = (load_le32(ar_data + 9) >> 6) & _MASK_LIMB;
+        ar_limb[4] = (load_le32(ar_data + 12) >> 8) | ar_hibit;
+    }
+
+    /**
+     * @brief Multiply
+     *
+     * h = h * r (mod 2^130-5). 2^130 üzerindeki taşma 5 ile
+     * çarpılıp başa eklendiğinden s = r * 5 önceden verilir.
+     * Sonuç tam indirgenmiş değildir, sadece parçalar 26
+     * bite yakın tutulur
+     *
+     * @param uint32_t* H
+     * @param uint32_t* R
+     * @param uint32_t* S
+     */
+    static inline void multiply(
+        uint32_t* ar_h,
+        const uint32_t* ar_r,
+        const uint32_t* ar_s
+    ) noexcept
+    {
+        const uint64_t tm_h0 = ar_h[0], tm_h1 = ar_h[1], tm_h2 = ar_h[2], tm_h3 = ar_h[3], tm_h4 = ar_h[4];
+
+        const uint64_t tm_d0 = tm_h0 * ar_r[0] + tm_h1 * ar_s[4] + tm_h2 * ar_s[3] + tm_h3 * ar_s[2] + tm_h4 * ar_s[1];
+        uint64_t tm_d1 = tm_h0 * ar_r[1] + tm_h1 * ar_r[0] + tm_h2 * ar_s[4] + tm_h3 * ar_s[3] + tm_h4 * ar_s[2];
+        uint64_t tm_d2 = tm_h0 * ar_r[2] + tm_h1 * ar_r[1] + tm_h2 * ar_r[0] + tm_h3 * ar_s[4] + tm_h4 * ar_s[3];
+        uint64_t tm_d3 = tm_h0 * ar_r[3] + tm_h1 * ar_r[2] + tm_h2 * ar_r[1] + tm_h3 * ar_r[0] + tm_h4 * ar_s[4];
+        uint64_t tm_d4 = tm_h0 * ar_r[4] + tm_h1 * ar_r[3] + tm_h2 * ar_r[2] + tm_h3 * ar_r[1] + tm_h4 * ar_r[0];
+
+        // CARRY PROPAGATION, 2^130 = 5 (MOD P)
+        uint32_t tm_carry = static_cast<uint32_t>(tm_d0 >> 26); ar_h[0] = static_cast<uint32_t>(tm_d0) & _MASK_LIMB;
+        tm_d1 += tm_carry; tm_carry = static_cast<uint32_t>(tm_d1 >> 26); ar_h[1] = static_cast<uint32_t>(tm_d1) & _MASK_LIMB;
+        tm_d2 += tm_carry; tm_carry = static_cast<uint32_t>(tm_d2 >> 26); ar_h[2] = static_cast<uint32_t>(tm_d2) & _MASK_LIMB;
+        tm_d3 += tm_carry; tm_carry = static_cast<uint32_t>(tm_d3 >> 26); ar_h[3] = static_cast<uint32_t>(tm_d3) & _MASK_LIMB;
+        tm_d4 += tm_carry; tm_carry = static_cast<uint32_t>(tm_d4 >> 26); ar_h[4] = static_cast<uint32_t>(tm_d4) & _MASK_LIMB;
+        ar_h[0] += tm_carry * 5; tm_carry = ar_h[0] >> 26; ar_h[0] &= _MASK_LIMB;
+        ar_h[1] += tm_carry;
+    }
+
+    /**
+     * @brief Times Five
+     *
+     * @param uint32_t* R
+     * @param uint32_t* S
+     */
+    static inline void times_five(const uint32_t* ar_r, uint32_t* ar_s) noexcept
+    {
+        for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+            ar_s[tm_count] = ar_r[tm_count] * 5;
+    }
+
+    /**
+     * @brief Init
+     *
+     * Anahtarın ilk 16 baytından r değerini RFC 8439 bölüm
+     * 2.5'e göre kırpar (clamp). Vektör yolunun kuvvetleri
+     * power ile ayrıca hesaplanır
+     *
+     * @param uint8_t* Key
+     * @param PolyKey& Out
+     */
+    static inline void init(
+        const uint8_t* ar_key,
+        PolyKey& ar_out
+    ) noexcept
+    {
+        uint32_t* tm_r = ar_out.m_power[0];
+        tm_r[0] = (load_le32(ar_key + 0)) & 0x3ffffff;
+        tm_r[1] = (load_le32(ar_key + 3) >> 2) & 0x3ffff03;
+        tm_r[2] = (load_le32(ar_key + 6) >> 4) & 0x3ffc0ff;
+        tm_r[3] = (load_le32(ar_key + 9) >> 6) & 0x3f03fff;
+        tm_r[4] = (load_le32(ar_key + 12) >> 8) & 0x00fffff;
+
+        ar_out.m_count = 1;
+    }
+
+    /**
+     * @brief Power
+     *
+     * Vektör yolu için r^2, r^3 ve r^4 kuvvetlerini hesaplar.
+     * Daha önce hesaplandıysa bir şey yapmaz. Çekirdek
+     * fonksiyonları doğrudan çağrılacaksa önce çağrılmalıdır
+     *
+     * @param PolyKey& Key
+     */
+    [[maybe_unused]]
+    void power(
+        PolyKey& ar_key
+    ) noexcept
+    {
+        if( ar_key.m_count >= _SIZE_POWER )
+            return;
+
+        const uint32_t* tm_r = ar_key.m_power[0];
+
+        uint32_t tm_s[_SIZE_LIMB];
+        times_five(tm_r, tm_s);
+
+        for(std::size_t tm_power = 1; tm_power < _SIZE_POWER; ++tm_power)
+        {
+            std::memcpy(ar_key.m_power[tm_power], ar_key.m_power[tm_power - 1], sizeof(ar_key.m_power[0]));
+            multiply(ar_key.m_power[tm_power], tm_r, tm_s);
+        }
+
+        ar_key.m_count = _SIZE_POWER;
+    }
+
+    /**
+     * @brief Kernel Scalar
+     *
+     * Tam blokları sıra ile h = (h + m) * r adımından geçirir.
+     * Uzunluk 16'nın katı olmalıdır
+     *
+     * @param PolyKey& Key
+     * @param uint32_t* State
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @param uint32_t Hibit
+     */
+    static inline void kernel_scalar(
+        const PolyKey& ar_key,
+        uint32_t* ar_state,
+        const uint8_t* ar_data,
+        std::size_t ar_len,
+        const uint32_t ar_hibit
+    ) noexcept
+    {
+        const uint32_t* tm_r = ar_key.m_power[0];
+
+        uint32_t tm_s[_SIZE_LIMB];
+        times_five(tm_r, tm_s);
+
+        uint32_t tm_limb[_SIZE_LIMB];
+        while( ar_len >= _SIZE_BLOCK )
+        {
+            load_block(ar_data, ar_hibit, tm_limb);
+            for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                ar_state[tm_count] += tm_limb[tm_count];
+
+            multiply(ar_state, tm_r, tm_s);
+
+            ar_data += _SIZE_BLOCK;
+            ar_len -= _SIZE_BLOCK;
+        }
+    }
+
+    #if __POLY1305_X86__
+        /**
+         * @brief Load Block AVX2
+         *
+         * 4 ardışık bloğu (64 bayt) iki yüklemede alır ve 64
+         * bitlik yarıları ayırarak parçalara böler. Karıştırma
+         * azaltmak için şeritler 0, 2, 1, 3. blokları tutar;
+         * son çarpanlar bu sıraya göre verilir
+         *
+         * @param uint8_t* Data
+         * @param __m256i Hibit
+         * @param __m256i* Limb
+         */
+        __attribute__((target("avx2")))
+        static inline void load_block_avx2(
+            const uint8_t* ar_data,
+            const __m256i ar_hibit,
+            __m256i* ar_limb
+        ) noexcept
+        {
+            const __m256i tm_mask = _mm256_set1_epi64x(_MASK_LIMB);
+
+            const __m256i tm_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_data));
+            const __m256i tm_second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_data + 32));
+
+            const __m256i tm_low = _mm256_unpacklo_epi64(tm_first, tm_second);
+            const __m256i tm_high = _mm256_unpackhi_epi64(tm_first, tm_second);
+
+            ar_limb[0] = _mm256_and_si256(tm_low, tm_mask);
+            ar_limb[1] = _mm256_and_si256(_mm256_srli_epi64(tm_low, 26), tm_mask);
+            ar_limb[2] = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(tm_low, 52), _mm256_slli_epi64(tm_high, 12)), tm_mask);
+            ar_limb[3] = _mm256_and_si256(_mm256_srli_epi64(tm_high, 14), tm_mask);
+            ar_limb[4] = _mm256_or_si256(_mm256_srli_epi64(tm_high, 40), ar_hibit);
+        }
+
+        /**
+         * @brief Multiply AVX2
+         *
+         * Dört şeritte aynı anda h = h * r (mod 2^130-5).
+         * Parçalar 64 bitlik şeritlerin alt 32 bitindedir
+         *
+         * @param __m256i* H
+         * @param __m256i* R
+         * @param __m256i* S
+         */
+        __attribute__((target("avx2")))
+        static inline void multiply_avx2(
+            __m256i* ar_h,
+            const __m256i* ar_r,
+            const __m256i* ar_s
+        ) noexcept
+        {
+            #define __POLY_MUL(a, b) _mm256_mul_epu32(ar_h[a], b)
+            __m256i tm_d0 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(__POLY_MUL(0, ar_r[0]), __POLY_MUL(1, ar_s[4])), _mm256_add_epi64(__POLY_MUL(2, ar_s[3]), __POLY_MUL(3, ar_s[2]))), __POLY_MUL(4, ar_s[1]));
+            __m256i tm_d1 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(__POLY_MUL(0, ar_r[1]), __POLY_MUL(1, ar_r[0])), _mm256_add_epi64(__POLY_MUL(2, ar_s[4]), __POLY_MUL(3, ar_s[3]))), __POLY_MUL(4, ar_s[2]));
+            __m256i tm_d2 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(__POLY_MUL(0, ar_r[2]), __POLY_MUL(1, ar_r[1])), _mm256_add_epi64(__POLY_MUL(2, ar_r[0]), __POLY_MUL(3, ar_s[4]))), __POLY_MUL(4, ar_s[3]));
+            __m256i tm_d3 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(__POLY_MUL(0, ar_r[3]), __POLY_MUL(1, ar_r[2])), _mm256_add_epi64(__POLY_MUL(2, ar_r[1]), __POLY_MUL(3, ar_r[0]))), __POLY_MUL(4, ar_s[4]));
+            __m256i tm_d4 = _mm256_add_epi64(_mm256_add_epi64(_mm256_add_epi64(__POLY_MUL(0, ar_r[4]), __POLY_MUL(1, ar_r[3])), _mm256_add_epi64(__POLY_MUL(2, ar_r[2]), __POLY_MUL(3, ar_r[1]))), __POLY_MUL(4, ar_r[0]));
+            #undef __POLY_MUL
+
+            // CARRY PROPAGATION PER LANE
+            const __m256i tm_mask = _mm256_set1_epi64x(_MASK_LIMB);
+            __m256i tm_carry = _mm256_srli_epi64(tm_d0, 26); ar_h[0] = _mm256_and_si256(tm_d0, tm_mask);
+            tm_d1 = _mm256_add_epi64(tm_d1, tm_carry); tm_carry = _mm256_srli_epi64(tm_d1, 26); ar_h[1] = _mm256_and_si256(tm_d1, tm_mask);
+            tm_d2 = _mm256_add_epi64(tm_d2, tm_carry); tm_carry = _mm256_srli_epi64(tm_d2, 26); ar_h[2] = _mm256_and_si256(tm_d2, tm_mask);
+            tm_d3 = _mm256_add_epi64(tm_d3, tm_carry); tm_carry = _mm256_srli_epi64(tm_d3, 26); ar_h[3] = _mm256_and_si256(tm_d3, tm_mask);
+            tm_d4 = _mm256_add_epi64(tm_d4, tm_carry); tm_carry = _mm256_srli_epi64(tm_d4, 26); ar_h[4] = _mm256_and_si256(tm_d4, tm_mask);
+            ar_h[0] = _mm256_add_epi64(ar_h[0], _mm256_add_epi64(tm_carry, _mm256_slli_epi64(tm_carry, 2)));
+            tm_carry = _mm256_srli_epi64(ar_h[0], 26); ar_h[0] = _mm256_and_si256(ar_h[0], tm_mask);
+            ar_h[1] = _mm256_add_epi64(ar_h[1], tm_carry);
+        }
+
+        /**
+         * @brief Kernel AVX2
+         *
+         * Bloklar 4'erli gruplar halinde işlenir. Her şerit
+         * kendi blok dizisini r^4 ile Horner yöntemi ile
+         * biriktirir, son grupta şeritler tuttukları bloğun
+         * sırasına göre r^4, r^3, r^2 ve r ile çarpılıp toplanır. Böylece sonuç tek tek
+         * işlenmiş blokların sonucu ile aynıdır. 4 bloktan az
+         * kalan kısım ve kuvvetleri hesaplanmamış anahtar
+         * yazılımsal yol ile işlenir
+         *
+         * @param PolyKey& Key
+         * @param uint32_t* State
+         * @param uint8_t* Data
+         * @param size_t Length
+         * @param uint32_t Hibit
+         */
+        __attribute__((target("avx2")))
+        static inline void kernel_avx2(
+            const PolyKey& ar_key,
+            uint32_t* ar_state,
+            const uint8_t* ar_data,
+            std::size_t ar_len,
+            const uint32_t ar_hibit
+        ) noexcept
+        {
+            constexpr std::size_t tm_group = _SIZE_POWER * _SIZE_BLOCK;
+
+            if( ar_len >= _SIZE_VECTOR_MIN && ar_key.m_count >= _SIZE_POWER )
+            {
+                const uint32_t* tm_r1 = ar_key.m_power[0];
+                const uint32_t* tm_r2 = ar_key.m_power[1];
+                const uint32_t* tm_r3 = ar_key.m_power[2];
+                const uint32_t* tm_r4 = ar_key.m_power[3];
+
+                __m256i tm_r[_SIZE_LIMB], tm_s[_SIZE_LIMB], tm_fr[_SIZE_LIMB], tm_fs[_SIZE_LIMB];
+                for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                {
+                    tm_r[tm_count] = _mm256_set1_epi64x(tm_r4[tm_count]);
+                    tm_s[tm_count] = _mm256_set1_epi64x(tm_r4[tm_count] * 5);
+                    // LANES HOLD BLOCKS 0, 2, 1, 3
+                    tm_fr[tm_count] = _mm256_set_epi64x(tm_r1[tm_count], tm_r3[tm_count], tm_r2[tm_count], tm_r4[tm_count]);
+                    tm_fs[tm_count] = _mm256_set_epi64x(tm_r1[tm_count] * 5, tm_r3[tm_count] * 5, tm_r2[tm_count] * 5, tm_r4[tm_count] * 5);
+                }
+
+                // FIRST GROUP, CURRENT STATE GOES TO LANE 0
+                const __m256i tm_hibit = _mm256_set1_epi64x(ar_hibit);
+
+                __m256i tm_h[_SIZE_LIMB], tm_m[_SIZE_LIMB];
+                load_block_avx2(ar_data, tm_hibit, tm_h);
+                for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                    tm_h[tm_count] = _mm256_add_epi64(tm_h[tm_count], _mm256_set_epi64x(0, 0, 0, ar_state[tm_count]));
+
+                ar_data += tm_group;
+                ar_len -= tm_group;
+
+                // HORNER WITH R^4 PER LANE
+                while( ar_len >= tm_group )
+                {
+                    multiply_avx2(tm_h, tm_r, tm_s);
+                    load_block_avx2(ar_data, tm_hibit, tm_m);
+                    for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                        tm_h[tm_count] = _mm256_add_epi64(tm_h[tm_count], tm_m[tm_count]);
+
+                    ar_data += tm_group;
+                    ar_len -= tm_group;
+                }
+
+                // LANES TIMES R^4, R^3, R^2, R AND HORIZONTAL SUM
+                multiply_avx2(tm_h, tm_fr, tm_fs);
+
+                uint64_t tm_sum[_SIZE_LIMB];
+                for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                {
+                    alignas(32) uint64_t tm_lane[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(tm_lane), tm_h[tm_count]);
+                    tm_sum[tm_count] = tm_lane[0] + tm_lane[1] + tm_lane[2] + tm_lane[3];
+                }
+
+                uint64_t tm_carry = tm_sum[0] >> 26; tm_sum[0] &= _MASK_LIMB;
+                tm_sum[1] += tm_carry; tm_carry = tm_sum[1] >> 26; tm_sum[1] &= _MASK_LIMB;
+                tm_sum[2] += tm_carry; tm_carry = tm_sum[2] >> 26; tm_sum[2] &= _MASK_LIMB;
+                tm_sum[3] += tm_carry; tm_carry = tm_sum[3] >> 26; tm_sum[3] &= _MASK_LIMB;
+                tm_sum[4] += tm_carry; tm_carry = tm_sum[4] >> 26; tm_sum[4] &= _MASK_LIMB;
+                tm_sum[0] += tm_carry * 5; tm_carry = tm_sum[0] >> 26; tm_sum[0] &= _MASK_LIMB;
+                tm_sum[1] += tm_carry;
+
+                for(std::size_t tm_count = 0; tm_count < _SIZE_LIMB; ++tm_count)
+                    ar_state[tm_count] = static_cast<uint32_t>(tm_sum[tm_count]);
+            }
+
+            kernel_scalar(ar_key, ar_state, ar_data, ar_len, ar_hibit);
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemci AVX2 destekliyorsa onu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa yazılımsal yol döner
+     *
+     * @param kernel_t Kernel
+     * @return poly_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    poly_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_scalar;
+
+        switch( ar_kernel )
+        {
+            #if __POLY1305_X86__
+                case kernel_t::avx2: return &kernel_avx2;
+            #endif
+            case kernel_t::scalar:
+            default:
+                return &kernel_scalar;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Tam blokları seçilen çekirdek üzerinden akümülatöre ekler.
+     * Veri vektör yolu için yeterince uzunsa kuvvetler ilk
+     * kullanımda hesaplanır
+     *
+     * @param PolyKey& Key
+     * @param uint32_t* State
+     * @param uint8_t* Data
+     * @param size_t Length
+     */
+    [[maybe_unused]]
+    void apply(
+        PolyKey& ar_key,
+        uint32_t* ar_state,
+        const uint8_t* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static const poly_fn_t ss_fn = get_function(get_kernel());
+
+        if( ar_len >= _SIZE_VECTOR_MIN && ss_fn != &kernel_scalar )
+            power(ar_key);
+
+        ss_fn(ar_key, ar_state, ar_data, ar_len, _FLAG_HIBIT);
+    }
+}
\ No newline at end of file
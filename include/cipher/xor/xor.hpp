@@ -15,7 +15,12 @@
  */
 
 // Include
+#include <vector>
+#include <new>
+#include <algorithm>
+
 #include <core/algorithm.hpp>
+#include <cipher/xor/xorkernel.hpp>
 
 // Namespace
 namespace cipher::stream
@@ -26,14 +31,37 @@ namespace cipher::stream
     // Class
     class Xor final : public Algorithm
     {
+        public:
+            static constexpr std::size_t _SIZE_STREAM_MIN = 1024; // byte
+            static constexpr std::size_t _SIZE_ALIGN = 64; // byte
+
+        private:
+            std::vector<unsigned char> m_stream;
+            std::size_t m_stream_align { 0 };
+            std::size_t m_period { 0 };
+
+        private:
+            bool expand() noexcept;
+            inline const unsigned char* get_stream() const noexcept;
+
         public:
             explicit Xor(
                 const std::string& ar_name,
                 const std::string& ar_key
             );
 
+            using Algorithm::encrypt;
+            using Algorithm::decrypt;
+
             virtual bool encrypt(std::string& ar_text) noexcept override;
             virtual bool decrypt(std::string& ar_text) noexcept override;
+
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept override;
+
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const override;
+
+            bool apply(unsigned char* ar_data, const std::size_t ar_len, const std::size_t ar_offset = 0) noexcept;
     };
 
     /**
@@ -51,14 +79,127 @@ namespace cipher::stream
         const std::string& ar_key
     )
     : Algorithm(ar_name, ar_key)
-    {}
+    {
+        this->expand();
+    }
+
+    /**
+     * @brief Clone
+     *
+     * Aynı isim ile verilen anahtarı kullanan yeni
+     * Xor oluşturur
+     *
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> Xor::clone(
+        const std::string& ar_key
+    ) const
+    {
+        return std::make_unique<Xor>(this->get_name(), ar_key);
+    }
+
+    /**
+     * @brief Expand
+     * 
+     * Anahtar, uzunluğunun katı olan ve en az _SIZE_STREAM_MIN
+     * kadar olan bir periyoda tekrar edilerek yazılır. Sonuna bir
+     * anahtar boyu daha eklenir, bu sayede anahtarın hangi
+     * konumundan başlanırsa başlansın bir periyot boyunca kesintisiz
+     * akış okunabilir. Akışın başı önbellek satırına hizalanır.
+     * Akış için bellek ayrılamazsa periyot sıfır kalır ve
+     * şifreleme işlemleri başarısız döner
+     *
+     * @return bool
+     */
+    bool Xor::expand() noexcept
+    {
+        this->m_period = 0;
+
+        if( this->has_error() )
+            return false;
+
+        const std::string& tm_key = this->get_key();
+        const std::size_t tm_keylen = tm_key.size();
+
+        const std::size_t tm_period = ((_SIZE_STREAM_MIN + tm_keylen - 1) / tm_keylen) * tm_keylen;
+        const std::size_t tm_size = tm_period + tm_keylen;
+
+        try { this->m_stream.assign(tm_size + _SIZE_ALIGN, 0); }
+        catch( const std::bad_alloc& )
+        {
+            this->m_stream.clear();
+            return false;
+        }
+
+        const auto tm_addr = reinterpret_cast<std::uintptr_t>(this->m_stream.data());
+        this->m_stream_align = (_SIZE_ALIGN - (tm_addr % _SIZE_ALIGN)) % _SIZE_ALIGN;
+
+        unsigned char* tm_stream = this->m_stream.data() + this->m_stream_align;
+        for(std::size_t tm_count = 0; tm_count < tm_size; ++tm_count)
+            tm_stream[tm_count] = static_cast<unsigned char>(tm_key[tm_count % tm_keylen]);
+
+        this->m_period = tm_period;
+        return true;
+    }
+
+    /**
+     * @brief Get Stream
+     * 
+     * Hizalanmış anahtar akışının başlangıcını döndürür
+     * 
+     * @return const unsigned char*
+     */
+    const unsigned char* Xor::get_stream() const noexcept
+    {
+        return this->m_stream.data() + this->m_stream_align;
+    }
+
+    /**
+     * @brief Apply
+     * 
+     * Veriyi, anahtar akışında verilen konumdan başlayarak
+     * xor işleminden geçirir. Anahtar indeksi her bayt için
+     * (konum + sıra) mod anahtar uzunluğu olur. Veri periyot
+     * boyunda parçalara bölünür ve her parça tek çağrıda vektör
+     * çekirdeğe verilir
+     * 
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @param size_t Key Offset
+     * @return bool
+     */
+    bool Xor::apply(
+        unsigned char* ar_data,
+        std::size_t ar_len,
+        const std::size_t ar_offset
+    ) noexcept
+    {
+        if( this->has_error() || this->m_period == 0 )
+            return false;
+
+        const std::size_t tm_keylen = this->get_key().size();
+        const unsigned char* tm_stream = this->get_stream() + (ar_offset % tm_keylen);
+
+        // PERIOD IS A MULTIPLE OF KEY LENGTH, KEY POSITION STAYS THE SAME
+        while( ar_len )
+        {
+            const std::size_t tm_chunk = std::min(ar_len, this->m_period);
+            xorkernel::apply(ar_data, tm_stream, tm_chunk);
+
+            ar_data += tm_chunk;
+            ar_len -= tm_chunk;
+        }
+
+        return true;
+    }
 
     /**
      * @brief Encrypt
      * 
      * Xor şifreleme işlemini yapar.
-     * Verilen metini alır ve şifreleme anahtarı
-     * ile karakter karakter şifreler. Eğer
+     * Verilen metini alır ve genişletilmiş anahtar
+     * akışı ile vektör çekirdek üzerinden şifreler. Eğer
      * işlem başarılı ise true, değilse false
      * dönerek işlemin başarıyla yapılıp yapılmadığını
      * bildirir
@@ -70,16 +211,7 @@ namespace cipher::stream
         std::string& ar_text
     ) noexcept
     {
-        if( this->has_error() )
-            return false;
-
-        const std::string& tm_key = this->get_key();    
-        const uint16_t tm_keylen = tm_key.size();
-
-        for( uint16_t tm_count = 0; tm_count < ar_text.size(); ++tm_count)
-            ar_text[tm_count] ^= tm_key[tm_count & tm_keylen];
-
-        return true;
+        return this->apply(reinterpret_cast<unsigned char*>(ar_text.data()), ar_text.size());
     }
 
     /**
@@ -98,4 +230,39 @@ namespace cipher::stream
     {
         return this->encrypt(ar_text);
     }
+
+    /**
+     * @brief Encrypt (Buffer)
+     * 
+     * Verilen alanı kopyalamadan yerinde şifreler
+     * 
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool Xor::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->apply(reinterpret_cast<unsigned char*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     * 
+     * Xor işlemi kendi tersi olduğundan şifreleme
+     * fonksiyonunu kullanır
+     * 
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool Xor::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return this->encrypt(ar_data, ar_len);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Xor Kernel (Xor Çekirdeği)
+ *
+ * Verinin önceden genişletilmiş anahtar akışı ile xor
+ * işlemini yapan çekirdekler. Destekleyen x86-64 işlemcilerde
+ * AVX-512, AVX2 ya da SSE2 ile tek komutta 64, 32 ya da 16 bayt
+ * işlenir. Desteklemeyen sistemlerde 8 baytlık kelimeler ile
+ * yazılımsal işlem yapılır. Hangi yolun kullanılacağı ilk
+ * çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __XOR_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __XOR_X86__ 0
+#endif
+
+// Namespace
+namespace cipher::stream::xorkernel
+{
+    // Type Definition
+    using xor_fn_t = void (*)(unsigned char*, const unsigned char*, std::size_t) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        scalar = 0,
+        sse2,
+        avx2,
+        avx512
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AVX512F | core::platform::_CPU_AVX512BW, kernel_t::avx512 },
+        { core::platform::_CPU_AVX2, kernel_t::avx2 },
+        { core::platform::_CPU_SSE2, kernel_t::sse2 },
+        { core::platform::_CPU_NULL, kernel_t::scalar }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] xor_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] void apply(unsigned char* ar_data, const unsigned char* ar_stream, const std::size_t ar_len) noexcept;
+
+    /**
+     * @brief Kernel Scalar
+     *
+     * Veriyi 8 baytlık kelimeler halinde, kalan kısmı
+     * bayt bayt xor işleminden geçirir
+     *
+     * @param unsigned char* Data
+     * @param unsigned char* Stream
+     * @param size_t Length
+     */
+    static inline void kernel_scalar(
+        unsigned char* ar_data,
+        const unsigned char* ar_stream,
+        std::size_t ar_len
+    ) noexcept
+    {
+        while( ar_len >= sizeof(uint64_t) )
+        {
+            uint64_t tm_data, tm_key;
+            std::memcpy(&tm_data, ar_data, sizeof(tm_data));
+            std::memcpy(&tm_key, ar_stream, sizeof(tm_key));
+            tm_data ^= tm_key;
+            std::memcpy(ar_data, &tm_data, sizeof(tm_data));
+
+            ar_data += sizeof(uint64_t);
+            ar_stream += sizeof(uint64_t);
+            ar_len -= sizeof(uint64_t);
+        }
+
+        while( ar_len-- )
+            *ar_data++ ^= *ar_stream++;
+    }
+
+    #if __XOR_X86__
+        /**
+         * @brief Kernel SSE2
+         *
+         * 16 baytlık bloklar halinde xor işlemi yapar,
+         * kalan kısım yazılımsal yol ile tamamlanır
+         *
+         * @param unsigned char* Data
+         * @param unsigned char* Stream
+         * @param size_t Length
+         */
+        __attribute__((target("sse2")))
+        static inline void kernel_sse2(
+            unsigned char* ar_data,
+            const unsigned char* ar_stream,
+            std::size_t ar_len
+        ) noexcept
+        {
+            while( ar_len >= 64 )
+            {
+                for(std::size_t tm_lane = 0; tm_lane < 64; tm_lane += 16)
+                {
+                    const __m128i tm_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_data + tm_lane));
+                    const __m128i tm_key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_stream + tm_lane));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(ar_data + tm_lane), _mm_xor_si128(tm_data, tm_key));
+                }
+
+                ar_data += 64;
+                ar_stream += 64;
+                ar_len -= 64;
+            }
+
+            while( ar_len >= 16 )
+            {
+                const __m128i tm_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_data));
+                const __m128i tm_key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_stream));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(ar_data), _mm_xor_si128(tm_data, tm_key));
+
+                ar_data += 16;
+                ar_stream += 16;
+                ar_len -= 16;
+            }
+
+            kernel_scalar(ar_data, ar_stream, ar_len);
+        }
+
+        /**
+         * @brief Kernel AVX2
+         *
+         * 32 baytlık bloklar halinde, döngü başına 4 blok
+         * işleyerek xor işlemi yapar
+         *
+         * @param unsigned char* Data
+         * @param unsigned char* Stream
+         * @param size_t Length
+         */
+        __attribute__((target("avx2")))
+        static inline void kernel_avx2(
+            unsigned char* ar_data,
+            const unsigned char* ar_stream,
+            std::size_t ar_len
+        ) noexcept
+        {
+            while( ar_len >= 128 )
+            {
+                for(std::size_t tm_lane = 0; tm_lane < 128; tm_lane += 32)
+                {
+                    const __m256i tm_data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_data + tm_lane));
+                    const __m256i tm_key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_stream + tm_lane));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ar_data + tm_lane), _mm256_xor_si256(tm_data, tm_key));
+                }
+
+                ar_data += 128;
+                ar_stream += 128;
+                ar_len -= 128;
+            }
+
+            while( ar_len >= 32 )
+            {
+                const __m256i tm_data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_data));
+                const __m256i tm_key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_stream));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(ar_data), _mm256_xor_si256(tm_data, tm_key));
+
+                ar_data += 32;
+                ar_stream += 32;
+                ar_len -= 32;
+            }
+
+            kernel_scalar(ar_data, ar_stream, ar_len);
+        }
+
+        /**
+         * @brief Kernel AVX-512
+         *
+         * 64 baytlık bloklar halinde xor işlemi yapar, kalan
+         * kısım maskeli yükleme ve yazma ile tek adımda biter
+         *
+         * @param unsigned char* Data
+         * @param unsigned char* Stream
+         * @param size_t Length
+         */
+        __attribute__((target("avx512f,avx512bw")))
+        static inline void kernel_avx512(
+            unsigned char* ar_data,
+            const unsigned char* ar_stream,
+            std::size_t ar_len
+        ) noexcept
+        {
+            while( ar_len >= 256 )
+            {
+                for(std::size_t tm_lane = 0; tm_lane < 256; tm_lane += 64)
+                {
+                    const __m512i tm_data = _mm512_loadu_si512(ar_data + tm_lane);
+                    const __m512i tm_key = _mm512_loadu_si512(ar_stream + tm_lane);
+                    _mm512_storeu_si512(ar_data + tm_lane, _mm512_xor_si512(tm_data, tm_key));
+                }
+
+                ar_data += 256;
+                ar_stream += 256;
+                ar_len -= 256;
+            }
+
+            while( ar_len >= 64 )
+            {
+                const __m512i tm_data = _mm512_loadu_si512(ar_data);
+                const __m512i tm_key = _mm512_loadu_si512(ar_stream);
+                _mm512_storeu_si512(ar_data, _mm512_xor_si512(tm_data, tm_key));
+
+                ar_data += 64;
+                ar_stream += 64;
+                ar_len -= 64;
+            }
+
+            if( ar_len )
+            {
+                const __mmask64 tm_mask = (~__mmask64{ 0 }) >> (64 - ar_len);
+                const __m512i tm_data = _mm512_maskz_loadu_epi8(tm_mask, ar_data);
+                const __m512i tm_key = _mm512_maskz_loadu_epi8(tm_mask, ar_stream);
+                _mm512_mask_storeu_epi8(ar_data, tm_mask, _mm512_xor_si512(tm_data, tm_key));
+            }
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemcinin desteklediği en geniş çekirdeği seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa yazılımsal yol döner
+     *
+     * @param kernel_t Kernel
+     * @return xor_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    xor_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_scalar;
+
+        switch( ar_kernel )
+        {
+            #if __XOR_X86__
+                case kernel_t::avx512: return &kernel_avx512;
+                case kernel_t::avx2: return &kernel_avx2;
+                case kernel_t::sse2: return &kernel_sse2;
+            #endif
+            case kernel_t::scalar:
+            default:
+                return &kernel_scalar;
+        }
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Veriyi aynı uzunluktaki anahtar akışı ile seçilen
+     * çekirdek üzerinden xor işleminden geçirir
+     *
+     * @param unsigned char* Data
+     * @param unsigned char* Stream
+     * @param size_t Length
+     */
+    [[maybe_unused]]
+    void apply(
+        unsigned char* ar_data,
+        const unsigned char* ar_stream,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static const xor_fn_t ss_fn = get_function(get_kernel());
+        ss_fn(ar_data, ar_stream, ar_len);
+    }
+}
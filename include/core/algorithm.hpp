@@ -16,7 +16,11 @@
 
 // Include
 #include <cstdint>
+#include <cstddef>
 #include <string>
+#include <new>
+#include <memory>
+#include <algorithm>
 
 #include <tools/charset/utf.hpp>
 using namespace tools::charset;
@@ -24,6 +28,17 @@ using namespace tools::charset;
 // Namespace
 namespace core::algorithm
 {
+    // Struct
+    struct Frame
+    {
+        std::byte* m_data { nullptr };
+        std::size_t m_header { 0 };
+        std::size_t m_payload { 0 };
+
+        constexpr std::byte* body() const noexcept { return this->m_data + this->m_header; }
+        constexpr bool empty() const noexcept { return this->m_data == nullptr || this->m_payload == 0; }
+    };
+
     // Class
     class Algorithm
     {
@@ -63,6 +78,19 @@ namespace core::algorithm
             virtual bool encrypt(std::string& ar_text) noexcept { (void)ar_text; return false; };
             virtual bool decrypt(std::string& ar_text) noexcept { (void)ar_text; return false; };
 
+            virtual bool has_buffer() const noexcept;
+            virtual bool encrypt(std::byte* ar_data, const std::size_t ar_len) noexcept;
+            virtual bool decrypt(std::byte* ar_data, const std::size_t ar_len) noexcept;
+
+            bool encrypt(const Frame& ar_frame) noexcept;
+            bool decrypt(const Frame& ar_frame) noexcept;
+
+            virtual std::size_t get_seal_size() const noexcept;
+            virtual bool seal(const Frame& ar_frame, std::byte* ar_trailer) noexcept;
+            virtual bool open(const Frame& ar_frame, const std::byte* ar_trailer) noexcept;
+
+            virtual std::unique_ptr<Algorithm> clone(const std::string& ar_key) const;
+
             static inline bool is_valid_name(const std::string& ar_name) noexcept;
             static inline bool is_valid_key(const std::string& ar_key) noexcept;
     };
@@ -200,6 +228,200 @@ namespace core::algorithm
         return this->m_key;
     }
 
+    /**
+     * @brief Has Buffer
+     * 
+     * Algoritmanın boyutu değiştirmeyen tampon arayüzünü
+     * (encrypt/decrypt byte*) destekleyip desteklemediğini
+     * döndürür. Etiket ekleyen doğrulamalı algoritmalar bu
+     * arayüzü desteklemez ve false döndürür; bu durumda tampon
+     * çağrıları her zaman false döner, çerçeve için seal ve
+     * open kullanılmalıdır. Çağıran, şifreleme hatasını
+     * desteklenmeyen arayüzden bu fonksiyon ile ayırt eder
+     * 
+     * @return bool
+     */
+    bool Algorithm::has_buffer() const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * @brief Encrypt (Buffer)
+     * 
+     * Verilen alanı yerinde şifreler. Kendi tampon desteği
+     * olmayan algoritmalar için alan iş parçacığına ait metne
+     * kopyalanır, metin şifrelenir ve geri yazılır, kopya için bellek
+     * ayrılamazsa false döner. Tampon desteği olan algoritmalar
+     * bu fonksiyonu kopyasız olarak yeniden tanımlamalıdır
+     * 
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool Algorithm::encrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static thread_local std::string ss_text;
+        try {
+            ss_text.assign(reinterpret_cast<const char*>(ar_data), ar_len);
+        } catch( const std::bad_alloc& ) {
+            return false;
+        }
+
+        if( !this->encrypt(ss_text) || ss_text.size() != ar_len )
+            return false;
+
+        std::copy(ss_text.begin(), ss_text.end(), reinterpret_cast<char*>(ar_data));
+        return true;
+    }
+
+    /**
+     * @brief Decrypt (Buffer)
+     * 
+     * Verilen alanın şifresini yerinde çözer. Kendi tampon
+     * desteği olmayan algoritmalar için metin üzerinden çalışır,
+     * kopya için bellek ayrılamazsa false döner
+     * 
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    bool Algorithm::decrypt(
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        static thread_local std::string ss_text;
+        try {
+            ss_text.assign(reinterpret_cast<const char*>(ar_data), ar_len);
+        } catch( const std::bad_alloc& ) {
+            return false;
+        }
+
+        if( !this->decrypt(ss_text) || ss_text.size() != ar_len )
+            return false;
+
+        std::copy(ss_text.begin(), ss_text.end(), reinterpret_cast<char*>(ar_data));
+        return true;
+    }
+
+    /**
+     * @brief Encrypt (Frame)
+     * 
+     * Paketlenmiş çerçevede başlıktan sonraki veri bölümünün
+     * tamamını tek geçişte, gönderim tamponunun içinde şifreler.
+     * Başlık açık kalır
+     * 
+     * @param Frame& Frame
+     * @return bool
+     */
+    bool Algorithm::encrypt(
+        const Frame& ar_frame
+    ) noexcept
+    {
+        if( ar_frame.empty() )
+            return ar_frame.m_payload == 0;
+
+        return this->encrypt(ar_frame.body(), ar_frame.m_payload);
+    }
+
+    /**
+     * @brief Decrypt (Frame)
+     * 
+     * Alınan çerçevenin veri bölümünün şifresini alım
+     * tamponunun içinde tek geçişte çözer
+     * 
+     * @param Frame& Frame
+     * @return bool
+     */
+    bool Algorithm::decrypt(
+        const Frame& ar_frame
+    ) noexcept
+    {
+        if( ar_frame.empty() )
+            return ar_frame.m_payload == 0;
+
+        return this->decrypt(ar_frame.body(), ar_frame.m_payload);
+    }
+
+    /**
+     * @brief Get Seal Size
+     * 
+     * Algoritmanın çerçeve sonuna eklediği kuyruk boyutunu
+     * döndürür: doğrulamalı şifreleme (AEAD) için nonce ve
+     * etiket, çerçeve başına nonce üreten akış şifreleyicileri
+     * için sadece nonce. Kuyruk eklemeyenler için sıfırdır
+     * 
+     * @return size_t
+     */
+    std::size_t Algorithm::get_seal_size() const noexcept
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Seal (Frame)
+     * 
+     * Çerçevenin veri bölümünü şifreler, başlığı ek veri olarak
+     * doğrular ve get_seal_size kadar kuyruğu verilen alana yazar.
+     * Doğrulama yapmayan algoritmalar için sadece şifreleme yapılır
+     * 
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool Algorithm::seal(
+        const Frame& ar_frame,
+        std::byte* ar_trailer
+    ) noexcept
+    {
+        (void)ar_trailer;
+        return this->encrypt(ar_frame);
+    }
+
+    /**
+     * @brief Open (Frame)
+     * 
+     * Kuyruk ile başlığı ve veri bölümünü doğrular, veri
+     * bölümünün şifresini yerinde çözer. Doğrulama yapmayan
+     * algoritmalar için sadece şifre çözülür
+     * 
+     * @param Frame& Frame
+     * @param byte* Trailer
+     * @return bool
+     */
+    bool Algorithm::open(
+        const Frame& ar_frame,
+        const std::byte* ar_trailer
+    ) noexcept
+    {
+        (void)ar_trailer;
+        return this->decrypt(ar_frame);
+    }
+
+    /**
+     * @brief Clone
+     * 
+     * Aynı türde ve aynı ayarlarda fakat verilen anahtarı
+     * kullanan yeni bir algoritma oluşturur. Bağlantıya ait
+     * anahtar ile her bağlantının kendi şifreleyicisi olur.
+     * Kopyalanamayan algoritmalar boş döndürür, bu durumda
+     * ortak algoritma kullanılmaya devam edilir
+     * 
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<Algorithm> Algorithm::clone(
+        const std::string& ar_key
+    ) const
+    {
+        (void)ar_key;
+        return nullptr;
+    }
+
     /**
      * @brief Set Name
      * 
@@ -0,0 +1,324 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Cpu (İşlemci)
+ *
+ * Vektör çekirdekleri olan her yapının (xor, crc32c, aes,
+ * chacha20 vb.) işlemci özelliklerini kendisi sorgulaması
+ * yerine özellikler tek bir yerde, ilk kullanımda bir kez
+ * tespit edilir. Çekirdekler sürümlerini gerekli özellikler
+ * ile en iyiden başlayarak sıralı bir tablo (Variant) olarak
+ * verir, ilk çağrıda desteklenen en iyi sürüm seçilir.
+ *
+ * Karşılaştırma ve ölçüm için kullanılacak en yüksek seviye
+ * derleme bayrağı ile (__CPU_LEVEL_SCALAR__, __CPU_LEVEL_SSE2__,
+ * __CPU_LEVEL_SSSE3__, __CPU_LEVEL_SSE41__, __CPU_LEVEL_SSE42__,
+ * __CPU_LEVEL_AVX2__, __CPU_LEVEL_AVX512__) ya da KRIPTON_CPU_LEVEL
+ * ortam değişkeni ile (scalar, sse2, ssse3, sse41, sse42, avx2,
+ * avx512, native) sınırlandırılabilir. Ortam değişkeni derleme
+ * bayrağından önce gelir. AES-NI, PCLMUL ve SHA SSE4.2 seviyesi
+ * ile birlikte açılır
+ */
+
+// Define
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define __CPU_X86__ 1
+#else
+    #define __CPU_X86__ 0
+#endif
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+// Namespace
+namespace core::platform
+{
+    // Type Definition
+    using cpu_t = std::uint32_t;
+
+    // Cpu Feature
+    static inline constexpr cpu_t _CPU_NULL = { 0 << 0 };
+    static inline constexpr cpu_t _CPU_SSE2 = { 1 << 0 };
+    static inline constexpr cpu_t _CPU_SSSE3 = { 1 << 1 };
+    static inline constexpr cpu_t _CPU_SSE41 = { 1 << 2 };
+    static inline constexpr cpu_t _CPU_SSE42 = { 1 << 3 };
+    static inline constexpr cpu_t _CPU_AVX2 = { 1 << 4 };
+    static inline constexpr cpu_t _CPU_AVX512F = { 1 << 5 };
+    static inline constexpr cpu_t _CPU_AVX512BW = { 1 << 6 };
+    static inline constexpr cpu_t _CPU_AES = { 1 << 7 };
+    static inline constexpr cpu_t _CPU_PCLMUL = { 1 << 8 };
+    static inline constexpr cpu_t _CPU_SHA = { 1 << 9 };
+
+    // Enum
+    enum class CpuLevel : std::uint8_t {
+        Scalar = 0,
+        Sse2,
+        Ssse3,
+        Sse41,
+        Sse42,
+        Avx2,
+        Avx512,
+        Native
+    };
+
+    // String
+    constexpr const char* const ss_cpu_env = "KRIPTON_CPU_LEVEL";
+
+    constexpr const char* const ss_cpu_level_names[] = {
+        "scalar", "sse2", "ssse3", "sse41", "sse42", "avx2", "avx512", "native"
+    };
+
+    // Build Level
+    #if defined __CPU_LEVEL_SCALAR__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Scalar;
+    #elif defined __CPU_LEVEL_SSE2__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Sse2;
+    #elif defined __CPU_LEVEL_SSSE3__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Ssse3;
+    #elif defined __CPU_LEVEL_SSE41__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Sse41;
+    #elif defined __CPU_LEVEL_SSE42__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Sse42;
+    #elif defined __CPU_LEVEL_AVX2__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Avx2;
+    #elif defined __CPU_LEVEL_AVX512__
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Avx512;
+    #else
+        static constexpr CpuLevel cpu_build_level = CpuLevel::Native;
+    #endif
+
+    // Struct
+    template<class T>
+    struct Variant
+    {
+        cpu_t m_require { _CPU_NULL };
+        T m_value {};
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] constexpr cpu_t cpu_level_mask(const CpuLevel ar_level) noexcept;
+    [[maybe_unused]] [[nodiscard]] constexpr const char* cpu_level_name(const CpuLevel ar_level) noexcept;
+    [[maybe_unused]] [[nodiscard]] CpuLevel to_cpu_level(const char* ar_name, const CpuLevel ar_default = CpuLevel::Native) noexcept;
+
+    [[maybe_unused]] [[nodiscard]] cpu_t detect_cpu() noexcept;
+    [[maybe_unused]] [[nodiscard]] CpuLevel get_cpu_level() noexcept;
+    [[maybe_unused]] [[nodiscard]] cpu_t get_cpu() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool has_cpu(const cpu_t ar_require) noexcept;
+
+    /**
+     * @brief Cpu Level Mask
+     *
+     * Seviyede kullanılabilecek özellikleri döndürür. Her
+     * seviye bir öncekinin özelliklerini de içerir
+     *
+     * @param CpuLevel Level
+     * @return cpu_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    constexpr cpu_t cpu_level_mask(const CpuLevel ar_level) noexcept
+    {
+        switch( ar_level )
+        {
+            case CpuLevel::Scalar: return _CPU_NULL;
+            case CpuLevel::Sse2: return _CPU_SSE2;
+            case CpuLevel::Ssse3: return cpu_level_mask(CpuLevel::Sse2) | _CPU_SSSE3;
+            case CpuLevel::Sse41: return cpu_level_mask(CpuLevel::Ssse3) | _CPU_SSE41;
+            case CpuLevel::Sse42: return cpu_level_mask(CpuLevel::Sse41) | _CPU_SSE42 | _CPU_AES | _CPU_PCLMUL | _CPU_SHA;
+            case CpuLevel::Avx2: return cpu_level_mask(CpuLevel::Sse42) | _CPU_AVX2;
+            case CpuLevel::Avx512: return cpu_level_mask(CpuLevel::Avx2) | _CPU_AVX512F | _CPU_AVX512BW;
+            case CpuLevel::Native: return ~_CPU_NULL;
+        }
+
+        return _CPU_NULL;
+    }
+
+    /**
+     * @brief Cpu Level Name
+     *
+     * @param CpuLevel Level
+     * @return const char*
+     */
+    [[maybe_unused]] [[nodiscard]]
+    constexpr const char* cpu_level_name(const CpuLevel ar_level) noexcept
+    {
+        const std::size_t tm_index = static_cast<std::size_t>(ar_level);
+        return tm_index < sizeof(ss_cpu_level_names) / sizeof(ss_cpu_level_names[0]) ? ss_cpu_level_names[tm_index] : "unknown";
+    }
+
+    /**
+     * @brief To Cpu Level
+     *
+     * Seviye adını seviyeye çevirir. Ad boş ya da
+     * tanınmıyorsa verilen varsayılan seviye döner
+     *
+     * @param char* Name
+     * @param CpuLevel Default
+     * @return CpuLevel
+     */
+    [[maybe_unused]] [[nodiscard]]
+    CpuLevel to_cpu_level(
+        const char* ar_name,
+        const CpuLevel ar_default
+    ) noexcept
+    {
+        if( ar_name == nullptr || *ar_name == '\0' )
+            return ar_default;
+
+        for(std::size_t tm_count = 0; tm_count < sizeof(ss_cpu_level_names) / sizeof(ss_cpu_level_names[0]); ++tm_count)
+            if( std::strcmp(ar_name, ss_cpu_level_names[tm_count]) == 0 )
+                return static_cast<CpuLevel>(tm_count);
+
+        return ar_default;
+    }
+
+    /**
+     * @brief Detect Cpu
+     *
+     * İşlemcinin ve işletim sisteminin desteklediği özellikleri
+     * seviye sınırı uygulamadan sorgular. x86 dışındaki
+     * sistemlerde hiçbir özellik yoktur
+     *
+     * @return cpu_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    cpu_t detect_cpu() noexcept
+    {
+        cpu_t tm_cpu = _CPU_NULL;
+
+        #if __CPU_X86__
+            __builtin_cpu_init();
+
+            if( __builtin_cpu_supports("sse2") ) tm_cpu |= _CPU_SSE2;
+            if( __builtin_cpu_supports("ssse3") ) tm_cpu |= _CPU_SSSE3;
+            if( __builtin_cpu_supports("sse4.1") ) tm_cpu |= _CPU_SSE41;
+            if( __builtin_cpu_supports("sse4.2") ) tm_cpu |= _CPU_SSE42;
+            if( __builtin_cpu_supports("avx2") ) tm_cpu |= _CPU_AVX2;
+            if( __builtin_cpu_supports("avx512f") ) tm_cpu |= _CPU_AVX512F;
+            if( __builtin_cpu_supports("avx512bw") ) tm_cpu |= _CPU_AVX512BW;
+            if( __builtin_cpu_supports("aes") ) tm_cpu |= _CPU_AES;
+            if( __builtin_cpu_supports("pclmul") ) tm_cpu |= _CPU_PCLMUL;
+            if( __builtin_cpu_supports("sha") ) tm_cpu |= _CPU_SHA;
+        #endif
+
+        return tm_cpu;
+    }
+
+    /**
+     * @brief Get Cpu Level
+     *
+     * Kullanılacak en yüksek seviyeyi döndürür. Ortam değişkeni
+     * varsa o, yoksa derleme bayrağı geçerlidir. Bir kez okunur
+     *
+     * @return CpuLevel
+     */
+    [[maybe_unused]] [[nodiscard]]
+    CpuLevel get_cpu_level() noexcept
+    {
+        static const CpuLevel ss_level = to_cpu_level(std::getenv(ss_cpu_env), cpu_build_level);
+        return ss_level;
+    }
+
+    /**
+     * @brief Get Cpu
+     *
+     * Seviye sınırı uygulanmış, çekirdeklerin kullanabileceği
+     * özellikleri döndürür. İlk çağrıda bir kez hesaplanır
+     *
+     * @return cpu_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    cpu_t get_cpu() noexcept
+    {
+        static const cpu_t ss_cpu = detect_cpu() & cpu_level_mask(get_cpu_level());
+        return ss_cpu;
+    }
+
+    /**
+     * @brief Has Cpu
+     *
+     * Verilen özelliklerin hepsi kullanılabiliyorsa true döner
+     *
+     * @param cpu_t Require
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool has_cpu(const cpu_t ar_require) noexcept
+    {
+        return (get_cpu() & ar_require) == ar_require;
+    }
+
+    /**
+     * @brief Select Variant
+     *
+     * En iyiden başlayarak sıralı tablodan verilen özellikler
+     * ile çalışabilen ilk sürümü döndürür. Tablonun son
+     * sürümü özellik gerektirmeyen yedek yol olmalıdır
+     *
+     * @tparam T Value
+     * @param Variant<T>[N] Variants
+     * @param cpu_t Cpu
+     * @return T
+     */
+    template<class T, std::size_t N>
+    [[maybe_unused]] [[nodiscard]]
+    constexpr T select_variant(
+        const Variant<T> (&ar_variants)[N],
+        const cpu_t ar_cpu
+    ) noexcept
+    {
+        for(const Variant<T>& tm_variant : ar_variants)
+            if( (ar_cpu & tm_variant.m_require) == tm_variant.m_require )
+                return tm_variant.m_value;
+
+        return ar_variants[N - 1].m_value;
+    }
+
+    /**
+     * @brief Bind Variant
+     *
+     * Tablodan bu işlemcide kullanılabilen en iyi sürümü
+     * döndürür. Sonuç çağıran tarafta bir kez saklanmalıdır
+     *
+     * @tparam T Value
+     * @param Variant<T>[N] Variants
+     * @return T
+     */
+    template<class T, std::size_t N>
+    [[maybe_unused]] [[nodiscard]]
+    T bind_variant(
+        const Variant<T> (&ar_variants)[N]
+    ) noexcept
+    {
+        return select_variant(ar_variants, get_cpu());
+    }
+
+    /**
+     * @brief Has Variant
+     *
+     * Tablodaki sürümün bu işlemcide kullanılıp
+     * kullanılamayacağını döndürür. Tabloda olmayan sürüm
+     * için false döner
+     *
+     * @tparam T Value
+     * @param Variant<T>[N] Variants
+     * @param T Value
+     * @return bool
+     */
+    template<class T, std::size_t N>
+    [[maybe_unused]] [[nodiscard]]
+    bool has_variant(
+        const Variant<T> (&ar_variants)[N],
+        const T& ar_value
+    ) noexcept
+    {
+        for(const Variant<T>& tm_variant : ar_variants)
+            if( tm_variant.m_value == ar_value )
+                return has_cpu(tm_variant.m_require);
+
+        return false;
+    }
+}
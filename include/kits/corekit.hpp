@@ -4,6 +4,7 @@
 // Include
 #include <core/buildtype.hpp>
 #include <core/platform.hpp>
+#include <core/cpu.hpp>
 #include <core/flag.hpp>
 #include <core/status.hpp>
 #include <core/version.hpp>
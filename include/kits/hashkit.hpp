@@ -9,4 +9,8 @@
  */
 
 // Include
-#include <tools/hash/vch.hpp>
\ No newline at end of file
+#include <tools/hash/vch.hpp>
+#include <tools/hash/crc32c.hpp>
+#include <tools/hash/sha256.hpp>
+#include <tools/hash/fasthash.hpp>
+#include <tools/hash/blake3.hpp>
\ No newline at end of file
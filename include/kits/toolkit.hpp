@@ -4,4 +4,5 @@
 #include <tools/time/time.hpp>
 #include <tools/console/console.hpp>
 #include <tools/console/color.hpp>
-#include <tools/charset/utf.hpp>
\ No newline at end of file
+#include <tools/charset/utf.hpp>
+#include <tools/compress/lz.hpp>
\ No newline at end of file
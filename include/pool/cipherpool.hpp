@@ -5,12 +5,27 @@
  * Cipher Pool (Şifre Havuzu)
  * 
  * Şifreleme yöntemlerini tek bir dosyada tutmayı
- * sağlıyoruz bu sayede karmaşıklık daha az oluyor
+ * sağlıyoruz bu sayede karmaşıklık daha az oluyor.
+ * El sıkışmada anlaşılabilen yöntemler birer bit ile
+ * gösterilir (suite), iki tarafın da sunduğu yöntemlerden
+ * işlemcilerde en hızlı çalışanı seçilir
+ *
+ * Sadece çerçeve başına nonce üreten yöntemler anlaşılabilir;
+ * aynı anahtar ile her çerçevede aynı anahtar akışını veren
+ * Xor havuzda değildir. Doğrulamasız akış yöntemleri (ChaCha20,
+ * AES-CTR) ortakta doğrulamalı yöntem yoksa seçilir
  */
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
 #include <core/algorithm.hpp>
 
 #include <cipher/xor/xor.hpp>
+#include <cipher/chacha20/chacha20.hpp>
+#include <cipher/chacha20/chacha20poly1305.hpp>
+#include <cipher/aes/aes.hpp>
 
 // Namespace
 namespace pool::cipherpool
@@ -18,4 +33,160 @@ namespace pool::cipherpool
     // Using Namespace
     using namespace core::algorithm;
     using namespace cipher::stream;
+    using namespace cipher::block;
+
+    // Using
+    using suite_t = uint8_t;
+
+    // Suite
+    static inline constexpr suite_t _SUITE_NULL = { 0 << 0 };
+    // 1 << 0 RESERVED, XOR HAS NO PER FRAME NONCE AND IS NEVER NEGOTIATED
+    static inline constexpr suite_t _SUITE_CHACHA20 = { 1 << 1 };
+    static inline constexpr suite_t _SUITE_CHACHA20_POLY1305 = { 1 << 2 };
+    static inline constexpr suite_t _SUITE_AES_CTR = { 1 << 3 };
+    static inline constexpr suite_t _SUITE_AES_GCM = { 1 << 4 };
+
+    static inline constexpr suite_t _SUITE_AEAD = _SUITE_CHACHA20_POLY1305 | _SUITE_AES_GCM;
+    static inline constexpr suite_t _SUITE_ALL = _SUITE_CHACHA20 | _SUITE_AEAD | _SUITE_AES_CTR;
+
+    // Limit
+    static inline constexpr std::size_t _SIZE_SUITE_KEY = 32; // byte
+
+    // Rank
+    static inline constexpr suite_t ss_rank_accel[] = { _SUITE_AES_GCM, _SUITE_CHACHA20_POLY1305, _SUITE_AES_CTR, _SUITE_CHACHA20 };
+    static inline constexpr suite_t ss_rank_soft[] = { _SUITE_CHACHA20_POLY1305, _SUITE_AES_GCM, _SUITE_CHACHA20, _SUITE_AES_CTR };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] suite_t suite_of(const Algorithm& ar_cipher) noexcept;
+    [[maybe_unused]] [[nodiscard]] suite_t get_accel() noexcept;
+    [[maybe_unused]] [[nodiscard]] suite_t pick_suite(suite_t ar_common, const suite_t ar_accel) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::unique_ptr<Algorithm> make_suite(const suite_t ar_suite, const std::string& ar_name, const std::string& ar_key);
+
+    /**
+     * @brief Suite Of
+     * 
+     * Şifreleyicinin hangi yönteme ait olduğunu döndürür.
+     * Havuzda olmayan bir şifreleyici için boş döner
+     * 
+     * @param Algorithm& Cipher
+     * @return suite_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    suite_t suite_of(
+        const Algorithm& ar_cipher
+    ) noexcept
+    {
+        if( dynamic_cast<const AesGcm*>(&ar_cipher) )
+            return _SUITE_AES_GCM;
+
+        if( dynamic_cast<const ChaCha20Poly1305*>(&ar_cipher) )
+            return _SUITE_CHACHA20_POLY1305;
+
+        if( dynamic_cast<const AesCtr*>(&ar_cipher) )
+            return _SUITE_AES_CTR;
+
+        if( dynamic_cast<const ChaCha20*>(&ar_cipher) )
+            return _SUITE_CHACHA20;
+
+        return _SUITE_NULL;
+    }
+
+    /**
+     * @brief Get Accel
+     * 
+     * Bu işlemcide donanım çekirdeği ile çalışan yöntemleri
+     * döndürür. AES için AES-NI, GCM için ayrıca PCLMULQDQ,
+     * ChaCha20 için SIMD çekirdeği gerekir. Sonuç bir kez
+     * hesaplanır
+     * 
+     * @return suite_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    suite_t get_accel() noexcept
+    {
+        static const suite_t ss_accel = []() noexcept
+        {
+            suite_t tm_accel = _SUITE_NULL;
+
+            if( chachakernel::get_kernel() != chachakernel::kernel_t::scalar )
+                tm_accel |= _SUITE_CHACHA20 | _SUITE_CHACHA20_POLY1305;
+
+            if( aeskernel::get_kernel() == aeskernel::kernel_t::aesni )
+            {
+                tm_accel |= _SUITE_AES_CTR;
+
+                if( ghashkernel::get_kernel() == ghashkernel::kernel_t::pclmul )
+                    tm_accel |= _SUITE_AES_GCM;
+            }
+
+            return tm_accel;
+        }();
+
+        return ss_accel;
+    }
+
+    /**
+     * @brief Pick Suite
+     * 
+     * İki tarafın ortak sunduğu yöntemlerden birini seçer.
+     * Ortakta doğrulamalı (AEAD) yöntem varsa sadece onlara
+     * bakılır. Önce iki işlemcide de donanım ile çalışan
+     * yöntemlere, yoksa yazılımda en hızlı olana bakılır.
+     * Girdiler iki tarafta da aynı olduğundan iki taraf da
+     * aynı yöntemi seçer
+     * 
+     * @param suite_t Common
+     * @param suite_t Accel (Both Sides)
+     * @return suite_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    suite_t pick_suite(
+        suite_t ar_common,
+        const suite_t ar_accel
+    ) noexcept
+    {
+        // INTEGRITY IS NEVER TRADED FOR SPEED
+        if( ar_common & _SUITE_AEAD )
+            ar_common &= _SUITE_AEAD;
+
+        for(const suite_t tm_suite : ss_rank_accel)
+            if( ar_common & ar_accel & tm_suite )
+                return tm_suite;
+
+        for(const suite_t tm_suite : ss_rank_soft)
+            if( ar_common & tm_suite )
+                return tm_suite;
+
+        return _SUITE_NULL;
+    }
+
+    /**
+     * @brief Make Suite
+     * 
+     * Verilen yöntem için isim ve anahtar ile yeni şifreleyici
+     * oluşturur. Anahtar yöntemin beklediği uzunlukta olmalıdır,
+     * bilinmeyen yöntem için boş döner
+     * 
+     * @param suite_t Suite
+     * @param string& Name
+     * @param string& Key
+     * @return unique_ptr<Algorithm>
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::unique_ptr<Algorithm> make_suite(
+        const suite_t ar_suite,
+        const std::string& ar_name,
+        const std::string& ar_key
+    )
+    {
+        switch( ar_suite )
+        {
+            case _SUITE_CHACHA20: return std::make_unique<ChaCha20>(ar_name, ar_key);
+            case _SUITE_CHACHA20_POLY1305: return std::make_unique<ChaCha20Poly1305>(ar_name, ar_key);
+            case _SUITE_AES_CTR: return std::make_unique<AesCtr>(ar_name, ar_key);
+            case _SUITE_AES_GCM: return std::make_unique<AesGcm>(ar_name, ar_key);
+        }
+
+        return nullptr;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,304 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Parallel Pool (Paralel Şifreleme Havuzu)
+ *
+ * Sayaç kipindeki şifreleyicilerde (ChaCha20, AES-CTR) her
+ * blok sadece kendi sayaç değerine bağlıdır. Bu sayede büyük
+ * bir tampon parçalara bölünüp her parça kendi blok konumu
+ * ile ayrı bir iş parçacığında şifrelenebilir ve sonuç tek
+ * geçişte şifrelemek ile aynı olur
+ *
+ * Eşik değerinin altındaki tamponlar çağıran iş parçacığında
+ * şifrelenir. Üstündekiler parçalara bölünür, ThreadPool
+ * çalışanları ve çağıran iş parçacığı sıradaki parçayı
+ * atomik sayaç ile alarak işler. Çağıran taraf tüm parçalar
+ * bitene kadar bekler. Havuz durmuş ya da meşgul olsa bile
+ * çağıran iş parçacığı kalan parçaları kendisi bitirdiği için
+ * kilitlenme olmaz
+ *
+ * Şifreleyicinin _SIZE_BLOCK sabiti ve blok konumu alan
+ * apply(data, len, block) const fonksiyonu olmalıdır
+ *
+ * Aynı iş dağıtımı (for_each) ağaç yapılı özetlerde de
+ * kullanılır; büyük bir girdinin tam alt ağaçları parçalara
+ * bölünüp her parçanın zincir değeri ayrı iş parçacığında
+ * hesaplanır (hash)
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include <pool/threadpool.hpp>
+
+// Namespace
+namespace pool::parallelpool
+{
+    // Using Namespace
+    using namespace pool::threadpool;
+
+    // Limit
+    static constexpr std::size_t _MIN_LEN_PARALLEL = 256 * 1024; // byte
+    static constexpr std::size_t _MIN_SIZE_CHUNK = 64 * 1024; // byte
+    static constexpr std::size_t _SIZE_ALIGN = 4 * 1024; // byte
+    static constexpr std::size_t _DEF_CHUNK_PER_THREAD = 4;
+
+    // Struct
+    struct TaskState
+    {
+        std::size_t m_count { 0 };
+        std::atomic<std::size_t> m_next { 0 };
+
+        void* m_task { nullptr };
+        void (*m_call)(void*, std::size_t) noexcept { nullptr };
+
+        TaskGroup m_group;
+    };
+
+    /**
+     * @brief Chunk Size
+     *
+     * Parça boyutunu hesaplar. Her iş parçacığına birkaç parça
+     * düşecek kadar küçük bölünür ki erken biten iş parçacığı
+     * diğerlerinin yükünü alabilsin. Parça en az _MIN_SIZE_CHUNK
+     * olur ve _SIZE_ALIGN katına yuvarlanır; böylece her blok
+     * boyutunun (16, 64) tam katıdır
+     *
+     * @param size_t Length
+     * @param size_t Thread Count
+     * @return size_t
+     */
+    static inline std::size_t chunk_size(
+        const std::size_t ar_len,
+        const std::size_t ar_thread_count
+    ) noexcept
+    {
+        const std::size_t tm_parts = (ar_thread_count + 1) * _DEF_CHUNK_PER_THREAD;
+        const std::size_t tm_chunk = std::max(_MIN_SIZE_CHUNK, (ar_len + tm_parts - 1) / tm_parts);
+        return (tm_chunk + _SIZE_ALIGN - 1) & ~(_SIZE_ALIGN - 1);
+    }
+
+    /**
+     * @brief Run Tasks
+     *
+     * Sıradaki işi alıp çalıştırır, iş kalmayınca çıkar. Her iş
+     * kümeden düşülür, son işi bitiren bekleyeni uyandırır. İş
+     * alınamayan durumda
+     * işin kendisine dokunulmaz
+     *
+     * @param TaskState& State
+     */
+    static inline void run_tasks(
+        TaskState& ar_state
+    ) noexcept
+    {
+        while( true )
+        {
+            const std::size_t tm_index = ar_state.m_next.fetch_add(1, std::memory_order_relaxed);
+            if( tm_index >= ar_state.m_count )
+                return;
+
+            ar_state.m_call(ar_state.m_task, tm_index);
+            ar_state.m_group.done();
+        }
+    }
+
+    /**
+     * @brief For Each
+     *
+     * 0 ile verilen sayı arasındaki her sıra için işi çalıştırır.
+     * ThreadPool çalışanları ve çağıran iş parçacığı sıradaki
+     * işi atomik sayaç ile alır, hepsi bitince döner. Yardımcı
+     * görevler tek seferde eklenir, bitiş TaskGroup ile beklenir. Havuz
+     * durmuşsa ya da bellek ayrılamazsa işler çağıran iş
+     * parçacığında sıra ile çalışır
+     *
+     * Geç başlayan havuz görevleri iş bulamadan çıkar ve
+     * paylaşılan durum son görev ile birlikte silinir; işe
+     * fonksiyon döndükten sonra dokunulmaz
+     *
+     * @tparam Func Function
+     * @param ThreadPool& Pool
+     * @param size_t Count
+     * @param Func& Function
+     */
+    template<class Func>
+    [[maybe_unused]]
+    void for_each(
+        ThreadPool& ar_pool,
+        const std::size_t ar_count,
+        Func& ar_func
+    ) noexcept
+    {
+        auto tm_serial = [&ar_func, ar_count]() noexcept {
+            for(std::size_t tm_index = 0; tm_index < ar_count; ++tm_index)
+                ar_func(tm_index);
+        };
+
+        if( ar_count < 2 || !ar_pool.is_running() )
+            return tm_serial();
+
+        std::shared_ptr<TaskState> tm_state;
+        try {
+            tm_state = std::make_shared<TaskState>();
+        } catch(...) {
+            return tm_serial();
+        }
+
+        tm_state->m_count = ar_count;
+        tm_state->m_group.add(ar_count);
+        tm_state->m_task = static_cast<void*>(std::addressof(ar_func));
+        tm_state->m_call = [](void* ar_task, const std::size_t ar_index) noexcept {
+            (*static_cast<Func*>(ar_task))(ar_index);
+        };
+
+        // WAKE AT MOST ONE WORKER PER REMAINING TASK
+        const std::size_t tm_helpers = std::min(ar_pool.get_thread_count(), ar_count - 1);
+        ar_pool.enqueue_bulk(tm_helpers, [tm_state](std::size_t) {
+            run_tasks(*tm_state);
+        });
+
+        // CALLER WORKS TOO, THEN JOINS
+        run_tasks(*tm_state);
+
+        try {
+            tm_state->m_group.wait();
+        } catch(...) {}
+    }
+
+    /**
+     * @brief Apply
+     *
+     * Tamponu eşik değerinin üstündeyse parçalara bölüp havuz
+     * ile birlikte, değilse çağıran iş parçacığında şifreler.
+     * Tüm parçalar bitince döner. Sayaç kipinde şifreleme ve
+     * şifre çözme aynı işlem olduğundan ikisi için de kullanılır
+     *
+     * @tparam Cipher Cipher
+     * @param ThreadPool& Pool
+     * @param Cipher& Cipher
+     * @param unsigned char* Data
+     * @param size_t Length
+     * @return bool
+     */
+    template<class Cipher>
+    [[maybe_unused]]
+    bool apply(
+        ThreadPool& ar_pool,
+        const Cipher& ar_cipher,
+        unsigned char* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        const std::size_t tm_threads = ar_pool.get_thread_count();
+
+        if( ar_cipher.has_error() )
+            return false;
+
+        if( ar_len < _MIN_LEN_PARALLEL || !ar_pool.is_running() )
+            return ar_cipher.apply(ar_data, ar_len, 0);
+
+        const std::size_t tm_chunk = chunk_size(ar_len, tm_threads);
+        const std::size_t tm_count = (ar_len + tm_chunk - 1) / tm_chunk;
+        std::atomic<bool> tm_ok { true };
+
+        auto tm_task = [&ar_cipher, &tm_ok, ar_data, ar_len, tm_chunk](const std::size_t ar_index) noexcept
+        {
+            const std::size_t tm_offset = ar_index * tm_chunk;
+            const std::size_t tm_len = std::min(tm_chunk, ar_len - tm_offset);
+
+            if( !ar_cipher.apply(ar_data + tm_offset, tm_len, tm_offset / Cipher::_SIZE_BLOCK) )
+                tm_ok.store(false, std::memory_order_relaxed);
+        };
+
+        for_each(ar_pool, tm_count, tm_task);
+        return tm_ok.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Encrypt
+     *
+     * @tparam Cipher Cipher
+     * @param ThreadPool& Pool
+     * @param Cipher& Cipher
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    template<class Cipher>
+    [[maybe_unused]]
+    bool encrypt(
+        ThreadPool& ar_pool,
+        const Cipher& ar_cipher,
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return apply(ar_pool, ar_cipher, reinterpret_cast<unsigned char*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Decrypt
+     *
+     * Sayaç kipinde şifre çözme şifreleme ile aynı işlemdir
+     *
+     * @tparam Cipher Cipher
+     * @param ThreadPool& Pool
+     * @param Cipher& Cipher
+     * @param byte* Data
+     * @param size_t Length
+     * @return bool
+     */
+    template<class Cipher>
+    [[maybe_unused]]
+    bool decrypt(
+        ThreadPool& ar_pool,
+        const Cipher& ar_cipher,
+        std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return apply(ar_pool, ar_cipher, reinterpret_cast<unsigned char*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Hash
+     *
+     * Veriyi ağaç yapılı özete ekler. Eşik değerinin üstündeki
+     * girdilerde tam alt ağaçlar iş parçacığı başına birkaç
+     * bölüm düşecek şekilde bölünür ve zincir değerleri havuz
+     * ile birlikte hesaplanır. Sonuç tek iş parçacığında
+     * eklemek ile aynıdır
+     *
+     * Özetin update(data, len) ve bölüm sayısı ile çalıştırıcı
+     * alan update(data, len, parts, run) fonksiyonları olmalıdır
+     *
+     * @tparam Hasher Hasher
+     * @param ThreadPool& Pool
+     * @param Hasher& Hasher
+     * @param void* Data
+     * @param size_t Length
+     */
+    template<class Hasher>
+    [[maybe_unused]]
+    void hash(
+        ThreadPool& ar_pool,
+        Hasher& ar_hasher,
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_len < _MIN_LEN_PARALLEL || !ar_pool.is_running() )
+            return ar_hasher.update(ar_data, ar_len);
+
+        const std::size_t tm_parts = (ar_pool.get_thread_count() + 1) * _DEF_CHUNK_PER_THREAD;
+        ar_hasher.update(ar_data, ar_len, tm_parts, [&ar_pool](const std::size_t ar_count, auto& ar_task) noexcept {
+            for_each(ar_pool, ar_count, ar_task);
+        });
+    }
+}
@@ -0,0 +1,278 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Task (Görev)
+ *
+ * ThreadPool görevleri için sadece taşınabilen (move-only)
+ * çağrılabilir nesne. std::function birkaç işaretçiden büyük
+ * yakalamalarda her görev için bellek ayırır ve kopyalanabilir
+ * olmayan yakalamaları (unique_ptr gibi) tutamaz
+ *
+ * Task, _SIZE_TASK_INLINE bayta kadar olan ve taşınırken hata
+ * fırlatmayan çağrılabilir nesneleri kendi içinde (small buffer)
+ * tutar; bağlantı soketi ve ip metni yakalayan sunucu görevi
+ * gibi tipik görevler bellek ayırmadan oluşturulur ve taşınır.
+ * Daha büyük nesneler tek bir bellek ayırma ile dışarıda tutulur
+ */
+
+// Include
+#include <new>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+// Namespace
+namespace pool::task
+{
+    // Limit
+    static constexpr std::size_t _SIZE_TASK = 128; // byte
+    static constexpr std::size_t _SIZE_TASK_ALIGN = alignof(std::max_align_t); // byte
+    static constexpr std::size_t _SIZE_TASK_INLINE = _SIZE_TASK - _SIZE_TASK_ALIGN; // byte
+
+    // Struct
+    struct TaskOps
+    {
+        void (*m_invoke)(void*);
+        void (*m_move)(void*, void*) noexcept;
+        void (*m_destroy)(void*) noexcept;
+        bool m_inline;
+    };
+
+    // Class
+    class Task final
+    {
+        private:
+            template<class Func>
+            static constexpr bool is_inline_v = sizeof(Func) <= _SIZE_TASK_INLINE
+                && alignof(Func) <= _SIZE_TASK_ALIGN
+                && std::is_nothrow_move_constructible_v<Func>;
+
+            template<class Func>
+            static const TaskOps s_inline_ops;
+
+            template<class Func>
+            static const TaskOps s_heap_ops;
+
+        private:
+            alignas(_SIZE_TASK_ALIGN) unsigned char m_storage[_SIZE_TASK_INLINE];
+            const TaskOps* m_ops { nullptr };
+
+        public:
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            Task() noexcept = default;
+            Task(std::nullptr_t) noexcept;
+            Task(Task&& ar_task) noexcept;
+
+            template<class Func, class = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, Task> && std::is_invocable_v<std::decay_t<Func>&>>>
+            Task(Func&& ar_func);
+
+            ~Task();
+
+            Task& operator=(Task&& ar_task) noexcept;
+            Task& operator=(std::nullptr_t) noexcept;
+
+            [[nodiscard]] inline explicit operator bool() const noexcept;
+            [[nodiscard]] inline bool is_inline() const noexcept;
+
+            void operator()();
+
+        private:
+            void reset() noexcept;
+    };
+
+    // Static Assert
+    static_assert(sizeof(Task) == _SIZE_TASK, "Task must stay two cache lines");
+
+    /**
+     * @brief Inline Ops
+     *
+     * Nesne görevin kendi alanında tutulur, taşıma nesnenin
+     * kendi taşıma kurucusu ile yapılır
+     *
+     * @tparam Func Function
+     */
+    template<class Func>
+    const TaskOps Task::s_inline_ops =
+    {
+        [](void* ar_storage) { (*std::launder(static_cast<Func*>(ar_storage)))(); },
+        [](void* ar_dst, void* ar_src) noexcept {
+            Func* tm_src = std::launder(static_cast<Func*>(ar_src));
+            ::new (ar_dst) Func(std::move(*tm_src));
+            tm_src->~Func();
+        },
+        [](void* ar_storage) noexcept { std::launder(static_cast<Func*>(ar_storage))->~Func(); },
+        true
+    };
+
+    /**
+     * @brief Heap Ops
+     *
+     * Nesne dışarıda tutulur, alanda sadece işaretçisi bulunur.
+     * Taşıma işaretçinin kopyalanmasıdır
+     *
+     * @tparam Func Function
+     */
+    template<class Func>
+    const TaskOps Task::s_heap_ops =
+    {
+        [](void* ar_storage) { (**static_cast<Func**>(ar_storage))(); },
+        [](void* ar_dst, void* ar_src) noexcept { *static_cast<Func**>(ar_dst) = *static_cast<Func**>(ar_src); },
+        [](void* ar_storage) noexcept { delete *static_cast<Func**>(ar_storage); },
+        false
+    };
+
+    /**
+     * @brief Task
+     *
+     * Boş görev
+     */
+    Task::Task(std::nullptr_t) noexcept
+    {}
+
+    /**
+     * @brief Task
+     *
+     * Diğer görevin nesnesini bu göreve taşır, diğer görev
+     * boş kalır
+     *
+     * @param Task&& Task
+     */
+    Task::Task(Task&& ar_task) noexcept
+        : m_ops(ar_task.m_ops)
+    {
+        if( this->m_ops )
+        {
+            this->m_ops->m_move(this->m_storage, ar_task.m_storage);
+            ar_task.m_ops = nullptr;
+        }
+    }
+
+    /**
+     * @brief Task
+     *
+     * Çağrılabilir nesneyi sığıyorsa görevin alanına, sığmıyorsa
+     * ya da taşınırken hata fırlatabiliyorsa belleğe yerleştirir
+     *
+     * @tparam Func Function
+     * @param Func&& Function
+     */
+    template<class Func, class>
+    Task::Task(Func&& ar_func)
+    {
+        using func_t = std::decay_t<Func>;
+
+        if constexpr( is_inline_v<func_t> )
+        {
+            ::new (static_cast<void*>(this->m_storage)) func_t(std::forward<Func>(ar_func));
+            this->m_ops = &s_inline_ops<func_t>;
+        }
+        else
+        {
+            ::new (static_cast<void*>(this->m_storage)) func_t*(new func_t(std::forward<Func>(ar_func)));
+            this->m_ops = &s_heap_ops<func_t>;
+        }
+    }
+
+    /**
+     * @brief ~Task
+     */
+    Task::~Task()
+    {
+        this->reset();
+    }
+
+    /**
+     * @brief Operator =
+     *
+     * @param Task&& Task
+     * @return Task&
+     */
+    Task& Task::operator=(Task&& ar_task) noexcept
+    {
+        if( this == &ar_task )
+            return *this;
+
+        this->reset();
+        if( ar_task.m_ops )
+        {
+            ar_task.m_ops->m_move(this->m_storage, ar_task.m_storage);
+            this->m_ops = ar_task.m_ops;
+            ar_task.m_ops = nullptr;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Operator =
+     *
+     * Görevi boşaltır, tutulan nesne silinir
+     *
+     * @return Task&
+     */
+    Task& Task::operator=(std::nullptr_t) noexcept
+    {
+        this->reset();
+        return *this;
+    }
+
+    /**
+     * @brief Operator Bool
+     *
+     * Görevin bir nesne tutup tutmadığını döndürür
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    Task::operator bool() const noexcept
+    {
+        return this->m_ops != nullptr;
+    }
+
+    /**
+     * @brief Is Inline
+     *
+     * Nesnenin bellek ayırmadan görevin kendi alanında tutulup
+     * tutulmadığını döndürür
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    bool Task::is_inline() const noexcept
+    {
+        return this->m_ops != nullptr && this->m_ops->m_inline;
+    }
+
+    /**
+     * @brief Operator ()
+     *
+     * Görevi çalıştırır. Nesnenin fırlattığı hata çağırana geçer,
+     * boş (ya da taşınmış) görevde std::bad_function_call fırlatır
+     */
+    void Task::operator()()
+    {
+        if( !this->m_ops )
+            throw std::bad_function_call();
+
+        this->m_ops->m_invoke(this->m_storage);
+    }
+
+    /**
+     * @brief Reset
+     *
+     * Tutulan nesneyi siler ve görevi boşaltır
+     */
+    void Task::reset() noexcept
+    {
+        if( this->m_ops )
+        {
+            this->m_ops->m_destroy(this->m_storage);
+            this->m_ops = nullptr;
+        }
+    }
+}
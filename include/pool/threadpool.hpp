@@ -9,19 +9,73 @@
  * 
  * Bu yapı, her görev için yeni thread oluşturmanın maliyetini ortadan kaldırır,
  * CPU çekirdeklerinin dengeli kullanımını sağlar ve kaynak tüketimini azaltır.
+ * 
+ * Görevler tek bir kilitli kuyruk yerine iş çalma (work-stealing)
+ * ile dağıtılır. Her çalışanın kendine ait kilitsiz bir kuyruğu
+ * (Chase-Lev deque) vardır; çalışan kendi eklediği görevleri
+ * kuyruğun arkasından son giren ilk çıkar (LIFO) sırası ile alır,
+ * işi biten çalışan rastgele seçtiği başka bir çalışanın kuyruğunun
+ * önünden görev çalar. Havuz dışından eklenen görevler çalışanlara
+ * sıra ile dağıtılan kilitli gelen kutularına (inbox) yazılır, böylece
+ * üreticiler tek bir kilitte toplanmaz
+ * 
+ * İş bulamayan çalışan kısa bir süre aradıktan sonra kendi koşul
+ * değişkeninde uyur (park). Yeni görev eklendiğinde bekleyen
+ * çalışanlardan sadece biri uyandırılır
+ * 
+ * Görevler sadece taşınabilen Task nesnesi olarak tutulur. Gelen
+ * kutuları dairesel tampon, kuyruk düğümleri çalışan başına
+ * önbellek kullandığı için ısınmadan sonra tipik bir görevin
+ * eklenmesi bellek ayırmaz
+ * 
+ * submit ile sonucu bekleyen hafif bir Future döner, enqueue_bulk
+ * ile N görev çalışan başına tek kilitte eklenir ve uyuyan
+ * çalışanlar birlikte uyandırılır. TaskGroup görev kümesinin
+ * bitmesini bekler. Havuzun çalışanı bir sonucu ya da kümeyi
+ * beklerken boş durmaz, bekleyen görevleri çalıştırır; böylece
+ * kendi eklediği görevi bekleyen çalışan kilitlenmez
+ * 
+ * Görevler eklenirken bir şeride (lane) işaretlenir. Her şeridin
+ * çalışan başına kendi kuyruğu ve gelen kutusu vardır; el sıkışma
+ * ve yetki yanıtları gibi gecikmeye duyarlı görevler Control,
+ * geçmiş aktarımı ve büyük yayınlar gibi toplu işler Bulk
+ * şeridine eklenir. Katı (Strict) kipte çalışan her seçimde
+ * önce üst şeride bakar, alt şeridin aç kalmaması için her
+ * _DEF_LANE_STARVE seçimde bir kez alttan başlar. Ağırlıklı
+ * (Weighted) kipte şeritler ağırlıkları oranında seçilir.
+ * Şerit başına kuyruk derinliği ve çalışan görev sayısı
+ * get_lane_stats ile okunur
+ * 
+ * Havuz esnektir (elastic); en az ve en çok çalışan sayısı ile
+ * kurulur ve kurulurken iş parçacığı başlatmaz. İlk görev
+ * eklendiğinde en az sayıda çalışan başlatılır. Uyuyan çalışan
+ * bulamayan görev için tüm çalışanlar meşgulse hemen, iş arayan
+ * çalışan varsa görevler kuyrukta _DEF_GROW_WAIT süresinden uzun
+ * beklediğinde bir çalışan daha eklenir. _DEF_IDLE_TIME boyunca
+ * iş bulamayan çalışan en az sayının üstündeyse sonlanır
  */
 
 // Include
 #include <vector>
-#include <queue>
+#include <memory>
 #include <thread>
-#include <functional>
+#include <future>
+#include <chrono>
+#include <optional>
+#include <exception>
+#include <type_traits>
 #include <condition_variable>
 #include <mutex>
+#include <array>
 #include <atomic>
+#include <algorithm>
+
+#include <cstdint>
+#include <cstddef>
 
 #include <dev/developer.hpp>
 #include <core/crash.hpp>
+#include <pool/task.hpp>
 
 // Namespace
 namespace pool::threadpool
@@ -29,34 +83,351 @@ namespace pool::threadpool
     // Using Namespace
     using namespace core::crash;
 
+    // Limit
+    static constexpr std::size_t _SIZE_CACHE_LINE = 64; // byte
+    static constexpr std::size_t _DEF_SIZE_DEQUE = 256; // task (2^n)
+    static constexpr std::size_t _DEF_SIZE_INBOX = 64; // task (2^n)
+    static constexpr std::size_t _MAX_NODE_CACHE = 1024; // node
+    static constexpr std::size_t _DEF_SPIN_ROUND = 32; // search round before park
+    static constexpr std::size_t _SIZE_LANE = 3; // lane
+    static constexpr std::uint32_t _DEF_LANE_STARVE = 32; // pick, strict schedule
+    static constexpr std::uint32_t _DEF_WEIGHT_CONTROL = 8; // pick per round
+    static constexpr std::uint32_t _DEF_WEIGHT_NORMAL = 4; // pick per round
+    static constexpr std::uint32_t _DEF_WEIGHT_BULK = 1; // pick per round
+    static constexpr std::size_t _DEF_MIN_THREAD = 1; // thread, elastic pool
+    static constexpr std::int64_t _DEF_GROW_WAIT = 1000; // us, queue wait before growing
+    static constexpr std::int64_t _DEF_IDLE_TIME = 10000; // ms, idle time before shrinking
+
+    // Enum
+    enum class lane_t : std::uint8_t
+    {
+        Control = 0,
+        Normal,
+        Bulk
+    };
+
+    enum class schedule_t : std::uint8_t
+    {
+        Strict = 0,
+        Weighted
+    };
+
+    // Using
+    using task_t = task::Task;
+
+    // Struct
+    struct LaneStats
+    {
+        std::size_t m_queued { 0 };
+        std::uint64_t m_done { 0 };
+    };
+
+    // Struct
+    struct TaskNode
+    {
+        task_t m_func;
+    };
+
     // Class
-    class ThreadPool final : public virtual CrashHandler
+    class TaskDeque final
     {
         private:
-            std::vector<std::thread> m_workers;
-            std::queue<std::function<void()>> m_tasks;
-            
+            struct Ring
+            {
+                std::int64_t m_mask;
+                std::unique_ptr<std::atomic<TaskNode*>[]> m_slots;
+
+                explicit Ring(std::size_t ar_size);
+
+                [[nodiscard]] inline TaskNode* get(std::int64_t ar_index) const noexcept;
+                inline void put(std::int64_t ar_index, TaskNode* ar_node) noexcept;
+            };
+
+        private:
+            alignas(_SIZE_CACHE_LINE) std::atomic<std::int64_t> m_top { 0 };
+            alignas(_SIZE_CACHE_LINE) std::atomic<std::int64_t> m_bottom { 0 };
+            alignas(_SIZE_CACHE_LINE) std::atomic<Ring*> m_ring { nullptr };
+
+            std::vector<std::unique_ptr<Ring>> m_rings;
+
+        public:
+            TaskDeque(const TaskDeque&) = delete;
+            TaskDeque& operator=(const TaskDeque&) = delete;
+
+            explicit TaskDeque(std::size_t ar_size = _DEF_SIZE_DEQUE);
+            ~TaskDeque();
+
+            [[nodiscard]] inline std::size_t size() const noexcept;
+
+            void push(TaskNode* ar_node);
+            [[nodiscard]] TaskNode* pop() noexcept;
+            [[nodiscard]] TaskNode* steal() noexcept;
+            std::size_t clear() noexcept;
+
+        private:
+            Ring* grow(Ring* ar_ring, std::int64_t ar_top, std::int64_t ar_bottom);
+    };
+
+    // Class
+    class TaskQueue final
+    {
+        private:
+            std::vector<task_t> m_slots;
+            std::size_t m_head { 0 };
+            std::size_t m_size { 0 };
+            std::size_t m_init { 2 };
+
+        public:
+            explicit TaskQueue(std::size_t ar_size = _DEF_SIZE_INBOX);
+
+            [[nodiscard]] inline bool empty() const noexcept;
+
+            void push(task_t&& ar_task);
+            [[nodiscard]] bool pop(task_t& ar_task) noexcept;
+            std::size_t clear() noexcept;
+    };
+
+    // Struct
+    struct Lane
+    {
+        TaskDeque m_deque;
+
+        std::mutex m_inbox_mtx;
+        TaskQueue m_inbox;
+        std::atomic<std::size_t> m_inbox_size { 0 };
+    };
+
+    // Struct
+    struct alignas(_SIZE_CACHE_LINE) Worker
+    {
+        std::array<Lane, _SIZE_LANE> m_lanes;
+
+        std::vector<std::unique_ptr<TaskNode>> m_cache;
+
+        std::mutex m_park_mtx;
+        std::condition_variable m_park_convar;
+        bool m_notified { false };
+
+        std::uint64_t m_rand { 0 };
+
+        std::array<std::uint32_t, _SIZE_LANE> m_credit {};
+        std::uint32_t m_streak { 0 };
+        std::array<std::atomic<std::uint64_t>, _SIZE_LANE> m_done {};
+
+        bool m_active { false };
+    };
+
+    // Struct
+    template<class Result>
+    struct FutureState
+    {
+        using value_t = std::conditional_t<std::is_void_v<Result>, bool, Result>;
+
+        std::mutex m_mtx;
+        std::condition_variable m_convar;
+        std::atomic<bool> m_ready { false };
+
+        std::optional<value_t> m_value;
+        std::exception_ptr m_error;
+
+        template<class... Value>
+        void set_value(Value&&... ar_value);
+        void set_error(std::exception_ptr ar_error) noexcept;
+    };
+
+    // Class
+    template<class Result>
+    class Future final
+    {
+        private:
+            std::shared_ptr<FutureState<Result>> m_state;
+
+        public:
+            Future(const Future&) = delete;
+            Future& operator=(const Future&) = delete;
+
+            Future() noexcept = default;
+            Future(Future&&) noexcept = default;
+            Future& operator=(Future&&) noexcept = default;
+
+            explicit Future(std::shared_ptr<FutureState<Result>> ar_state) noexcept;
+
+            [[nodiscard]] inline bool is_valid() const noexcept;
+            [[nodiscard]] inline bool is_ready() const noexcept;
+
+            void wait() const noexcept;
+
+            template<class Rep, class Period>
+            [[nodiscard]] bool wait_for(const std::chrono::duration<Rep, Period>& ar_time) const noexcept;
+
+            Result get();
+    };
+
+    // Class
+    class TaskGroup final
+    {
+        private:
+            std::atomic<std::size_t> m_pending { 0 };
+
             std::mutex m_mtx;
             std::condition_variable m_convar;
+            bool m_finished { true };
+            std::exception_ptr m_error;
+
+        public:
+            TaskGroup(const TaskGroup&) = delete;
+            TaskGroup& operator=(const TaskGroup&) = delete;
+
+            TaskGroup() noexcept = default;
+            ~TaskGroup();
+
+            [[nodiscard]] inline bool is_done() const noexcept;
+            [[nodiscard]] inline std::size_t get_pending() const noexcept;
+
+            void add(std::size_t ar_count = 1) noexcept;
+            void done(std::exception_ptr ar_error = nullptr) noexcept;
+
+            void wait();
+
+            template<class Rep, class Period>
+            [[nodiscard]] bool wait_for(const std::chrono::duration<Rep, Period>& ar_time) noexcept;
+    };
+
+    // Class
+    template<class Func>
+    class GroupTask final
+    {
+        private:
+            TaskGroup* m_group;
+            Func m_func;
+
+        public:
+            GroupTask(const GroupTask&) = delete;
+            GroupTask& operator=(const GroupTask&) = delete;
+            GroupTask& operator=(GroupTask&&) = delete;
 
+            GroupTask(TaskGroup& ar_group, Func&& ar_func);
+            GroupTask(GroupTask&& ar_task) noexcept(std::is_nothrow_move_constructible_v<Func>);
+            ~GroupTask();
+
+            void operator()();
+    };
+
+    // Class
+    template<class Result, class Func>
+    class FutureTask final
+    {
+        private:
+            std::shared_ptr<FutureState<Result>> m_state;
+            Func m_func;
+
+        public:
+            FutureTask(const FutureTask&) = delete;
+            FutureTask& operator=(const FutureTask&) = delete;
+            FutureTask& operator=(FutureTask&&) = delete;
+
+            FutureTask(std::shared_ptr<FutureState<Result>> ar_state, Func&& ar_func);
+            FutureTask(FutureTask&& ar_task) noexcept(std::is_nothrow_move_constructible_v<Func>);
+            ~FutureTask();
+
+            void operator()();
+    };
+
+    // Class
+    class ThreadPool final : public virtual CrashHandler
+    {
+        private:
+            std::vector<std::thread> m_workers;
+            std::vector<std::unique_ptr<Worker>> m_queues;
+
+            std::mutex m_idle_mtx;
+            std::vector<std::size_t> m_idle;
+            std::atomic<std::size_t> m_sleeping { 0 };
+
+            std::atomic<std::size_t> m_next { 0 };
             std::atomic<bool> m_stop { false };
 
+            std::mutex m_spawn_mtx;
+            std::size_t m_min { 0 };
+            std::atomic<std::size_t> m_live { 0 };
+            std::atomic<std::size_t> m_searching { 0 };
+            std::atomic<std::int64_t> m_stall { 0 };
+            std::atomic<std::int64_t> m_grow_wait { _DEF_GROW_WAIT * 1000 };
+            std::atomic<std::int64_t> m_idle_time { _DEF_IDLE_TIME * 1000000 };
+
+            std::atomic<schedule_t> m_schedule { schedule_t::Strict };
+            std::array<std::atomic<std::uint32_t>, _SIZE_LANE> m_weight {};
+            std::array<std::atomic<std::size_t>, _SIZE_LANE> m_hint {};
+
+            static inline thread_local ThreadPool* s_current { nullptr };
+            static inline thread_local std::size_t s_current_index { 0 };
+
         public:
             ThreadPool(const ThreadPool&) = delete;
             ThreadPool& operator=(const ThreadPool&) = delete;
 
-            explicit ThreadPool(std::size_t ar_thread_count = std::thread::hardware_concurrency());
+            ThreadPool();
+            explicit ThreadPool(std::size_t ar_thread_count);
+            ThreadPool(std::size_t ar_min_count, std::size_t ar_max_count);
             ~ThreadPool();
 
             [[nodiscard]] inline bool is_running() const noexcept;
             [[nodiscard]] inline std::size_t get_thread_count() const noexcept;
+            [[nodiscard]] inline std::size_t get_live_count() const noexcept;
+            [[nodiscard]] inline schedule_t get_schedule() const noexcept;
+            [[nodiscard]] LaneStats get_lane_stats(lane_t ar_lane) const noexcept;
+
+            void set_schedule(schedule_t ar_schedule) noexcept;
+            void set_weight(lane_t ar_lane, std::uint32_t ar_weight) noexcept;
+            void set_grow_wait(std::chrono::microseconds ar_time) noexcept;
+            void set_idle_time(std::chrono::milliseconds ar_time) noexcept;
+
+            void enqueue(task_t ar_func, lane_t ar_lane = lane_t::Normal) noexcept;
+
+            template<class Func>
+            void enqueue(TaskGroup& ar_group, Func&& ar_func, lane_t ar_lane = lane_t::Normal) noexcept;
+
+            template<class Func, class Result = std::invoke_result_t<std::decay_t<Func>&>>
+            [[nodiscard]] Future<Result> submit(Func&& ar_func, lane_t ar_lane = lane_t::Normal);
+
+            std::size_t enqueue_bulk(task_t* ar_tasks, std::size_t ar_count, lane_t ar_lane = lane_t::Normal) noexcept;
+
+            template<class Func>
+            std::size_t enqueue_bulk(std::size_t ar_count, const Func& ar_func, lane_t ar_lane = lane_t::Normal) noexcept;
+
+            template<class Func>
+            std::size_t enqueue_bulk(TaskGroup& ar_group, std::size_t ar_count, const Func& ar_func, lane_t ar_lane = lane_t::Normal) noexcept;
+
+            [[nodiscard]] static bool run_pending() noexcept;
 
-            void enqueue(std::function<void()> ar_func) noexcept;
-            
             void stop() noexcept;
             void stop(const std::vector<std::thread::id>& ar_tid) noexcept;
 
         private:
+            template<class Make>
+            std::size_t push_bulk(lane_t ar_lane, std::size_t ar_count, Make&& ar_make) noexcept;
+
+            void run(std::size_t ar_index) noexcept;
+            [[nodiscard]] bool take(std::size_t ar_index, task_t& ar_task) noexcept;
+            [[nodiscard]] bool take_lane(std::size_t ar_index, std::size_t ar_lane, task_t& ar_task) noexcept;
+            [[nodiscard]] bool has_task() const noexcept;
+
+            [[nodiscard]] static TaskNode* make_node(Worker& ar_worker, task_t&& ar_task);
+            static void free_node(Worker& ar_worker, TaskNode* ar_node) noexcept;
+
+            [[nodiscard]] bool park(std::size_t ar_index) noexcept;
+            [[nodiscard]] bool retire(std::size_t ar_index) noexcept;
+            std::size_t wake(std::size_t ar_count) noexcept;
+            void wake_all() noexcept;
+
+            void grow(std::size_t ar_backlog) noexcept;
+            void spawn(std::size_t ar_target) noexcept;
+
+            [[nodiscard]] static inline constexpr bool has_hint(std::size_t ar_lane) noexcept;
+            inline void sub_hint(std::size_t ar_lane, std::size_t ar_count) noexcept;
+
+            void drop(std::size_t ar_index) noexcept;
+            void drop_inbox() noexcept;
             void shutdown() noexcept;
 
         protected:
@@ -64,193 +435,1949 @@ namespace pool::threadpool
     };
 
     /**
-     * @brief ThreadPool
+     * @brief Ring
      * 
-     * Verilen çekirdek miktarı kadar döngüde döner.
-     * Eğer otomatik sistem yerine elle (manuel) olarak
-     * değer girilmiş ve geçersiz ise, kendisini 1 çekirdeğe ayarlar.
-     * İşleyicilerin içine yenisini eklemek için kendi
-     * içinde döngü başlatır ve bu döngüde ya işlem havuzunun
-     * durmasını ya da işlemler (tasks) listesinin boş olmamasını kontrol eder.
-     * Eğer durmuş ise ve liste boş ise sonlanır ama aksi halde
-     * yeni işlemi işlemler (tasks) listesinin önünden alır ve listenin
-     * ön sırasındaki işlemi listeden kaldırır. Geçici olarak tuttuğumuz
-     * işlem çalıştırılarak hem işlem çalıştırılmış olur hem de çalışanlar (workers)
-     * listesine eklenmiş olur
+     * Kuyruğun dairesel tamponu. Boyut 2'nin katı olduğu için
+     * sıra değeri maske ile konuma çevrilir
      * 
-     * @param size_t Thread Count
+     * @param size_t Size
      */
-    ThreadPool::ThreadPool(std::size_t ar_thread_count)
-    {
-        if( ar_thread_count == 0 )
-            ar_thread_count = 1;
+    TaskDeque::Ring::Ring(std::size_t ar_size)
+        : m_mask(static_cast<std::int64_t>(ar_size) - 1),
+          m_slots(new std::atomic<TaskNode*>[ar_size]())
+    {}
 
-        for(std::size_t tm_count = 0; tm_count < ar_thread_count; ++tm_count)
-        {
-            this->m_workers.emplace_back([this]{
-                while( true )
-                {
-                    std::function<void()> tm_task;
-
-                    {
-                        std::unique_lock<std::mutex> tm_lock(this->m_mtx);
-
-                        this->m_convar.wait(tm_lock, [this]{
-                            return this->m_stop.load(std::memory_order_acquire)
-                                || CrashHandler::has_signal()
-                                || !this->m_tasks.empty();
-                        });
-
-                        if( this->m_stop.load(std::memory_order_relaxed) || CrashHandler::has_signal() )
-                            break;
+    /**
+     * @brief Get
+     * 
+     * @param int64_t Index
+     * @return TaskNode*
+     */
+    [[nodiscard]]
+    TaskNode* TaskDeque::Ring::get(std::int64_t ar_index) const noexcept
+    {
+        return this->m_slots[ar_index & this->m_mask].load(std::memory_order_relaxed);
+    }
 
-                        if( this->m_tasks.empty() )
-                            continue;
+    /**
+     * @brief Put
+     * 
+     * @param int64_t Index
+     * @param TaskNode* Node
+     */
+    void TaskDeque::Ring::put(std::int64_t ar_index, TaskNode* ar_node) noexcept
+    {
+        this->m_slots[ar_index & this->m_mask].store(ar_node, std::memory_order_relaxed);
+    }
 
-                        tm_task = std::move(this->m_tasks.front());
-                        this->m_tasks.pop();
-                    }
+    /**
+     * @brief TaskDeque
+     * 
+     * Verilen boyutu 2'nin katına yuvarlayıp ilk tamponu oluşturur
+     * 
+     * @param size_t Size
+     */
+    TaskDeque::TaskDeque(std::size_t ar_size)
+    {
+        std::size_t tm_size = 2;
+        while( tm_size < ar_size )
+            tm_size <<= 1;
 
-                    try {
-                        tm_task();
-                    } catch(...) {}
-                }
-            });
-        }
+        this->m_rings.emplace_back(std::make_unique<Ring>(tm_size));
+        this->m_ring.store(this->m_rings.back().get(), std::memory_order_relaxed);
     }
 
     /**
-     * @brief ~ThreadPool
+     * @brief ~TaskDeque
      * 
-     * Sınıf sonlandırıcısı önceden oluşturulmuş
-     * sonlandırma fonksiyonunu çalıştırarak yapının
-     * sonlanmasını sağlar
+     * Çalıştırılmadan kalan görevleri siler. Tüm iş parçacıkları
+     * sonlandıktan sonra çağrılır
      */
-    ThreadPool::~ThreadPool()
+    TaskDeque::~TaskDeque()
     {
-        this->shutdown();
+        const std::int64_t tm_bottom = this->m_bottom.load(std::memory_order_relaxed);
+        Ring* tm_ring = this->m_ring.load(std::memory_order_relaxed);
+
+        for(std::int64_t tm_index = this->m_top.load(std::memory_order_relaxed); tm_index < tm_bottom; ++tm_index)
+            delete tm_ring->get(tm_index);
     }
 
     /**
-     * @brief Is Running
+     * @brief Size
      * 
-     * İşlem havuzunun çalışıp çalışmadığını döndürecek
+     * Kuyruktaki görev sayısını döndürür. Başka iş parçacıkları
+     * aynı anda eklediği ya da aldığı için sadece yaklaşık değerdir
      * 
-     * @return bool
+     * @return size_t
      */
     [[nodiscard]]
-    bool ThreadPool::is_running() const noexcept
+    std::size_t TaskDeque::size() const noexcept
     {
-        return !this->m_stop.load(std::memory_order_relaxed) && !CrashHandler::has_signal();
+        const std::int64_t tm_bottom = this->m_bottom.load(std::memory_order_seq_cst);
+        const std::int64_t tm_top = this->m_top.load(std::memory_order_seq_cst);
+
+        return tm_bottom > tm_top ? static_cast<std::size_t>(tm_bottom - tm_top) : 0;
     }
 
     /**
-     * @brief Get Thread Count
+     * @brief Push
      * 
-     * Tutulan işlemlerin miktarını döndürecek
+     * Görevi kuyruğun arkasına ekler, sadece kuyruğun sahibi
+     * çağırır. Tampon dolmuşsa iki katına büyütülür
      * 
-     * @return size_t
+     * @param TaskNode* Node
      */
-    [[nodiscard]]
-    std::size_t ThreadPool::get_thread_count() const noexcept
+    void TaskDeque::push(TaskNode* ar_node)
     {
-        return this->m_workers.size();
+        const std::int64_t tm_bottom = this->m_bottom.load(std::memory_order_relaxed);
+        const std::int64_t tm_top = this->m_top.load(std::memory_order_acquire);
+        Ring* tm_ring = this->m_ring.load(std::memory_order_relaxed);
+
+        if( tm_bottom - tm_top > tm_ring->m_mask )
+            tm_ring = this->grow(tm_ring, tm_top, tm_bottom);
+
+        tm_ring->put(tm_bottom, ar_node);
+        this->m_bottom.store(tm_bottom + 1, std::memory_order_release);
     }
 
     /**
-     * @brief Enqueue
+     * @brief Pop
      * 
-     * Yeni bir görevi havuza ekler. Görev, uygun bir worker boşaldığında çalıştırılır.
-     * Eş zamanlı erişimi engellesin ve yeni bir işi kuyruğa göndersin.
-     * Yeni bir iş eklendiğinde dair haberdar etsin
+     * Kuyruğun arkasındaki görevi alır, sadece kuyruğun sahibi
+     * çağırır. Son görev için çalan ile yarışılırsa karşılaştır
+     * ve değiştir (CAS) ile tek kazanan olur
      * 
-     * @param function<void()> Function
+     * @return TaskNode*
      */
-    void ThreadPool::enqueue(
-        std::function<void()> ar_func
-    ) noexcept
+    [[nodiscard]]
+    TaskNode* TaskDeque::pop() noexcept
     {
+        const std::int64_t tm_bottom = this->m_bottom.load(std::memory_order_relaxed) - 1;
+        Ring* tm_ring = this->m_ring.load(std::memory_order_relaxed);
+
+        this->m_bottom.store(tm_bottom, std::memory_order_seq_cst);
+        std::int64_t tm_top = this->m_top.load(std::memory_order_seq_cst);
+
+        if( tm_top > tm_bottom )
         {
-            std::unique_lock<std::mutex> tm_lock(this->m_mtx);
+            this->m_bottom.store(tm_bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
 
-            if( this->m_stop.load(std::memory_order_relaxed) || CrashHandler::has_signal() )
-                return;
+        TaskNode* tm_node = tm_ring->get(tm_bottom);
+        if( tm_top == tm_bottom )
+        {
+            // LAST TASK, RACE WITH THIEVES
+            if( !this->m_top.compare_exchange_strong(tm_top, tm_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) )
+                tm_node = nullptr;
 
-            this->m_tasks.emplace(std::move(ar_func));
+            this->m_bottom.store(tm_bottom + 1, std::memory_order_relaxed);
         }
 
-        this->m_convar.notify_one();
+        return tm_node;
     }
 
     /**
-     * @brief Shutdown
+     * @brief Steal
      * 
-     * Sonlandırma yapmadan önce hala çalışır durumda olmasını kontrol eder.
-     * Durmuş ise eğer, zaten sonlandırılmış demektir. Tüm durumlara
-     * bildirim gönderir. Döngü ile tüm çalışanları (workers) sırayla kontrol eder.
-     * Eğer sonlandırılabilecek durumda ise ve ana işlem değilse sonlandırır
+     * Kuyruğun önündeki görevi alır, herhangi bir iş parçacığı
+     * çağırabilir. Başka bir çalan ya da sahibi ile yarışı
+     * kaybederse boş döner
+     * 
+     * @return TaskNode*
      */
-    void ThreadPool::shutdown() noexcept
+    [[nodiscard]]
+    TaskNode* TaskDeque::steal() noexcept
     {
-        if( this->m_stop.exchange(true, std::memory_order_acq_rel) )
-            return;
+        std::int64_t tm_top = this->m_top.load(std::memory_order_seq_cst);
+        const std::int64_t tm_bottom = this->m_bottom.load(std::memory_order_seq_cst);
 
-        this->m_convar.notify_all();
+        if( tm_top >= tm_bottom )
+            return nullptr;
 
-        const std::thread::id tm_self_id = std::this_thread::get_id();
-        for(auto& tm_worker : this->m_workers) {
-            if( tm_worker.joinable() && tm_worker.get_id() != tm_self_id )
-                tm_worker.join();
-        }
+        Ring* tm_ring = this->m_ring.load(std::memory_order_acquire);
+        TaskNode* tm_node = tm_ring->get(tm_top);
+
+        if( !this->m_top.compare_exchange_strong(tm_top, tm_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) )
+            return nullptr;
+
+        return tm_node;
     }
 
     /**
-     * @brief Stop
+     * @brief Grow
      * 
-     * İşlem havuzunu durdurarak sonlandırır
+     * Tamponu iki katına büyütüp bekleyen görevleri kopyalar.
+     * Eski tampon silinmez, aynı anda okuyan çalanlar olabileceği
+     * için kuyruk sonlanana kadar tutulur
+     * 
+     * @param Ring* Ring
+     * @param int64_t Top
+     * @param int64_t Bottom
+     * @return Ring*
      */
-    void ThreadPool::stop() noexcept
+    TaskDeque::Ring* TaskDeque::grow(Ring* ar_ring, std::int64_t ar_top, std::int64_t ar_bottom)
     {
-        this->shutdown();
+        this->m_rings.emplace_back(std::make_unique<Ring>(static_cast<std::size_t>(ar_ring->m_mask + 1) * 2));
+        Ring* tm_ring = this->m_rings.back().get();
+
+        for(std::int64_t tm_index = ar_top; tm_index < ar_bottom; ++tm_index)
+            tm_ring->put(tm_index, ar_ring->get(tm_index));
+
+        this->m_ring.store(tm_ring, std::memory_order_release);
+        return tm_ring;
     }
 
     /**
-     * @brief Stop
+     * @brief Clear
      * 
-     * Sonlandırma yapmadan önce hala çalışır durumda olmasını kontrol eder.
-     * Durmuş ise eğer, zaten sonlandırılmış demektir. Tüm durumlara
-     * bildirim gönderir. Döngü ile tüm çalışanları (workers) sırayla kontrol eder.
-     * Eğer sonlandırılabilecek durumda ise ve ana işlem değilse sonlandırır
+     * Kuyruktaki görevleri siler ve silinen görev sayısını döndürür.
+     * Sadece kuyruğun sahibi çağırır, aynı anda çalınan görevler
+     * çalanda kalır
      * 
-     * @brief vector<thread::id>& Thread ID Vector
+     * @return size_t
      */
-    void ThreadPool::stop(const std::vector<std::thread::id>& ar_tid) noexcept
+    std::size_t TaskDeque::clear() noexcept
     {
-        const std::thread::id tm_self_id = std::this_thread::get_id();
+        std::size_t tm_count = 0;
+        for(; TaskNode* tm_node = this->pop(); ++tm_count)
+            delete tm_node;
 
-        for(auto& tm_worker : this->m_workers)
-        {
-            if( tm_worker.get_id() == tm_self_id )
-                continue;
+        return tm_count;
+    }
 
-            for( auto& tm_thread_id : ar_tid )
-            {
-                if( tm_thread_id == tm_worker.get_id() && tm_worker.joinable() )
-                    tm_worker.join();
-            }
-        }
+    /**
+     * @brief TaskQueue
+     *
+     * Gelen kutusunun dairesel tamponu. Görevler tamponun içinde
+     * taşınır, tampon sadece dolduğunda iki katına büyütülür ve
+     * küçültülmez; ısınmadan sonra ekleme bellek ayırmaz.
+     * Tampon ilk eklemede ayrılır, hiç görev almayan şeridin
+     * gelen kutusu bellek tutmaz.
+     * Kilit ile korunur, tek başına eş zamanlı değildir
+     *
+     * @param size_t Size
+     */
+    TaskQueue::TaskQueue(std::size_t ar_size)
+    {
+        while( this->m_init < ar_size )
+            this->m_init <<= 1;
     }
 
     /**
-     * @brief Crashed
-     * 
-     * Beklenmedik sonlanmaların oluşmasını durumunda
-     * yapıda son yapılması gerekenleri yapar.
-     * Sınıfı sonlandırarak işlemlerin başarı ve güvenle
-     * sonlanmasını sağlar
+     * @brief Empty
+     *
+     * @return bool
      */
-    void ThreadPool::crashed() noexcept
+    [[nodiscard]]
+    bool TaskQueue::empty() const noexcept
     {
-        this->shutdown();
+        return this->m_size == 0;
+    }
+
+    /**
+     * @brief Push
+     *
+     * Görevi kuyruğun sonuna taşır
+     *
+     * @param task_t&& Task
+     */
+    void TaskQueue::push(task_t&& ar_task)
+    {
+        if( this->m_slots.empty() )
+            this->m_slots.resize(this->m_init);
+
+        const std::size_t tm_mask = this->m_slots.size() - 1;
+
+        if( this->m_size > tm_mask )
+        {
+            std::vector<task_t> tm_slots(this->m_slots.size() * 2);
+            for(std::size_t tm_index = 0; tm_index < this->m_size; ++tm_index)
+                tm_slots[tm_index] = std::move(this->m_slots[(this->m_head + tm_index) & tm_mask]);
+
+            this->m_slots.swap(tm_slots);
+            this->m_head = 0;
+        }
+
+        this->m_slots[(this->m_head + this->m_size) & (this->m_slots.size() - 1)] = std::move(ar_task);
+        ++this->m_size;
+    }
+
+    /**
+     * @brief Pop
+     *
+     * Kuyruğun başındaki görevi alır
+     *
+     * @param task_t& Task
+     * @return bool
+     */
+    [[nodiscard]]
+    bool TaskQueue::pop(task_t& ar_task) noexcept
+    {
+        if( this->m_size == 0 )
+            return false;
+
+        ar_task = std::move(this->m_slots[this->m_head]);
+        this->m_head = (this->m_head + 1) & (this->m_slots.size() - 1);
+        --this->m_size;
+        return true;
+    }
+
+    /**
+     * @brief Clear
+     * 
+     * Kuyruktaki görevleri siler ve silinen görev sayısını döndürür
+     * 
+     * @return size_t
+     */
+    std::size_t TaskQueue::clear() noexcept
+    {
+        std::size_t tm_count = 0;
+        for(task_t tm_task; this->pop(tm_task); ++tm_count)
+            tm_task = nullptr;
+
+        return tm_count;
+    }
+
+    /**
+     * @brief ThreadPool
+     * 
+     * Esnek havuz oluşturur. En az _DEF_MIN_THREAD, en çok
+     * çekirdek sayısı kadar çalışan ile çalışır; sunucu ve
+     * istemci gibi çok sayıda kurulan yapılar boşta iken
+     * çekirdek sayısı kadar iş parçacığı tutmaz
+     */
+    ThreadPool::ThreadPool()
+        : ThreadPool(_DEF_MIN_THREAD, std::thread::hardware_concurrency())
+    {}
+
+    /**
+     * @brief ThreadPool
+     * 
+     * Verilen çekirdek miktarı kadar çalışan ile sabit havuz
+     * oluşturur. Eğer değer geçersiz ise kendisini 1 çekirdeğe
+     * ayarlar. Çalışanların tamamı ilk görev eklendiğinde başlar
+     * ve havuz sonlanana kadar küçülmez
+     * 
+     * @param size_t Thread Count
+     */
+    ThreadPool::ThreadPool(std::size_t ar_thread_count)
+        : ThreadPool(ar_thread_count, ar_thread_count)
+    {}
+
+    /**
+     * @brief ThreadPool
+     * 
+     * En az ve en çok çalışan sayısı ile havuz oluşturur. En çok
+     * sayı geçersiz ise 1'e, en az sayı en çok sayıdan büyük ise
+     * en çok sayıya ayarlanır. Her çalışanın kuyruğu en çok sayı
+     * kadar baştan oluşturulur, çünkü çalışanlar birbirinin
+     * kuyruğundan çalar; iş parçacıkları ise ihtiyaç oldukça başlar
+     * 
+     * @param size_t Min Count
+     * @param size_t Max Count
+     */
+    ThreadPool::ThreadPool(std::size_t ar_min_count, std::size_t ar_max_count)
+    {
+        if( ar_max_count == 0 )
+            ar_max_count = 1;
+
+        this->m_min = std::min(ar_min_count, ar_max_count);
+
+        this->m_idle.reserve(ar_max_count);
+        this->m_workers.resize(ar_max_count);
+        for(std::size_t tm_count = 0; tm_count < ar_max_count; ++tm_count)
+        {
+            this->m_queues.emplace_back(std::make_unique<Worker>());
+            this->m_queues.back()->m_rand = 0x9E3779B97F4A7C15ull * (tm_count + 1);
+        }
+
+        this->m_weight[static_cast<std::size_t>(lane_t::Control)].store(_DEF_WEIGHT_CONTROL, std::memory_order_relaxed);
+        this->m_weight[static_cast<std::size_t>(lane_t::Normal)].store(_DEF_WEIGHT_NORMAL, std::memory_order_relaxed);
+        this->m_weight[static_cast<std::size_t>(lane_t::Bulk)].store(_DEF_WEIGHT_BULK, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief ~ThreadPool
+     * 
+     * Sınıf sonlandırıcısı önceden oluşturulmuş
+     * sonlandırma fonksiyonunu çalıştırarak yapının
+     * sonlanmasını sağlar
+     */
+    ThreadPool::~ThreadPool()
+    {
+        this->shutdown();
+    }
+
+    /**
+     * @brief Is Running
+     * 
+     * İşlem havuzunun çalışıp çalışmadığını döndürecek
+     * 
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::is_running() const noexcept
+    {
+        return !this->m_stop.load(std::memory_order_relaxed) && !CrashHandler::has_signal();
+    }
+
+    /**
+     * @brief Get Thread Count
+     * 
+     * Havuzun en çok çalışabileceği işlem miktarını döndürecek
+     * 
+     * @return size_t
+     */
+    [[nodiscard]]
+    std::size_t ThreadPool::get_thread_count() const noexcept
+    {
+        return this->m_workers.size();
+    }
+
+    /**
+     * @brief Get Live Count
+     * 
+     * O an başlamış ve sonlanmamış çalışan sayısını döndürür
+     * 
+     * @return size_t
+     */
+    [[nodiscard]]
+    std::size_t ThreadPool::get_live_count() const noexcept
+    {
+        return this->m_live.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get Schedule
+     * 
+     * Şeritler arası seçim kipini döndürür
+     * 
+     * @return schedule_t
+     */
+    [[nodiscard]]
+    schedule_t ThreadPool::get_schedule() const noexcept
+    {
+        return this->m_schedule.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get Lane Stats
+     * 
+     * Şeritte bekleyen görev sayısını (kuyruk derinliği) ve şeritten
+     * alınıp çalıştırılan görev sayısını döndürür. Çalışanlar aynı
+     * anda eklediği ya da aldığı için sadece yaklaşık değerdir
+     * 
+     * @param lane_t Lane
+     * @return LaneStats
+     */
+    [[nodiscard]]
+    LaneStats ThreadPool::get_lane_stats(const lane_t ar_lane) const noexcept
+    {
+        const std::size_t tm_lane = static_cast<std::size_t>(ar_lane);
+
+        LaneStats tm_stats;
+        for(const auto& tm_worker : this->m_queues)
+        {
+            const Lane& tm_queue = tm_worker->m_lanes[tm_lane];
+            tm_stats.m_queued += tm_queue.m_deque.size() + tm_queue.m_inbox_size.load(std::memory_order_relaxed);
+            tm_stats.m_done += tm_worker->m_done[tm_lane].load(std::memory_order_relaxed);
+        }
+
+        return tm_stats;
+    }
+
+    /**
+     * @brief Set Schedule
+     * 
+     * Şeritler arası seçim kipini değiştirir. Çalışanlar yeni kipi
+     * bir sonraki seçimde kullanır
+     * 
+     * @param schedule_t Schedule
+     */
+    void ThreadPool::set_schedule(const schedule_t ar_schedule) noexcept
+    {
+        this->m_schedule.store(ar_schedule, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set Weight
+     * 
+     * Ağırlıklı kipte şeridin bir turdaki seçim sayısını değiştirir.
+     * Ağırlık en az 1 olur, böylece hiçbir şerit aç kalmaz
+     * 
+     * @param lane_t Lane
+     * @param uint32_t Weight
+     */
+    void ThreadPool::set_weight(const lane_t ar_lane, const std::uint32_t ar_weight) noexcept
+    {
+        this->m_weight[static_cast<std::size_t>(ar_lane)].store(std::max<std::uint32_t>(1, ar_weight), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set Grow Wait
+     * 
+     * Görevlerin uyuyan çalışan bulamadan kuyrukta bekleyebileceği
+     * süreyi ayarlar, süre aşılınca havuza bir çalışan eklenir
+     * 
+     * @param microseconds Time
+     */
+    void ThreadPool::set_grow_wait(const std::chrono::microseconds ar_time) noexcept
+    {
+        this->m_grow_wait.store(std::chrono::duration_cast<std::chrono::nanoseconds>(ar_time).count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set Idle Time
+     * 
+     * En az sayının üstündeki çalışanın iş bulamadan bekleyeceği
+     * süreyi ayarlar, süre dolunca çalışan sonlanır. Zaten uyuyan
+     * çalışanlar bir sonraki uyumalarında yeni süreyi kullanır
+     * 
+     * @param milliseconds Time
+     */
+    void ThreadPool::set_idle_time(const std::chrono::milliseconds ar_time) noexcept
+    {
+        this->m_idle_time.store(std::chrono::duration_cast<std::chrono::nanoseconds>(ar_time).count(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enqueue
+     * 
+     * Yeni bir görevi havuza ekler. Görev, uygun bir worker boşaldığında çalıştırılır.
+     * Havuzun kendi çalışanı ekliyorsa görev kendi kuyruğuna kilitsiz
+     * eklenir, dışarıdan eklenen görevler sıradaki çalışanın gelen
+     * kutusuna yazılır. Ardından uyuyan bir çalışan varsa uyandırılır.
+     * Boş görev (nullptr ya da taşınmış görev) eklenmeden bırakılır
+     * 
+     * @param task_t Function
+     * @param lane_t Lane
+     */
+    void ThreadPool::enqueue(
+        task_t ar_func,
+        const lane_t ar_lane
+    ) noexcept
+    {
+        if( !ar_func )
+            return;
+
+        this->push_bulk(ar_lane, 1, [&ar_func](std::size_t) -> task_t&& {
+            return std::move(ar_func);
+        });
+    }
+
+    /**
+     * @brief Enqueue
+     * 
+     * Görevi kümeye sayarak ekler. Görev çalışınca ya da havuz
+     * durduğu için çalışmadan silinirse küme bir azalır; silinen
+     * görev kümeye broken_promise hatası olarak yazılır
+     * 
+     * @tparam Func Function
+     * @param TaskGroup& Group
+     * @param Func&& Function
+     * @param lane_t Lane
+     */
+    template<class Func>
+    void ThreadPool::enqueue(
+        TaskGroup& ar_group,
+        Func&& ar_func,
+        const lane_t ar_lane
+    ) noexcept
+    {
+        try {
+            this->enqueue(GroupTask<std::decay_t<Func>>(ar_group, std::decay_t<Func>(std::forward<Func>(ar_func))), ar_lane);
+        } catch(...) {}
+    }
+
+    /**
+     * @brief Submit
+     * 
+     * Görevi ekler ve sonucunu bekleyen Future döndürür. Görevin
+     * fırlattığı hata get ile çağırana geçer. Havuz durmuşsa ya
+     * da görev çalışmadan silinirse get broken_promise hatası
+     * fırlatır. Paylaşılan durum için tek bellek ayırma yapılır
+     * 
+     * @tparam Func Function
+     * @tparam Result Result
+     * @param Func&& Function
+     * @param lane_t Lane
+     * @return Future<Result>
+     */
+    template<class Func, class Result>
+    [[nodiscard]]
+    Future<Result> ThreadPool::submit(
+        Func&& ar_func,
+        const lane_t ar_lane
+    )
+    {
+        auto tm_state = std::make_shared<FutureState<Result>>();
+        this->enqueue(FutureTask<Result, std::decay_t<Func>>(tm_state, std::decay_t<Func>(std::forward<Func>(ar_func))), ar_lane);
+
+        return Future<Result>(std::move(tm_state));
+    }
+
+    /**
+     * @brief Enqueue Bulk
+     * 
+     * Verilen görevleri taşıyarak ekler. Dışarıdan eklenirken
+     * görevler çalışanlara bölünür ve her gelen kutusu bir kez
+     * kilitlenir, ardından eklenen görev kadar uyuyan çalışan
+     * birlikte uyandırılır. Eklenen görev sayısını döndürür
+     * 
+     * @param task_t* Tasks
+     * @param size_t Count
+     * @param lane_t Lane
+     * @return size_t
+     */
+    std::size_t ThreadPool::enqueue_bulk(
+        task_t* ar_tasks,
+        const std::size_t ar_count,
+        const lane_t ar_lane
+    ) noexcept
+    {
+        return this->push_bulk(ar_lane, ar_count, [ar_tasks](const std::size_t ar_index) -> task_t&& {
+            return std::move(ar_tasks[ar_index]);
+        });
+    }
+
+    /**
+     * @brief Enqueue Bulk
+     * 
+     * 0 ile verilen sayı arasındaki her sıra için fonksiyonun bir
+     * kopyasını sıra ile çalıştıran görev ekler
+     * 
+     * @tparam Func Function
+     * @param size_t Count
+     * @param Func& Function
+     * @param lane_t Lane
+     * @return size_t
+     */
+    template<class Func>
+    std::size_t ThreadPool::enqueue_bulk(
+        const std::size_t ar_count,
+        const Func& ar_func,
+        const lane_t ar_lane
+    ) noexcept
+    {
+        return this->push_bulk(ar_lane, ar_count, [&ar_func](const std::size_t ar_index) {
+            return task_t([ar_func, ar_index]() mutable { ar_func(ar_index); });
+        });
+    }
+
+    /**
+     * @brief Enqueue Bulk
+     * 
+     * Sıra başına görevleri kümeye sayarak ekler. "Bu N işi
+     * çalıştır ve bekle" için enqueue_bulk ardından wait yeterlidir
+     * 
+     * @tparam Func Function
+     * @param TaskGroup& Group
+     * @param size_t Count
+     * @param Func& Function
+     * @param lane_t Lane
+     * @return size_t
+     */
+    template<class Func>
+    std::size_t ThreadPool::enqueue_bulk(
+        TaskGroup& ar_group,
+        const std::size_t ar_count,
+        const Func& ar_func,
+        const lane_t ar_lane
+    ) noexcept
+    {
+        return this->push_bulk(ar_lane, ar_count, [&ar_group, &ar_func](const std::size_t ar_index) {
+            auto tm_call = [ar_func, ar_index]() mutable { ar_func(ar_index); };
+            return task_t(GroupTask<decltype(tm_call)>(ar_group, std::move(tm_call)));
+        });
+    }
+
+    /**
+     * @brief Run Pending
+     * 
+     * Çağıran iş parçacığı bir havuzun çalışanı ise bekleyen bir
+     * görevi alıp çalıştırır. Sonuç ya da küme beklenirken
+     * kullanılır; çalışan beklerken kendi eklediği görevleri de
+     * bitirebilir. Havuz durmuşsa çalışanın kendi kuyruğu silinir
+     * ve bekleyen sonuçlar broken_promise ile uyanır. Görev yoksa
+     * ya da çalışan değilse false döner
+     * 
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::run_pending() noexcept
+    {
+        ThreadPool* tm_pool = s_current;
+        if( tm_pool == nullptr )
+            return false;
+
+        if( !tm_pool->is_running() )
+        {
+            tm_pool->drop(s_current_index);
+            return false;
+        }
+
+        task_t tm_task;
+        if( !tm_pool->take(s_current_index, tm_task) )
+            return false;
+
+        try {
+            tm_task();
+        } catch(...) {}
+
+        return true;
+    }
+
+    /**
+     * @brief Push Bulk
+     * 
+     * Görevleri üretici fonksiyondan alıp ekler. Çalışan kendi
+     * kuyruğuna kilitsiz ekler; dışarıdan eklenirken görevler
+     * sıradaki çalışandan başlayarak eşit parçalar halinde gelen
+     * kutularına yazılır, her kutu bir kez kilitlenir. Görevler
+     * yazıldıktan sonra uyuyanlara bakılır
+     * 
+     * @tparam Make Make
+     * @param lane_t Lane
+     * @param size_t Count
+     * @param Make&& Make
+     * @return size_t
+     */
+    template<class Make>
+    std::size_t ThreadPool::push_bulk(
+        const lane_t ar_lane,
+        const std::size_t ar_count,
+        Make&& ar_make
+    ) noexcept
+    {
+        const std::size_t tm_lane = static_cast<std::size_t>(ar_lane);
+
+        if( ar_count == 0 || this->m_stop.load(std::memory_order_acquire) || CrashHandler::has_signal() )
+            return 0;
+
+        // COUNT BEFORE PUSHING SO A QUEUED TASK IS NEVER HIDDEN
+        if( has_hint(tm_lane) )
+            this->m_hint[tm_lane].fetch_add(ar_count, std::memory_order_relaxed);
+
+        std::size_t tm_pushed = 0;
+        try {
+            if( s_current == this )
+            {
+                Worker& tm_worker = *this->m_queues[s_current_index];
+                for(; tm_pushed < ar_count; ++tm_pushed)
+                {
+                    TaskNode* tm_node = make_node(tm_worker, ar_make(tm_pushed));
+
+                    try {
+                        tm_worker.m_lanes[tm_lane].m_deque.push(tm_node);
+                    } catch(...) {
+                        free_node(tm_worker, tm_node);
+                        throw;
+                    }
+                }
+            }
+            else
+            {
+                const std::size_t tm_workers = this->m_queues.size();
+                const std::size_t tm_start = this->m_next.fetch_add(1, std::memory_order_relaxed);
+                const std::size_t tm_share = (ar_count + tm_workers - 1) / tm_workers;
+
+                for(std::size_t tm_step = 0; tm_pushed < ar_count; ++tm_step)
+                {
+                    Lane& tm_queue = this->m_queues[(tm_start + tm_step) % tm_workers]->m_lanes[tm_lane];
+                    const std::size_t tm_first = tm_pushed;
+                    const std::size_t tm_last = std::min(ar_count, tm_pushed + tm_share);
+
+                    std::lock_guard<std::mutex> tm_lock(tm_queue.m_inbox_mtx);
+                    try {
+                        for(; tm_pushed < tm_last; ++tm_pushed)
+                            tm_queue.m_inbox.push(ar_make(tm_pushed));
+                    } catch(...) {
+                        tm_queue.m_inbox_size.fetch_add(tm_pushed - tm_first, std::memory_order_seq_cst);
+                        throw;
+                    }
+
+                    tm_queue.m_inbox_size.fetch_add(tm_pushed - tm_first, std::memory_order_seq_cst);
+                }
+            }
+        } catch(...) {}
+
+        this->sub_hint(tm_lane, ar_count - tm_pushed);
+        if( tm_pushed == 0 )
+            return 0;
+
+        // PUBLISH THE TASKS BEFORE LOOKING FOR SLEEPERS
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        this->grow(tm_pushed - this->wake(tm_pushed));
+
+        return tm_pushed;
+    }
+
+    /**
+     * @brief Run
+     * 
+     * Çalışanın döngüsü. Görev bulduğu sürece çalıştırır, bulamazsa
+     * birkaç tur daha arayıp uyur. Havuz durunca ya da çökme
+     * sinyali gelince sonlanır, bekleyen görevler çalıştırılmaz.
+     * Boşta kaldığı için emekli olan çalışan kuyruğu boş olduğu
+     * için silme yapmadan sonlanır
+     * 
+     * @param size_t Index
+     */
+    void ThreadPool::run(std::size_t ar_index) noexcept
+    {
+        s_current = this;
+        s_current_index = ar_index;
+
+        task_t tm_task;
+        std::size_t tm_round = 0;
+
+        while( true )
+        {
+            if( this->m_stop.load(std::memory_order_acquire) || CrashHandler::has_signal() )
+                break;
+
+            if( this->take(ar_index, tm_task) )
+            {
+                if( tm_round > 0 )
+                    this->m_searching.fetch_sub(1, std::memory_order_relaxed);
+
+                tm_round = 0;
+
+                try {
+                    tm_task();
+                } catch(...) {}
+
+                tm_task = nullptr;
+
+                // TASKS ARE STILL WAITING, CHECK THE QUEUE WAIT TARGET
+                if( this->m_stall.load(std::memory_order_relaxed) != 0 )
+                    this->grow(0);
+
+                continue;
+            }
+
+            // THE QUEUE RAN DRY, NO TASK IS WAITING ANY MORE
+            if( tm_round == 0 )
+            {
+                this->m_searching.fetch_add(1, std::memory_order_seq_cst);
+                if( this->m_stall.load(std::memory_order_relaxed) != 0 )
+                    this->m_stall.store(0, std::memory_order_relaxed);
+            }
+
+            if( ++tm_round < _DEF_SPIN_ROUND )
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            tm_round = 0;
+            this->m_searching.fetch_sub(1, std::memory_order_relaxed);
+
+            if( !this->park(ar_index) )
+            {
+                // RETIRED, GIVE THE NODE CACHE BACK
+                std::vector<std::unique_ptr<TaskNode>>().swap(this->m_queues[ar_index]->m_cache);
+                s_current = nullptr;
+                return;
+            }
+        }
+
+        if( tm_round > 0 )
+            this->m_searching.fetch_sub(1, std::memory_order_relaxed);
+
+        this->drop(ar_index);
+        s_current = nullptr;
+    }
+
+    /**
+     * @brief Take
+     * 
+     * Çalışan için sıradaki görevi seçer. Katı kipte şeritlere
+     * Control, Normal, Bulk sırası ile bakılır; üst şeritler
+     * sürekli dolu olsa da Bulk aç kalmasın diye her
+     * _DEF_LANE_STARVE seçimde bir kez alttan başlanır. Ağırlıklı
+     * kipte her şeridin turda ağırlığı kadar seçim hakkı vardır,
+     * hakkı biten ya da boş olan şeridin sırası sonrakine geçer,
+     * seçilecek şerit kalmayınca haklar yenilenir. Sadece Normal
+     * şeritte görev varsa seçim yapılmadan doğrudan alınır
+     * 
+     * @param size_t Index
+     * @param task_t& Task
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::take(std::size_t ar_index, task_t& ar_task) noexcept
+    {
+        Worker& tm_self = *this->m_queues[ar_index];
+
+        auto tm_pick = [this, ar_index, &ar_task, &tm_self](const std::size_t ar_lane) noexcept {
+            if( !this->take_lane(ar_index, ar_lane, ar_task) )
+                return false;
+
+            this->sub_hint(ar_lane, 1);
+            tm_self.m_done[ar_lane].store(tm_self.m_done[ar_lane].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return true;
+        };
+
+        // ONLY THE DEFAULT LANE HAS WORK, NOTHING TO SCHEDULE
+        bool tm_single = true;
+        for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+            tm_single = tm_single && !(has_hint(tm_lane) && this->m_hint[tm_lane].load(std::memory_order_relaxed) > 0);
+
+        if( tm_single )
+            return tm_pick(static_cast<std::size_t>(lane_t::Normal));
+
+        // STRICT, LOWER LANES FIRST ONCE PER STARVE ROUND
+        if( this->m_schedule.load(std::memory_order_relaxed) == schedule_t::Strict )
+        {
+            const bool tm_starve = tm_self.m_streak >= _DEF_LANE_STARVE;
+            for(std::size_t tm_step = 0; tm_step < _SIZE_LANE; ++tm_step)
+            {
+                if( tm_pick(tm_starve ? _SIZE_LANE - 1 - tm_step : tm_step) )
+                {
+                    tm_self.m_streak = tm_starve ? 0 : tm_self.m_streak + 1;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // WEIGHTED, LANES WITH CREDIT FIRST
+        for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+        {
+            if( tm_self.m_credit[tm_lane] > 0 && tm_pick(tm_lane) )
+            {
+                --tm_self.m_credit[tm_lane];
+                return true;
+            }
+        }
+
+        // NEW ROUND
+        for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+            tm_self.m_credit[tm_lane] = this->m_weight[tm_lane].load(std::memory_order_relaxed);
+
+        for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+        {
+            if( tm_pick(tm_lane) )
+            {
+                --tm_self.m_credit[tm_lane];
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Take Lane
+     * 
+     * Şeritten görev alır. Önce çalışanın kendi kuyruğuna (LIFO)
+     * ve gelen kutusuna (FIFO), sonra rastgele seçilen çalışandan
+     * başlayarak diğer çalışanların aynı şeridine bakılır. Sayılan
+     * şeritte bekleyen görev yoksa kuyruklara hiç bakılmaz
+     * 
+     * @param size_t Index
+     * @param size_t Lane
+     * @param task_t& Task
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::take_lane(std::size_t ar_index, std::size_t ar_lane, task_t& ar_task) noexcept
+    {
+        if( has_hint(ar_lane) && this->m_hint[ar_lane].load(std::memory_order_relaxed) == 0 )
+            return false;
+
+        Worker& tm_self = *this->m_queues[ar_index];
+        Lane& tm_own = tm_self.m_lanes[ar_lane];
+
+        auto tm_unpack = [&ar_task, &tm_self](TaskNode* ar_node) noexcept {
+            ar_task = std::move(ar_node->m_func);
+            free_node(tm_self, ar_node);
+            return true;
+        };
+
+        auto tm_inbox = [&ar_task](Lane& ar_queue) noexcept {
+            if( ar_queue.m_inbox_size.load(std::memory_order_relaxed) == 0 )
+                return false;
+
+            std::lock_guard<std::mutex> tm_lock(ar_queue.m_inbox_mtx);
+            if( !ar_queue.m_inbox.pop(ar_task) )
+                return false;
+
+            ar_queue.m_inbox_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        };
+
+        // OWN DEQUE (LIFO), OWN INBOX (FIFO)
+        if( TaskNode* tm_node = tm_own.m_deque.pop() )
+            return tm_unpack(tm_node);
+
+        if( tm_inbox(tm_own) )
+            return true;
+
+        // STEAL, START FROM A RANDOM VICTIM
+        const std::size_t tm_count = this->m_queues.size();
+        if( tm_count < 2 )
+            return false;
+
+        tm_self.m_rand ^= tm_self.m_rand << 13;
+        tm_self.m_rand ^= tm_self.m_rand >> 7;
+        tm_self.m_rand ^= tm_self.m_rand << 17;
+
+        const std::size_t tm_start = static_cast<std::size_t>(tm_self.m_rand % tm_count);
+        for(std::size_t tm_step = 0; tm_step < tm_count; ++tm_step)
+        {
+            const std::size_t tm_victim = (tm_start + tm_step) % tm_count;
+            if( tm_victim == ar_index )
+                continue;
+
+            Lane& tm_queue = this->m_queues[tm_victim]->m_lanes[ar_lane];
+            if( TaskNode* tm_node = tm_queue.m_deque.steal() )
+                return tm_unpack(tm_node);
+
+            if( tm_inbox(tm_queue) )
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Has Task
+     * 
+     * Herhangi bir kuyrukta ya da gelen kutusunda görev olup
+     * olmadığını döndürür
+     * 
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::has_task() const noexcept
+    {
+        for(const auto& tm_worker : this->m_queues) {
+            for(const Lane& tm_queue : tm_worker->m_lanes) {
+                if( tm_queue.m_deque.size() > 0 || tm_queue.m_inbox_size.load(std::memory_order_seq_cst) > 0 )
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Make Node
+     *
+     * Çalışanın kendi kuyruğu için görev düğümü verir. Önce
+     * çalışanın önbelleğindeki boş düğüm kullanılır, yoksa yeni
+     * düğüm ayrılır. Sadece çalışanın kendi iş parçacığı çağırır
+     *
+     * @param Worker& Worker
+     * @param task_t&& Task
+     * @return TaskNode*
+     */
+    [[nodiscard]]
+    TaskNode* ThreadPool::make_node(Worker& ar_worker, task_t&& ar_task)
+    {
+        if( ar_worker.m_cache.empty() )
+            return new TaskNode{ std::move(ar_task) };
+
+        TaskNode* tm_node = ar_worker.m_cache.back().release();
+        ar_worker.m_cache.pop_back();
+
+        tm_node->m_func = std::move(ar_task);
+        return tm_node;
+    }
+
+    /**
+     * @brief Free Node
+     *
+     * Görevi alınmış düğümü çalışanın önbelleğine geri koyar,
+     * önbellek doluysa siler. Düğümü hangi çalışan eklemiş
+     * olursa olsun çalıştıran çalışanın önbelleğine döner
+     *
+     * @param Worker& Worker
+     * @param TaskNode* Node
+     */
+    void ThreadPool::free_node(Worker& ar_worker, TaskNode* ar_node) noexcept
+    {
+        ar_node->m_func = nullptr;
+
+        if( ar_worker.m_cache.size() < _MAX_NODE_CACHE )
+            ar_worker.m_cache.emplace_back(ar_node);
+        else
+            delete ar_node;
+    }
+
+    /**
+     * @brief Park
+     * 
+     * Çalışanı bekleyenler listesine yazıp uyutur. Listeye yazdıktan
+     * sonra kuyruklara bir kez daha bakılır; ekleyen taraf görevi
+     * yazdıktan sonra bekleyenlere baktığı için iki taraftan biri
+     * mutlaka diğerini görür ve uyandırma kaybolmaz.
+     * Çalışan sayısı en az sayının üstünde ise boşta kalma süresi
+     * kadar uyunur, süre dolunca çalışan emekli olmayı dener.
+     * Çalışan emekli olduysa false döner
+     * 
+     * @param size_t Index
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::park(std::size_t ar_index) noexcept
+    {
+        Worker& tm_worker = *this->m_queues[ar_index];
+
+        {
+            std::lock_guard<std::mutex> tm_lock(this->m_idle_mtx);
+            this->m_idle.push_back(ar_index);
+            this->m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if( this->has_task() || !this->is_running() )
+        {
+            std::lock_guard<std::mutex> tm_lock(this->m_idle_mtx);
+
+            auto tm_iter = std::find(this->m_idle.begin(), this->m_idle.end(), ar_index);
+            if( tm_iter != this->m_idle.end() )
+            {
+                this->m_idle.erase(tm_iter);
+                this->m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            // ALREADY WOKEN, CONSUME THE NOTIFY BELOW
+        }
+
+        const auto tm_woken = [this, &tm_worker]{
+            return tm_worker.m_notified || !this->is_running();
+        };
+
+        std::unique_lock<std::mutex> tm_lock(tm_worker.m_park_mtx);
+        while( !tm_woken() )
+        {
+            if( this->m_live.load(std::memory_order_relaxed) <= this->m_min )
+            {
+                tm_worker.m_park_convar.wait(tm_lock, tm_woken);
+                break;
+            }
+
+            const std::chrono::nanoseconds tm_idle_time(this->m_idle_time.load(std::memory_order_relaxed));
+            if( tm_worker.m_park_convar.wait_for(tm_lock, tm_idle_time, tm_woken) )
+                break;
+
+            // IDLE FOR TOO LONG, LEAVE THE POOL IF STILL LISTED
+            tm_lock.unlock();
+            {
+                std::lock_guard<std::mutex> tm_idle_lock(this->m_idle_mtx);
+
+                auto tm_iter = std::find(this->m_idle.begin(), this->m_idle.end(), ar_index);
+                if( tm_iter == this->m_idle.end() || this->m_live.load(std::memory_order_relaxed) <= this->m_min )
+                {
+                    // WOKEN MEANWHILE OR NEEDED, KEEP SLEEPING
+                    tm_lock.lock();
+                    continue;
+                }
+
+                this->m_idle.erase(tm_iter);
+                this->m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            return !this->retire(ar_index);
+        }
+
+        tm_worker.m_notified = false;
+        return true;
+    }
+
+    /**
+     * @brief Retire
+     * 
+     * Bekleyenler listesinden çıkmış çalışanı sonlanmak üzere
+     * işaretler. Çalışan sayısı düşürüldükten sonra kuyruklara bir
+     * kez daha bakılır; ekleyen taraf görevi yazdıktan sonra çalışan
+     * sayısına baktığı için ya görev burada görülür ve çalışan
+     * kalır ya da ekleyen taraf yeni çalışan başlatır. Kilit, yeni
+     * çalışanın bu yuvayı ancak karar verildikten sonra almasını sağlar
+     * 
+     * @param size_t Index
+     * @return bool
+     */
+    [[nodiscard]]
+    bool ThreadPool::retire(std::size_t ar_index) noexcept
+    {
+        std::lock_guard<std::mutex> tm_lock(this->m_spawn_mtx);
+
+        if( this->m_live.load(std::memory_order_relaxed) <= this->m_min || !this->is_running() )
+            return false;
+
+        this->m_live.fetch_sub(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if( this->has_task() )
+        {
+            this->m_live.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        this->m_queues[ar_index]->m_active = false;
+        return true;
+    }
+
+    /**
+     * @brief Wake
+     * 
+     * Bekleyenler listesinden en son uyuyanlardan başlayarak
+     * verilen sayı kadar çalışanı tek kilitte alıp uyandırır.
+     * Uyuyan yoksa kilit alınmaz. Uyandırılan çalışan sayısını
+     * döndürür
+     * 
+     * @param size_t Count
+     * @return size_t
+     */
+    std::size_t ThreadPool::wake(std::size_t ar_count) noexcept
+    {
+        if( this->m_sleeping.load(std::memory_order_seq_cst) == 0 )
+            return 0;
+
+        std::lock_guard<std::mutex> tm_lock(this->m_idle_mtx);
+
+        std::size_t tm_woken = 0;
+        for(; tm_woken < ar_count && !this->m_idle.empty(); ++tm_woken)
+        {
+            Worker& tm_worker = *this->m_queues[this->m_idle.back()];
+            this->m_idle.pop_back();
+            this->m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+            {
+                std::lock_guard<std::mutex> tm_park_lock(tm_worker.m_park_mtx);
+                tm_worker.m_notified = true;
+            }
+
+            tm_worker.m_park_convar.notify_one();
+        }
+
+        return tm_woken;
+    }
+
+    /**
+     * @brief Wake All
+     * 
+     * Sonlandırma sırasında tüm çalışanları uyandırır
+     */
+    void ThreadPool::wake_all() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> tm_lock(this->m_idle_mtx);
+            this->m_idle.clear();
+            this->m_sleeping.store(0, std::memory_order_relaxed);
+        }
+
+        for(auto& tm_worker : this->m_queues)
+        {
+            {
+                std::lock_guard<std::mutex> tm_lock(tm_worker->m_park_mtx);
+                tm_worker->m_notified = true;
+            }
+
+            tm_worker->m_park_convar.notify_one();
+        }
+    }
+
+    /**
+     * @brief Grow
+     * 
+     * Görev eklendikten ya da çalıştırıldıktan sonra çağrılır.
+     * Çalışan sayısı en az sayının (ilk görevde en az 1) altında
+     * ise eksikler başlatılır. Uyuyan çalışan bulamayan görevler
+     * kaldıysa ve tüm çalışanlar görev çalıştırıyorsa beklemenin
+     * bir sınırı olmadığı için hemen bir çalışan başlatılır. İş
+     * arayan çalışan varsa beklemenin başladığı an tutulur; kuyruk
+     * o andan beri hiç boşalmadan bekleme süresi aşıldıysa bir
+     * çalışan daha başlatılır. Süreyi çalışanlar kuyruk
+     * boşaldığında sıfırlar
+     * 
+     * @param size_t Backlog
+     */
+    void ThreadPool::grow(const std::size_t ar_backlog) noexcept
+    {
+        const std::size_t tm_floor = std::max<std::size_t>(1, this->m_min);
+        const std::size_t tm_live = this->m_live.load(std::memory_order_seq_cst);
+
+        if( tm_live >= this->m_workers.size() )
+            return;
+
+        if( tm_live < tm_floor )
+        {
+            this->spawn(tm_floor);
+            return;
+        }
+
+        // EVERY LIVE WORKER IS INSIDE A TASK
+        if( ar_backlog > 0 && this->m_searching.load(std::memory_order_seq_cst) == 0 )
+        {
+            this->spawn(tm_live + 1);
+            return;
+        }
+
+        const std::int64_t tm_now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+
+        std::int64_t tm_stall = this->m_stall.load(std::memory_order_relaxed);
+        if( tm_stall == 0 )
+        {
+            if( ar_backlog > 0 )
+                this->m_stall.compare_exchange_strong(tm_stall, tm_now, std::memory_order_relaxed);
+
+            return;
+        }
+
+        if( tm_now - tm_stall < this->m_grow_wait.load(std::memory_order_relaxed) )
+            return;
+
+        // ONE GROWER PER WAIT PERIOD
+        if( this->m_stall.compare_exchange_strong(tm_stall, tm_now, std::memory_order_relaxed) )
+            this->spawn(tm_live + 1);
+    }
+
+    /**
+     * @brief Spawn
+     * 
+     * Çalışan sayısı verilen hedefe ulaşana kadar boş yuvalarda
+     * çalışan başlatır. Yuvada emekli olmuş çalışanın iş parçacığı
+     * varsa önce onun bitmesi beklenir. Havuz durmuşsa ya da iş
+     * parçacığı oluşturulamazsa başlatmayı bırakır
+     * 
+     * @param size_t Target
+     */
+    void ThreadPool::spawn(const std::size_t ar_target) noexcept
+    {
+        std::lock_guard<std::mutex> tm_lock(this->m_spawn_mtx);
+
+        for(std::size_t tm_index = 0; tm_index < this->m_workers.size(); ++tm_index)
+        {
+            if( this->m_live.load(std::memory_order_relaxed) >= ar_target || !this->is_running() )
+                return;
+
+            Worker& tm_worker = *this->m_queues[tm_index];
+            if( tm_worker.m_active )
+                continue;
+
+            try {
+                if( this->m_workers[tm_index].joinable() )
+                    this->m_workers[tm_index].join();
+
+                tm_worker.m_active = true;
+                this->m_live.fetch_add(1, std::memory_order_seq_cst);
+
+                this->m_workers[tm_index] = std::thread([this, tm_index]{
+                    this->run(tm_index);
+                });
+            } catch(...) {
+                if( tm_worker.m_active )
+                {
+                    tm_worker.m_active = false;
+                    this->m_live.fetch_sub(1, std::memory_order_seq_cst);
+                }
+
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Shutdown
+     * 
+     * Sonlandırma yapmadan önce hala çalışır durumda olmasını kontrol eder.
+     * Durmuş ise eğer, zaten sonlandırılmış demektir. Tüm durumlara
+     * bildirim gönderir. Döngü ile tüm çalışanları (workers) sırayla kontrol eder.
+     * Eğer sonlandırılabilecek durumda ise ve ana işlem değilse sonlandırır
+     */
+    void ThreadPool::shutdown() noexcept
+    {
+        if( this->m_stop.exchange(true, std::memory_order_acq_rel) )
+            return;
+
+        // NO WORKER IS STARTED AFTER THIS
+        {
+            std::lock_guard<std::mutex> tm_lock(this->m_spawn_mtx);
+        }
+
+        this->wake_all();
+
+        // DROP PENDING TASKS SO FUTURES AND GROUPS WAKE UP
+        this->drop_inbox();
+
+        const std::thread::id tm_self_id = std::this_thread::get_id();
+        for(auto& tm_worker : this->m_workers) {
+            if( tm_worker.joinable() && tm_worker.get_id() != tm_self_id )
+                tm_worker.join();
+        }
+
+        // TASKS PUSHED WHILE STOPPING
+        this->drop_inbox();
+    }
+
+    /**
+     * @brief Has Hint
+     * 
+     * Şeridin bekleyen görev sayısının ortak sayaçta tutulup
+     * tutulmadığını döndürür. Varsayılan şerit (Normal) sayılmaz;
+     * sık yolda ortak bir sayaca yazılmaz, diğer şeritler boşken
+     * çalışanlar kuyruklarına bakmadan geçer
+     * 
+     * @param size_t Lane
+     * @return bool
+     */
+    [[nodiscard]]
+    constexpr bool ThreadPool::has_hint(const std::size_t ar_lane) noexcept
+    {
+        return ar_lane != static_cast<std::size_t>(lane_t::Normal);
+    }
+
+    /**
+     * @brief Sub Hint
+     * 
+     * Sayılan şeritten alınan ya da silinen görevleri düşer
+     * 
+     * @param size_t Lane
+     * @param size_t Count
+     */
+    void ThreadPool::sub_hint(const std::size_t ar_lane, const std::size_t ar_count) noexcept
+    {
+        if( ar_count > 0 && has_hint(ar_lane) )
+            this->m_hint[ar_lane].fetch_sub(ar_count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drop
+     * 
+     * Havuz durduğunda çalışanın kendi kuyruğunda kalan görevleri
+     * siler. Sadece çalışanın kendisi çağırır
+     * 
+     * @param size_t Index
+     */
+    void ThreadPool::drop(std::size_t ar_index) noexcept
+    {
+        for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+            this->sub_hint(tm_lane, this->m_queues[ar_index]->m_lanes[tm_lane].m_deque.clear());
+    }
+
+    /**
+     * @brief Drop Inbox
+     * 
+     * Tüm gelen kutularında kalan görevleri siler. Silinen
+     * görevlerin Future ve TaskGroup'ları broken_promise ile uyanır
+     */
+    void ThreadPool::drop_inbox() noexcept
+    {
+        for(auto& tm_worker : this->m_queues)
+        {
+            for(std::size_t tm_lane = 0; tm_lane < _SIZE_LANE; ++tm_lane)
+            {
+                Lane& tm_queue = tm_worker->m_lanes[tm_lane];
+
+                std::lock_guard<std::mutex> tm_lock(tm_queue.m_inbox_mtx);
+                this->sub_hint(tm_lane, tm_queue.m_inbox.clear());
+                tm_queue.m_inbox_size.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Stop
+     * 
+     * İşlem havuzunu durdurarak sonlandırır
+     */
+    void ThreadPool::stop() noexcept
+    {
+        this->shutdown();
+    }
+
+    /**
+     * @brief Stop
+     * 
+     * Sonlandırma yapmadan önce hala çalışır durumda olmasını kontrol eder.
+     * Durmuş ise eğer, zaten sonlandırılmış demektir. Tüm durumlara
+     * bildirim gönderir. Döngü ile tüm çalışanları (workers) sırayla kontrol eder.
+     * Eğer sonlandırılabilecek durumda ise ve ana işlem değilse sonlandırır
+     * 
+     * @brief vector<thread::id>& Thread ID Vector
+     */
+    void ThreadPool::stop(const std::vector<std::thread::id>& ar_tid) noexcept
+    {
+        const std::thread::id tm_self_id = std::this_thread::get_id();
+
+        for(auto& tm_worker : this->m_workers)
+        {
+            if( tm_worker.get_id() == tm_self_id )
+                continue;
+
+            for( auto& tm_thread_id : ar_tid )
+            {
+                if( tm_thread_id == tm_worker.get_id() && tm_worker.joinable() )
+                    tm_worker.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Crashed
+     * 
+     * Beklenmedik sonlanmaların oluşmasını durumunda
+     * yapıda son yapılması gerekenleri yapar.
+     * Sınıfı sonlandırarak işlemlerin başarı ve güvenle
+     * sonlanmasını sağlar
+     */
+    void ThreadPool::crashed() noexcept
+    {
+        this->shutdown();
+    }
+
+    /**
+     * @brief Set Value
+     * 
+     * Sonucu yazar ve bekleyenleri uyandırır. İlk yazılan sonuç
+     * ya da hata geçerlidir, sonrakiler yok sayılır
+     * 
+     * @tparam Value Value
+     * @param Value&&... Value
+     */
+    template<class Result>
+    template<class... Value>
+    void FutureState<Result>::set_value(
+        Value&&... ar_value
+    )
+    {
+        std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+        if( this->m_ready.load(std::memory_order_relaxed) )
+            return;
+
+        this->m_value.emplace(std::forward<Value>(ar_value)...);
+        this->m_ready.store(true, std::memory_order_release);
+        this->m_convar.notify_all();
+    }
+
+    /**
+     * @brief Set Error
+     * 
+     * Hatayı yazar ve bekleyenleri uyandırır
+     * 
+     * @param exception_ptr Error
+     */
+    template<class Result>
+    void FutureState<Result>::set_error(
+        std::exception_ptr ar_error
+    ) noexcept
+    {
+        std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+        if( this->m_ready.load(std::memory_order_relaxed) )
+            return;
+
+        this->m_error = std::move(ar_error);
+        this->m_ready.store(true, std::memory_order_release);
+        this->m_convar.notify_all();
+    }
+
+    /**
+     * @brief Future
+     * 
+     * @param shared_ptr<FutureState<Result>> State
+     */
+    template<class Result>
+    Future<Result>::Future(
+        std::shared_ptr<FutureState<Result>> ar_state
+    ) noexcept
+        : m_state(std::move(ar_state))
+    {}
+
+    /**
+     * @brief Is Valid
+     * 
+     * Future'ın bir görevin sonucuna bağlı olup olmadığını döndürür
+     * 
+     * @return bool
+     */
+    template<class Result>
+    [[nodiscard]]
+    bool Future<Result>::is_valid() const noexcept
+    {
+        return this->m_state != nullptr;
+    }
+
+    /**
+     * @brief Is Ready
+     * 
+     * Sonucun ya da hatanın yazılıp yazılmadığını döndürür
+     * 
+     * @return bool
+     */
+    template<class Result>
+    [[nodiscard]]
+    bool Future<Result>::is_ready() const noexcept
+    {
+        return this->m_state && this->m_state->m_ready.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Wait
+     * 
+     * Sonuç hazır olana kadar bekler. Havuzun çalışanı beklerken
+     * bekleyen görevleri çalıştırır, görev kalmazsa uyur
+     */
+    template<class Result>
+    void Future<Result>::wait() const noexcept
+    {
+        if( !this->m_state )
+            return;
+
+        while( !this->is_ready() )
+        {
+            if( ThreadPool::run_pending() )
+                continue;
+
+            std::unique_lock<std::mutex> tm_lock(this->m_state->m_mtx);
+            this->m_state->m_convar.wait(tm_lock, [this] {
+                return this->m_state->m_ready.load(std::memory_order_relaxed);
+            });
+        }
+    }
+
+    /**
+     * @brief Wait For
+     * 
+     * Sonucu en fazla verilen süre kadar bekler. Süre içinde
+     * hazır olursa true döner
+     * 
+     * @param duration Time
+     * @return bool
+     */
+    template<class Result>
+    template<class Rep, class Period>
+    [[nodiscard]]
+    bool Future<Result>::wait_for(
+        const std::chrono::duration<Rep, Period>& ar_time
+    ) const noexcept
+    {
+        if( !this->m_state )
+            return false;
+
+        const auto tm_deadline = std::chrono::steady_clock::now() + ar_time;
+        while( !this->is_ready() )
+        {
+            if( std::chrono::steady_clock::now() >= tm_deadline )
+                return false;
+
+            if( ThreadPool::run_pending() )
+                continue;
+
+            std::unique_lock<std::mutex> tm_lock(this->m_state->m_mtx);
+            return this->m_state->m_convar.wait_until(tm_lock, tm_deadline, [this] {
+                return this->m_state->m_ready.load(std::memory_order_relaxed);
+            });
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Get
+     * 
+     * Sonucu bekler ve döndürür. Görev hata fırlatmışsa aynı hata
+     * fırlatılır. Sonuç Future'dan taşınır, bir kez alınmalıdır
+     * 
+     * @return Result
+     */
+    template<class Result>
+    Result Future<Result>::get()
+    {
+        if( !this->m_state )
+            throw std::future_error(std::future_errc::no_state);
+
+        this->wait();
+
+        std::shared_ptr<FutureState<Result>> tm_state = std::move(this->m_state);
+        if( tm_state->m_error )
+            std::rethrow_exception(tm_state->m_error);
+
+        if constexpr( !std::is_void_v<Result> )
+            return std::move(*tm_state->m_value);
+    }
+
+    /**
+     * @brief ~TaskGroup
+     * 
+     * Kümedeki görevler bitene kadar bekler, görev hataları
+     * yok sayılır
+     */
+    TaskGroup::~TaskGroup()
+    {
+        try {
+            this->wait();
+        } catch(...) {}
+    }
+
+    /**
+     * @brief Is Done
+     * 
+     * Kümede bekleyen görev kalıp kalmadığını döndürür
+     * 
+     * @return bool
+     */
+    [[nodiscard]]
+    bool TaskGroup::is_done() const noexcept
+    {
+        return this->m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @brief Get Pending
+     * 
+     * Kümede bitmeyi bekleyen görev sayısını döndürür
+     * 
+     * @return size_t
+     */
+    [[nodiscard]]
+    std::size_t TaskGroup::get_pending() const noexcept
+    {
+        return this->m_pending.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Add
+     * 
+     * Kümeye verilen sayı kadar görev ekler. Boş kümeye ekleme
+     * kilit altında yapılır, dolu kümeye ekleme kilitsizdir
+     * 
+     * @param size_t Count
+     */
+    void TaskGroup::add(
+        const std::size_t ar_count
+    ) noexcept
+    {
+        if( ar_count == 0 )
+            return;
+
+        std::size_t tm_pending = this->m_pending.load(std::memory_order_acquire);
+        while( tm_pending > 0 )
+        {
+            if( this->m_pending.compare_exchange_weak(tm_pending, tm_pending + ar_count, std::memory_order_acq_rel, std::memory_order_acquire) )
+                return;
+        }
+
+        std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+        if( this->m_pending.fetch_add(ar_count, std::memory_order_acq_rel) == 0 )
+            this->m_finished = false;
+    }
+
+    /**
+     * @brief Done
+     * 
+     * Kümeden bir görevi düşer, görev hata ile bittiyse ilk hata
+     * saklanır. Son görev kilit altında düşülür ve bekleyenler
+     * kilit bırakılmadan uyandırılır; bekleyen küme nesnesini
+     * sildiğinde bu fonksiyon kümeye artık dokunmaz
+     * 
+     * @param exception_ptr Error
+     */
+    void TaskGroup::done(
+        std::exception_ptr ar_error
+    ) noexcept
+    {
+        if( ar_error )
+        {
+            std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+            if( !this->m_error )
+                this->m_error = std::move(ar_error);
+        }
+
+        std::size_t tm_pending = this->m_pending.load(std::memory_order_acquire);
+        while( tm_pending > 1 )
+        {
+            if( this->m_pending.compare_exchange_weak(tm_pending, tm_pending - 1, std::memory_order_acq_rel, std::memory_order_acquire) )
+                return;
+        }
+
+        std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+        if( this->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+        {
+            this->m_finished = true;
+            this->m_convar.notify_all();
+        }
+    }
+
+    /**
+     * @brief Wait
+     * 
+     * Kümedeki görevler bitene kadar bekler. Havuzun çalışanı
+     * beklerken bekleyen görevleri çalıştırır. Görevlerden biri
+     * hata fırlattıysa ilk hata fırlatılır ve küme yeniden
+     * kullanılabilir hale gelir
+     */
+    void TaskGroup::wait()
+    {
+        while( !this->is_done() && ThreadPool::run_pending() )
+        {}
+
+        std::unique_lock<std::mutex> tm_lock(this->m_mtx);
+        this->m_convar.wait(tm_lock, [this] { return this->m_finished; });
+
+        if( this->m_error )
+            std::rethrow_exception(std::exchange(this->m_error, nullptr));
+    }
+
+    /**
+     * @brief Wait For
+     * 
+     * Kümeyi en fazla verilen süre kadar bekler. Süre içinde
+     * biterse true döner, görev hataları wait ile alınır
+     * 
+     * @param duration Time
+     * @return bool
+     */
+    template<class Rep, class Period>
+    [[nodiscard]]
+    bool TaskGroup::wait_for(
+        const std::chrono::duration<Rep, Period>& ar_time
+    ) noexcept
+    {
+        const auto tm_deadline = std::chrono::steady_clock::now() + ar_time;
+        while( !this->is_done() && std::chrono::steady_clock::now() < tm_deadline && ThreadPool::run_pending() )
+        {}
+
+        std::unique_lock<std::mutex> tm_lock(this->m_mtx);
+        return this->m_convar.wait_until(tm_lock, tm_deadline, [this] { return this->m_finished; });
+    }
+
+    /**
+     * @brief GroupTask
+     * 
+     * Görevi kümeye sayar
+     * 
+     * @param TaskGroup& Group
+     * @param Func&& Function
+     */
+    template<class Func>
+    GroupTask<Func>::GroupTask(
+        TaskGroup& ar_group,
+        Func&& ar_func
+    )
+        : m_group(nullptr), m_func(std::move(ar_func))
+    {
+        ar_group.add(1);
+        this->m_group = &ar_group;
+    }
+
+    /**
+     * @brief GroupTask
+     * 
+     * Kümedeki sayım taşınan göreve geçer
+     * 
+     * @param GroupTask&& Task
+     */
+    template<class Func>
+    GroupTask<Func>::GroupTask(
+        GroupTask&& ar_task
+    ) noexcept(std::is_nothrow_move_constructible_v<Func>)
+        : m_group(nullptr), m_func(std::move(ar_task.m_func))
+    {
+        this->m_group = std::exchange(ar_task.m_group, nullptr);
+    }
+
+    /**
+     * @brief ~GroupTask
+     * 
+     * Görev çalışmadan silinirse küme broken_promise hatası ile düşülür
+     */
+    template<class Func>
+    GroupTask<Func>::~GroupTask()
+    {
+        if( this->m_group )
+            this->m_group->done(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+    }
+
+    /**
+     * @brief Operator ()
+     * 
+     * Görevi çalıştırır ve kümeden düşer. Görevin hatası kümeye yazılır
+     */
+    template<class Func>
+    void GroupTask<Func>::operator()()
+    {
+        TaskGroup* tm_group = std::exchange(this->m_group, nullptr);
+
+        try {
+            this->m_func();
+        } catch(...) {
+            tm_group->done(std::current_exception());
+            return;
+        }
+
+        tm_group->done();
+    }
+
+    /**
+     * @brief FutureTask
+     * 
+     * @param shared_ptr<FutureState<Result>> State
+     * @param Func&& Function
+     */
+    template<class Result, class Func>
+    FutureTask<Result, Func>::FutureTask(
+        std::shared_ptr<FutureState<Result>> ar_state,
+        Func&& ar_func
+    )
+        : m_state(std::move(ar_state)), m_func(std::move(ar_func))
+    {}
+
+    /**
+     * @brief FutureTask
+     * 
+     * @param FutureTask&& Task
+     */
+    template<class Result, class Func>
+    FutureTask<Result, Func>::FutureTask(
+        FutureTask&& ar_task
+    ) noexcept(std::is_nothrow_move_constructible_v<Func>)
+        : m_state(nullptr), m_func(std::move(ar_task.m_func))
+    {
+        this->m_state = std::move(ar_task.m_state);
+    }
+
+    /**
+     * @brief ~FutureTask
+     * 
+     * Görev çalışmadan silinirse sonuca broken_promise hatası yazılır
+     */
+    template<class Result, class Func>
+    FutureTask<Result, Func>::~FutureTask()
+    {
+        if( this->m_state )
+            this->m_state->set_error(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+    }
+
+    /**
+     * @brief Operator ()
+     * 
+     * Görevi çalıştırır, sonucu ya da hatayı Future'a yazar
+     */
+    template<class Result, class Func>
+    void FutureTask<Result, Func>::operator()()
+    {
+        std::shared_ptr<FutureState<Result>> tm_state = std::move(this->m_state);
+
+        try {
+            if constexpr( std::is_void_v<Result> )
+            {
+                this->m_func();
+                tm_state->set_value(true);
+            }
+            else
+                tm_state->set_value(this->m_func());
+        } catch(...) {
+            tm_state->set_error(std::current_exception());
+        }
     }
-}
\ No newline at end of file
+}
@@ -83,6 +83,7 @@ namespace netsocket::client
         client_reinit_err,
         client_not_running,
         server_ip_type_not_valid,
+        session_open_err,
         
         succ = 21000,
         connected_and_handshake_verified,
@@ -176,6 +177,8 @@ namespace netsocket::client
             Status send(const socket_t ar_sock, const DataPacket& ar_datapack) noexcept override;
             Status recv(const socket_t ar_sock, DataPacket& ar_datapack) noexcept override;
 
+            Status rotate_key(const std::string& ar_key) noexcept override;
+
             Status run() noexcept override;
             Status stop() noexcept override;
 
@@ -184,6 +187,7 @@ namespace netsocket::client
         protected:
             Status init() noexcept override;
 
+            void rekeyed(const socket_t ar_sock, const std::string& ar_key) noexcept override;
             void crashed() noexcept override;
     };
 
@@ -398,8 +402,19 @@ namespace netsocket::client
         // STATUS VARIABLE FOR HANDSHAKE
         Status tm_handshake;
 
+        // RANDOM FOR SESSION KEY, NO PREDICTABLE SALT
+        Hello tm_own { this->get_feature(), {} };
+        if( !Socket::make_random(tm_own.m_random).is_ok() )
+        {
+            // LOG
+            if( this->get_flag().has(_FLAG_SOCKET_LOGGER) )
+                this->get_logger().write(level_t::Err, this->get_server_ip() + " Session Random Failed");
+
+            return Status::err(domain_t::client, status::to_underlying(client_code_t::session_open_err));
+        }
+
         // HANDSHAKE SEND VERIFY
-        tm_handshake = Socket::handshake_send_verify(this->get_socket());
+        tm_handshake = Socket::handshake_send_verify(this->get_socket(), tm_own.m_feature, tm_own.m_random);
         if( !tm_handshake.is_ok() )
         {
             // LOG
@@ -410,7 +425,8 @@ namespace netsocket::client
         }
 
         // HANDSHAKE RECV VERIFY
-        tm_handshake = Socket::handshake_recv_verify(this->get_socket());
+        Hello tm_peer {};
+        tm_handshake = Socket::handshake_recv_verify(this->get_socket(), tm_peer.m_feature, tm_peer.m_random);
         if( !tm_handshake.is_ok() )
         {
             // LOG
@@ -420,6 +436,16 @@ namespace netsocket::client
             return Status::err(domain_t::client, status::to_underlying(client_code_t::server_recv_handshake_err));
         }
 
+        // OPEN SESSION WITH BOTH HANDSHAKE RECORDS, CLIENT RECORD FIRST
+        if( !this->open_session(this->get_socket(), tm_own, tm_peer).is_ok() )
+        {
+            // LOG
+            if( this->get_flag().has(_FLAG_SOCKET_LOGGER) )
+                this->get_logger().write(level_t::Err, this->get_server_ip() + " Session Open Failed");
+
+            return Status::err(domain_t::client, status::to_underlying(client_code_t::session_open_err));
+        }
+
         // ADD TO CONNECTS LIST
         {
             std::scoped_lock tm_lock(s_connects_mtx);
@@ -489,7 +515,8 @@ namespace netsocket::client
                 this->m_handler(*this);
 
             // SOCKET CLOSE
-            const Status tm_close = this->close();
+            this->close_session(tm_client_sock);
+            [[maybe_unused]] const Status tm_close = this->close();
             DEBUG_ONLY(this->get_logger().write(level_t::Debug, "Client Socket Close, Code: " + std::to_string(tm_close.get_code()), GET_SOURCE));
 
             // REMOVE SERVER CONNECTION DATA FROM LIST
@@ -761,6 +788,24 @@ namespace netsocket::client
         return Socket::recv(ar_sock, ar_datapack);
     }
 
+    /**
+     * @brief Rotate Key
+     * 
+     * Anahtarı sadece sunucu değiştirir, istemci yeni anahtarı
+     * sunucunun duyurusundan alır. İki uç aynı anda duyurursa
+     * iki taraf farklı anahtarda kalacağından istemcide
+     * anahtar değişimi key_not_rotate ile reddedilir
+     * 
+     * @param string& Key
+     * @return Status
+     */
+    Status Client::rotate_key(
+        [[maybe_unused]] const std::string& ar_key
+    ) noexcept
+    {
+        return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_rotate));
+    }
+
     /**
      * @brief Initialize
      * 
@@ -986,6 +1031,27 @@ namespace netsocket::client
         this->get_logger().write("============================");
     }
 
+    /**
+     * @brief Rekeyed
+     * 
+     * Sunucu bağlantı üzerinden yeni anahtar bildirdiğinde
+     * bunu ana anahtar olarak saklar, böylece bağlantı koptuktan
+     * sonra tekrar bağlanırken yeni anahtar ile el sıkışılır
+     * 
+     * @param socket_t Socket
+     * @param string& Key
+     */
+    void Client::rekeyed(
+        [[maybe_unused]] const socket_t ar_sock,
+        const std::string& ar_key
+    ) noexcept
+    {
+        [[maybe_unused]] const Status tm_master = this->set_master(ar_key);
+
+        // DEBUG LOG
+        DEBUG_ONLY(this->get_logger().write(tm_master.is_ok() ? level_t::Debug : level_t::Warn, this->get_policy().get_username(), Socket::get_ip(ar_sock) + (tm_master.is_ok() ? " Master Key Rotated" : " Master Key Not Rotated"), GET_SOURCE));
+    }
+
     /**
      * @brief Crashed
      * 
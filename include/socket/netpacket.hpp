@@ -1,55 +1,128 @@
 // Abdulkadir U. - 21/12/2025
 // Abdulkadir U. - 2026/02/09
+// Abdulkadir U. - 2026/10/18
 #pragma once
 
 // Include
+#include <new>
 #include <string>
 #include <array>
 #include <vector>
 #include <algorithm>
 #include <charconv>
+#include <string_view>
 
 #include <kits/toolkit.hpp>
+#include <tools/hash/crc32c.hpp>
+
+#include <socket/netschema.hpp>
 
 // Namespace
 namespace netsocket::netpacket
 {
-    static inline constexpr uint32_t _SIZE_HEADER = 10;
+    // Type Definition
+    using frame_t = uint8_t;
 
     static inline constexpr uint32_t _SIZE_PASSWORD = 384;
     static inline constexpr uint32_t _SIZE_USERNAME = 128;
     static inline constexpr uint32_t _SIZE_MESSAGE = 2048;
 
-    static inline constexpr uint32_t _PACK_LEN_PASSWORD = 3;
-    static inline constexpr uint32_t _PACK_LEN_USERNAME = 3;
-    static inline constexpr uint32_t _PACK_LEN_MESSAGE = 4;
-
-    static inline constexpr uint32_t _PACK_START_LEN_PASSWORD = 0;
-    static inline constexpr uint32_t _PACK_START_LEN_USERNAME = _PACK_START_LEN_PASSWORD + _PACK_LEN_PASSWORD;
-    static inline constexpr uint32_t _PACK_START_LEN_MESSAGE = _PACK_START_LEN_USERNAME + _PACK_LEN_USERNAME;
-
-    static inline constexpr uint32_t _PACK_LEN_TOTAL = _PACK_LEN_PASSWORD + _PACK_LEN_USERNAME + _PACK_LEN_MESSAGE;
-    static inline constexpr uint32_t _PACK_START_LEN_TOTAL = _PACK_LEN_PASSWORD + _PACK_LEN_USERNAME + _PACK_LEN_MESSAGE;
-    static inline constexpr uint32_t _SIZE_SOCKET_TOTAL = _PACK_START_LEN_TOTAL + _SIZE_PASSWORD + _SIZE_USERNAME + _SIZE_MESSAGE;
+    // Schema
+    static inline constexpr uint32_t _FIELD_PASSWORD = 0;
+    static inline constexpr uint32_t _FIELD_USERNAME = 1;
+    static inline constexpr uint32_t _FIELD_MESSAGE = 2;
+    static inline constexpr uint32_t _FIELD_FRAME = 3;
+
+    using DataSchema = netschema::Schema<
+        netschema::Text<_SIZE_PASSWORD>,
+        netschema::Text<_SIZE_USERNAME>,
+        netschema::Text<_SIZE_MESSAGE>,
+        netschema::Value<frame_t>
+    >;
+
+    // Limit (Derived From Schema)
+    static inline constexpr uint32_t _SIZE_HEADER = DataSchema::size_header;
+    static inline constexpr uint32_t _SIZE_TRAILER = sizeof(tools::hash::crc32c::crc_t);
+    static inline constexpr uint32_t _SIZE_SEAL = 32; // byte
+
+    static inline constexpr uint32_t _PACK_LEN_PASSWORD = DataSchema::ss_width[_FIELD_PASSWORD];
+    static inline constexpr uint32_t _PACK_LEN_USERNAME = DataSchema::ss_width[_FIELD_USERNAME];
+    static inline constexpr uint32_t _PACK_LEN_MESSAGE = DataSchema::ss_width[_FIELD_MESSAGE];
+    static inline constexpr uint32_t _PACK_LEN_FRAME = DataSchema::ss_width[_FIELD_FRAME];
+
+    static inline constexpr uint32_t _PACK_START_LEN_PASSWORD = DataSchema::ss_offset[_FIELD_PASSWORD];
+    static inline constexpr uint32_t _PACK_START_LEN_USERNAME = DataSchema::ss_offset[_FIELD_USERNAME];
+    static inline constexpr uint32_t _PACK_START_LEN_MESSAGE = DataSchema::ss_offset[_FIELD_MESSAGE];
+    static inline constexpr uint32_t _PACK_START_LEN_FRAME = DataSchema::ss_offset[_FIELD_FRAME];
+
+    static inline constexpr uint32_t _PACK_LEN_TOTAL = DataSchema::size_header;
+    static inline constexpr uint32_t _PACK_START_LEN_TOTAL = DataSchema::size_header;
+    static inline constexpr uint32_t _SIZE_SOCKET_TOTAL = DataSchema::size_total;
+    static inline constexpr uint32_t _SIZE_FRAME_TOTAL = _SIZE_SOCKET_TOTAL + _SIZE_SEAL + _SIZE_TRAILER;
 
     static inline constexpr uint32_t _SIZE_OVER_SOCKET = _SIZE_SOCKET_TOTAL + 128;
     static inline constexpr uint32_t _SIZE_UNDER_SOCKET = _SIZE_PASSWORD + _SIZE_USERNAME;
 
-    static inline constexpr uint32_t _POS_START_PASSWORD = _PACK_START_LEN_TOTAL;
+    static inline constexpr uint32_t _POS_START_PASSWORD = DataSchema::size_header + DataSchema::ss_payload_offset[_FIELD_PASSWORD];
     static inline constexpr uint32_t _POS_END_PASSWORD = _POS_START_PASSWORD + _SIZE_PASSWORD;
 
-    static inline constexpr uint32_t _POS_START_USERNAME = _POS_END_PASSWORD;
+    static inline constexpr uint32_t _POS_START_USERNAME = DataSchema::size_header + DataSchema::ss_payload_offset[_FIELD_USERNAME];
     static inline constexpr uint32_t _POS_END_USERNAME = _POS_START_USERNAME + _SIZE_USERNAME;
 
-    static inline constexpr uint32_t _POS_START_MESSAGE = _POS_END_USERNAME;
+    static inline constexpr uint32_t _POS_START_MESSAGE = DataSchema::size_header + DataSchema::ss_payload_offset[_FIELD_MESSAGE];
     static inline constexpr uint32_t _POS_END_MESSAGE = _POS_START_MESSAGE + _SIZE_MESSAGE;
 
+    // Type Definition
+    using buffer_t = std::array<std::byte, _SIZE_FRAME_TOTAL>;
+
+    // Flag
+    static inline constexpr frame_t _FRAME_NULL = { 0 << 0 };
+    static inline constexpr frame_t _FRAME_COMPRESS = { 1 << 0 };
+    static inline constexpr frame_t _FRAME_CRC = { 1 << 1 };
+    static inline constexpr frame_t _FRAME_AEAD = { 1 << 2 };
+    static inline constexpr frame_t _FRAME_REKEY = { 1 << 3 };
+    static inline constexpr frame_t _FRAME_EPOCH = { 0xF0 };
+
+    // Key Epoch (Upper Bits Of Frame)
+    static inline constexpr uint32_t _POS_FRAME_EPOCH = 4;
+    static inline constexpr uint8_t _SIZE_EPOCH = (_FRAME_EPOCH >> _POS_FRAME_EPOCH) + 1;
+
+    /**
+     * @brief Get Epoch
+     *
+     * Çerçeve bayrağının üst bitlerindeki anahtar dönemini döndürür
+     *
+     * @param frame_t Frame
+     * @return uint8_t
+     */
+    static inline constexpr uint8_t get_epoch(const frame_t _frame) noexcept
+    {
+        return static_cast<uint8_t>((_frame & _FRAME_EPOCH) >> _POS_FRAME_EPOCH);
+    }
+
+    /**
+     * @brief Set Epoch
+     *
+     * Anahtar dönemini çerçeve bayrağının üst bitlerine yazar
+     *
+     * @param frame_t Frame
+     * @param uint8_t Epoch
+     * @return frame_t
+     */
+    static inline constexpr frame_t set_epoch(const frame_t _frame, const uint8_t _epoch) noexcept
+    {
+        return static_cast<frame_t>((_frame & ~_FRAME_EPOCH) | ((_epoch << _POS_FRAME_EPOCH) & _FRAME_EPOCH));
+    }
+
     // Using Namespace
     using namespace tools::charset;
+    using namespace tools::hash;
 
     // Class
     class NetPacket final
     {
+        static_assert(_SIZE_HEADER == _PACK_LEN_TOTAL);
+        static_assert(_SIZE_HEADER == 12, "Header layout is part of the wire format");
         static_assert(_POS_START_PASSWORD + _SIZE_PASSWORD <= _SIZE_SOCKET_TOTAL);
         static_assert(_POS_START_USERNAME + _SIZE_USERNAME <= _SIZE_SOCKET_TOTAL);
         static_assert(_POS_START_MESSAGE + _SIZE_MESSAGE <= _SIZE_SOCKET_TOTAL);
@@ -58,20 +131,16 @@ namespace netsocket::netpacket
             std::string password;
             std::string username;
             std::string message;
+            frame_t frame { _FRAME_NULL };
 
             std::vector<std::byte> buffer;
 
-            static inline void append_bytes(
-                std::vector<std::byte>& _out,
-                const char* _data,
-                std::uint32_t _len
-            ) noexcept;
-
         public:
             NetPacket(
                 const std::string& _u8_pwd,
                 const std::string& _u8_usrname,
-                const std::string& _u8_msg
+                const std::string& _u8_msg,
+                const frame_t _frame = _FRAME_NULL
             );
 
             NetPacket(
@@ -87,11 +156,13 @@ namespace netsocket::netpacket
             inline const std::string& getPassword() const noexcept;
             inline const std::string& getUsername() const noexcept;
             inline const std::string& getMessage() const noexcept;
+            inline frame_t getFrame() const noexcept;
 
             const std::vector<std::byte>& pack(
                 const std::string& _u8_pwd,
                 const std::string& _u8_usrname,
-                const std::string& _u8_msg
+                const std::string& _u8_msg,
+                const frame_t _frame = _FRAME_NULL
             ) noexcept;
 
             const std::vector<std::byte>& pack(
@@ -99,25 +170,101 @@ namespace netsocket::netpacket
                 const std::u32string& _u32_usrname,
                 const std::u32string& _u32_msg
             ) noexcept;
+
+            static std::size_t layout(
+                std::byte* _out,
+                std::size_t _cap,
+                std::string_view _u8_pwd,
+                std::string_view _u8_usrname,
+                std::string_view _u8_msg,
+                const frame_t _frame = _FRAME_NULL
+            ) noexcept;
+
+            static inline std::size_t seal(
+                std::byte* _out,
+                std::size_t _len,
+                std::size_t _cap,
+                const frame_t _frame
+            ) noexcept;
+
+            static std::size_t encode(
+                std::byte* _out,
+                std::size_t _cap,
+                std::string_view _u8_pwd,
+                std::string_view _u8_usrname,
+                std::string_view _u8_msg,
+                const frame_t _frame = _FRAME_NULL
+            ) noexcept;
+
+            static std::size_t encode(
+                std::byte* _out,
+                std::size_t _cap,
+                const std::u32string& _u32_pwd,
+                const std::u32string& _u32_usrname,
+                const std::u32string& _u32_msg,
+                const frame_t _frame = _FRAME_NULL
+            ) noexcept;
+
+            static inline std::size_t encode(
+                buffer_t& _out,
+                std::string_view _u8_pwd,
+                std::string_view _u8_usrname,
+                std::string_view _u8_msg,
+                const frame_t _frame = _FRAME_NULL
+            ) noexcept
+            { return encode(_out.data(), _out.size(), _u8_pwd, _u8_usrname, _u8_msg, _frame); }
+
+            static inline std::size_t encode(
+                buffer_t& _out,
+                const std::u32string& _u32_pwd,
+                const std::u32string& _u32_usrname,
+                const std::u32string& _u32_msg,
+                const frame_t _frame = _FRAME_NULL
+            ) noexcept
+            { return encode(_out.data(), _out.size(), _u32_pwd, _u32_usrname, _u32_msg, _frame); }
     };
 
-    void NetPacket::append_bytes(
-        std::vector<std::byte>& _out,
-        const char* _data,
-        std::uint32_t _len
+    /**
+     * @brief Seal
+     * 
+     * Çerçeve bayrağında CRC varsa başlık ve veri üzerinden
+     * hesaplanan CRC32C değerini büyük sonlu (big endian)
+     * olarak sona ekler. Alan yetersizse 0 döner
+     * 
+     * @param byte* Output
+     * @param size_t Length
+     * @param size_t Capacity
+     * @param frame_t Frame
+     * @return size_t
+     */
+    std::size_t NetPacket::seal(
+        std::byte* _out,
+        const std::size_t _len,
+        const std::size_t _cap,
+        const frame_t _frame
     ) noexcept
     {
-        const std::byte* b = reinterpret_cast<const std::byte*>(_data);
-        _out.insert(_out.end(), b, b + _len);
+        if( !(_frame & _FRAME_CRC) )
+            return _len;
+
+        if( _len + _SIZE_TRAILER > _cap )
+            return 0;
+
+        const crc32c::crc_t tm_crc = crc32c::crc32c(_out, _len);
+        for(uint32_t tm_count = 0; tm_count < _SIZE_TRAILER; ++tm_count)
+            _out[_len + tm_count] = static_cast<std::byte>((tm_crc >> (8 * (_SIZE_TRAILER - 1 - tm_count))) & 0xFF);
+
+        return _len + _SIZE_TRAILER;
     }
 
     NetPacket::NetPacket(
         const std::string& _u8_pwd,
         const std::string& _u8_usrname,
-        const std::string& _u8_msg
+        const std::string& _u8_msg,
+        const frame_t _frame
     )
     {
-        this->pack(_u8_pwd, _u8_usrname, _u8_msg);
+        this->pack(_u8_pwd, _u8_usrname, _u8_msg, _frame);
     }
 
     NetPacket::NetPacket(
@@ -159,40 +306,46 @@ namespace netsocket::netpacket
         return this->message;
     }
 
+    frame_t NetPacket::getFrame(
+    ) const noexcept
+    {
+        return this->frame;
+    }
+
     const std::vector<std::byte>& NetPacket::pack(
         const std::string& _u8_pwd,
         const std::string& _u8_usrname,
-        const std::string& _u8_msg
+        const std::string& _u8_msg,
+        const frame_t _frame
     ) noexcept
     {
         this->password.clear();
         this->username.clear();
         this->message.clear();
+        this->frame = _FRAME_NULL;
         this->buffer.clear();
 
-        if( _u8_usrname.empty() || _u8_msg.empty() )
-            return this->buffer;
-
-        char header[_SIZE_HEADER + 1] {};
-
-        std::snprintf(
-            header,
-            sizeof(header),
-            "%03zu%03zu%04zu",
-            _u8_pwd.size(),
-            _u8_usrname.size(),
-            _u8_msg.size()
-        );
+        // EMPTY BUFFER ON ALLOCATION FAILURE, SAME AS AN INVALID PACKET
+        try {
+            this->buffer.resize(_SIZE_HEADER + _u8_pwd.size() + _u8_usrname.size() + _u8_msg.size() + _SIZE_TRAILER);
 
-        append_bytes(this->buffer, header, _SIZE_HEADER);
+            const std::size_t tm_len = encode(this->buffer.data(), this->buffer.size(), _u8_pwd, _u8_usrname, _u8_msg, _frame);
+            this->buffer.resize(tm_len);
 
-        append_bytes(this->buffer, _u8_pwd.data(), _u8_pwd.size());
-        append_bytes(this->buffer, _u8_usrname.data(), _u8_usrname.size());
-        append_bytes(this->buffer, _u8_msg.data(), _u8_msg.size());
+            if( tm_len == 0 )
+                return this->buffer;
 
-        this->password = _u8_pwd;
-        this->username = _u8_usrname;
-        this->message = _u8_msg;
+            this->password = _u8_pwd;
+            this->username = _u8_usrname;
+            this->message = _u8_msg;
+            this->frame = _frame;
+        } catch( const std::bad_alloc& ) {
+            this->password.clear();
+            this->username.clear();
+            this->message.clear();
+            this->frame = _FRAME_NULL;
+            this->buffer.clear();
+        }
 
         return this->buffer;
     }
@@ -203,10 +356,164 @@ namespace netsocket::netpacket
         const std::u32string& _u32_msg
     ) noexcept
     {
-        return this->pack(
-            utf::to_utf8(_u32_pwd),
-            utf::to_utf8(_u32_usrname),
-            utf::to_utf8(_u32_msg)
-        );
+        this->password.clear();
+        this->username.clear();
+        this->message.clear();
+        this->frame = _FRAME_NULL;
+        this->buffer.clear();
+
+        // EMPTY BUFFER ON ALLOCATION FAILURE, SAME AS AN INVALID PACKET
+        try {
+            this->buffer.resize(_SIZE_FRAME_TOTAL);
+
+            const std::size_t tm_len = encode(this->buffer.data(), this->buffer.size(), _u32_pwd, _u32_usrname, _u32_msg);
+            this->buffer.resize(tm_len);
+
+            if( tm_len == 0 )
+                return this->buffer;
+
+            // FIELDS BACK FROM ENCODED PAYLOAD, NO SECOND CONVERSION
+            DataSchema::values_t tm_values {};
+            DataSchema::texts_t tm_texts {};
+            const char* tm_raw = reinterpret_cast<const char*>(this->buffer.data());
+
+            if( DataSchema::read_header(tm_raw, tm_values)
+                && DataSchema::decode(tm_raw + _SIZE_HEADER, tm_len - _SIZE_HEADER, tm_values, tm_texts) )
+            {
+                this->password = tm_texts[_FIELD_PASSWORD];
+                this->username = tm_texts[_FIELD_USERNAME];
+                this->message = tm_texts[_FIELD_MESSAGE];
+            }
+        } catch( const std::bad_alloc& ) {
+            this->password.clear();
+            this->username.clear();
+            this->message.clear();
+            this->frame = _FRAME_NULL;
+            this->buffer.clear();
+        }
+
+        return this->buffer;
+    }
+
+    /**
+     * @brief Encode
+     * 
+     * Paketi bellek ayırmadan verilen alana yazar ve yazılan
+     * bayt sayısını döndürür. Kullanıcı adı ya da mesaj boşsa,
+     * bir alan sınırını aşarsa ya da alan yetersizse 0 döner.
+     * Alan olarak buffer_t verilirse her paket sığar
+     * 
+     * @param byte* Output
+     * @param size_t Capacity
+     * @param string_view Password
+     * @param string_view Username
+     * @param string_view Message
+     * @param frame_t Frame
+     * @return size_t
+     */
+    std::size_t NetPacket::encode(
+        std::byte* _out,
+        const std::size_t _cap,
+        const std::string_view _u8_pwd,
+        const std::string_view _u8_usrname,
+        const std::string_view _u8_msg,
+        const frame_t _frame
+    ) noexcept
+    {
+        const std::size_t tm_len = layout(_out, _cap, _u8_pwd, _u8_usrname, _u8_msg, _frame);
+        if( tm_len == 0 )
+            return 0;
+
+        return seal(_out, tm_len, _cap, _frame);
+    }
+
+    /**
+     * @brief Layout
+     * 
+     * Başlığı ve açık veriyi verilen alana yazar, sona CRC
+     * eklemez. Veri bölümü yerinde şifrelenecekse önce bu
+     * fonksiyon, şifrelemeden sonra seal çağrılır
+     * 
+     * @param byte* Output
+     * @param size_t Capacity
+     * @param string_view Password
+     * @param string_view Username
+     * @param string_view Message
+     * @param frame_t Frame
+     * @return size_t
+     */
+    std::size_t NetPacket::layout(
+        std::byte* _out,
+        const std::size_t _cap,
+        const std::string_view _u8_pwd,
+        const std::string_view _u8_usrname,
+        const std::string_view _u8_msg,
+        const frame_t _frame
+    ) noexcept
+    {
+        if( _u8_usrname.empty() || _u8_msg.empty() )
+            return 0;
+
+        DataSchema::values_t tm_values {};
+        tm_values[_FIELD_FRAME] = _frame;
+
+        const DataSchema::texts_t tm_texts { _u8_pwd, _u8_usrname, _u8_msg, std::string_view() };
+
+        return DataSchema::encode(_out, _cap, tm_values, tm_texts);
+    }
+
+    /**
+     * @brief Encode (UTF-32)
+     * 
+     * UTF-32 alanları ara metin oluşturmadan doğrudan
+     * verilen alana UTF-8 olarak yazar
+     * 
+     * @param byte* Output
+     * @param size_t Capacity
+     * @param u32string& Password
+     * @param u32string& Username
+     * @param u32string& Message
+     * @param frame_t Frame
+     * @return size_t
+     */
+    std::size_t NetPacket::encode(
+        std::byte* _out,
+        const std::size_t _cap,
+        const std::u32string& _u32_pwd,
+        const std::u32string& _u32_usrname,
+        const std::u32string& _u32_msg,
+        const frame_t _frame
+    ) noexcept
+    {
+        if( _u32_usrname.empty() || _u32_msg.empty() )
+            return 0;
+
+        const std::size_t tm_len_pwd = utf::utf8_size(_u32_pwd);
+        const std::size_t tm_len_name = utf::utf8_size(_u32_usrname);
+        const std::size_t tm_len_msg = utf::utf8_size(_u32_msg);
+
+        if( tm_len_pwd > _SIZE_PASSWORD || tm_len_name > _SIZE_USERNAME || tm_len_msg > _SIZE_MESSAGE )
+            return 0;
+
+        const std::size_t tm_len = _SIZE_HEADER + tm_len_pwd + tm_len_name + tm_len_msg;
+        if( tm_len > _cap )
+            return 0;
+
+        DataSchema::values_t tm_values {};
+        tm_values[_FIELD_PASSWORD] = static_cast<netschema::value_t>(tm_len_pwd);
+        tm_values[_FIELD_USERNAME] = static_cast<netschema::value_t>(tm_len_name);
+        tm_values[_FIELD_MESSAGE] = static_cast<netschema::value_t>(tm_len_msg);
+        tm_values[_FIELD_FRAME] = _frame;
+
+        char* tm_out = reinterpret_cast<char*>(_out);
+        if( !DataSchema::write_header(tm_out, tm_values) )
+            return 0;
+
+        tm_out += _SIZE_HEADER;
+        tm_out += utf::to_utf8(_u32_pwd, tm_out, tm_len_pwd);
+        tm_out += utf::to_utf8(_u32_usrname, tm_out, tm_len_name);
+        tm_out += utf::to_utf8(_u32_msg, tm_out, tm_len_msg);
+
+        return seal(_out, tm_len, _cap, _frame);
     }
 }
\ No newline at end of file
@@ -0,0 +1,449 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Net Schema (Paket Şeması)
+ *
+ * Paket başlığındaki alanların genişlik, taban ve sınır
+ * değerleri elle tutulan sabitler yerine derleme zamanında
+ * alan listesinden üretilir. Başlık yerleşimi (offset), veri
+ * yerleşimi, yazma ve okuma fonksiyonları ile protokol özeti
+ * (hash) aynı tanımdan çıkar. Yeni bir paket türü için sadece
+ * alan listesi yazmak yeterlidir, sabit konumlu yazıcı ve
+ * okuyucu otomatik olarak oluşur
+ *
+ * Metin (Text) alanı başlıkta onluk tabanda uzunluk olarak,
+ * veride ise ham bayt olarak yer alır. Değer (Value) alanı
+ * sadece başlıkta onaltılık tabanda yer alır
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Namespace
+namespace netsocket::netschema
+{
+    // Type Definition
+    using value_t = uint32_t;
+
+    // Enum
+    enum class kind_t : uint8_t
+    {
+        text = 1,
+        value = 2
+    };
+
+    /**
+     * @brief Digits
+     *
+     * Verilen en büyük değerin belirtilen tabanda kaç
+     * basamak ile yazılacağını hesaplar
+     *
+     * @param uint64_t Max
+     * @param uint32_t Radix
+     * @return uint32_t
+     */
+    constexpr uint32_t digits(
+        uint64_t ar_max,
+        const uint32_t ar_radix
+    ) noexcept
+    {
+        uint32_t tm_digits = 1;
+        while( ar_max >= ar_radix )
+        {
+            ar_max /= ar_radix;
+            ++tm_digits;
+        }
+        return tm_digits;
+    }
+
+    // Struct
+    template<uint32_t MaxT>
+    struct Text
+    {
+        static_assert(MaxT > 0, "Text field needs a positive limit");
+
+        static constexpr kind_t kind = kind_t::text;
+        static constexpr uint32_t radix = 10;
+        static constexpr uint32_t max = MaxT;
+        static constexpr uint32_t width = digits(MaxT, 10);
+    };
+
+    template<class ValueT>
+    struct Value
+    {
+        static_assert(std::is_unsigned_v<ValueT> && sizeof(ValueT) <= sizeof(value_t), "Value field must be an unsigned integer up to 32 bits");
+
+        static constexpr kind_t kind = kind_t::value;
+        static constexpr uint32_t radix = 16;
+        static constexpr uint32_t max = std::numeric_limits<ValueT>::max();
+        static constexpr uint32_t width = sizeof(ValueT) * 2;
+    };
+
+    // Namespace
+    namespace detail
+    {
+        template<size_t N>
+        constexpr std::array<uint32_t, N> prefix(const std::array<uint32_t, N>& ar_size) noexcept
+        {
+            std::array<uint32_t, N> tm_offset {};
+            uint32_t tm_sum = 0;
+            for(size_t tm_count = 0; tm_count < N; ++tm_count)
+            {
+                tm_offset[tm_count] = tm_sum;
+                tm_sum += ar_size[tm_count];
+            }
+            return tm_offset;
+        }
+
+        template<size_t N>
+        constexpr uint32_t sum(const std::array<uint32_t, N>& ar_size) noexcept
+        {
+            uint32_t tm_sum = 0;
+            for(size_t tm_count = 0; tm_count < N; ++tm_count)
+                tm_sum += ar_size[tm_count];
+            return tm_sum;
+        }
+
+        constexpr uint32_t mix(uint32_t ar_hash, const uint32_t ar_value) noexcept
+        {
+            for(uint32_t tm_count = 0; tm_count < sizeof(uint32_t); ++tm_count)
+            {
+                ar_hash ^= (ar_value >> (8 * tm_count)) & 0xFF;
+                ar_hash *= 0x01000193u;
+            }
+            return ar_hash;
+        }
+
+        static constexpr char ss_digitmap[16] =
+        {
+            '0', '1', '2', '3', '4', '5', '6', '7',
+            '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+        };
+
+        constexpr int digit_value(const char ar_char) noexcept
+        {
+            if( ar_char >= '0' && ar_char <= '9' ) return ar_char - '0';
+            if( ar_char >= 'a' && ar_char <= 'f' ) return ar_char - 'a' + 10;
+            if( ar_char >= 'A' && ar_char <= 'F' ) return ar_char - 'A' + 10;
+            return -1;
+        }
+    }
+
+    // Struct
+    template<class... FieldsT>
+    struct Schema
+    {
+        static_assert(sizeof...(FieldsT) > 0, "Schema needs at least one field");
+
+        static constexpr uint32_t count = sizeof...(FieldsT);
+
+        using values_t = std::array<value_t, count>;
+        using texts_t = std::array<std::string_view, count>;
+
+        static constexpr std::array<kind_t, count> ss_kind = { FieldsT::kind... };
+        static constexpr std::array<uint32_t, count> ss_radix = { FieldsT::radix... };
+        static constexpr std::array<uint32_t, count> ss_max = { FieldsT::max... };
+        static constexpr std::array<uint32_t, count> ss_width = { FieldsT::width... };
+        static constexpr std::array<uint32_t, count> ss_block = { (FieldsT::kind == kind_t::text ? FieldsT::max : 0)... };
+
+        static constexpr std::array<uint32_t, count> ss_offset = detail::prefix(ss_width);
+        static constexpr std::array<uint32_t, count> ss_payload_offset = detail::prefix(ss_block);
+
+        static constexpr uint32_t size_header = detail::sum(ss_width);
+        static constexpr uint32_t size_payload = detail::sum(ss_block);
+        static constexpr uint32_t size_total = size_header + size_payload;
+
+        static constexpr uint32_t hash = []() constexpr {
+            uint32_t tm_hash = detail::mix(0x811c9dc5u, count);
+            for(uint32_t tm_count = 0; tm_count < count; ++tm_count)
+            {
+                tm_hash = detail::mix(tm_hash, static_cast<uint32_t>(ss_kind[tm_count]));
+                tm_hash = detail::mix(tm_hash, ss_radix[tm_count]);
+                tm_hash = detail::mix(tm_hash, ss_width[tm_count]);
+                tm_hash = detail::mix(tm_hash, ss_max[tm_count]);
+            }
+            return tm_hash;
+        }();
+
+        private:
+            template<uint32_t IndexT>
+            static bool write_field(char* ar_out, value_t ar_value) noexcept;
+
+            template<uint32_t IndexT>
+            static bool read_field(const char* ar_in, value_t& ar_value) noexcept;
+
+            template<size_t... IndexT>
+            static bool write_all(char* ar_out, const values_t& ar_values, std::index_sequence<IndexT...>) noexcept;
+
+            template<size_t... IndexT>
+            static bool read_all(const char* ar_in, values_t& ar_values, std::index_sequence<IndexT...>) noexcept;
+
+        public:
+            static bool write_header(char* ar_out, const values_t& ar_values) noexcept;
+            static bool read_header(const char* ar_in, values_t& ar_values) noexcept;
+
+            static uint32_t payload_size(const values_t& ar_values) noexcept;
+
+            static size_t encode(std::byte* ar_out, size_t ar_cap, values_t& ar_values, const texts_t& ar_texts) noexcept;
+            static bool decode(const char* ar_payload, size_t ar_len, const values_t& ar_values, texts_t& ar_texts) noexcept;
+    };
+
+    /**
+     * @brief Write Field
+     *
+     * Tek alanı sabit konumuna, sabit genişlikte ve sıfır
+     * dolgulu olarak yazar. Genişlik ve taban derleme zamanında
+     * bilindiği için döngü açılmış olarak üretilir
+     *
+     * @param char* Header
+     * @param value_t Value
+     * @return bool
+     */
+    template<class... FieldsT>
+    template<uint32_t IndexT>
+    bool Schema<FieldsT...>::write_field(
+        char* ar_out,
+        value_t ar_value
+    ) noexcept
+    {
+        constexpr uint32_t tm_radix = ss_radix[IndexT];
+        constexpr uint32_t tm_width = ss_width[IndexT];
+
+        if( ar_value > ss_max[IndexT] )
+            return false;
+
+        char* tm_out = ar_out + ss_offset[IndexT];
+        for(uint32_t tm_count = tm_width; tm_count > 0; --tm_count)
+        {
+            tm_out[tm_count - 1] = detail::ss_digitmap[ar_value % tm_radix];
+            ar_value /= tm_radix;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Read Field
+     *
+     * Tek alanı sabit konumundan okur. Geçersiz karakter ya
+     * da sınırı aşan değer bulunursa başarısız döner
+     *
+     * @param char* Header
+     * @param value_t& Value
+     * @return bool
+     */
+    template<class... FieldsT>
+    template<uint32_t IndexT>
+    bool Schema<FieldsT...>::read_field(
+        const char* ar_in,
+        value_t& ar_value
+    ) noexcept
+    {
+        constexpr uint32_t tm_radix = ss_radix[IndexT];
+        constexpr uint32_t tm_width = ss_width[IndexT];
+
+        const char* tm_in = ar_in + ss_offset[IndexT];
+        uint64_t tm_value = 0;
+
+        for(uint32_t tm_count = 0; tm_count < tm_width; ++tm_count)
+        {
+            const int tm_digit = detail::digit_value(tm_in[tm_count]);
+            if( tm_digit < 0 || static_cast<uint32_t>(tm_digit) >= tm_radix )
+                return false;
+
+            tm_value = tm_value * tm_radix + static_cast<uint32_t>(tm_digit);
+        }
+
+        if( tm_value > ss_max[IndexT] )
+            return false;
+
+        ar_value = static_cast<value_t>(tm_value);
+        return true;
+    }
+
+    template<class... FieldsT>
+    template<size_t... IndexT>
+    bool Schema<FieldsT...>::write_all(
+        char* ar_out,
+        const values_t& ar_values,
+        std::index_sequence<IndexT...>
+    ) noexcept
+    {
+        return ( write_field<IndexT>(ar_out, ar_values[IndexT]) && ... );
+    }
+
+    template<class... FieldsT>
+    template<size_t... IndexT>
+    bool Schema<FieldsT...>::read_all(
+        const char* ar_in,
+        values_t& ar_values,
+        std::index_sequence<IndexT...>
+    ) noexcept
+    {
+        return ( read_field<IndexT>(ar_in, ar_values[IndexT]) && ... );
+    }
+
+    /**
+     * @brief Write Header
+     *
+     * Tüm alanları başlık alanına yazar. Başlık alanı en az
+     * size_header kadar olmalıdır
+     *
+     * @param char* Header
+     * @param values_t& Values
+     * @return bool
+     */
+    template<class... FieldsT>
+    bool Schema<FieldsT...>::write_header(
+        char* ar_out,
+        const values_t& ar_values
+    ) noexcept
+    {
+        return write_all(ar_out, ar_values, std::make_index_sequence<count>{});
+    }
+
+    /**
+     * @brief Read Header
+     *
+     * Başlık alanındaki tüm alanları okur. Herhangi bir alan
+     * hatalı ise başarısız döner
+     *
+     * @param char* Header
+     * @param values_t& Values
+     * @return bool
+     */
+    template<class... FieldsT>
+    bool Schema<FieldsT...>::read_header(
+        const char* ar_in,
+        values_t& ar_values
+    ) noexcept
+    {
+        return read_all(ar_in, ar_values, std::make_index_sequence<count>{});
+    }
+
+    /**
+     * @brief Payload Size
+     *
+     * Metin alanlarının uzunluk toplamını döndürür
+     *
+     * @param values_t& Values
+     * @return uint32_t
+     */
+    template<class... FieldsT>
+    uint32_t Schema<FieldsT...>::payload_size(
+        const values_t& ar_values
+    ) noexcept
+    {
+        uint32_t tm_size = 0;
+        for(uint32_t tm_count = 0; tm_count < count; ++tm_count)
+            if( ss_kind[tm_count] == kind_t::text )
+                tm_size += ar_values[tm_count];
+
+        return tm_size;
+    }
+
+    /**
+     * @brief Encode
+     *
+     * Metin alanlarının uzunluklarını değer listesine yazar,
+     * başlığı ve ardından metinleri sırasıyla verilen alana
+     * kopyalar. Alan yetersizse ya da bir alan sınırını aşarsa
+     * 0 döner, aksi halde yazılan bayt sayısını döndürür
+     *
+     * @param byte* Output
+     * @param size_t Capacity
+     * @param values_t& Values
+     * @param texts_t& Texts
+     * @return size_t
+     */
+    template<class... FieldsT>
+    size_t Schema<FieldsT...>::encode(
+        std::byte* ar_out,
+        const size_t ar_cap,
+        values_t& ar_values,
+        const texts_t& ar_texts
+    ) noexcept
+    {
+        // TEXT LENGTHS
+        for(uint32_t tm_count = 0; tm_count < count; ++tm_count)
+        {
+            if( ss_kind[tm_count] != kind_t::text )
+                continue;
+
+            if( ar_texts[tm_count].size() > ss_max[tm_count] )
+                return 0;
+
+            ar_values[tm_count] = static_cast<value_t>(ar_texts[tm_count].size());
+        }
+
+        const size_t tm_size = size_header + payload_size(ar_values);
+        if( tm_size > ar_cap )
+            return 0;
+
+        // HEADER
+        char* tm_out = reinterpret_cast<char*>(ar_out);
+        if( !write_header(tm_out, ar_values) )
+            return 0;
+
+        // PAYLOAD
+        size_t tm_pos = size_header;
+        for(uint32_t tm_count = 0; tm_count < count; ++tm_count)
+        {
+            if( ss_kind[tm_count] != kind_t::text || ar_texts[tm_count].empty() )
+                continue;
+
+            std::memcpy(tm_out + tm_pos, ar_texts[tm_count].data(), ar_texts[tm_count].size());
+            tm_pos += ar_texts[tm_count].size();
+        }
+
+        return tm_size;
+    }
+
+    /**
+     * @brief Decode
+     *
+     * Okunmuş başlık değerlerine göre veri alanını metin
+     * alanlarına böler. Kopyalama yapmaz, görünümler verilen
+     * alanı gösterir
+     *
+     * @param char* Payload
+     * @param size_t Length
+     * @param values_t& Values
+     * @param texts_t& Texts
+     * @return bool
+     */
+    template<class... FieldsT>
+    bool Schema<FieldsT...>::decode(
+        const char* ar_payload,
+        const size_t ar_len,
+        const values_t& ar_values,
+        texts_t& ar_texts
+    ) noexcept
+    {
+        if( ar_len < payload_size(ar_values) )
+            return false;
+
+        size_t tm_pos = 0;
+        for(uint32_t tm_count = 0; tm_count < count; ++tm_count)
+        {
+            if( ss_kind[tm_count] != kind_t::text )
+            {
+                ar_texts[tm_count] = std::string_view();
+                continue;
+            }
+
+            ar_texts[tm_count] = std::string_view(ar_payload + tm_pos, ar_values[tm_count]);
+            tm_pos += ar_values[tm_count];
+        }
+
+        return true;
+    }
+}
@@ -9,6 +9,16 @@
  * bir erişim politikası gereklidir. Sunucu'ya özel ve
  * İstemci'ye özel olan veya ikisine de ortak olan ayarları
  * içerir
+ *
+ * Şifreler tuzlu PBKDF2-HMAC-SHA256 özeti olarak saklanır ve
+ * sabit zamanda karşılaştırılır. Bağlantı katılırken gelen
+ * şifre bir kez özet ile doğrulanır, sonraki mesajlarda
+ * bağlantının doğrulama önbelleğindeki (AuthCache) politikaya
+ * ait anahtarla üretilmiş HMAC etiketi ile karşılaştırılır.
+ * Önbellek sadece şifre ya da şifre gerekliliği değişince
+ * geçersiz olur, yasaklama ve izin listesi önbelleği etkilemez.
+ * Karşıya gönderilen şifre doğrulayıcıdan ayrı tutulur, sadece
+ * doğrulama yapan uçta (set_verify_only) açık şifre tutulmaz
  */
 
 // Include
@@ -17,10 +27,15 @@
 #include <string>
 #include <atomic>
 #include <mutex>
+#include <array>
+#include <random>
 #include <unordered_set>
 
 #include <kits/corekit.hpp>
 
+#include <tools/hash/sha256.hpp>
+#include <tools/hash/fasthash.hpp>
+
 // Namespace
 namespace netsocket::policy
 {
@@ -31,6 +46,7 @@ namespace netsocket::policy
     // Using Namespace
     using namespace core::status;
     using namespace core::version;
+    using namespace tools::hash;
 
     // Socket Type Definiton
     using socket_t = int;
@@ -48,6 +64,12 @@ namespace netsocket::policy
     static constexpr name_len_t _MIN_LEN_PASSWORD = 4;
     static constexpr name_len_t _MAX_LEN_PASSWORD = 128;
 
+    static constexpr uint32_t _MIN_ROUNDS_PASSWORD = 1000;
+    static constexpr uint32_t _DEF_ROUNDS_PASSWORD = 100000;
+    static constexpr uint32_t _MAX_ROUNDS_PASSWORD = 10000000;
+
+    static constexpr std::size_t _SIZE_PASSWORD_SALT = 16; // byte
+
     static constexpr name_len_t _MIN_LEN_USERNAME = 2;
     static constexpr name_len_t _MAX_LEN_USERNAME = 32;
 
@@ -75,6 +97,8 @@ namespace netsocket::policy
         set_allow_fail,
         set_notallow_fail,
         socket_not_valid,
+        fail_set_password_rounds,
+        cache_key_not_make,
 
         succ = 1000,
         set_username,
@@ -89,6 +113,9 @@ namespace netsocket::policy
         can_auth_with_password,
         set_allow_ipaddr,
         set_notallow_ipaddr,
+        set_password_rounds,
+        can_auth_with_cache,
+        set_verify_only,
 
         warn = 2000,
         same_value,
@@ -98,24 +125,51 @@ namespace netsocket::policy
         info = 3000
     };
 
+    // Struct
+    struct PasswordHash
+    {
+        std::array<uint8_t, _SIZE_PASSWORD_SALT> m_salt {};
+        sha256::digest_t m_digest {};
+        uint32_t m_rounds { 0 };
+    };
+
+    // Struct
+    struct AuthCache
+    {
+        bool m_verified { false };
+        std::size_t m_version { 0 };
+        sha256::digest_t m_tag {};
+    };
+
     // Class
     class AccessPolicy final
     {
         private:
             std::atomic<bool> m_require_password { false };
+            std::atomic<uint32_t> m_password_rounds { _DEF_ROUNDS_PASSWORD };
+            std::atomic<bool> m_verify_only { false };
             std::string m_password {};
-            std::string m_old_password {};
+            PasswordHash m_password_hash {};
+            PasswordHash m_old_password_hash {};
+            sha256::digest_t m_password_tag {};
+            sha256::digest_t m_old_password_tag {};
+            std::atomic<std::size_t> m_password_gen { 0 };
             std::string m_username {};
 
             std::atomic<max_conn_t> m_max_connection { _DEF_CONNECTION };
             std::atomic<max_conn_t> m_max_same_ip { _DEF_SAME_IP_COUNT };
 
             std::unordered_set<socket_t> m_banned_socket_list;
-            std::unordered_set<std::string> m_allowed_ip_list;
+            std::unordered_set<std::string, fasthash::StringHash> m_allowed_ip_list;
 
             TimeVersion m_timever;
+            sha256::digest_t m_cache_key {};
+            bool m_cache_keyed { false };
             
             mutable std::mutex m_mtx;
+
+        private:
+            sha256::digest_t make_cache_tag(const std::string& ar_pwd) const noexcept;
         
         public:
             explicit AccessPolicy(
@@ -123,13 +177,18 @@ namespace netsocket::policy
                 const std::string& ar_password = ""
             );
 
+            inline bool has_error() const noexcept;
+
             inline bool is_connection_banned(const socket_t ar_socket) noexcept;
             inline bool is_connection_allowed(const std::string& ar_ipaddr) noexcept;
             inline bool is_require_password() const noexcept;
+            inline bool is_verify_only() const noexcept;
             
             inline const std::string& get_username() const noexcept;
             inline const std::string& get_password() const noexcept;
-            inline const std::string& get_old_password() const noexcept;
+            inline PasswordHash get_password_hash() const noexcept;
+            inline PasswordHash get_old_password_hash() const noexcept;
+            inline uint32_t get_password_rounds() const noexcept;
 
             inline max_conn_t get_max_connection() const noexcept;
             inline max_conn_t get_max_same_ip() const noexcept;
@@ -138,6 +197,8 @@ namespace netsocket::policy
 
             Status set_username(const std::string& ar_username) noexcept;
             Status set_password(const std::string& ar_password) noexcept;
+            Status set_password_rounds(const uint32_t ar_rounds = _DEF_ROUNDS_PASSWORD) noexcept;
+            Status set_verify_only(const bool ar_only = true) noexcept;
             Status set_require_password(const bool ar_require = true) noexcept;
             Status set_max_connection(const max_conn_t ar_max_conn = _DEF_CONNECTION) noexcept;
             Status set_max_same_ip(const max_conn_t ar_max_same_ip = _DEF_SAME_IP_COUNT) noexcept;
@@ -146,17 +207,23 @@ namespace netsocket::policy
 
             Status can_allow(const std::string& ar_ipaddr) noexcept;
             Status can_auth(const std::string& ar_ipaddr, const std::string& ar_pwd) noexcept;
+            Status can_auth(const std::string& ar_ipaddr, const std::string& ar_pwd, AuthCache& ar_cache) noexcept;
 
         public:
             [[maybe_unused]] [[nodiscard]] static bool is_valid_username(const std::string& ar_username) noexcept;
             [[maybe_unused]] [[nodiscard]] static bool is_valid_password(const std::string& ar_password) noexcept;
+            [[maybe_unused]] [[nodiscard]] static PasswordHash make_password_hash(const std::string& ar_password, const uint32_t ar_rounds = _DEF_ROUNDS_PASSWORD) noexcept;
+            [[maybe_unused]] [[nodiscard]] static bool is_password_match(const PasswordHash& ar_hash, const std::string& ar_password) noexcept;
     };
 
     /**
      * @brief AccessPolicy
      * 
      * Kullanıcı adı ve şifre alıp bunları
-     * ayarlayarak sınıfı başlatmış olur
+     * ayarlayarak sınıfı başlatmış olur. Doğrulama önbelleği
+     * etiketleri için rastgele bir anahtar üretilir, üretilemezse
+     * politika hatalı kalır (has_error) ve önbellekli giriş
+     * cache_key_not_make ile reddedilir
      * 
      * @param string& Username
      * @param string& Password
@@ -166,10 +233,58 @@ namespace netsocket::policy
         const std::string& ar_password
     )
     {
+        try {
+            std::random_device tm_device;
+            for(std::size_t tm_count = 0; tm_count < this->m_cache_key.size(); tm_count += 4)
+            {
+                const uint32_t tm_word = tm_device();
+                std::memcpy(this->m_cache_key.data() + tm_count, &tm_word, 4);
+            }
+
+            this->m_cache_keyed = true;
+        } catch(...) {}
+
         this->set_username(ar_username);
         this->set_password(ar_password);
     }
 
+    /**
+     * @brief Make Cache Tag
+     *
+     * Şifrenin politikaya ait anahtar ile HMAC etiketini
+     * üretir. Önbellekte şifrenin kendisi yerine bu etiket
+     * tutulur ve her mesajda tek bir HMAC hesaplanır
+     *
+     * @param string& Password
+     * @return digest_t
+     */
+    sha256::digest_t AccessPolicy::make_cache_tag(
+        const std::string& ar_pwd
+    ) const noexcept
+    {
+        sha256::digest_t tm_tag {};
+
+        sha256::Hmac tm_hmac(this->m_cache_key.data(), this->m_cache_key.size());
+        tm_hmac.update(ar_pwd.data(), ar_pwd.size());
+        tm_hmac.finish(tm_tag.data());
+
+        return tm_tag;
+    }
+
+    /**
+     * @brief Has Error
+     * 
+     * Doğrulama önbelleği anahtarının üretilemediğini
+     * döndürür. Bu durumda etiketler tahmin edilebilir
+     * olacağından önbellek kullanılmaz
+     * 
+     * @return bool
+     */
+    bool AccessPolicy::has_error() const noexcept
+    {
+        return !this->m_cache_keyed;
+    }
+
     /**
      * @brief Is Connection Banned
      * 
@@ -216,6 +331,19 @@ namespace netsocket::policy
         return this->m_require_password.load();
     }
 
+    /**
+     * @brief Is Verify Only
+     * 
+     * Politikanın sadece gelen şifreleri doğrulayıp açık
+     * şifre tutmadığını döndürür
+     * 
+     * @return bool
+     */
+    bool AccessPolicy::is_verify_only() const noexcept
+    {
+        return this->m_verify_only.load();
+    }
+
     /**
      * @brief Get Username
      * 
@@ -231,7 +359,9 @@ namespace netsocket::policy
     /**
      * @brief Get Password
      * 
-     * Şuanki şifreyi döndürür
+     * Bu ucun karşı tarafa gönderdiği şifreyi döndürür.
+     * Gelen şifrelerin doğrulanmasında kullanılmaz, sadece
+     * doğrulama yapan uçta boştur
      * 
      * @return string&
      */
@@ -241,15 +371,42 @@ namespace netsocket::policy
     }
 
     /**
-     * @brief Get Old Password
+     * @brief Get Password Hash
      * 
-     * Eski şifreyi döndürür
+     * Şuanki şifrenin tuzlu özetini döndürür
      * 
-     * @return string&
+     * @return PasswordHash
      */
-    const std::string& AccessPolicy::get_old_password() const noexcept
+    PasswordHash AccessPolicy::get_password_hash() const noexcept
     {
-        return this->m_old_password;
+        std::scoped_lock tm_lock(this->m_mtx);
+        return this->m_password_hash;
+    }
+
+    /**
+     * @brief Get Old Password Hash
+     * 
+     * Eski şifrenin tuzlu özetini döndürür. Eski şifre
+     * yoksa tur sayısı sıfırdır
+     * 
+     * @return PasswordHash
+     */
+    PasswordHash AccessPolicy::get_old_password_hash() const noexcept
+    {
+        std::scoped_lock tm_lock(this->m_mtx);
+        return this->m_old_password_hash;
+    }
+
+    /**
+     * @brief Get Password Rounds
+     * 
+     * Yeni şifre özetlenirken kullanılacak tur sayısı
+     * 
+     * @return uint32_t
+     */
+    uint32_t AccessPolicy::get_password_rounds() const noexcept
+    {
+        return this->m_password_rounds.load(std::memory_order_seq_cst);
     }
 
     /**
@@ -319,8 +476,10 @@ namespace netsocket::policy
      * 
      * Yeni bir şifre ayarlanmasını sağlar ve
      * verilen şifrenin geçerliliğini kontrol ettikten
-     * sonra şifreyi geçici olarak tutar. Yeni şifreyi
-     * ayarlar ve tutulan şifreyi eski şifre olarak ayarlar
+     * sonra şifrenin tuzlu özetini kilit dışında üretir.
+     * Yeni özeti ayarlar, öncekini ve etiketini eski şifre
+     * olarak tutar, politika ve şifre sürümünü artırır. Sadece
+     * doğrulama yapan uçta açık şifre saklanmaz
      * 
      * @param string& Password
      * @return Status
@@ -330,18 +489,84 @@ namespace netsocket::policy
         if( !is_valid_password(ar_password.c_str()) )
             return Status::err(domain_t::policy, to_underlying(policy_e::not_valid_password));
 
-        std::scoped_lock tm_lock(this->m_mtx);
+        // DERIVE OUTSIDE THE LOCK
+        const PasswordHash tm_hash = make_password_hash(ar_password, this->m_password_rounds.load(std::memory_order_seq_cst));
+        if( tm_hash.m_rounds == 0 )
+            return Status::err(domain_t::policy, to_underlying(policy_e::fail_set_password));
 
-        std::string tm_new_old_password = this->m_password;
-        this->m_password = ar_password;
+        const sha256::digest_t tm_tag = this->make_cache_tag(ar_password);
 
-        if( this->m_password != ar_password )
-            return Status::err(domain_t::policy, to_underlying(policy_e::fail_set_password));
+        std::scoped_lock tm_lock(this->m_mtx);
+
+        this->m_old_password_hash = this->m_password_hash;
+        this->m_old_password_tag = this->m_password_tag;
+        this->m_password_hash = tm_hash;
+        this->m_password_tag = tm_tag;
+        if( !this->m_verify_only.load(std::memory_order_seq_cst) )
+            this->m_password = ar_password;
+        this->m_password_gen.fetch_add(1, std::memory_order_seq_cst);
+        this->m_timever++;
 
-        this->m_old_password = tm_new_old_password;
         return Status::ok(domain_t::policy, to_underlying(policy_e::set_password));
     }
 
+    /**
+     * @brief Set Password Rounds
+     * 
+     * Bundan sonra ayarlanacak şifrelerin özetlenmesinde
+     * kullanılacak tur sayısını ayarlar. Ayarlanmış şifre
+     * kendi tur sayısı ile saklandığından etkilenmez
+     * 
+     * @param uint32_t Rounds
+     * @return Status
+     */
+    Status AccessPolicy::set_password_rounds(const uint32_t ar_rounds) noexcept
+    {
+        if( ar_rounds < _MIN_ROUNDS_PASSWORD )
+            return Status::err(domain_t::policy, to_underlying(policy_e::value_under_min));
+        else if( ar_rounds > _MAX_ROUNDS_PASSWORD )
+            return Status::err(domain_t::policy, to_underlying(policy_e::value_over_max));
+        else if( this->m_password_rounds.load(std::memory_order_seq_cst) == ar_rounds )
+            return Status::warn(domain_t::policy, to_underlying(policy_e::same_value));
+
+        this->m_password_rounds.store(ar_rounds, std::memory_order_seq_cst);
+        return this->m_password_rounds.load(std::memory_order_seq_cst) == ar_rounds ?
+            Status::ok(domain_t::policy, to_underlying(policy_e::set_password_rounds)) :
+            Status::err(domain_t::policy, to_underlying(policy_e::fail_set_password_rounds));
+    }
+
+    /**
+     * @brief Set Verify Only
+     * 
+     * Politikayı sadece gelen şifreleri doğrulayan uç (sunucu)
+     * olarak ayarlar. Açık şifre bellekten silinir ve bundan
+     * sonra ayarlanan şifrelerin sadece özeti tutulur
+     * 
+     * @param bool Only
+     * @return Status
+     */
+    Status AccessPolicy::set_verify_only(const bool ar_only) noexcept
+    {
+        std::scoped_lock tm_lock(this->m_mtx);
+
+        if( this->m_verify_only.load(std::memory_order_seq_cst) == ar_only )
+            return Status::warn(domain_t::policy, to_underlying(policy_e::same_value));
+
+        this->m_verify_only.store(ar_only, std::memory_order_seq_cst);
+
+        // CLEARTEXT MUST NOT STAY IN MEMORY
+        if( ar_only )
+        {
+            volatile char* tm_wipe = this->m_password.data();
+            for(std::size_t tm_count = 0; tm_count < this->m_password.size(); ++tm_count)
+                tm_wipe[tm_count] = 0;
+
+            this->m_password.clear();
+        }
+
+        return Status::ok(domain_t::policy, to_underlying(policy_e::set_verify_only));
+    }
+
     /**
      * @brief Set Require Password
      * 
@@ -358,6 +583,9 @@ namespace netsocket::policy
             return Status::warn(domain_t::policy, to_underlying(policy_e::same_value));
 
         this->m_require_password.store(ar_require, std::memory_order_seq_cst);
+        this->m_password_gen.fetch_add(1, std::memory_order_seq_cst);
+        this->m_timever++;
+
         return this->m_require_password.load(std::memory_order_seq_cst) == ar_require ?
             Status::ok(domain_t::policy, to_underlying(policy_e::set_require_password)) :
             Status::err(domain_t::policy, to_underlying(policy_e::fail_set_require_password));
@@ -530,9 +758,12 @@ namespace netsocket::policy
      * 
      * Belirtilen ip adresi izin verilmişse eğer, şifre kontrolüne tabi tutulur.
      * Şifre istenmiyorsa sorun değil ama aksi halde şifre doğruluğu yapar.
-     * Her ikisini de başarıyla geçerse, giriş yapabilir demektir
+     * Her ikisini de başarıyla geçerse, giriş yapabilir demektir. Şifre
+     * özetleri kilit altında kopyalanır, türetme kilit dışında ve
+     * sadece bir kez yapılır, eski şifre etiketi ile karşılaştırılır
      * 
      * @param string& IP
+     * @param string& Password
      * @return Status
      */
     Status AccessPolicy::can_auth(
@@ -547,11 +778,95 @@ namespace netsocket::policy
         if( !this->m_require_password.load(std::memory_order_seq_cst) )
             return Status::ok(domain_t::policy, to_underlying(policy_e::can_auth_no_password_require));
 
-        std::scoped_lock tm_lock(this->m_mtx);
+        PasswordHash tm_current {};
+        sha256::digest_t tm_old {};
+        bool tm_has_old = false;
+        {
+            std::scoped_lock tm_lock(this->m_mtx);
+            tm_current = this->m_password_hash;
+            tm_old = this->m_old_password_tag;
+            tm_has_old = this->m_old_password_hash.m_rounds != 0;
+        }
+
+        // OLD PASSWORD IS ONLY A HINT, CHECKED WITH ITS TAG INSTEAD OF A SECOND DERIVATION
+        if( is_password_match(tm_current, ar_pwd) )
+            return Status::ok(domain_t::policy, to_underlying(policy_e::can_auth_with_password));
+        else if( tm_has_old && this->m_cache_keyed && sha256::verify(this->make_cache_tag(ar_pwd).data(), tm_old.data(), sha256::_SIZE_DIGEST) )
+            return Status::warn(domain_t::policy, to_underlying(policy_e::cannot_auth_with_old_password));
+
+        return Status::err(domain_t::policy, to_underlying(policy_e::cannot_auth_password_not_matched));
+    }
+
+    /**
+     * @brief Can Auth
+     * 
+     * Bağlantının doğrulama önbelleği ile giriş kontrolü yapar.
+     * Önbellek şuanki şifre sürümünde doğrulanmışsa ve gelen
+     * şifrenin etiketi tutuyorsa türetme yapılmadan giriş kabul
+     * edilir. Aksi halde (bağlantı katılırken) şifre bir kez
+     * tuzlu özet ile doğrulanır, başarılı olursa önbellek bu
+     * sürüm ve şifrenin etiketi ile güncellenir. Eski şifre
+     * sadece etiketi ile karşılaştırılır. İzin
+     * listesi her mesajda kontrol edilir, yasaklama ve izin
+     * listesi değişiklikleri önbelleği geçersiz kılmaz
+     * 
+     * @param string& IP
+     * @param string& Password
+     * @param AuthCache& Cache
+     * @return Status
+     */
+    Status AccessPolicy::can_auth(
+        const std::string& ar_ipaddr,
+        const std::string& ar_pwd,
+        AuthCache& ar_cache
+    ) noexcept
+    {
+        const Status tm_status = this->can_allow(ar_ipaddr);
+        if( !tm_status.is_ok() )
+        {
+            ar_cache = {};
+            return tm_status;
+        }
+
+        if( !this->m_require_password.load(std::memory_order_seq_cst) )
+            return Status::ok(domain_t::policy, to_underlying(policy_e::can_auth_no_password_require));
+
+        // A ZERO KEY WOULD MAKE THE TAGS GUESSABLE
+        if( !this->m_cache_keyed )
+        {
+            ar_cache = {};
+            return Status::err(domain_t::policy, to_underlying(policy_e::cache_key_not_make));
+        }
+
+        const sha256::digest_t tm_tag = this->make_cache_tag(ar_pwd);
+
+        if( ar_cache.m_verified && ar_cache.m_version == this->m_password_gen.load(std::memory_order_seq_cst)
+            && sha256::verify(tm_tag.data(), ar_cache.m_tag.data(), sha256::_SIZE_DIGEST) )
+            return Status::ok(domain_t::policy, to_underlying(policy_e::can_auth_with_cache));
+
+        // JOIN, ONE FULL DERIVATION, LATER MESSAGES ONLY COMPARE THE TAG
+        PasswordHash tm_current {};
+        sha256::digest_t tm_old {};
+        bool tm_has_old = false;
+        std::size_t tm_version = 0;
+        {
+            std::scoped_lock tm_lock(this->m_mtx);
+            tm_current = this->m_password_hash;
+            tm_old = this->m_old_password_tag;
+            tm_has_old = this->m_old_password_hash.m_rounds != 0;
+            tm_version = this->m_password_gen.load(std::memory_order_seq_cst);
+        }
+
+        ar_cache = {};
+        if( is_password_match(tm_current, ar_pwd) )
+        {
+            ar_cache.m_verified = true;
+            ar_cache.m_version = tm_version;
+            ar_cache.m_tag = tm_tag;
 
-        if( ar_pwd == this->m_password )
             return Status::ok(domain_t::policy, to_underlying(policy_e::can_auth_with_password));
-        else if( ar_pwd == this->m_old_password )
+        }
+        else if( tm_has_old && sha256::verify(tm_tag.data(), tm_old.data(), sha256::_SIZE_DIGEST) )
             return Status::warn(domain_t::policy, to_underlying(policy_e::cannot_auth_with_old_password));
 
         return Status::err(domain_t::policy, to_underlying(policy_e::cannot_auth_password_not_matched));
@@ -591,4 +906,77 @@ namespace netsocket::policy
         const name_len_t tm_len = static_cast<name_len_t>(ar_password.length());
         return tm_len >= _MIN_LEN_PASSWORD && tm_len <= _MAX_LEN_PASSWORD;
     }
+
+    /**
+     * @brief Make Password Hash
+     * 
+     * Rastgele tuz üretip şifreden verilen tur sayısı ile
+     * PBKDF2-HMAC-SHA256 özeti çıkarır. Rastgele değer
+     * üretilemezse ya da türetme başarısız olursa tur
+     * sayısı sıfır olan boş özet döner
+     * 
+     * @param string& Password
+     * @param uint32_t Rounds
+     * @return PasswordHash
+     */
+    [[maybe_unused]] [[nodiscard]]
+    PasswordHash AccessPolicy::make_password_hash(
+        const std::string& ar_password,
+        const uint32_t ar_rounds
+    ) noexcept
+    {
+        PasswordHash tm_hash {};
+
+        try {
+            std::random_device tm_device;
+            for(std::size_t tm_count = 0; tm_count < _SIZE_PASSWORD_SALT; tm_count += 4)
+            {
+                const uint32_t tm_word = tm_device();
+                std::memcpy(tm_hash.m_salt.data() + tm_count, &tm_word, 4);
+            }
+        } catch(...) {
+            return {};
+        }
+
+        const std::string_view tm_salt(reinterpret_cast<const char*>(tm_hash.m_salt.data()), _SIZE_PASSWORD_SALT);
+        if( !sha256::pbkdf2(ar_password, tm_salt, ar_rounds, tm_hash.m_digest.data(), sha256::_SIZE_DIGEST) )
+            return {};
+
+        tm_hash.m_rounds = ar_rounds;
+        return tm_hash;
+    }
+
+    /**
+     * @brief Is Password Match
+     * 
+     * Şifreyi özetin tuzu ve tur sayısı ile yeniden türetip
+     * sabit zamanda karşılaştırır. Boş özet hiçbir şifre ile
+     * eşleşmez
+     * 
+     * @param PasswordHash& Hash
+     * @param string& Password
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool AccessPolicy::is_password_match(
+        const PasswordHash& ar_hash,
+        const std::string& ar_password
+    ) noexcept
+    {
+        if( ar_hash.m_rounds == 0 )
+            return false;
+
+        sha256::digest_t tm_digest {};
+        const std::string_view tm_salt(reinterpret_cast<const char*>(ar_hash.m_salt.data()), _SIZE_PASSWORD_SALT);
+        if( !sha256::pbkdf2(ar_password, tm_salt, ar_hash.m_rounds, tm_digest.data(), sha256::_SIZE_DIGEST) )
+            return false;
+
+        const bool tm_match = sha256::verify(tm_digest.data(), ar_hash.m_digest.data(), sha256::_SIZE_DIGEST);
+
+        volatile uint8_t* tm_ptr = tm_digest.data();
+        for(std::size_t tm_count = 0; tm_count < sha256::_SIZE_DIGEST; ++tm_count)
+            tm_ptr[tm_count] = 0;
+
+        return tm_match;
+    }
 }
\ No newline at end of file
@@ -227,7 +227,7 @@ namespace netsocket::server
             flag::Flag m_status { _FLAG_SOCKET_NULL };
 
             std::unordered_map<socket_t, SocketCtx> m_clients;
-            std::unordered_map<std::string, size_t> m_ip_count;
+            std::unordered_map<std::string, size_t, hash::fasthash::StringHash> m_ip_count;
 
             data_handler m_handler;
 
@@ -288,6 +288,7 @@ namespace netsocket::server
         protected:
             Status init() noexcept override;
 
+            bool can_accept_key() const noexcept override;
             void crashed() noexcept override;
     };
 
@@ -366,6 +367,18 @@ namespace netsocket::server
                 this->get_logger().write(level_t::Err, this->get_policy().get_username(), "Password Require Error, Code: " + std::to_string(tm_status.get_code()));
         }
 
+        // VERIFY ONLY, A SERVER KEEPS NO CLEARTEXT PASSWORD
+        tm_status = this->get_policy().set_verify_only();
+        if( !tm_status.is_ok() && !tm_status.is_warn() )
+        {
+            // DEBUG LOG
+            DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), "Server Constructor Set Verify Only Error, Code: " + std::to_string(tm_status.get_code()), GET_SOURCE));
+
+            // LOGGER
+            if( this->get_flag().has(_FLAG_SOCKET_LOGGER) )
+                this->get_logger().write(level_t::Err, this->get_policy().get_username(), "Verify Only Error, Code: " + std::to_string(tm_status.get_code()));
+        }
+
         // MAX CONNECTION
         tm_status = this->get_policy().set_max_connection(ar_max_client);
         if( !tm_status.is_ok() && !tm_status.is_warn() )
@@ -649,11 +662,12 @@ namespace netsocket::server
             // CLIENT IP
             std::string tm_ip = Socket::get_ip(tm_cli_accpt);
 
-            // THREAD POOL
-            this->m_tpool.enqueue([this, tm_cli_accpt, tm_ip]
+            // THREAD POOL, HANDSHAKE AND AUTH ON THE CONTROL LANE
+            this->m_tpool.enqueue([this, tm_cli_accpt, tm_ip = std::move(tm_ip)]
             {
                 // SOCKET VERSION HANDSHAKE RECEIVE
-                Status tm_handshake_recv = Socket::handshake_recv_verify(tm_cli_accpt, false);
+                Hello tm_peer {};
+                Status tm_handshake_recv = Socket::handshake_recv_verify(tm_cli_accpt, tm_peer.m_feature, tm_peer.m_random, false);
                 if( !tm_handshake_recv.is_ok() )
                 {
                     // DEBUG LOG
@@ -664,8 +678,21 @@ namespace netsocket::server
                     return;
                 }
 
+                // RANDOM FOR SESSION KEY, NO PREDICTABLE SALT
+                Hello tm_own { this->get_feature(), {} };
+                Status tm_make_random = Socket::make_random(tm_own.m_random);
+                if( !tm_make_random.is_ok() )
+                {
+                    // DEBUG LOG
+                    DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), tm_ip + " Session Random Error, Code: " + std::to_string(tm_make_random.get_code()), GET_SOURCE));
+
+                    // CLOSE SOCKET
+                    Socket::close_socket(tm_cli_accpt);
+                    return;
+                }
+
                 // SOCKET VERSION HASH SEND
-                Status tm_handshake_send = Socket::handshake_send_verify(tm_cli_accpt);
+                Status tm_handshake_send = Socket::handshake_send_verify(tm_cli_accpt, tm_own.m_feature, tm_own.m_random);
                 if( !tm_handshake_send.is_ok() )
                 {
                     // DEBUG LOG
@@ -703,11 +730,8 @@ namespace netsocket::server
                 {
                     std::scoped_lock tm_lock(this->m_mtx);
 
-                    if( this->m_ip_count.find(tm_ip) == this->m_ip_count.end() )
-                        this->m_ip_count.emplace(tm_ip, 0);
-
-                    ++this->m_ip_count.at(tm_ip);
-                    tm_same_ip_count = this->m_ip_count.at(tm_ip);
+                    // SINGLE LOOKUP, INSERTS ZERO FOR A NEW IP
+                    tm_same_ip_count = ++this->m_ip_count[tm_ip];
 
                     // OVER MAX CONNECTION ?
                     if( this->m_clients.size() > this->get_policy().get_max_connection() )
@@ -731,6 +755,12 @@ namespace netsocket::server
                     this->m_clients.emplace(tm_cli_accpt, SocketCtx{ UserPacket{}, tm_ip });
                 }
 
+                // OPEN SESSION WITH BOTH HANDSHAKE RECORDS, CLIENT RECORD FIRST
+                const bool tm_session_open = this->open_session(tm_cli_accpt, tm_peer, tm_own).is_ok();
+                if( !tm_session_open ) {
+                    DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), tm_ip + " Session Open Error", GET_SOURCE));
+                }
+
                 DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), tm_ip + " Added To Client List", GET_SOURCE));
 
                 // LOG
@@ -748,6 +778,7 @@ namespace netsocket::server
                     tm_it->second.m_ip = tm_ip;
                     tm_it->second.m_user.m_same_user_count = tm_same_ip_count;
                     tm_it->second.m_user.m_try_passwd = 0;
+                    tm_it->second.m_user.m_auth = {};
 
                     tm_client = tm_it->second;
                 }
@@ -755,10 +786,12 @@ namespace netsocket::server
                 // RUN
                 DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), "Server Handler Starting...", GET_SOURCE));
 
-                if( this->m_handler )
+                // WITHOUT A SESSION (KEY) THE HANDLER IS SKIPPED, CLEANUP STILL RUNS
+                if( this->m_handler && tm_session_open )
                     this->m_handler(*this, tm_cli_accpt, tm_client);
                 
                 // CLOSE
+                this->close_session(tm_cli_accpt);
                 Socket::close_socket(tm_cli_accpt);
                 DEBUG_ONLY(this->get_logger().write(level_t::Debug, this->get_policy().get_username(), "Client Socket Closed, Ip/SameUserCount: " + (tm_client.m_ip) + '/' + std::to_string(tm_same_ip_count), GET_SOURCE));
                 
@@ -766,13 +799,12 @@ namespace netsocket::server
                 {
                     std::scoped_lock tm_lock(this->m_mtx);
 
-                    if( this->m_ip_count.find(tm_ip) != this->m_ip_count.end() )
-                    {
-                        if( this->m_ip_count.at(tm_ip) ) --this->m_ip_count.at(tm_ip);
-                        else this->m_ip_count.at(tm_ip) = 0;
-                    }
-                    else
-                        this->m_ip_count.emplace(tm_ip, 0);
+                    // LAST CONNECTION OF THE IP LEAVES THE TABLE
+                    auto tm_it = this->m_ip_count.find(tm_ip);
+                    if( tm_it != this->m_ip_count.end() && (tm_it->second <= 1) )
+                        this->m_ip_count.erase(tm_it);
+                    else if( tm_it != this->m_ip_count.end() )
+                        --tm_it->second;
                 }
 
                 // LOG
@@ -784,7 +816,7 @@ namespace netsocket::server
                     std::scoped_lock tm_lock(this->m_mtx);
                     this->m_clients.erase(tm_cli_accpt);
                 }
-            });
+            }, lane_t::Control);
         }
     }
 
@@ -1175,8 +1207,8 @@ namespace netsocket::server
             return Status::err(domain_t::server, status::to_underlying(server_code_t::fail_recv_from_client));
         }
 
-        // CAN AUTH ?
-        tm_status = this->get_policy().can_auth(tm_ip, ar_datapack.m_pwd);
+        // CAN AUTH ? (FULL CHECK WHEN THE CONNECTION JOINS, THEN THE CACHE TAG)
+        tm_status = this->get_policy().can_auth(tm_ip, ar_datapack.m_pwd, tm_client.m_user.m_auth);
         if( tm_status.is_ok() )
         {
             // DEBUG LOG
@@ -1495,6 +1527,19 @@ namespace netsocket::server
         this->get_logger().write("============================");
     }
 
+    /**
+     * @brief Can Accept Key
+     * 
+     * Anahtarı sadece sunucu değiştirir. İstemciden gelen
+     * anahtar duyurusu uygulanmaz, key_not_accept ile reddedilir
+     * 
+     * @return bool
+     */
+    bool Server::can_accept_key() const noexcept
+    {
+        return false;
+    }
+
     /**
      * @brief Crashed
      * 
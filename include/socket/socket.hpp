@@ -34,6 +34,7 @@
     #include <sys/socket.h>
     #include <arpa/inet.h>
     #include <netinet/in.h>
+    #include <netinet/tcp.h>
     #include <unistd.h>
     #include <netdb.h>
     #include <poll.h>
@@ -43,11 +44,19 @@
 #endif
 
 #include <cstdint>
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <array>
 #include <atomic>
 #include <mutex>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <unordered_map>
+#include <random>
+#include <string_view>
 
 // Namespace
 namespace netsocket
@@ -69,6 +78,7 @@ namespace netsocket
     using socket_recv_t = int;
 
     using wait_time_t = uint16_t;
+    using batch_time_t = uint32_t;
     using buff_size_t = uint32_t;
 
     // Enum
@@ -118,6 +128,22 @@ namespace netsocket
         socket_has_already,
         recv_length_not_expected,
         recv_socket_close_header,
+        session_not_found,
+        packet_not_decompress,
+        packet_too_large,
+        packet_crc_mismatch,
+        packet_not_encrypt,
+        packet_not_decrypt,
+        packet_not_auth,
+        session_key_not_derive,
+        packet_epoch_unknown,
+        key_not_rotate,
+        cipher_suite_not_valid,
+        cipher_suite_not_make,
+        frame_version_not_match,
+        key_epoch_not_match,
+        random_not_make,
+        key_not_accept,
 
         succ = 1000,
         socket_set,
@@ -133,6 +159,16 @@ namespace netsocket
         socket_data_recv,
         set_timeout,
         socket_set_running,
+        session_open,
+        session_close,
+        set_compress_threshold,
+        socket_data_queued,
+        socket_data_flushed,
+        set_batch_delay,
+        set_key_grace,
+        key_rotate,
+        set_cipher_suite,
+        random_make,
 
         warn = 2000,
         same_value,
@@ -174,6 +210,7 @@ namespace netsocket
         uint16_t m_try_passwd { 0 };
         uint16_t m_same_user_count { 0 };
         std::string m_username { "" };
+        policy::AuthCache m_auth {};
     };
 
     // Struct
@@ -209,6 +246,39 @@ namespace netsocket
     using status::status_t;
     using status::domain_t;
 
+    // Session Key
+    static constexpr uint8_t ss_random_size = 32;
+    static constexpr std::string_view ss_session_info = "kripton|session-key|v1";
+    static constexpr std::string_view ss_suite_info = "kripton|cipher-suite|v1";
+
+    using random_t = std::array<uint8_t, ss_random_size>;
+    using transcript_t = hash::sha256::digest_t;
+
+    // Struct
+    struct SessionCtx
+    {
+        flag::Flag m_feature;
+
+        std::mutex m_keymtx;
+        std::shared_ptr<algorithm::Algorithm> m_cipher;
+        std::shared_ptr<algorithm::Algorithm> m_prev_cipher;
+        std::chrono::steady_clock::time_point m_prev_until;
+        uint8_t m_epoch { 0 };
+        cipherpool::suite_t m_suite { cipherpool::_SUITE_NULL };
+        transcript_t m_transcript {};
+        bool m_bound { false };
+
+        std::mutex m_outmtx;
+        std::vector<std::byte> m_outbuf;
+        std::chrono::steady_clock::time_point m_outtime;
+        bool m_broken { false };
+
+        std::mutex m_inmtx;
+        std::vector<char> m_inbuf;
+        std::size_t m_inpos { 0 };
+        std::size_t m_inlen { 0 };
+    };
+
     // Limit
     static constexpr socket_t _MIN_SOCKET = 1;
 
@@ -219,23 +289,160 @@ namespace netsocket
     static constexpr wait_time_t _DEF_TIMEOUT = 5; // second
     static constexpr wait_time_t _MAX_TIMEOUT = 30; // second
 
+    static constexpr buff_size_t _MIN_COMPRESS_THRESHOLD = 16; // byte
+    static constexpr buff_size_t _DEF_COMPRESS_THRESHOLD = 128; // byte
+    static constexpr buff_size_t _MAX_COMPRESS_THRESHOLD = netpacket::_SIZE_MESSAGE; // byte
+
+    static constexpr batch_time_t _MIN_BATCH_DELAY = 10; // microsecond
+    static constexpr batch_time_t _DEF_BATCH_DELAY = 200; // microsecond
+    static constexpr batch_time_t _MAX_BATCH_DELAY = 10000; // microsecond
+
+    static constexpr buff_size_t _SIZE_BATCH_BUFFER = 16 * 1024; // byte
+    static constexpr buff_size_t _SIZE_READ_AHEAD = 16 * 1024; // byte
+
+    static constexpr wait_time_t _MIN_KEY_GRACE = 1; // second
+    static constexpr wait_time_t _DEF_KEY_GRACE = 30; // second
+    static constexpr wait_time_t _MAX_KEY_GRACE = 600; // second
+
     // Flag
     static constexpr flag::flag_t _FLAG_SOCKET_NULL = { 0 << 0 };
     static constexpr flag::flag_t _FLAG_SOCKET_LOGGER = { 1 << 0 };
     static constexpr flag::flag_t _FLAG_SOCKET_DEBUG = { 1 << 1 };
     static constexpr flag::flag_t _FLAG_SOCKET_IPV6 = { 1 << 2 };
+    static constexpr flag::flag_t _FLAG_SOCKET_COMPRESS = { 1 << 3 };
+    static constexpr flag::flag_t _FLAG_SOCKET_BATCH = { 1 << 4 };
+    static constexpr flag::flag_t _FLAG_SOCKET_CRC = { 1 << 5 };
+    static constexpr flag::flag_t _FLAG_SOCKET_SESSION_KEY = { 1 << 6 };
+    static constexpr flag::flag_t _FLAG_SOCKET_KEY_EPOCH = { 1 << 7 };
+    static constexpr flag::flag_t _FLAG_SOCKET_CIPHER_SUITE = { 1 << 8 };
+
+    // Feature
+    static constexpr flag::flag_t _FEATURE_NULL = { 0 << 0 };
+    static constexpr flag::flag_t _FEATURE_COMPRESS = { 1 << 0 };
+    static constexpr flag::flag_t _FEATURE_BATCH = { 1 << 1 };
+    static constexpr flag::flag_t _FEATURE_CRC = { 1 << 2 };
+    static constexpr flag::flag_t _FEATURE_SESSION_KEY = { 1 << 3 };
+    static constexpr flag::flag_t _FEATURE_KEY_EPOCH = { 1 << 4 };
+
+    static constexpr uint8_t ss_feature_size = sizeof(flag::flag_t);
+
+    // Capability (Upper Bytes Of Feature)
+    static constexpr uint8_t _POS_FEATURE_SUITE = 8;
+    static constexpr uint8_t _POS_FEATURE_ACCEL = 16;
+    static constexpr uint8_t _POS_FEATURE_FRAME = 24;
+
+    // Wire Version (Framing + Packet Schema)
+    // HER SÜRÜM BİR ÇERÇEVE DÜZENİ VE PAKET ŞEMASI İKİLİSİDİR, ŞEMA DEĞİŞİNCE YENİ SÜRÜM EKLENİR
+    static constexpr uint8_t _VERSION_FRAME = 1;
+    static constexpr uint32_t ss_schema_hash[_VERSION_FRAME] = { 0xed14fe0eu };
+    static constexpr flag::flag_t _FEATURE_FRAME = { flag::flag_t{1} << (_POS_FEATURE_FRAME + _VERSION_FRAME - 1) };
+
+    static_assert(ss_schema_hash[_VERSION_FRAME - 1] == netpacket::DataSchema::hash, "Packet schema changed, add a new wire version");
+
+    /**
+     * @brief Get Suite Offer
+     * 
+     * Özelliklerin ikinci baytında taşınan, sunulan
+     * şifreleme yöntemlerini döndürür
+     * 
+     * @param flag_t Feature
+     * @return suite_t
+     */
+    static inline constexpr cipherpool::suite_t get_suite_offer(const flag::flag_t ar_feature) noexcept
+    {
+        return static_cast<cipherpool::suite_t>((ar_feature >> _POS_FEATURE_SUITE) & 0xFF);
+    }
+
+    /**
+     * @brief Get Suite Accel
+     * 
+     * Özelliklerin üçüncü baytında taşınan, işlemcide
+     * donanım ile çalışan yöntemleri döndürür
+     * 
+     * @param flag_t Feature
+     * @return suite_t
+     */
+    static inline constexpr cipherpool::suite_t get_suite_accel(const flag::flag_t ar_feature) noexcept
+    {
+        return static_cast<cipherpool::suite_t>((ar_feature >> _POS_FEATURE_ACCEL) & 0xFF);
+    }
+
+    /**
+     * @brief Get Frame Version
+     * 
+     * Özelliklerin son baytında her bit bir çerçeve ve paket
+     * şeması sürümünü gösterir, en yüksek sürümü döndürür.
+     * Ortak özelliklere uygulanınca iki tarafın anlaştığı
+     * (aşağı inilen) sürümü verir. Hiç bit yoksa sürüm
+     * bilinmiyordur ve 0 döner
+     * 
+     * @param flag_t Feature
+     * @return uint8_t
+     */
+    static inline constexpr uint8_t get_frame_version(const flag::flag_t ar_feature) noexcept
+    {
+        uint8_t tm_version = 0;
+        for(flag::flag_t tm_bits = (ar_feature >> _POS_FEATURE_FRAME) & 0xFF; tm_bits; tm_bits >>= 1)
+            ++tm_version;
+
+        return tm_version;
+    }
 
-    // Version Hash
+    // Version Hash (Protocol Magic)
+    // SADECE EL SIKIŞMA KAYDININ DÜZENİNİ (MAGIC + ÖZELLİK + RASTGELE DEĞER) KAPSAR, SÜRÜMLER ÖZELLİKLERDE ANLAŞILIR
     static constexpr uint8_t ss_hash_hex_size = 16;
-    static constexpr uint32_t ss_hash_code = (
-        netpacket::_SIZE_HEADER +
-        netpacket::_SIZE_PASSWORD + netpacket::_SIZE_USERNAME + netpacket::_SIZE_MESSAGE +
-        netpacket::_PACK_LEN_PASSWORD + netpacket::_PACK_LEN_PASSWORD + netpacket::_PACK_LEN_PASSWORD +
-        netpacket::_PACK_START_LEN_PASSWORD +
-        netpacket::_SIZE_OVER_SOCKET
-    ) % (uint32_t)~0;
+    static constexpr uint32_t ss_hash_code = ss_hash_hex_size + sizeof(flag::flag_t) + sizeof(random_t);
 
-    static constexpr hash::vch::Vch<ss_hash_hex_size> ss_ver_hash("2026-03-31|server-client-fix|test|0530", ss_hash_code);
+    static constexpr hash::vch::Vch<ss_hash_hex_size> ss_ver_hash("netsocket|handshake|magic|feature|random", ss_hash_code);
+    static constexpr uint32_t ss_record_size = ss_hash_code;
+
+    // Handshake Record
+    struct Hello
+    {
+        flag::flag_t m_feature { _FEATURE_NULL };
+        random_t m_random {};
+    };
+
+    /**
+     * @brief Put Record
+     * 
+     * El sıkışma kaydını ağa gönderilen düzende yazar:
+     * magic, ağ bayt sırası ile özellikler ve rastgele değer
+     * 
+     * @param char* Record
+     * @param Hello& Hello
+     */
+    static inline void put_record(char* ar_record, const Hello& ar_hello) noexcept
+    {
+        std::memcpy(ar_record, ss_ver_hash.c_str(), ss_hash_hex_size);
+
+        for(uint8_t tm_count = 0; tm_count < ss_feature_size; ++tm_count)
+            ar_record[ss_hash_hex_size + tm_count] = static_cast<char>((ar_hello.m_feature >> (8 * (ss_feature_size - 1 - tm_count))) & 0xFF);
+
+        std::memcpy(ar_record + ss_hash_hex_size + ss_feature_size, ar_hello.m_random.data(), ss_random_size);
+    }
+
+    /**
+     * @brief Make Transcript
+     * 
+     * İstemci ve sunucu kayıtlarının (önce istemci) SHA-256
+     * özetini döndürür. Açık gönderilen özellikler ve yöntem
+     * teklifleri anahtar türetmeye bu özet ile bağlanır;
+     * aradaki biri kayıtları değiştirirse iki uç farklı
+     * anahtara ulaşır ve çerçeveler açılmaz
+     * 
+     * @param Hello& Client
+     * @param Hello& Server
+     * @return transcript_t
+     */
+    static inline transcript_t make_transcript(const Hello& ar_client, const Hello& ar_server) noexcept
+    {
+        char tm_records[ss_record_size * 2] {};
+        put_record(tm_records, ar_client);
+        put_record(tm_records + ss_record_size, ar_server);
+
+        return hash::sha256::digest(tm_records, sizeof(tm_records));
+    }
 
     // WSA SOCKET
     #if __OS_WINDOWS__
@@ -285,14 +492,21 @@ namespace netsocket
             [[maybe_unused]] static bool close_socket(const socket_t ar_sock) noexcept;
             [[maybe_unused]] [[nodiscard]] static std::string get_ip(const socket_t ar_sock) noexcept;
 
-            [[maybe_unused]] [[nodiscard]] static Status handshake_send_verify(const socket_t ar_sock) noexcept;
+            [[maybe_unused]] [[nodiscard]] static Status send_all(const socket_t ar_sock, const std::byte* ar_data, const std::size_t ar_len) noexcept;
+
+            [[maybe_unused]] [[nodiscard]] static Status handshake_send_verify(const socket_t ar_sock, const flag::flag_t ar_feature = _FEATURE_NULL, const random_t& ar_random = {}) noexcept;
             [[maybe_unused]] [[nodiscard]] static Status handshake_recv_verify(const socket_t ar_sock, const bool ar_close = true) noexcept;
+            [[maybe_unused]] [[nodiscard]] static Status handshake_recv_verify(const socket_t ar_sock, flag::flag_t& ar_feature, const bool ar_close = true) noexcept;
+            [[maybe_unused]] [[nodiscard]] static Status handshake_recv_verify(const socket_t ar_sock, flag::flag_t& ar_feature, random_t& ar_random, const bool ar_close = true) noexcept;
+
+            [[maybe_unused]] [[nodiscard]] static Status make_random(random_t& ar_random) noexcept;
 
         private:
-            algorithm::Algorithm m_cipher;
+            algorithm::Algorithm& m_cipher;
             log::Logger<file::FileOut> m_logger;
             policy::AccessPolicy m_policy;
             flag::Flag m_flag;
+            bool m_can_clone { false };
 
             socket_t m_sock { ss_inv_socket };
             ipv_t m_ipv { ipv_t::none };
@@ -301,8 +515,26 @@ namespace netsocket
             std::atomic<bool> m_running { false };
 
             std::atomic<wait_time_t> m_timeout { _DEF_TIMEOUT };
+            std::atomic<buff_size_t> m_compress_threshold { _DEF_COMPRESS_THRESHOLD };
+
+            std::atomic<batch_time_t> m_batch_delay { _DEF_BATCH_DELAY };
+
+            std::shared_ptr<algorithm::Algorithm> m_master;
+            std::atomic<wait_time_t> m_key_grace { _DEF_KEY_GRACE };
+            std::atomic<cipherpool::suite_t> m_suite { cipherpool::_SUITE_NULL };
+
+            std::unordered_map<socket_t, std::shared_ptr<SessionCtx>> m_sessions;
+
+            std::thread m_flusher;
+            std::vector<std::pair<socket_t, std::shared_ptr<SessionCtx>>> m_flush_list;
+            std::condition_variable m_flush_cv;
+            bool m_flush_stop { false };
+            bool m_flush_pending { false };
 
             mutable std::mutex m_mtx;
+            mutable std::mutex m_session_mtx;
+            mutable std::mutex m_flush_mtx;
+            mutable std::mutex m_key_mtx;
 
             inline static std::atomic<uint32_t> s_total_sock { 0 };
 
@@ -310,6 +542,24 @@ namespace netsocket
             inline static void inc_total_socket() noexcept { ++s_total_sock; };
             inline static void dec_total_socket() noexcept { if( s_total_sock ) --s_total_sock; };
 
+            std::unique_ptr<algorithm::Algorithm> suite_cipher(const cipherpool::suite_t ar_suite, const std::string& ar_key, const transcript_t* ar_transcript) const noexcept;
+            std::unique_ptr<algorithm::Algorithm> derive_cipher(const algorithm::Algorithm& ar_base, const transcript_t& ar_transcript) const noexcept;
+            Status make_session(const socket_t ar_sock, const flag::flag_t ar_own_feature, const flag::flag_t ar_peer_feature, const transcript_t* ar_transcript) noexcept;
+            std::shared_ptr<algorithm::Algorithm> make_cipher(const SessionCtx& ar_session, const std::string& ar_key) const noexcept;
+
+            Status send_frame(const socket_t ar_sock, SessionCtx* ar_session, algorithm::Algorithm& ar_cipher, netpacket::frame_t ar_frame, std::string_view ar_pwd, std::string_view ar_name, std::string_view ar_body) noexcept;
+            Status announce_key(const socket_t ar_sock, SessionCtx& ar_session, const std::string& ar_key) noexcept;
+            Status accept_key(SessionCtx& ar_session, const uint8_t ar_epoch, const std::string& ar_key) noexcept;
+
+            Status queue_frame(const socket_t ar_sock, SessionCtx& ar_session, const std::byte* ar_data, const std::size_t ar_len) noexcept;
+            int recv_frame_bytes(const socket_t ar_sock, SessionCtx* ar_session, char* ar_dst, const std::size_t ar_len) noexcept;
+            Status recv_packet(const socket_t ar_sock, DataPacket& ar_datapack) noexcept;
+
+            void wake_flusher() noexcept;
+            void stop_flusher() noexcept;
+            void flush_runner() noexcept;
+            bool flush_expired() noexcept;
+
         public:
             explicit Socket(
                 algorithm::Algorithm& ar_cipher,
@@ -337,6 +587,15 @@ namespace netsocket
             virtual inline socket_port_t get_port() const noexcept;
             virtual inline ipv_t get_ipv() const noexcept;
             virtual inline wait_time_t get_timeout() const noexcept;
+            virtual inline buff_size_t get_compress_threshold() const noexcept;
+            virtual inline batch_time_t get_batch_delay() const noexcept;
+            virtual inline wait_time_t get_key_grace() const noexcept;
+            virtual inline cipherpool::suite_t get_cipher_suite() const noexcept;
+            virtual inline flag::flag_t get_feature() const noexcept;
+            virtual flag::flag_t get_session_feature(const socket_t ar_sock) const noexcept;
+            virtual uint8_t get_session_epoch(const socket_t ar_sock) const noexcept;
+            virtual cipherpool::suite_t get_session_suite(const socket_t ar_sock) const noexcept;
+            virtual bool has_pending(const socket_t ar_sock) const noexcept;
 
             virtual Status run() noexcept { return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::socket_no_run)); }
             virtual Status stop() noexcept { return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::socket_no_stop)); }
@@ -357,6 +616,17 @@ namespace netsocket
             virtual Status set_port(const socket_port_t ar_port) noexcept;
             virtual Status set_ipv(const ipv_t ar_ipv) noexcept;
             virtual Status set_timeout(const wait_time_t ar_timeout = _DEF_TIMEOUT) noexcept;
+            virtual Status set_compress_threshold(const buff_size_t ar_threshold = _DEF_COMPRESS_THRESHOLD) noexcept;
+
+            virtual Status set_batch_delay(const batch_time_t ar_delay = _DEF_BATCH_DELAY) noexcept;
+            virtual Status set_key_grace(const wait_time_t ar_grace = _DEF_KEY_GRACE) noexcept;
+            virtual Status set_cipher_suite(const cipherpool::suite_t ar_suite) noexcept;
+
+            virtual Status rotate_key(const std::string& ar_key) noexcept;
+
+            virtual Status open_session(const socket_t ar_sock, const flag::flag_t ar_peer_feature) noexcept;
+            virtual Status open_session(const socket_t ar_sock, const Hello& ar_client, const Hello& ar_server) noexcept;
+            virtual Status close_session(const socket_t ar_sock) noexcept;
 
             virtual Status create() noexcept;
             virtual Status close() noexcept;
@@ -364,8 +634,19 @@ namespace netsocket
 
             virtual Status send(const socket_t ar_sock, const DataPacket& ar_datapack) noexcept;
             virtual Status recv(const socket_t ar_sock, DataPacket& ar_datapack) noexcept;
+            virtual Status flush(const socket_t ar_sock) noexcept;
 
         protected:
+            std::shared_ptr<SessionCtx> get_session(const socket_t ar_sock) const noexcept;
+            std::shared_ptr<algorithm::Algorithm> get_master() const noexcept;
+            Status set_master(const std::string& ar_key) noexcept;
+
+            std::shared_ptr<algorithm::Algorithm> send_cipher(SessionCtx* ar_session, uint8_t& ar_epoch) const noexcept;
+            std::shared_ptr<algorithm::Algorithm> recv_cipher(SessionCtx* ar_session, const uint8_t ar_epoch) const noexcept;
+
+            virtual void rekeyed(const socket_t ar_sock, const std::string& ar_key) noexcept { (void)ar_sock; (void)ar_key; }
+            virtual bool can_accept_key() const noexcept { return true; }
+
             virtual Status init() noexcept { return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::socket_no_init)); }
             virtual Status set_running(const bool ar_running = true) noexcept;
 
@@ -379,7 +660,10 @@ namespace netsocket
      * kayıt yapısı, sokete verilecek isim, port numarası,
      * ip sürüm türü ve bayrak değeri olur. Bunları alaraktan
      * gerekli atamaları yaparak soketi oluşturur. Eğer
-     * Windows kullanılıyor ise, ek bir kontrol sağlar
+     * Windows kullanılıyor ise, ek bir kontrol sağlar.
+     * Şifreleme yapısı kopyalanmaz, referans olarak tutulur.
+     * Böylece verilen gerçek algoritma kullanılır, bu yüzden
+     * soketten daha uzun yaşaması gerekir
      * 
      * @param Algorithm& Cipher
      * @param string& Filepath
@@ -403,6 +687,12 @@ namespace netsocket
         m_policy(ar_name, ar_password),
         m_flag(ar_flag)
     {
+        // PER CONNECTION KEYS NEED A CIPHER THAT CAN BE CLONED WITH A NEW KEY
+        this->m_can_clone = this->m_cipher.clone(this->m_cipher.get_key()) != nullptr;
+
+        // OWN CIPHER AND THE AUTHENTICATED ONES ARE OFFERED BY DEFAULT
+        this->m_suite.store(cipherpool::suite_of(this->m_cipher) | cipherpool::_SUITE_AEAD, std::memory_order_relaxed);
+
         // PORT & IP TYPE
         this->set_port(ar_port);
         this->set_ipv(ar_ipv);
@@ -462,7 +752,7 @@ namespace netsocket
      */
     bool Socket::has_error() const noexcept
     {
-        return !this->has_socket() || !this->has_port() || !this->has_ipv() || !this->has_cipher();
+        return !this->has_socket() || !this->has_port() || !this->has_ipv() || !this->has_cipher() || this->m_policy.has_error();
     }
 
     /**
@@ -573,6 +863,190 @@ namespace netsocket
         return this->m_timeout.load(std::memory_order_acquire);
     }
 
+    /**
+     * @brief Get Compress Threshold
+     * 
+     * Mesajın sıkıştırılması için gereken en az
+     * uzunluk değerini döndürür
+     * 
+     * @return buff_size_t
+     */
+    buff_size_t Socket::get_compress_threshold() const noexcept
+    {
+        return this->m_compress_threshold.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get Batch Delay
+     * 
+     * Toplu gönderimde bekleyen paketlerin en fazla ne kadar
+     * (mikrosaniye) bekletileceğini döndürür
+     * 
+     * @return batch_time_t
+     */
+    batch_time_t Socket::get_batch_delay() const noexcept
+    {
+        return this->m_batch_delay.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get Key Grace
+     * 
+     * Anahtar değiştikten sonra önceki dönemin anahtarı ile
+     * gelen paketlerin kaç saniye daha kabul edileceğini döndürür
+     * 
+     * @return wait_time_t
+     */
+    wait_time_t Socket::get_key_grace() const noexcept
+    {
+        return this->m_key_grace.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get Cipher Suite
+     * 
+     * El sıkışmada sunulan şifreleme yöntemlerini döndürür
+     * 
+     * @return suite_t
+     */
+    cipherpool::suite_t Socket::get_cipher_suite() const noexcept
+    {
+        return this->m_suite.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get Feature
+     * 
+     * Soketin el sıkışmada karşı tarafa sunacağı özellikleri
+     * bayraklara bakarak döndürür. İlk bayt özellikler, sonraki
+     * baytlar sunulan şifreleme yöntemleri, işlemcide donanım ile
+     * çalışan yöntemler ve desteklenen çerçeve sürümleridir
+     * 
+     * @return flag_t
+     */
+    flag::flag_t Socket::get_feature() const noexcept
+    {
+        flag::flag_t tm_feature = _FEATURE_NULL;
+
+        if( this->m_flag.has(_FLAG_SOCKET_COMPRESS) )
+            tm_feature |= _FEATURE_COMPRESS;
+
+        if( this->m_flag.has(_FLAG_SOCKET_BATCH) )
+            tm_feature |= _FEATURE_BATCH;
+
+        if( this->m_flag.has(_FLAG_SOCKET_CRC) )
+            tm_feature |= _FEATURE_CRC;
+
+        if( this->m_flag.has(_FLAG_SOCKET_SESSION_KEY) && this->m_can_clone )
+            tm_feature |= _FEATURE_SESSION_KEY;
+
+        if( this->m_flag.has(_FLAG_SOCKET_KEY_EPOCH) && this->m_can_clone )
+            tm_feature |= _FEATURE_KEY_EPOCH;
+
+        // OFFERED CIPHERS AND THE ONES THIS CPU RUNS IN HARDWARE
+        if( this->m_flag.has(_FLAG_SOCKET_CIPHER_SUITE) )
+        {
+            tm_feature |= static_cast<flag::flag_t>(this->get_cipher_suite()) << _POS_FEATURE_SUITE;
+            tm_feature |= static_cast<flag::flag_t>(cipherpool::get_accel()) << _POS_FEATURE_ACCEL;
+        }
+
+        tm_feature |= _FEATURE_FRAME;
+        return tm_feature;
+    }
+
+    /**
+     * @brief Get Session Feature
+     * 
+     * Bağlantı için el sıkışmada iki tarafın da anlaştığı
+     * özellikleri döndürür. Oturum yoksa hiçbir özellik
+     * kullanılmaz
+     * 
+     * @param socket_t Socket
+     * @return flag_t
+     */
+    flag::flag_t Socket::get_session_feature(const socket_t ar_sock) const noexcept
+    {
+        const auto tm_session = this->get_session(ar_sock);
+        return tm_session ? tm_session->m_feature.get() : _FEATURE_NULL;
+    }
+
+    /**
+     * @brief Get Session Epoch
+     * 
+     * Bağlantının gönderimde kullandığı anahtar dönemini
+     * döndürür. Oturum yoksa ya da dönem anlaşılmadıysa 0 olur
+     * 
+     * @param socket_t Socket
+     * @return uint8_t
+     */
+    uint8_t Socket::get_session_epoch(const socket_t ar_sock) const noexcept
+    {
+        const auto tm_session = this->get_session(ar_sock);
+        if( !tm_session )
+            return 0;
+
+        std::scoped_lock tm_lock(tm_session->m_keymtx);
+        return tm_session->m_epoch;
+    }
+
+    /**
+     * @brief Get Session Suite
+     * 
+     * Bağlantı için el sıkışmada seçilen şifreleme yöntemini
+     * döndürür. Yöntem anlaşılmadıysa soketin kendi şifreleyicisi
+     * kullanılır ve boş döner
+     * 
+     * @param socket_t Socket
+     * @return suite_t
+     */
+    cipherpool::suite_t Socket::get_session_suite(const socket_t ar_sock) const noexcept
+    {
+        const auto tm_session = this->get_session(ar_sock);
+        return tm_session ? tm_session->m_suite : cipherpool::_SUITE_NULL;
+    }
+
+    /**
+     * @brief Has Pending
+     * 
+     * Toplu alımda soketten tek seferde birden fazla paket okunabilir.
+     * Okunmuş ama henüz alınmamış paket varsa soket hazır görünmese
+     * bile alma işlemi yapılmalıdır. Select/poll kullanan işleyiciler
+     * beklemeye geçmeden önce bunu kontrol etmelidir
+     * 
+     * @param socket_t Socket
+     * @return bool
+     */
+    bool Socket::has_pending(const socket_t ar_sock) const noexcept
+    {
+        const auto tm_session = this->get_session(ar_sock);
+        if( !tm_session )
+            return false;
+
+        std::scoped_lock tm_lock(tm_session->m_inmtx);
+        return tm_session->m_inpos < tm_session->m_inlen;
+    }
+
+    /**
+     * @brief Get Session
+     * 
+     * Bağlantıya ait oturumu döndürür. Paylaşımlı işaretçi
+     * sayesinde oturum silinse bile kullanan işlem güvenle
+     * devam eder
+     * 
+     * @param socket_t Socket
+     * @return shared_ptr<SessionCtx>
+     */
+    std::shared_ptr<SessionCtx> Socket::get_session(const socket_t ar_sock) const noexcept
+    {
+        std::scoped_lock tm_lock(this->m_session_mtx);
+
+        auto tm_it = this->m_sessions.find(ar_sock);
+        if( tm_it == this->m_sessions.end() )
+            return nullptr;
+
+        return tm_it->second;
+    }
+
     /**
      * @brief Print
      * 
@@ -612,6 +1086,117 @@ namespace netsocket
         return this->m_cipher;
     }
 
+    /**
+     * @brief Get Master
+     * 
+     * Yeni açılan bağlantıların kullanacağı ana şifreleyiciyi
+     * döndürür. Anahtar hiç değişmediyse kurucuya verilen
+     * şifreleyici sahiplenilmeden döner
+     * 
+     * @return shared_ptr<Algorithm>
+     */
+    std::shared_ptr<algorithm::Algorithm> Socket::get_master() const noexcept
+    {
+        std::scoped_lock tm_lock(this->m_key_mtx);
+
+        if( this->m_master )
+            return this->m_master;
+
+        // NON OWNING, CONSTRUCTOR CIPHER OUTLIVES THE SOCKET
+        return std::shared_ptr<algorithm::Algorithm>(std::shared_ptr<algorithm::Algorithm>(), &this->m_cipher);
+    }
+
+    /**
+     * @brief Set Master
+     * 
+     * Ana şifreleyicinin aynı türde ve verilen anahtar ile
+     * kopyasını oluşturup bundan sonra açılacak bağlantılar
+     * için kullanır. Açık bağlantılar etkilenmez
+     * 
+     * @param string& Key
+     * @return Status
+     */
+    Status Socket::set_master(const std::string& ar_key) noexcept
+    {
+        if( !this->m_can_clone )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_rotate));
+
+        std::shared_ptr<algorithm::Algorithm> tm_master;
+        try {
+            tm_master = this->m_cipher.clone(ar_key);
+        } catch(...) {}
+
+        if( !tm_master || tm_master->has_error() )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_rotate));
+
+        std::scoped_lock tm_lock(this->m_key_mtx);
+        this->m_master = std::move(tm_master);
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::key_rotate));
+    }
+
+    /**
+     * @brief Send Cipher
+     * 
+     * Bağlantının geçerli dönemdeki şifreleyicisini ve dönemini
+     * döndürür. Paylaşımlı işaretçi sayesinde gönderim sürerken
+     * anahtar değişse bile kullanılan şifreleyici silinmez
+     * 
+     * @param SessionCtx* Session
+     * @param uint8_t& Epoch
+     * @return shared_ptr<Algorithm>
+     */
+    std::shared_ptr<algorithm::Algorithm> Socket::send_cipher(
+        SessionCtx* ar_session,
+        uint8_t& ar_epoch
+    ) const noexcept
+    {
+        ar_epoch = 0;
+        if( !ar_session )
+            return this->get_master();
+
+        std::scoped_lock tm_lock(ar_session->m_keymtx);
+        ar_epoch = ar_session->m_epoch;
+        return ar_session->m_cipher;
+    }
+
+    /**
+     * @brief Recv Cipher
+     * 
+     * Gelen paketin dönemine göre şifreleyiciyi seçer. Geçerli
+     * dönem ya da bekleme süresi dolmamış önceki dönem kabul
+     * edilir, süresi dolan önceki anahtar bellekten silinir.
+     * Tanınmayan dönem için boş döner
+     * 
+     * @param SessionCtx* Session
+     * @param uint8_t Epoch
+     * @return shared_ptr<Algorithm>
+     */
+    std::shared_ptr<algorithm::Algorithm> Socket::recv_cipher(
+        SessionCtx* ar_session,
+        const uint8_t ar_epoch
+    ) const noexcept
+    {
+        if( !ar_session )
+            return ar_epoch == 0 ? this->get_master() : nullptr;
+
+        std::scoped_lock tm_lock(ar_session->m_keymtx);
+        if( ar_epoch == ar_session->m_epoch )
+            return ar_session->m_cipher;
+
+        if( !ar_session->m_prev_cipher )
+            return nullptr;
+
+        // GRACE WINDOW OVER, DROP THE OLD KEY
+        if( std::chrono::steady_clock::now() >= ar_session->m_prev_until ) {
+            ar_session->m_prev_cipher.reset();
+            return nullptr;
+        }
+
+        const uint8_t tm_prev = static_cast<uint8_t>((ar_session->m_epoch + netpacket::_SIZE_EPOCH - 1) % netpacket::_SIZE_EPOCH);
+        return ar_epoch == tm_prev ? ar_session->m_prev_cipher : nullptr;
+    }
+
     /**
      * @brief Get Logger
      * 
@@ -793,55 +1378,546 @@ namespace netsocket
     }
 
     /**
-     * @brief Set Running
+     * @brief Set Compress Threshold
      * 
-     * Soketin çalışıp çalışmadığı bilgisini tutacak olan
-     * değişkeni ayarlamayı sağlar
+     * Kısa mesajları sıkıştırmak kazanç sağlamaz, aksine işlem
+     * yükü getirir. Bu yüzden belirlenen uzunluğun altındaki
+     * mesajlar sıkıştırılmadan gönderilir
      * 
-     * @param bool Running
+     * @param buff_size_t Threshold
      * @return Status
      */
-    Status Socket::set_running(const bool ar_running) noexcept
+    Status Socket::set_compress_threshold(const buff_size_t ar_threshold) noexcept
     {
-        // SAME VALUE
-        if( ar_running == this->m_running.load(std::memory_order_seq_cst) )
-            return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::same_value));
-        
-        // SET
-        this->m_running.store(ar_running, std::memory_order_seq_cst);
-        return ar_running == this->m_running.load(std::memory_order_seq_cst) ?
-            Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_set_running)) :
-            Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_set_running));
+        if( ar_threshold < _MIN_COMPRESS_THRESHOLD )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_under_min));
+        else if( ar_threshold > _MAX_COMPRESS_THRESHOLD )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_over_max));
+        else if( ar_threshold == this->m_compress_threshold.load(std::memory_order_seq_cst) )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::same_value));
+
+        this->m_compress_threshold.store(ar_threshold, std::memory_order_seq_cst);
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::set_compress_threshold));
     }
 
     /**
-     * @brief Create
+     * @brief Set Batch Delay
      * 
-     * Ayarlanmış soket verilerini kullanarak soket bağlantısını
-     * başlatır. Sonucu durum ile döndürür
+     * Toplu gönderimde ilk paket kuyruğa girdikten sonra en fazla
+     * ne kadar bekleneceğini (mikrosaniye) ayarlar. Süre dolduğunda
+     * ya da tampon dolduğunda paketler tek seferde gönderilir
      * 
-     * @param Status
+     * @param batch_time_t Delay
+     * @return Status
      */
-    Status Socket::create() noexcept
+    Status Socket::set_batch_delay(const batch_time_t ar_delay) noexcept
     {
-        if( Socket::is_valid_socket(this->m_sock) )
-            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::socket_has_already));
+        if( ar_delay < _MIN_BATCH_DELAY )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_under_min));
+        else if( ar_delay > _MAX_BATCH_DELAY )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_over_max));
+        else if( ar_delay == this->m_batch_delay.load(std::memory_order_seq_cst) )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::same_value));
 
-        socket_dom_t tm_sock_domain;
-        socket_conn_t tm_sock_type;
-        socket_proto_t tm_sock_proto;
+        this->m_batch_delay.store(ar_delay, std::memory_order_seq_cst);
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::set_batch_delay));
+    }
 
-        switch(this->m_ipv)
-        {
-            case ipv_t::ipv4:
-                tm_sock_domain = tcp::ipv4::domain;
-                tm_sock_type   = tcp::ipv4::type;
-                tm_sock_proto  = tcp::ipv4::protocol;
-                break;
+    /**
+     * @brief Set Key Grace
+     * 
+     * Anahtar değiştikten sonra önceki dönemin anahtarı ile
+     * gelen paketlerin kaç saniye daha kabul edileceğini ayarlar.
+     * Yolda olan ve kuyrukta bekleyen paketler bu sürede açılır
+     * 
+     * @param wait_time_t Grace
+     * @return Status
+     */
+    Status Socket::set_key_grace(const wait_time_t ar_grace) noexcept
+    {
+        if( ar_grace < _MIN_KEY_GRACE )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_under_min));
+        else if( ar_grace > _MAX_KEY_GRACE )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::value_over_max));
+        else if( ar_grace == this->m_key_grace.load(std::memory_order_seq_cst) )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::same_value));
 
-            case ipv_t::ipv6:
-            default:
-                tm_sock_domain = tcp::ipv6::domain;
+        this->m_key_grace.store(ar_grace, std::memory_order_seq_cst);
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::set_key_grace));
+    }
+
+    /**
+     * @brief Set Cipher Suite
+     * 
+     * El sıkışmada sunulacak şifreleme yöntemlerini ayarlar.
+     * Sadece havuzdaki yöntemler verilebilir, değişiklik
+     * sonraki bağlantılarda geçerli olur
+     * 
+     * @param suite_t Suite
+     * @return Status
+     */
+    Status Socket::set_cipher_suite(const cipherpool::suite_t ar_suite) noexcept
+    {
+        if( ar_suite == cipherpool::_SUITE_NULL || (ar_suite & ~cipherpool::_SUITE_ALL) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::cipher_suite_not_valid));
+        else if( ar_suite == this->m_suite.load(std::memory_order_seq_cst) )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::same_value));
+
+        this->m_suite.store(ar_suite, std::memory_order_seq_cst);
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::set_cipher_suite));
+    }
+
+    /**
+     * @brief Open Session
+     * 
+     * El sıkışma sonrası karşı tarafın sunduğu özellikler ile
+     * kendi özelliklerimizin kesişimini bağlantıya ait oturum
+     * olarak saklar. Gönderme ve alma işlemleri bu oturuma
+     * bakarak sıkıştırma gibi özellikleri kullanır. İki taraf
+     * da şifreleme yöntemi sunduysa ortak yöntemlerden iki
+     * işlemcide de en hızlı çalışanı bağlantının şifreleyicisi
+     * olur. Ortak çerçeve sürümü yoksa oturum açılmaz. El sıkışma
+     * kayıtları olmadığından anahtarlar kayıtlara bağlanmaz
+     * 
+     * @param socket_t Socket
+     * @param flag_t Peer Feature
+     * @return Status
+     */
+    Status Socket::open_session(
+        const socket_t ar_sock,
+        const flag::flag_t ar_peer_feature
+    ) noexcept
+    {
+        return this->make_session(ar_sock, this->get_feature(), ar_peer_feature, nullptr);
+    }
+
+    /**
+     * @brief Open Session (Handshake)
+     * 
+     * Oturumu iki tarafın el sıkışma kayıtları ile açar. Kayıtların
+     * özeti (transcript) yöntem anahtarının ve iki taraf da
+     * anlaştıysa bağlantı anahtarının türetilmesinde tuz olur;
+     * açık giden özellikler ya da yöntem teklifleri yolda
+     * değiştirilirse iki uç farklı anahtara ulaşır. İki taraf da
+     * aynı sıra ile (önce istemci, sonra sunucu) ve gönderdiği
+     * kaydın aynısını vermelidir
+     * 
+     * @param socket_t Socket
+     * @param Hello& Client
+     * @param Hello& Server
+     * @return Status
+     */
+    Status Socket::open_session(
+        const socket_t ar_sock,
+        const Hello& ar_client,
+        const Hello& ar_server
+    ) noexcept
+    {
+        const transcript_t tm_transcript = make_transcript(ar_client, ar_server);
+        return this->make_session(ar_sock, ar_client.m_feature, ar_server.m_feature, &tm_transcript);
+    }
+
+    /**
+     * @brief Make Session
+     * 
+     * İki tarafın özelliklerinin kesişimi ile oturumu oluşturur.
+     * Kesişim iki yönde de aynı olduğundan taraflar hangi ucun
+     * kendisi olduğunu bilmeden aynı oturuma ulaşır. Özet
+     * verildiyse anahtarlar ona bağlanır ve yeni dönemlerde de
+     * aynı şekilde türetilmek üzere oturumda tutulur
+     * 
+     * @param socket_t Socket
+     * @param flag_t Own Feature
+     * @param flag_t Peer Feature
+     * @param transcript_t* Transcript
+     * @return Status
+     */
+    Status Socket::make_session(
+        const socket_t ar_sock,
+        const flag::flag_t ar_own_feature,
+        const flag::flag_t ar_peer_feature,
+        const transcript_t* ar_transcript
+    ) noexcept
+    {
+        if( !Socket::is_valid_socket(ar_sock) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::target_socket_not_valid));
+
+        const flag::flag_t tm_feature = ar_own_feature & ar_peer_feature;
+
+        // A PEER WITHOUT FRAME VERSIONS PREDATES THEM AND SPEAKS THE FIRST ONE
+        if( get_frame_version(ar_own_feature) && get_frame_version(ar_peer_feature) && !get_frame_version(tm_feature) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::frame_version_not_match));
+
+        auto tm_session = std::make_shared<SessionCtx>();
+        tm_session->m_feature.set(tm_feature);
+        tm_session->m_suite = cipherpool::pick_suite(get_suite_offer(tm_feature), get_suite_accel(tm_feature));
+
+        if( ar_transcript )
+        {
+            tm_session->m_transcript = *ar_transcript;
+            tm_session->m_bound = true;
+        }
+
+        if( tm_session->m_suite == cipherpool::_SUITE_NULL )
+            tm_session->m_cipher = this->get_master();
+        else
+            tm_session->m_cipher = this->suite_cipher(tm_session->m_suite, this->get_master()->get_key(), ar_transcript);
+
+        if( !tm_session->m_cipher )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::cipher_suite_not_make));
+
+        // BOTH SIDES AGREED, A SESSION WITHOUT ITS OWN KEY MUST NOT FALL BACK TO THE SHARED ONE
+        if( ar_transcript && tm_session->m_feature.has(_FEATURE_SESSION_KEY) )
+        {
+            tm_session->m_cipher = this->derive_cipher(*tm_session->m_cipher, *ar_transcript);
+            if( !tm_session->m_cipher || tm_session->m_cipher->has_error() )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::session_key_not_derive));
+        }
+
+        // BATCHING DOES ITS OWN COALESCING, NAGLE ONLY ADDS DELAY
+        if( tm_feature & _FEATURE_BATCH )
+        {
+            int tm_nodelay = 1;
+            ::setsockopt(ar_sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&tm_nodelay), sizeof(tm_nodelay));
+
+            // BUFFER NEVER GROWS PAST ONE FULL BATCH PLUS ONE FRAME
+            tm_session->m_outbuf.reserve(_SIZE_BATCH_BUFFER + netpacket::_SIZE_FRAME_TOTAL);
+        }
+
+        {
+            std::scoped_lock tm_lock(this->m_session_mtx);
+            this->m_sessions[ar_sock] = tm_session;
+        }
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::session_open));
+    }
+
+    /**
+     * @brief Suite Cipher
+     * 
+     * Anlaşılan yöntem için ana anahtardan HKDF-SHA256 ile
+     * yöntemin beklediği uzunlukta anahtar türetir ve şifreleyiciyi
+     * oluşturur. İki tarafın kendi şifreleyicisi farklı türde
+     * olsa bile aynı anahtara ulaşılır. El sıkışma özeti
+     * verilirse tuz olarak kullanılır, yöntem anahtarı bağlantıya
+     * ve yolda değiştirilmemiş tekliflere bağlanır. Türetilen
+     * anahtar iş bitince bellekten silinir
+     * 
+     * @param suite_t Suite
+     * @param string& Key
+     * @param transcript_t* Transcript
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<algorithm::Algorithm> Socket::suite_cipher(
+        const cipherpool::suite_t ar_suite,
+        const std::string& ar_key,
+        const transcript_t* ar_transcript
+    ) const noexcept
+    {
+        try {
+            std::string tm_key(cipherpool::_SIZE_SUITE_KEY, '\0');
+
+            const std::string_view tm_salt = ar_transcript ?
+                std::string_view(reinterpret_cast<const char*>(ar_transcript->data()), ar_transcript->size())
+                : std::string_view();
+
+            if( !hash::sha256::hkdf(ar_key, tm_salt, ss_suite_info, reinterpret_cast<uint8_t*>(tm_key.data()), tm_key.size()) )
+                return nullptr;
+
+            auto tm_cipher = cipherpool::make_suite(ar_suite, this->m_cipher.get_name(), tm_key);
+
+            volatile char* tm_ptr = tm_key.data();
+            for(std::size_t tm_count = 0; tm_count < tm_key.size(); ++tm_count)
+                tm_ptr[tm_count] = 0;
+
+            if( !tm_cipher || tm_cipher->has_error() )
+                return nullptr;
+
+            return tm_cipher;
+        } catch(...) {
+            return nullptr;
+        }
+    }
+
+    /**
+     * @brief Derive Cipher
+     * 
+     * Verilen şifreleyicinin anahtarından, el sıkışma özeti
+     * (iki tarafın özellikleri ve rastgele değerleri) tuz olacak
+     * şekilde HKDF-SHA256 ile aynı uzunlukta yeni anahtar türetir
+     * ve aynı türde şifreleyici oluşturur. Türetilen anahtar iş
+     * bitince bellekten silinir
+     * 
+     * @param Algorithm& Base
+     * @param transcript_t& Transcript
+     * @return unique_ptr<Algorithm>
+     */
+    std::unique_ptr<algorithm::Algorithm> Socket::derive_cipher(
+        const algorithm::Algorithm& ar_base,
+        const transcript_t& ar_transcript
+    ) const noexcept
+    {
+        if( ar_base.has_error() )
+            return nullptr;
+
+        try {
+            const std::string& tm_base = ar_base.get_key();
+            std::string tm_key(tm_base.size(), '\0');
+
+            if( !hash::sha256::hkdf(tm_base, std::string_view(reinterpret_cast<const char*>(ar_transcript.data()), ar_transcript.size()), ss_session_info, reinterpret_cast<uint8_t*>(tm_key.data()), tm_key.size()) )
+                return nullptr;
+
+            auto tm_cipher = ar_base.clone(tm_key);
+
+            volatile char* tm_ptr = tm_key.data();
+            for(std::size_t tm_count = 0; tm_count < tm_key.size(); ++tm_count)
+                tm_ptr[tm_count] = 0;
+
+            return tm_cipher;
+        } catch(...) {
+            return nullptr;
+        }
+    }
+
+    /**
+     * @brief Make Cipher
+     * 
+     * Bağlantının yeni dönemi için verilen anahtardan
+     * şifreleyici oluşturur. Yöntem anlaşıldıysa o yöntem için
+     * el sıkışma özeti ile türetilir. Oturum anahtarı
+     * anlaşıldıysa aynı özet ile yeniden türetilir,
+     * anlaşılmadıysa anahtar doğrudan kullanılır
+     * 
+     * @param SessionCtx& Session
+     * @param string& Key
+     * @return shared_ptr<Algorithm>
+     */
+    std::shared_ptr<algorithm::Algorithm> Socket::make_cipher(
+        const SessionCtx& ar_session,
+        const std::string& ar_key
+    ) const noexcept
+    {
+        std::shared_ptr<algorithm::Algorithm> tm_cipher;
+
+        try {
+            const transcript_t* tm_transcript = ar_session.m_bound ? &ar_session.m_transcript : nullptr;
+
+            if( ar_session.m_suite != cipherpool::_SUITE_NULL )
+                tm_cipher = this->suite_cipher(ar_session.m_suite, ar_key, tm_transcript);
+            else
+                tm_cipher = this->m_cipher.clone(ar_key);
+
+            if( tm_cipher && tm_transcript && ar_session.m_feature.has(_FEATURE_SESSION_KEY) )
+                tm_cipher = this->derive_cipher(*tm_cipher, *tm_transcript);
+        } catch(...) {
+            return nullptr;
+        }
+
+        if( !tm_cipher || tm_cipher->has_error() )
+            return nullptr;
+
+        return tm_cipher;
+    }
+
+    /**
+     * @brief Rotate Key
+     * 
+     * Bağlantıları kapatmadan anahtarı değiştirir. Yeni anahtar
+     * bundan sonra açılacak bağlantılar için ana anahtar olur.
+     * Dönem anlaşılan her açık bağlantıya yeni anahtar geçerli
+     * dönemin anahtarı ile şifrelenmiş olarak bildirilir ve
+     * gönderim yeni döneme geçer. Önceki dönemin paketleri
+     * bekleme süresi boyunca kabul edilir. Dönem anlaşılmayan
+     * bağlantılar açık kaldığı sürece eski anahtarı kullanır.
+     * Anahtarı bağlantının tek ucu değiştirir; iki uç aynı
+     * dönemde duyurursa ikisi de kendi anahtarına geçip ayrılır.
+     * Bu yüzden istemci anahtar değiştirmez, sunucu da karşıdan
+     * gelen duyuruyu kabul etmez (can_accept_key)
+     * 
+     * @param string& Key
+     * @return Status
+     */
+    Status Socket::rotate_key(const std::string& ar_key) noexcept
+    {
+        // KEY TRAVELS IN THE MESSAGE FIELD
+        if( ar_key.empty() || ar_key.size() > netpacket::_SIZE_MESSAGE )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_rotate));
+
+        const Status tm_master = this->set_master(ar_key);
+        if( !tm_master.is_ok() )
+            return tm_master;
+
+        // SNAPSHOT, ANNOUNCE WITHOUT HOLDING THE SESSION MAP
+        std::vector<std::pair<socket_t, std::shared_ptr<SessionCtx>>> tm_sessions;
+        try {
+            std::scoped_lock tm_lock(this->m_session_mtx);
+            tm_sessions.assign(this->m_sessions.begin(), this->m_sessions.end());
+        } catch(...) {
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_rotate));
+        }
+
+        for(auto& [tm_sock, tm_session] : tm_sessions)
+        {
+            if( !tm_session->m_feature.has(_FEATURE_KEY_EPOCH) )
+                continue;
+
+            // A FAILED PEER STAYS ON THE OLD EPOCH, OTHERS STILL ROTATE
+            const Status tm_announce = this->announce_key(tm_sock, *tm_session, ar_key);
+            if( !tm_announce.is_ok() ) {
+                DEBUG_ONLY(this->m_logger.write(level_t::Debug, this->get_policy().get_username(), get_ip(tm_sock) + " Key Not Rotated", GET_SOURCE));
+            }
+        }
+
+        return tm_master;
+    }
+
+    /**
+     * @brief Announce Key
+     * 
+     * Yeni anahtarı geçerli dönem ile şifrelenmiş anahtar
+     * değişimi paketi olarak gönderir, ardından gönderimi yeni
+     * döneme geçirir. Oturum kilidi gönderim bitene kadar
+     * tutulduğu için yeni dönemdeki hiçbir paket duyurudan önce
+     * yola çıkmaz
+     * 
+     * @param socket_t Socket
+     * @param SessionCtx& Session
+     * @param string& Key
+     * @return Status
+     */
+    Status Socket::announce_key(
+        const socket_t ar_sock,
+        SessionCtx& ar_session,
+        const std::string& ar_key
+    ) noexcept
+    {
+        std::shared_ptr<algorithm::Algorithm> tm_next = this->make_cipher(ar_session, ar_key);
+        if( !tm_next )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::session_key_not_derive));
+
+        std::scoped_lock tm_lock(ar_session.m_keymtx);
+
+        const netpacket::frame_t tm_frame = netpacket::set_epoch(netpacket::_FRAME_REKEY, ar_session.m_epoch);
+        const Status tm_send = this->send_frame(ar_sock, &ar_session, *ar_session.m_cipher, tm_frame, {}, this->get_policy().get_username(), ar_key);
+        if( !tm_send.is_ok() )
+            return tm_send;
+
+        ar_session.m_prev_cipher = std::move(ar_session.m_cipher);
+        ar_session.m_prev_until = std::chrono::steady_clock::now() + std::chrono::seconds(this->get_key_grace());
+        ar_session.m_cipher = std::move(tm_next);
+        ar_session.m_epoch = static_cast<uint8_t>((ar_session.m_epoch + 1) % netpacket::_SIZE_EPOCH);
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::key_rotate));
+    }
+
+    /**
+     * @brief Accept Key
+     * 
+     * Karşı taraftan gelen anahtar değişimini uygular. Duyuru
+     * geçerli dönemde geldiyse yeni anahtar sonraki dönem olur,
+     * geçerli anahtar bekleme süresi boyunca önceki dönem
+     * olarak kalır. Geçerli dönemde gelmeyen (tekrar edilen ya
+     * da eski dönemden gelen) duyuru protokol hatasıdır
+     * 
+     * @param SessionCtx& Session
+     * @param uint8_t Epoch
+     * @param string& Key
+     * @return Status
+     */
+    Status Socket::accept_key(
+        SessionCtx& ar_session,
+        const uint8_t ar_epoch,
+        const std::string& ar_key
+    ) noexcept
+    {
+        std::shared_ptr<algorithm::Algorithm> tm_next = this->make_cipher(ar_session, ar_key);
+        if( !tm_next )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::session_key_not_derive));
+
+        std::scoped_lock tm_lock(ar_session.m_keymtx);
+        if( ar_epoch != ar_session.m_epoch )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_epoch_not_match));
+
+        ar_session.m_prev_cipher = std::move(ar_session.m_cipher);
+        ar_session.m_prev_until = std::chrono::steady_clock::now() + std::chrono::seconds(this->get_key_grace());
+        ar_session.m_cipher = std::move(tm_next);
+        ar_session.m_epoch = static_cast<uint8_t>((ar_session.m_epoch + 1) % netpacket::_SIZE_EPOCH);
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::key_rotate));
+    }
+
+    /**
+     * @brief Close Session
+     * 
+     * Bağlantı kapandığında ona ait oturum bilgisini siler,
+     * aynı soket numarası tekrar kullanıldığında eski
+     * özellikler kalmamış olur. Kuyrukta bekleyen paketler
+     * silinmeden önce gönderilir
+     * 
+     * @param socket_t Socket
+     * @return Status
+     */
+    Status Socket::close_session(const socket_t ar_sock) noexcept
+    {
+        this->flush(ar_sock);
+
+        std::scoped_lock tm_lock(this->m_session_mtx);
+
+        return this->m_sessions.erase(ar_sock) ?
+            Status::ok(domain_t::socket, status::to_underlying(socket_code_t::session_close))
+            : Status::warn(domain_t::socket, status::to_underlying(socket_code_t::session_not_found));
+    }
+
+    /**
+     * @brief Set Running
+     * 
+     * Soketin çalışıp çalışmadığı bilgisini tutacak olan
+     * değişkeni ayarlamayı sağlar
+     * 
+     * @param bool Running
+     * @return Status
+     */
+    Status Socket::set_running(const bool ar_running) noexcept
+    {
+        // SAME VALUE
+        if( ar_running == this->m_running.load(std::memory_order_seq_cst) )
+            return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::same_value));
+        
+        // SET
+        this->m_running.store(ar_running, std::memory_order_seq_cst);
+        return ar_running == this->m_running.load(std::memory_order_seq_cst) ?
+            Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_set_running)) :
+            Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_set_running));
+    }
+
+    /**
+     * @brief Create
+     * 
+     * Ayarlanmış soket verilerini kullanarak soket bağlantısını
+     * başlatır. Sonucu durum ile döndürür
+     * 
+     * @param Status
+     */
+    Status Socket::create() noexcept
+    {
+        if( Socket::is_valid_socket(this->m_sock) )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::socket_has_already));
+
+        socket_dom_t tm_sock_domain;
+        socket_conn_t tm_sock_type;
+        socket_proto_t tm_sock_proto;
+
+        switch(this->m_ipv)
+        {
+            case ipv_t::ipv4:
+                tm_sock_domain = tcp::ipv4::domain;
+                tm_sock_type   = tcp::ipv4::type;
+                tm_sock_proto  = tcp::ipv4::protocol;
+                break;
+
+            case ipv_t::ipv6:
+            default:
+                tm_sock_domain = tcp::ipv6::domain;
                 tm_sock_type   = tcp::ipv6::type;
                 tm_sock_proto  = tcp::ipv6::protocol;                
                 break;
@@ -941,6 +2017,13 @@ namespace netsocket
             this->m_flag.clear();
         }
 
+        this->stop_flusher();
+
+        {
+            std::scoped_lock tm_lock(this->m_session_mtx);
+            this->m_sessions.clear();
+        }
+
         return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_clear));
     }
 
@@ -949,7 +2032,9 @@ namespace netsocket
      * 
      * Oluşturduğumuz soket ile veri göndermek istenilen soketler kontrol edilir.
      * Veri aktif olan sürüme göre ayarlanır. Sonrasında belirtilen socket
-     * numarasına iletilir
+     * numarasına iletilir. Paket iş parçacığına ait tampona açık olarak
+     * yazılır, veri bölümü tek geçişte yerinde şifrelenir. İlk gönderimden
+     * sonra bellek ayrılmaz
      * 
      * @param socket_t Target Socket
      * @param DataPacket& Data
@@ -969,40 +2054,43 @@ namespace netsocket
         if( ar_datapack.m_name.empty() || ar_datapack.m_msg.empty() )
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::not_enough_data_in_packet));
 
-        // ENCRYPT THE ALL DATA
-        auto tm_pwd = ar_datapack.m_pwd;
-        auto tm_name = ar_datapack.m_name;
-        auto tm_msg = ar_datapack.m_msg;
+        // FIELD OVER ITS LIMIT
+        if( ar_datapack.m_pwd.size() > netpacket::_SIZE_PASSWORD
+            || ar_datapack.m_name.size() > netpacket::_SIZE_USERNAME
+            || ar_datapack.m_msg.size() > netpacket::_SIZE_MESSAGE )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_too_large));
 
-        this->get_cipher().encrypt(tm_pwd);
-        this->get_cipher().encrypt(tm_name);
-        this->get_cipher().encrypt(tm_msg);
+        // PER THREAD SCRATCH, CAPACITY IS KEPT SO STEADY STATE DOES NOT ALLOCATE
+        static thread_local std::string ss_packed;
 
-        // NET PACKET BUFFER
-        netpacket::NetPacket tm_netpack(tm_pwd, tm_name, tm_msg);
-        const auto& tm_buffer = tm_netpack.get();
+        // SESSION FEATURES
+        const auto tm_session = this->get_session(ar_target_sock);
+        const flag::Flag tm_feature(tm_session ? tm_session->m_feature.get() : _FEATURE_NULL);
 
-        // TOTAL SENT DATA SIZE VARIABLE
-        uint32_t tm_total_sent = 0;
-        const uint32_t tm_total_size = tm_buffer.size();
+        // COMPRESS MESSAGE BEFORE ENCRYPT IF NEGOTIATED
+        netpacket::frame_t tm_frame = netpacket::_FRAME_NULL;
+        std::string_view tm_body = ar_datapack.m_msg;
+        if( tm_body.size() >= this->get_compress_threshold() && tm_feature.has(_FEATURE_COMPRESS) )
+        {
+            if( compress::lz::compress(ar_datapack.m_msg, ss_packed) )
+            {
+                tm_body = ss_packed;
+                tm_frame |= netpacket::_FRAME_COMPRESS;
+            }
+        }
 
-        // SEND
-        while( tm_total_sent < tm_total_size ) {
-            int tm_sent = ::send(ar_target_sock,
-                reinterpret_cast<const char*>(tm_buffer.data()) + tm_total_sent,
-                static_cast<int>(tm_total_size - tm_total_sent),
-                0
-            );
+        // CURRENT EPOCH CIPHER, KEPT ALIVE EVEN IF THE KEY ROTATES MEANWHILE
+        uint8_t tm_epoch = 0;
+        const std::shared_ptr<algorithm::Algorithm> tm_cipher = this->send_cipher(tm_session.get(), tm_epoch);
+        if( !tm_cipher )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_encrypt));
 
-            // NOT SENT OR SOCKET CLOSED
-            if( tm_sent < 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_send));
-            else if ( tm_sent == 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_can_be_close));
+        if( tm_feature.has(_FEATURE_KEY_EPOCH) )
+            tm_frame = netpacket::set_epoch(tm_frame, tm_epoch);
 
-            // ADD SENT DATA SIZE TO VARIABLE UNTIL SENT ENDS UP
-            tm_total_sent += tm_sent;
-        }
+        const Status tm_send = this->send_frame(ar_target_sock, tm_session.get(), *tm_cipher, tm_frame, ar_datapack.m_pwd, ar_datapack.m_name, tm_body);
+        if( !tm_send.is_ok() )
+            return tm_send;
 
         // LOGGER
         DEBUG_ONLY(
@@ -1010,7 +2098,72 @@ namespace netsocket
             this->m_logger.write(level_t::Debug, this->get_policy().get_username(), tm_ip + " Sent", GET_SOURCE)
         );
 
-        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_sent));
+        return tm_send;
+    }
+
+    /**
+     * @brief Send Frame
+     * 
+     * Alanları çerçeveye yerleştirir, verilen şifreleyici ile
+     * yerinde şifreler, anlaşıldıysa CRC ekler ve toplu
+     * gönderim varsa kuyruğa, yoksa doğrudan gönderir. Veri ve
+     * anahtar değişimi paketleri aynı yoldan geçer
+     * 
+     * @param socket_t Target Socket
+     * @param SessionCtx* Session
+     * @param Algorithm& Cipher
+     * @param frame_t Frame
+     * @param string_view Password
+     * @param string_view Name
+     * @param string_view Body
+     * @return Status
+     */
+    Status Socket::send_frame(
+        const socket_t ar_target_sock,
+        SessionCtx* ar_session,
+        algorithm::Algorithm& ar_cipher,
+        netpacket::frame_t ar_frame,
+        std::string_view ar_pwd,
+        std::string_view ar_name,
+        std::string_view ar_body
+    ) noexcept
+    {
+        // PER THREAD SCRATCH, CAPACITY IS KEPT SO STEADY STATE DOES NOT ALLOCATE
+        static thread_local netpacket::buffer_t ss_frame;
+
+        const flag::Flag tm_feature(ar_session ? ar_session->m_feature.get() : _FEATURE_NULL);
+
+        // INTEGRITY TRAILER IF NEGOTIATED
+        if( tm_feature.has(_FEATURE_CRC) )
+            ar_frame |= netpacket::_FRAME_CRC;
+
+        // SEALING CIPHER APPENDS NONCE (AND TAG) AFTER THE BODY
+        const std::size_t tm_seal = ar_cipher.get_seal_size();
+        if( tm_seal > netpacket::_SIZE_SEAL )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_encrypt));
+        else if( tm_seal )
+            ar_frame |= netpacket::_FRAME_AEAD;
+
+        // PLAIN FRAME INTO SCRATCH BUFFER
+        std::size_t tm_len = netpacket::NetPacket::layout(ss_frame.data(), ss_frame.size(), ar_pwd, ar_name, ar_body, ar_frame);
+        if( tm_len == 0 || tm_len + tm_seal > ss_frame.size() )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_too_large));
+
+        // ENCRYPT (AND AUTHENTICATE HEADER + BODY) IN PLACE, ONE PASS
+        if( !ar_cipher.seal(algorithm::Frame{ ss_frame.data(), netpacket::_SIZE_HEADER, tm_len - netpacket::_SIZE_HEADER }, ss_frame.data() + tm_len) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_encrypt));
+
+        tm_len += tm_seal;
+
+        // TRAILER OVER CIPHERTEXT
+        tm_len = netpacket::NetPacket::seal(ss_frame.data(), tm_len, ss_frame.size(), ar_frame);
+        if( tm_len == 0 )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_too_large));
+
+        // BATCH SESSION QUEUES THE FRAME, OTHERWISE SEND NOW
+        return ar_session && tm_feature.has(_FEATURE_BATCH) ?
+            this->queue_frame(ar_target_sock, *ar_session, ss_frame.data(), tm_len)
+            : Socket::send_all(ar_target_sock, ss_frame.data(), tm_len);
     }
 
     /**
@@ -1018,7 +2171,9 @@ namespace netsocket
      * 
      * Oluşturduğumuz soket ile veri alınmak istenilen soketler kontrol edilir.
      * Sorun bulunmaması dahilinde veri belirtilen soketten alınır. Sürüm kontrolü
-     * sonrasında hata bulunursa hata durumu döndürülür aksi halde başarı döndürülür
+     * sonrasında hata bulunursa hata durumu döndürülür aksi halde başarı döndürülür.
+     * Anahtar değişimi paketi veri değildir; uygulanır ve sıradaki paket aynı
+     * döngüde okunur, art arda gelen duyurular yığını büyütmez
      * 
      * @param socket_t Target Socket
      * @param DataPacket& Data
@@ -1027,82 +2182,178 @@ namespace netsocket
         const socket_t ar_target_sock,
         DataPacket& ar_datapack
     ) noexcept
+    {
+        while( true )
+        {
+            const Status tm_status = this->recv_packet(ar_target_sock, ar_datapack);
+            if( !tm_status.is_ok() || tm_status.get_code() != status::to_underlying(socket_code_t::key_rotate) )
+                return tm_status;
+        }
+    }
+
+    /**
+     * @brief Receive Packet
+     * 
+     * Tek bir paketi okur, doğrular ve çözer. Anahtar değişimi
+     * paketi ise yeni anahtarı uygular ve key_rotate döndürür,
+     * veri paketine bir şey yazılmaz
+     * 
+     * @param socket_t Target Socket
+     * @param DataPacket& Data
+     * @return Status
+     */
+    Status Socket::recv_packet(
+        const socket_t ar_target_sock,
+        DataPacket& ar_datapack
+    ) noexcept
     {
         // NOT VALID SOCKET
         if( !Socket::is_valid_socket(ar_target_sock) )
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::target_socket_not_valid));
 
+        // SESSION FEATURES
+        const auto tm_session = this->get_session(ar_target_sock);
+        const flag::Flag tm_feature(tm_session ? tm_session->m_feature.get() : _FEATURE_NULL);
+
+        // BATCH SESSION READS AHEAD, ONLY ONE READER AT A TIME
+        SessionCtx* tm_reader = tm_feature.has(_FEATURE_BATCH) ? tm_session.get() : nullptr;
+        std::unique_lock<std::mutex> tm_inlock;
+        if( tm_reader )
+        {
+            // REQUEST/RESPONSE MUST NOT WAIT FOR BATCH DEADLINE
+            this->flush(ar_target_sock);
+            tm_inlock = std::unique_lock<std::mutex>(tm_reader->m_inmtx);
+        }
+
         // HEADER DATA ARRAY
         constexpr size_t size_header = netpacket::_SIZE_HEADER;
-        char tm_header[size_header] {};
+        char tm_header[size_header + 1] {};
 
         // RECEIVE NEXT DATA LENGTH
-        // RECEIVE THE REAL DATA
-        int tm_total_header = 0;
-        const int tm_expected_header = static_cast<int>(size_header);
-        while( tm_total_header < tm_expected_header )
-        {
-            int tm_recv = ::recv(ar_target_sock, tm_header + tm_total_header, tm_expected_header - tm_total_header, 0);
+        const int tm_recv_header = this->recv_frame_bytes(ar_target_sock, tm_reader, tm_header, size_header);
+        if( tm_recv_header < 0 )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_recv_header));
+        else if( tm_recv_header == 0 )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::recv_socket_close_header));
 
-            if( tm_recv < 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_recv_header));
-            else if( tm_recv == 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::recv_socket_close_header));
+        // READ NEXT DATA LENGTH
+        netpacket::DataSchema::values_t tm_values {};
+        if( !netpacket::DataSchema::read_header(tm_header, tm_values) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
 
-            tm_total_header += tm_recv;
-        }
+        const netpacket::frame_t tm_frame = static_cast<netpacket::frame_t>(tm_values[netpacket::_FIELD_FRAME]);
 
-        // LENGTH VARIABLES
-        uint16_t tm_len_pwd = 0;
-        uint16_t tm_len_name = 0;
-        uint16_t tm_len_msg = 0;
+        // COMPRESSED FRAME WITHOUT NEGOTIATION
+        const bool tm_compressed = (tm_frame & netpacket::_FRAME_COMPRESS) != 0;
+        if( tm_compressed && !tm_feature.has(_FEATURE_COMPRESS) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
 
-        // READ NEXT DATA LENGTH
-        if( std::sscanf(tm_header, "%03hu%03hu%04hu", &tm_len_pwd, &tm_len_name, &tm_len_msg) != 3 )
+        // CRC TRAILER WITHOUT NEGOTIATION
+        const bool tm_has_crc = (tm_frame & netpacket::_FRAME_CRC) != 0;
+        if( tm_has_crc && !tm_feature.has(_FEATURE_CRC) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
+
+        // KEY EPOCH OR KEY ANNOUNCEMENT WITHOUT NEGOTIATION
+        const bool tm_rekey = (tm_frame & netpacket::_FRAME_REKEY) != 0;
+        const uint8_t tm_epoch = netpacket::get_epoch(tm_frame);
+        if( (tm_rekey || tm_epoch) && !tm_feature.has(_FEATURE_KEY_EPOCH) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
+
+        // CIPHER OF THE FRAME EPOCH, CURRENT OR PREVIOUS ONE WITHIN GRACE
+        const std::shared_ptr<algorithm::Algorithm> tm_epoch_cipher = this->recv_cipher(tm_session.get(), tm_epoch);
+        if( !tm_epoch_cipher )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_epoch_unknown));
+
+        algorithm::Algorithm& tm_cipher = *tm_epoch_cipher;
+
+        // SEALED FRAME MUST MATCH THE CIPHER, NO SILENT DOWNGRADE
+        const bool tm_has_aead = (tm_frame & netpacket::_FRAME_AEAD) != 0;
+        const uint32_t tm_seal_len = static_cast<uint32_t>(tm_cipher.get_seal_size());
+        if( tm_has_aead != (tm_seal_len != 0) || tm_seal_len > netpacket::_SIZE_SEAL )
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
 
         // DATA LENGTH IS VALID?
-        const uint32_t tm_payload_len = tm_len_pwd + tm_len_name + tm_len_msg;
+        const uint32_t tm_payload_len = netpacket::DataSchema::payload_size(tm_values);
         if( tm_payload_len == 0 )
             return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::packet_no_data));
 
-        // VECTOR FOR DATA
-        std::vector<char> tm_payload(tm_payload_len);
+        // VECTOR FOR HEADER, DATA, SEAL AND TRAILER. HEADER STAYS IN FRONT AS ASSOCIATED DATA
+        const uint32_t tm_trailer_len = tm_has_crc ? netpacket::_SIZE_TRAILER : 0;
+        std::vector<char> tm_packet(size_header + tm_payload_len + tm_seal_len + tm_trailer_len);
+        std::memcpy(tm_packet.data(), tm_header, size_header);
+        char* const tm_payload = tm_packet.data() + size_header;
 
         // RECEIVE THE REAL DATA
-        int tm_total_recv = 0;
-        const int tm_expected_len = static_cast<int>(tm_payload_len);
-        while( tm_total_recv < tm_expected_len )
+        const int tm_recv_payload = this->recv_frame_bytes(ar_target_sock, tm_reader, tm_payload, tm_packet.size() - size_header);
+        if( tm_recv_payload < 0 )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_recv));
+        else if( tm_recv_payload == 0 )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::recv_socket_close));
+
+        if( tm_inlock.owns_lock() )
+            tm_inlock.unlock();
+
+        // VERIFY TRAILER BEFORE DECRYPT
+        if( tm_has_crc )
         {
-            int tm_recv = ::recv(ar_target_sock, tm_payload.data() + tm_total_recv, tm_expected_len - tm_total_recv, 0);
+            const hash::crc32c::crc_t tm_crc = hash::crc32c::crc32c(tm_packet.data(), size_header + tm_payload_len + tm_seal_len);
 
-            if( tm_recv < 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_recv));
-            else if( tm_recv == 0 )
-                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::recv_socket_close));
+            hash::crc32c::crc_t tm_trailer = 0;
+            for(uint32_t tm_count = 0; tm_count < tm_trailer_len; ++tm_count)
+                tm_trailer = (tm_trailer << 8) | static_cast<uint8_t>(tm_payload[tm_payload_len + tm_seal_len + tm_count]);
 
-            tm_total_recv += tm_recv;
+            if( tm_crc != tm_trailer )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_crc_mismatch));
         }
 
-        // OFFSET
-        uint32_t tm_offset = 0;
+        // VERIFY AND DECRYPT THE WHOLE BODY IN PLACE, ONE PASS
+        if( !tm_cipher.open(algorithm::Frame{ reinterpret_cast<std::byte*>(tm_packet.data()), size_header, tm_payload_len }, reinterpret_cast<const std::byte*>(tm_payload + tm_payload_len)) )
+            return Status::err(domain_t::socket, status::to_underlying(tm_has_aead ? socket_code_t::packet_not_auth : socket_code_t::packet_not_decrypt));
 
-        // PASSWORD LENGTH
-        std::string tm_pwd(tm_payload.data() + tm_offset, tm_len_pwd);
-        tm_offset += tm_len_pwd;
+        // SPLIT PAYLOAD INTO FIELDS
+        netpacket::DataSchema::texts_t tm_texts {};
+        if( !netpacket::DataSchema::decode(tm_payload, tm_payload_len, tm_values, tm_texts) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
 
-        // NAME LENGTH
-        std::string tm_name(tm_payload.data() + tm_offset, tm_len_name);
-        tm_offset += tm_len_name;
+        std::string tm_pwd(tm_texts[netpacket::_FIELD_PASSWORD]);
+        std::string tm_name(tm_texts[netpacket::_FIELD_USERNAME]);
+        std::string tm_msg(tm_texts[netpacket::_FIELD_MESSAGE]);
 
-        // MESSAGE LENGTH
-        std::string tm_msg(tm_payload.data() + tm_offset, tm_len_msg);
-        tm_offset += tm_len_msg;
+        // DECOMPRESS MESSAGE AFTER DECRYPT
+        if( tm_compressed )
+        {
+            std::string tm_unpacked;
+            if( !compress::lz::decompress(tm_msg, tm_unpacked, netpacket::_SIZE_MESSAGE) )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_decompress));
 
-        // DECRYPT ALL
-        this->get_cipher().decrypt(tm_pwd);
-        this->get_cipher().decrypt(tm_name);
-        this->get_cipher().decrypt(tm_msg);
+            tm_msg.swap(tm_unpacked);
+        }
+
+        // KEY ANNOUNCEMENT IS NOT DATA, APPLY IT AND LET THE CALLER READ THE NEXT FRAME
+        if( tm_rekey )
+        {
+            // ONLY ONE END ANNOUNCES, A CROSSED ANNOUNCEMENT WOULD SPLIT THE KEYS
+            const Status tm_accept = this->can_accept_key() ?
+                this->accept_key(*tm_session, tm_epoch, tm_msg)
+                : Status::err(domain_t::socket, status::to_underlying(socket_code_t::key_not_accept));
+            if( tm_accept.is_ok() )
+                this->rekeyed(ar_target_sock, tm_msg);
+
+            // PLAIN KEY MUST NOT STAY IN MEMORY
+            volatile char* tm_wipe = tm_msg.data();
+            for(std::size_t tm_count = 0; tm_count < tm_msg.size(); ++tm_count)
+                tm_wipe[tm_count] = 0;
+
+            tm_wipe = tm_packet.data();
+            for(std::size_t tm_count = 0; tm_count < tm_packet.size(); ++tm_count)
+                tm_wipe[tm_count] = 0;
+
+            if( tm_accept.is_err() )
+                return tm_accept;
+
+            DEBUG_ONLY(this->m_logger.write(level_t::Debug, this->get_policy().get_username(), get_ip(ar_target_sock) + " Key Rotated", GET_SOURCE));
+            return tm_accept;
+        }
 
         // ASSIGN TO DATA PACKET
         ar_datapack.m_pwd = tm_pwd;
@@ -1124,6 +2375,282 @@ namespace netsocket
         return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_recv));
     }
 
+    /**
+     * @brief Flush
+     * 
+     * Bağlantının kuyruğunda bekleyen paketleri süre dolmasını
+     * beklemeden tek seferde gönderir
+     * 
+     * @param socket_t Target Socket
+     * @return Status
+     */
+    Status Socket::flush(
+        const socket_t ar_target_sock
+    ) noexcept
+    {
+        const auto tm_session = this->get_session(ar_target_sock);
+        if( !tm_session )
+            return Status::warn(domain_t::socket, status::to_underlying(socket_code_t::session_not_found));
+
+        std::scoped_lock tm_lock(tm_session->m_outmtx);
+        if( tm_session->m_outbuf.empty() )
+            return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_flushed));
+
+        const Status tm_send = Socket::send_all(ar_target_sock, tm_session->m_outbuf.data(), tm_session->m_outbuf.size());
+        tm_session->m_outbuf.clear();
+
+        if( !tm_send.is_ok() ) {
+            tm_session->m_broken = true;
+            return tm_send;
+        }
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_flushed));
+    }
+
+    /**
+     * @brief Queue Frame
+     * 
+     * Paketi bağlantının gönderim tamponuna ekler. Tampon dolarsa
+     * hemen gönderilir, dolmazsa ilk paketten itibaren belirlenen
+     * süre sonunda arka plandaki işlem tarafından gönderilir.
+     * Arka planda oluşan gönderim hatası sonraki çağrıda döner
+     * 
+     * @param socket_t Target Socket
+     * @param SessionCtx& Session
+     * @param byte* Data
+     * @param size_t Length
+     * @return Status
+     */
+    Status Socket::queue_frame(
+        const socket_t ar_target_sock,
+        SessionCtx& ar_session,
+        const std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        bool tm_first = false;
+
+        {
+            std::scoped_lock tm_lock(ar_session.m_outmtx);
+
+            if( ar_session.m_broken )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_send));
+
+            if( ar_session.m_outbuf.empty() ) {
+                ar_session.m_outtime = std::chrono::steady_clock::now();
+                tm_first = true;
+            }
+
+            ar_session.m_outbuf.insert(ar_session.m_outbuf.end(), ar_data, ar_data + ar_len);
+
+            // BUFFER FULL, FLUSH NOW
+            if( ar_session.m_outbuf.size() >= _SIZE_BATCH_BUFFER )
+            {
+                const Status tm_send = Socket::send_all(ar_target_sock, ar_session.m_outbuf.data(), ar_session.m_outbuf.size());
+                ar_session.m_outbuf.clear();
+
+                if( !tm_send.is_ok() )
+                    ar_session.m_broken = true;
+
+                return tm_send;
+            }
+        }
+
+        // FIRST FRAME ARMS THE DEADLINE
+        if( tm_first )
+            this->wake_flusher();
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_queued));
+    }
+
+    /**
+     * @brief Receive Frame Bytes
+     * 
+     * İstenilen uzunluk tamamlanana kadar veri okur. Toplu alım
+     * açık olan oturumlarda tek okuma ile mümkün olduğunca fazla
+     * veri alınır ve sonraki paketler tampondan verilir. Başarıda
+     * uzunluk, bağlantı kapanırsa 0, hata olursa -1 döner
+     * 
+     * @param socket_t Target Socket
+     * @param SessionCtx* Session
+     * @param char* Destination
+     * @param size_t Length
+     * @return int
+     */
+    int Socket::recv_frame_bytes(
+        const socket_t ar_target_sock,
+        SessionCtx* ar_session,
+        char* ar_dst,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        std::size_t tm_total = 0;
+
+        // DIRECT READ
+        if( !ar_session )
+        {
+            while( tm_total < ar_len )
+            {
+                int tm_recv = ::recv(ar_target_sock, ar_dst + tm_total, static_cast<int>(ar_len - tm_total), 0);
+                if( tm_recv <= 0 )
+                    return tm_recv < 0 ? -1 : 0;
+
+                tm_total += static_cast<std::size_t>(tm_recv);
+            }
+
+            return static_cast<int>(tm_total);
+        }
+
+        // READ AHEAD BUFFER
+        if( ar_session->m_inbuf.size() < _SIZE_READ_AHEAD )
+            ar_session->m_inbuf.resize(_SIZE_READ_AHEAD);
+
+        while( tm_total < ar_len )
+        {
+            // REFILL
+            if( ar_session->m_inpos >= ar_session->m_inlen )
+            {
+                int tm_recv = ::recv(ar_target_sock, ar_session->m_inbuf.data(), static_cast<int>(ar_session->m_inbuf.size()), 0);
+                if( tm_recv <= 0 )
+                    return tm_recv < 0 ? -1 : 0;
+
+                ar_session->m_inpos = 0;
+                ar_session->m_inlen = static_cast<std::size_t>(tm_recv);
+            }
+
+            const std::size_t tm_copy = std::min(ar_len - tm_total, ar_session->m_inlen - ar_session->m_inpos);
+            std::memcpy(ar_dst + tm_total, ar_session->m_inbuf.data() + ar_session->m_inpos, tm_copy);
+
+            ar_session->m_inpos += tm_copy;
+            tm_total += tm_copy;
+        }
+
+        return static_cast<int>(tm_total);
+    }
+
+    /**
+     * @brief Wake Flusher
+     * 
+     * Toplu gönderim işlemini gerekirse ilk seferde başlatır
+     * ve bekleyen paket olduğunu bildirir
+     */
+    void Socket::wake_flusher() noexcept
+    {
+        {
+            std::scoped_lock tm_lock(this->m_flush_mtx);
+
+            if( this->m_flush_stop )
+                return;
+
+            if( !this->m_flusher.joinable() )
+                this->m_flusher = std::thread(&Socket::flush_runner, this);
+
+            this->m_flush_pending = true;
+        }
+
+        this->m_flush_cv.notify_one();
+    }
+
+    /**
+     * @brief Stop Flusher
+     * 
+     * Toplu gönderim işlemini durdurur ve bitmesini bekler.
+     * Sonrasında soket tekrar kullanılırsa işlem yeniden
+     * başlatılabilir
+     */
+    void Socket::stop_flusher() noexcept
+    {
+        {
+            std::scoped_lock tm_lock(this->m_flush_mtx);
+            this->m_flush_stop = true;
+        }
+
+        this->m_flush_cv.notify_all();
+
+        if( this->m_flusher.joinable() && this->m_flusher.get_id() != std::this_thread::get_id() )
+            this->m_flusher.join();
+
+        {
+            std::scoped_lock tm_lock(this->m_flush_mtx);
+            this->m_flush_stop = false;
+            this->m_flush_pending = false;
+        }
+    }
+
+    /**
+     * @brief Flush Runner
+     * 
+     * Bekleyen paket yokken uyur. Paket kuyruğa girdiğinde belirlenen
+     * süre kadar bekler ve süresi dolan tamponları gönderir
+     */
+    void Socket::flush_runner() noexcept
+    {
+        std::unique_lock tm_lock(this->m_flush_mtx);
+
+        while( !this->m_flush_stop )
+        {
+            // SLEEP UNTIL SOMETHING QUEUED
+            this->m_flush_cv.wait(tm_lock, [this]{ return this->m_flush_stop || this->m_flush_pending; });
+            if( this->m_flush_stop )
+                break;
+
+            // WAIT FOR DEADLINE
+            const auto tm_delay = std::chrono::microseconds(this->m_batch_delay.load(std::memory_order_acquire));
+            this->m_flush_cv.wait_for(tm_lock, tm_delay, [this]{ return this->m_flush_stop; });
+            this->m_flush_pending = false;
+
+            tm_lock.unlock();
+            const bool tm_left = this->flush_expired();
+            tm_lock.lock();
+
+            if( tm_left )
+                this->m_flush_pending = true;
+        }
+    }
+
+    /**
+     * @brief Flush Expired
+     * 
+     * Süresi dolan tüm bağlantı tamponlarını gönderir. Süresi
+     * dolmamış ama bekleyen paket varsa true döner. Oturum listesi
+     * sadece gönderim iş parçacığı tarafından kullanılır ve kapasitesi
+     * korunduğu için her uyanmada bellek ayrılmaz
+     * 
+     * @return bool
+     */
+    bool Socket::flush_expired() noexcept
+    {
+        auto& tm_sessions = this->m_flush_list;
+        {
+            std::scoped_lock tm_lock(this->m_session_mtx);
+            tm_sessions.assign(this->m_sessions.begin(), this->m_sessions.end());
+        }
+
+        const auto tm_now = std::chrono::steady_clock::now();
+        const auto tm_delay = std::chrono::microseconds(this->m_batch_delay.load(std::memory_order_acquire));
+
+        bool tm_left = false;
+        for(auto& [tm_sock, tm_session] : tm_sessions)
+        {
+            std::scoped_lock tm_lock(tm_session->m_outmtx);
+            if( tm_session->m_outbuf.empty() )
+                continue;
+
+            if( tm_now - tm_session->m_outtime < tm_delay ) {
+                tm_left = true;
+                continue;
+            }
+
+            if( !Socket::send_all(tm_sock, tm_session->m_outbuf.data(), tm_session->m_outbuf.size()).is_ok() )
+                tm_session->m_broken = true;
+
+            tm_session->m_outbuf.clear();
+        }
+
+        tm_sessions.clear();
+        return tm_left;
+    }
+
     /**
      * @brief Crashed
      * 
@@ -1396,25 +2923,71 @@ namespace netsocket
         return std::string{ tm_ipstr };
     }
 
+    /**
+     * @brief Send All
+     * 
+     * Verinin tamamı gönderilene kadar gönderme işlemini tekrarlar.
+     * Gönderilemezse ya da soket kapanmışsa hata döndürür
+     * 
+     * @param socket_t Socket
+     * @param byte* Data
+     * @param size_t Length
+     * @return Status
+     */
+    [[maybe_unused]] [[nodiscard]]
+    Status Socket::send_all(
+        const socket_t ar_sock,
+        const std::byte* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        // TOTAL SENT DATA SIZE VARIABLE
+        std::size_t tm_total_sent = 0;
+
+        // SEND
+        while( tm_total_sent < ar_len ) {
+            int tm_sent = ::send(ar_sock,
+                reinterpret_cast<const char*>(ar_data) + tm_total_sent,
+                static_cast<int>(ar_len - tm_total_sent),
+                0
+            );
+
+            // NOT SENT OR SOCKET CLOSED
+            if( tm_sent < 0 )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_not_send));
+            else if ( tm_sent == 0 )
+                return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_can_be_close));
+
+            // ADD SENT DATA SIZE TO VARIABLE UNTIL SENT ENDS UP
+            tm_total_sent += static_cast<std::size_t>(tm_sent);
+        }
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_data_sent));
+    }
+
     /**
      * @brief Handshake Send
      * 
      * Soket vb. bazı özel işlemlerde uyuşma kontrolü gerekir, yoksa aksi
-     * halde beklenmedik durumlar oluşabilir. İki soket arasındaki sürümün
-     * aynı hash numarasına sahip olacağını biliyoruz, bu hash numaralarını
-     * client (istemci) için connect sonrası şifreleme yapılmadan yapılmalı
+     * halde beklenmedik durumlar oluşabilir. Önce sadece el sıkışma
+     * kaydının düzenine bağlı sabit protokol değeri (magic), client
+     * (istemci) için connect sonrası şifreleme yapılmadan gönderilir.
+     * Ardından sunulan özellikler (çerçeve ve şema sürümleri dahil) ağ
+     * bayt sırası ile, en sonda bağlantı anahtarı için rastgele değer eklenir
      * 
      * @param socket_t Socket
+     * @param flag_t Feature
+     * @param random_t& Random
      * @return Status
      */
     [[maybe_unused]] [[nodiscard]]
-    Status Socket::handshake_send_verify(const socket_t ar_sock) noexcept
+    Status Socket::handshake_send_verify(const socket_t ar_sock, const flag::flag_t ar_feature, const random_t& ar_random) noexcept
     {
         if( !Socket::is_valid_socket(ar_sock) )
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_valid));
 
-        char tm_hash[ss_hash_hex_size] {};
-        std::memcpy(tm_hash, ss_ver_hash.c_str(), ss_hash_hex_size);
+        char tm_hash[ss_record_size] {};
+        put_record(tm_hash, Hello{ ar_feature, ar_random });
 
         int tm_sent = ::send(ar_sock, reinterpret_cast<const char*>(tm_hash), sizeof(tm_hash), 0);
         if( tm_sent != sizeof(tm_hash) )
@@ -1439,16 +3012,60 @@ namespace netsocket
     [[maybe_unused]] [[nodiscard]]
     Status Socket::handshake_recv_verify(const socket_t ar_sock, const bool ar_close) noexcept
     {
+        flag::flag_t tm_feature = _FEATURE_NULL;
+        return Socket::handshake_recv_verify(ar_sock, tm_feature, ar_close);
+    }
+
+    /**
+     * @brief Handshake Receive Verify
+     * 
+     * Sürüm hash değerini doğrular ve ardından gelen karşı tarafın
+     * sunduğu özellikleri okur. Özellikler sadece hash eşleşirse
+     * geçerli kabul edilir, gelen rastgele değer kullanılmaz
+     * 
+     * @param socket_t Socket
+     * @param flag_t& Feature
+     * @param bool Close
+     * @return Status
+     */
+    [[maybe_unused]] [[nodiscard]]
+    Status Socket::handshake_recv_verify(const socket_t ar_sock, flag::flag_t& ar_feature, const bool ar_close) noexcept
+    {
+        random_t tm_random {};
+        return Socket::handshake_recv_verify(ar_sock, ar_feature, tm_random, ar_close);
+    }
+
+    /**
+     * @brief Handshake Receive Verify
+     * 
+     * Protokol değerini (magic) doğrular, karşı tarafın sunduğu
+     * özellikleri ve bağlantı anahtarı için gönderdiği rastgele
+     * değeri okur. İkisi de sadece magic eşleşirse geçerli kabul
+     * edilir. Farklı sürümden uç burada kesilmez, ortak sürüm
+     * oturum açılırken özelliklerden seçilir
+     * 
+     * @param socket_t Socket
+     * @param flag_t& Feature
+     * @param random_t& Random
+     * @param bool Close
+     * @return Status
+     */
+    [[maybe_unused]] [[nodiscard]]
+    Status Socket::handshake_recv_verify(const socket_t ar_sock, flag::flag_t& ar_feature, random_t& ar_random, const bool ar_close) noexcept
+    {
+        ar_feature = _FEATURE_NULL;
+        ar_random.fill(0);
+
         if( !Socket::is_valid_socket(ar_sock) )
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_not_valid));
 
-        char tm_hash[ss_hash_hex_size] {};
+        char tm_hash[ss_record_size] {};
 
         int tm_recv = ::recv(ar_sock, reinterpret_cast<char*>(tm_hash), sizeof(tm_hash), MSG_WAITALL);
         if( tm_recv != sizeof(tm_hash))
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::not_enough_data_in_packet));
 
-        if( std::strncmp(tm_hash, ss_ver_hash.c_str(), sizeof(tm_hash)) != 0 )
+        if( std::strncmp(tm_hash, ss_ver_hash.c_str(), ss_hash_hex_size) != 0 )
         {
             if( ar_close )
             {
@@ -1459,6 +3076,47 @@ namespace netsocket
             return Status::err(domain_t::socket, status::to_underlying(socket_code_t::socket_hash_not_match));
         }
 
+        for(uint8_t tm_count = 0; tm_count < ss_feature_size; ++tm_count)
+            ar_feature = (ar_feature << 8) | static_cast<uint8_t>(tm_hash[ss_hash_hex_size + tm_count]);
+
+        std::memcpy(ar_random.data(), tm_hash + ss_hash_hex_size + ss_feature_size, ss_random_size);
+
         return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::socket_hash_match));
     }
+
+    /**
+     * @brief Make Random
+     * 
+     * El sıkışmada gönderilecek, bağlantı anahtarının
+     * türetilmesinde tuz olarak kullanılacak rastgele değeri
+     * işletim sisteminin rastgele kaynağından üretir. Kaynak
+     * çalışmazsa ya da değer tamamen sıfır çıkarsa tahmin
+     * edilebilir tuz kullanılmaması için random_not_make
+     * hatası döner ve değer sıfırlanır
+     * 
+     * @param random_t& Random
+     * @return Status
+     */
+    [[maybe_unused]] [[nodiscard]]
+    Status Socket::make_random(random_t& ar_random) noexcept
+    {
+        ar_random.fill(0);
+
+        try {
+            std::random_device tm_device;
+            for(std::size_t tm_count = 0; tm_count < ss_random_size; tm_count += 4)
+            {
+                const uint32_t tm_word = tm_device();
+                std::memcpy(ar_random.data() + tm_count, &tm_word, 4);
+            }
+        } catch(...) {
+            ar_random.fill(0);
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::random_not_make));
+        }
+
+        if( std::all_of(ar_random.begin(), ar_random.end(), [](const uint8_t ar_byte) { return ar_byte == 0; }) )
+            return Status::err(domain_t::socket, status::to_underlying(socket_code_t::random_not_make));
+
+        return Status::ok(domain_t::socket, status::to_underlying(socket_code_t::random_make));
+    }
 }
\ No newline at end of file
@@ -19,6 +19,8 @@ namespace tools::charset::utf
 {
     // Function Define:
     [[maybe_unused]] [[nodiscard]] std::string to_utf8(const std::u32string&) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::size_t to_utf8(const std::u32string&, char*, std::size_t) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::size_t utf8_size(const std::u32string&) noexcept;
     [[maybe_unused]] [[nodiscard]] std::u32string to_utf32(const std::string&) noexcept;
 
     [[maybe_unused]] [[nodiscard]] std::string to_lower(const std::string&) noexcept;
@@ -75,6 +77,78 @@ namespace tools::charset::utf
         return out;
     }
 
+    /**
+     * @brief To UTF-8 (Buffer)
+     * 
+     * UTF-32 metini bellek ayırmadan verilen alana UTF-8
+     * olarak yazar. Alan yetersizse hiçbir şey yazmadan 0
+     * döner, aksi halde yazılan bayt sayısını döndürür
+     * 
+     * @param u32string& Text
+     * @param char* Output
+     * @param size_t Capacity
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t to_utf8(
+        const std::u32string& ar_text,
+        char* ar_out,
+        const std::size_t ar_cap
+    ) noexcept
+    {
+        const std::size_t tm_size = utf8_size(ar_text);
+        if( tm_size > ar_cap )
+            return 0;
+
+        unsigned char* tm_out = reinterpret_cast<unsigned char*>(ar_out);
+        for(const char32_t tm_c32 : ar_text)
+        {
+            if( tm_c32 <= 0x7F )
+                *tm_out++ = static_cast<unsigned char>(tm_c32);
+            else if( tm_c32 <= 0x7FF )
+            {
+                *tm_out++ = static_cast<unsigned char>(0xC0 | (tm_c32 >> 6));
+                *tm_out++ = static_cast<unsigned char>(0x80 | (tm_c32 & 0x3F));
+            }
+            else if( tm_c32 <= 0xFFFF )
+            {
+                *tm_out++ = static_cast<unsigned char>(0xE0 | (tm_c32 >> 12));
+                *tm_out++ = static_cast<unsigned char>(0x80 | ((tm_c32 >> 6) & 0x3F));
+                *tm_out++ = static_cast<unsigned char>(0x80 | (tm_c32 & 0x3F));
+            }
+            else
+            {
+                *tm_out++ = static_cast<unsigned char>(0xF0 | (tm_c32 >> 18));
+                *tm_out++ = static_cast<unsigned char>(0x80 | ((tm_c32 >> 12) & 0x3F));
+                *tm_out++ = static_cast<unsigned char>(0x80 | ((tm_c32 >> 6) & 0x3F));
+                *tm_out++ = static_cast<unsigned char>(0x80 | (tm_c32 & 0x3F));
+            }
+        }
+
+        return tm_size;
+    }
+
+    /**
+     * @brief UTF-8 Size
+     * 
+     * UTF-32 metinin UTF-8 olarak kaç bayt tutacağını
+     * dönüştürme yapmadan hesaplar
+     * 
+     * @param u32string& Text
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t utf8_size(
+        const std::u32string& ar_text
+    ) noexcept
+    {
+        std::size_t tm_size = 0;
+        for(const char32_t tm_c32 : ar_text)
+            tm_size += tm_c32 <= 0x7F ? 1 : tm_c32 <= 0x7FF ? 2 : tm_c32 <= 0xFFFF ? 3 : 4;
+
+        return tm_size;
+    }
+
     /**
      * @brief To UTF-32
      * 
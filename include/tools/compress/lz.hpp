@@ -0,0 +1,444 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * LZ (Lempel-Ziv Sıkıştırma)
+ *
+ * Sohbet trafiği gibi tekrar eden metinlerde ağ üzerinden
+ * gönderilen veri miktarını azaltmak için dış bağımlılığı
+ * olmayan LZ77 ailesinden bir blok sıkıştırıcı. Biçim LZ4 blok
+ * biçimine benzer: her dizi bir belirteç (token), ham baytlar
+ * (literal) ve 2 baytlık geri uzaklık (offset) ile eşleşme
+ * uzunluğundan oluşur. Çözme işlemi tüm sınırları kontrol eder,
+ * bu sayede ağdan gelen bozuk veri belleği taşıramaz
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <new>
+#include <array>
+#include <algorithm>
+
+// Namespace
+namespace tools::compress::lz
+{
+    // Limit
+    static constexpr std::size_t _MIN_MATCH = 4;
+    static constexpr std::size_t _MAX_OFFSET = 0xFFFF;
+    static constexpr std::size_t _LAST_LITERALS = 5;
+    static constexpr std::size_t _MFLIMIT = 12;
+
+    static constexpr uint32_t _MIN_HASH_BITS = 8;
+    static constexpr uint32_t _MAX_HASH_BITS = 12;
+    static constexpr uint32_t _HASH_SIZE = 1u << _MAX_HASH_BITS;
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] constexpr std::size_t compress_bound(const std::size_t ar_len) noexcept;
+
+    [[maybe_unused]] [[nodiscard]] std::size_t compress(const std::byte* ar_src, const std::size_t ar_srclen, std::byte* ar_dst, const std::size_t ar_dstcap) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::size_t decompress(const std::byte* ar_src, const std::size_t ar_srclen, std::byte* ar_dst, const std::size_t ar_dstcap) noexcept;
+
+    [[maybe_unused]] [[nodiscard]] bool compress(const std::string& ar_in, std::string& ar_out) noexcept;
+    [[maybe_unused]] [[nodiscard]] bool decompress(const std::string& ar_in, std::string& ar_out, const std::size_t ar_maxlen) noexcept;
+
+    /**
+     * @brief Compress Bound
+     *
+     * Sıkıştırılamayan en kötü durumda bile çıktının
+     * sığacağı en büyük boyutu hesaplar
+     *
+     * @param size_t Length
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    constexpr std::size_t compress_bound(const std::size_t ar_len) noexcept
+    {
+        return ar_len + (ar_len / 255) + 16;
+    }
+
+    /**
+     * @brief Read 32
+     *
+     * Hizalanmamış adresten 4 bayt okur
+     *
+     * @param byte* Pointer
+     * @return uint32_t
+     */
+    static inline uint32_t read32(const std::byte* ar_ptr) noexcept
+    {
+        uint32_t tm_value;
+        std::memcpy(&tm_value, ar_ptr, sizeof(tm_value));
+        return tm_value;
+    }
+
+    /**
+     * @brief Hash 32
+     *
+     * 4 baytlık diziyi eşleşme tablosundaki
+     * konumuna dönüştürür
+     *
+     * @param uint32_t Sequence
+     * @param uint32_t Hash Bits
+     * @return uint32_t
+     */
+    static inline constexpr uint32_t hash32(const uint32_t ar_seq, const uint32_t ar_bits) noexcept
+    {
+        return (ar_seq * 2654435761u) >> (32 - ar_bits);
+    }
+
+    /**
+     * @brief Write Length
+     *
+     * Belirteçe sığmayan uzunluğu 255 lik
+     * parçalar halinde yazar
+     *
+     * @param byte*& Output
+     * @param byte* Output End
+     * @param size_t Length
+     * @return bool
+     */
+    static inline bool write_length(std::byte*& ar_out, const std::byte* ar_end, std::size_t ar_len) noexcept
+    {
+        while( ar_len >= 255 )
+        {
+            if( ar_out >= ar_end )
+                return false;
+
+            *ar_out++ = std::byte{ 255 };
+            ar_len -= 255;
+        }
+
+        if( ar_out >= ar_end )
+            return false;
+
+        *ar_out++ = static_cast<std::byte>(ar_len);
+        return true;
+    }
+
+    /**
+     * @brief Read Length
+     *
+     * Parçalar halinde yazılmış uzunluğu okur
+     *
+     * @param byte*& Input
+     * @param byte* Input End
+     * @param size_t& Length
+     * @return bool
+     */
+    static inline bool read_length(const std::byte*& ar_in, const std::byte* ar_end, std::size_t& ar_len) noexcept
+    {
+        uint8_t tm_byte = 255;
+        while( tm_byte == 255 )
+        {
+            if( ar_in >= ar_end )
+                return false;
+
+            tm_byte = static_cast<uint8_t>(*ar_in++);
+            ar_len += tm_byte;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Write Sequence
+     *
+     * Ham baytları ve varsa eşleşmeyi tek bir dizi
+     * olarak çıktıya yazar
+     *
+     * @param byte*& Output
+     * @param byte* Output End
+     * @param byte* Literal
+     * @param size_t Literal Length
+     * @param size_t Offset
+     * @param size_t Match Length
+     * @return bool
+     */
+    static inline bool write_sequence(
+        std::byte*& ar_out,
+        const std::byte* ar_end,
+        const std::byte* ar_lit,
+        const std::size_t ar_litlen,
+        const std::size_t ar_offset,
+        const std::size_t ar_matchlen
+    ) noexcept
+    {
+        if( ar_out >= ar_end )
+            return false;
+
+        // TOKEN
+        std::byte* tm_token = ar_out++;
+        uint8_t tm_tokval = static_cast<uint8_t>((ar_litlen < 15 ? ar_litlen : 15) << 4);
+
+        // LITERAL LENGTH AND LITERALS
+        if( ar_litlen >= 15 && !write_length(ar_out, ar_end, ar_litlen - 15) )
+            return false;
+
+        if( static_cast<std::size_t>(ar_end - ar_out) < ar_litlen )
+            return false;
+
+        std::memcpy(ar_out, ar_lit, ar_litlen);
+        ar_out += ar_litlen;
+
+        // LAST SEQUENCE HAS NO MATCH
+        if( ar_matchlen == 0 )
+        {
+            *tm_token = static_cast<std::byte>(tm_tokval);
+            return true;
+        }
+
+        // OFFSET (LITTLE ENDIAN)
+        if( ar_end - ar_out < 2 )
+            return false;
+
+        *ar_out++ = static_cast<std::byte>(ar_offset & 0xFF);
+        *ar_out++ = static_cast<std::byte>((ar_offset >> 8) & 0xFF);
+
+        // MATCH LENGTH
+        const std::size_t tm_mlen = ar_matchlen - _MIN_MATCH;
+        tm_tokval |= static_cast<uint8_t>(tm_mlen < 15 ? tm_mlen : 15);
+
+        if( tm_mlen >= 15 && !write_length(ar_out, ar_end, tm_mlen - 15) )
+            return false;
+
+        *tm_token = static_cast<std::byte>(tm_tokval);
+        return true;
+    }
+
+    /**
+     * @brief Compress
+     *
+     * Verilen veriyi hedef belleğe sıkıştırır. Çıktı hedef
+     * belleğe sığmazsa 0 döner, bu durumda çağıran veriyi
+     * sıkıştırmadan göndermelidir
+     *
+     * @param byte* Source
+     * @param size_t Source Length
+     * @param byte* Destination
+     * @param size_t Destination Capacity
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t compress(
+        const std::byte* ar_src,
+        const std::size_t ar_srclen,
+        std::byte* ar_dst,
+        const std::size_t ar_dstcap
+    ) noexcept
+    {
+        if( !ar_src || !ar_dst || ar_srclen == 0 )
+            return 0;
+
+        // SMALL MESSAGES ONLY CLEAR A SMALL PART OF THE TABLE
+        uint32_t tm_bits = _MIN_HASH_BITS;
+        while( tm_bits < _MAX_HASH_BITS && (std::size_t{ 1 } << tm_bits) < ar_srclen )
+            ++tm_bits;
+
+        std::array<uint32_t, _HASH_SIZE> tm_table;
+        std::fill_n(tm_table.begin(), std::size_t{ 1 } << tm_bits, 0u);
+
+        const std::byte* tm_in = ar_src;
+        const std::byte* tm_anchor = ar_src;
+        const std::byte* const tm_inend = ar_src + ar_srclen;
+
+        std::byte* tm_out = ar_dst;
+        const std::byte* const tm_outend = ar_dst + ar_dstcap;
+
+        // SEARCH MATCHES
+        if( ar_srclen >= _MFLIMIT )
+        {
+            const std::byte* const tm_mflimit = tm_inend - _MFLIMIT;
+            const std::byte* const tm_matchlimit = tm_inend - _LAST_LITERALS;
+
+            while( tm_in < tm_mflimit )
+            {
+                const uint32_t tm_seq = read32(tm_in);
+                const uint32_t tm_hash = hash32(tm_seq, tm_bits);
+
+                // TABLE STORES POSITION + 1, ZERO MEANS EMPTY
+                const uint32_t tm_prev = tm_table[tm_hash];
+                tm_table[tm_hash] = static_cast<uint32_t>(tm_in - ar_src) + 1;
+
+                if( tm_prev == 0 )
+                {
+                    ++tm_in;
+                    continue;
+                }
+
+                const std::byte* tm_ref = ar_src + (tm_prev - 1);
+                const std::size_t tm_offset = static_cast<std::size_t>(tm_in - tm_ref);
+
+                if( tm_offset > _MAX_OFFSET || read32(tm_ref) != tm_seq )
+                {
+                    ++tm_in;
+                    continue;
+                }
+
+                // EXTEND MATCH
+                std::size_t tm_matchlen = _MIN_MATCH;
+                while( tm_in + tm_matchlen < tm_matchlimit && tm_ref[tm_matchlen] == tm_in[tm_matchlen] )
+                    ++tm_matchlen;
+
+                if( !write_sequence(tm_out, tm_outend, tm_anchor, static_cast<std::size_t>(tm_in - tm_anchor), tm_offset, tm_matchlen) )
+                    return 0;
+
+                tm_in += tm_matchlen;
+                tm_anchor = tm_in;
+            }
+        }
+
+        // LAST LITERALS
+        if( !write_sequence(tm_out, tm_outend, tm_anchor, static_cast<std::size_t>(tm_inend - tm_anchor), 0, 0) )
+            return 0;
+
+        return static_cast<std::size_t>(tm_out - ar_dst);
+    }
+
+    /**
+     * @brief Decompress
+     *
+     * Sıkıştırılmış veriyi hedef belleğe açar. Her okuma ve
+     * yazma sınırlar içinde kontrol edilir, bozuk ya da hedefe
+     * sığmayan veride 0 döner
+     *
+     * @param byte* Source
+     * @param size_t Source Length
+     * @param byte* Destination
+     * @param size_t Destination Capacity
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t decompress(
+        const std::byte* ar_src,
+        const std::size_t ar_srclen,
+        std::byte* ar_dst,
+        const std::size_t ar_dstcap
+    ) noexcept
+    {
+        if( !ar_src || !ar_dst || ar_srclen == 0 )
+            return 0;
+
+        const std::byte* tm_in = ar_src;
+        const std::byte* const tm_inend = ar_src + ar_srclen;
+
+        std::byte* tm_out = ar_dst;
+        const std::byte* const tm_outend = ar_dst + ar_dstcap;
+
+        while( tm_in < tm_inend )
+        {
+            // TOKEN
+            const uint8_t tm_token = static_cast<uint8_t>(*tm_in++);
+
+            // LITERALS
+            std::size_t tm_litlen = tm_token >> 4;
+            if( tm_litlen == 15 && !read_length(tm_in, tm_inend, tm_litlen) )
+                return 0;
+
+            if( static_cast<std::size_t>(tm_inend - tm_in) < tm_litlen || static_cast<std::size_t>(tm_outend - tm_out) < tm_litlen )
+                return 0;
+
+            std::memcpy(tm_out, tm_in, tm_litlen);
+            tm_in += tm_litlen;
+            tm_out += tm_litlen;
+
+            // END OF BLOCK
+            if( tm_in == tm_inend )
+                break;
+
+            // OFFSET
+            if( tm_inend - tm_in < 2 )
+                return 0;
+
+            const std::size_t tm_offset = static_cast<std::size_t>(tm_in[0]) | (static_cast<std::size_t>(tm_in[1]) << 8);
+            tm_in += 2;
+
+            if( tm_offset == 0 || tm_offset > static_cast<std::size_t>(tm_out - ar_dst) )
+                return 0;
+
+            // MATCH
+            std::size_t tm_matchlen = tm_token & 0x0F;
+            if( tm_matchlen == 15 && !read_length(tm_in, tm_inend, tm_matchlen) )
+                return 0;
+
+            tm_matchlen += _MIN_MATCH;
+            if( static_cast<std::size_t>(tm_outend - tm_out) < tm_matchlen )
+                return 0;
+
+            // OVERLAPPING COPY MUST GO BYTE BY BYTE
+            const std::byte* tm_ref = tm_out - tm_offset;
+            if( tm_offset >= tm_matchlen )
+                std::memcpy(tm_out, tm_ref, tm_matchlen);
+            else
+                for(std::size_t tm_count = 0; tm_count < tm_matchlen; ++tm_count)
+                    tm_out[tm_count] = tm_ref[tm_count];
+
+            tm_out += tm_matchlen;
+        }
+
+        return static_cast<std::size_t>(tm_out - ar_dst);
+    }
+
+    /**
+     * @brief Compress
+     *
+     * Metin üzerinde sıkıştırma yapar. Sıkıştırılmış hali
+     * orijinalinden kısa değilse ya da çıktı için bellek
+     * ayrılamazsa başarısız döner ve çıktı kullanılmamalıdır
+     *
+     * @param string& Input
+     * @param string& Output
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool compress(
+        const std::string& ar_in,
+        std::string& ar_out
+    ) noexcept
+    {
+        if( ar_in.empty() )
+            return false;
+
+        try { ar_out.resize(ar_in.size() - 1); }
+        catch( const std::bad_alloc& ) { ar_out.clear(); return false; }
+        const std::size_t tm_len = compress(
+            reinterpret_cast<const std::byte*>(ar_in.data()), ar_in.size(),
+            reinterpret_cast<std::byte*>(ar_out.data()), ar_out.size()
+        );
+
+        ar_out.resize(tm_len);
+        return tm_len != 0;
+    }
+
+    /**
+     * @brief Decompress
+     *
+     * Sıkıştırılmış metni en fazla verilen uzunluğa
+     * kadar açar, sınırı aşarsa, veri bozuksa ya da
+     * bellek ayrılamazsa başarısız döner
+     *
+     * @param string& Input
+     * @param string& Output
+     * @param size_t Max Length
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool decompress(
+        const std::string& ar_in,
+        std::string& ar_out,
+        const std::size_t ar_maxlen
+    ) noexcept
+    {
+        try { ar_out.resize(ar_maxlen); }
+        catch( const std::bad_alloc& ) { ar_out.clear(); return false; }
+        const std::size_t tm_len = decompress(
+            reinterpret_cast<const std::byte*>(ar_in.data()), ar_in.size(),
+            reinterpret_cast<std::byte*>(ar_out.data()), ar_out.size()
+        );
+
+        ar_out.resize(tm_len);
+        return tm_len != 0;
+    }
+}
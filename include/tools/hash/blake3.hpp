@@ -0,0 +1,1842 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * BLAKE3 (Ağaç Yapılı Kriptografik Özet)
+ *
+ * Dosya ve mesaj arşivlerinin içerik özeti (tekrar tespiti ve
+ * bütünlük) için 256 bitlik, istenen uzunlukta çıktı verebilen
+ * (XOF) özet. Veri 1024 baytlık parçalara (chunk) bölünür, her
+ * parçanın zincir değeri ayrı hesaplanır ve ikili ağaçta
+ * üst düğümler (parent) ile birleştirilir. Parçalar birbirinden
+ * bağımsız olduğu için aynı anda birden fazla parça SIMD
+ * şeritlerinde (SSE4.1 ile 4, AVX2 ile 8 parça) sıkıştırılır.
+ * Hangi yolun kullanılacağı ilk çağrıda çalışma zamanında
+ * belirlenir
+ *
+ * Özet sınıfı veriyi parça parça alabilir (aktarım sırasında
+ * gelen bölümler), sonuç tek seferde verilmiş gibi olur.
+ * Sonuç alındıktan sonra veri eklemeye devam edilebilir.
+ * Büyük girdilerde tam alt ağaçlar parçalara bölünüp verilen
+ * çalıştırıcı (ThreadPool, bkz. pool::parallelpool::hash) ile
+ * paralel hesaplanabilir
+ *
+ * Anahtarlı kip (keyed hash) MAC olarak kullanılabilir. Şifre
+ * saklamak için kullanılmamalıdır, bkz. sha256::pbkdf2
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <algorithm>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __BLAKE3_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __BLAKE3_X86__ 0
+#endif
+
+// Namespace
+namespace tools::hash::blake3
+{
+    // Limit
+    static constexpr std::size_t _SIZE_BLOCK = 64; // byte
+    static constexpr std::size_t _SIZE_CHUNK = 1024; // byte
+    static constexpr std::size_t _SIZE_DIGEST = 32; // byte
+    static constexpr std::size_t _SIZE_KEY = 32; // byte
+    static constexpr std::size_t _SIZE_CV = 32; // byte
+
+    static constexpr std::size_t _MAX_DEPTH = 54;
+    static constexpr std::size_t _MAX_LANE = 8;
+    static constexpr std::size_t _MAX_PIECE = 64;
+    static constexpr std::size_t _MIN_SIZE_PIECE = 64 * 1024; // byte
+
+    // Flag
+    static constexpr uint8_t _FLAG_CHUNK_START = { 1 << 0 };
+    static constexpr uint8_t _FLAG_CHUNK_END = { 1 << 1 };
+    static constexpr uint8_t _FLAG_PARENT = { 1 << 2 };
+    static constexpr uint8_t _FLAG_ROOT = { 1 << 3 };
+    static constexpr uint8_t _FLAG_KEYED_HASH = { 1 << 4 };
+
+    // Type Definition
+    using digest_t = std::array<uint8_t, _SIZE_DIGEST>;
+    using key_t = std::array<uint8_t, _SIZE_KEY>;
+    using many_fn_t = void (*)(const uint8_t* const*, std::size_t, std::size_t, const uint32_t*, uint64_t, bool, uint8_t, uint8_t, uint8_t, uint8_t*) noexcept;
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        portable = 0,
+        sse41,
+        avx2
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_AVX2, kernel_t::avx2 },
+        { core::platform::_CPU_SSE41, kernel_t::sse41 },
+        { core::platform::_CPU_NULL, kernel_t::portable }
+    };
+
+    // Initial Value
+    static constexpr uint32_t ss_iv[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    static constexpr uint8_t ss_permute[16] = { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+    [[maybe_unused]] [[nodiscard]] bool is_supported(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] many_fn_t get_function(const kernel_t ar_kernel) noexcept;
+    [[maybe_unused]] [[nodiscard]] std::size_t get_degree(const kernel_t ar_kernel) noexcept;
+
+    /**
+     * @brief Make Schedule
+     *
+     * Her turun mesaj kelimesi sırasını derleme zamanında
+     * permütasyonu art arda uygulayarak üretir
+     *
+     * @return array<array<uint8_t, 16>, 7>
+     */
+    static inline constexpr std::array<std::array<uint8_t, 16>, 7> make_schedule() noexcept
+    {
+        std::array<std::array<uint8_t, 16>, 7> tm_schedule {};
+
+        for(uint8_t tm_word = 0; tm_word < 16; ++tm_word)
+            tm_schedule[0][tm_word] = tm_word;
+
+        for(std::size_t tm_round = 1; tm_round < 7; ++tm_round)
+            for(std::size_t tm_word = 0; tm_word < 16; ++tm_word)
+                tm_schedule[tm_round][tm_word] = tm_schedule[tm_round - 1][ss_permute[tm_word]];
+
+        return tm_schedule;
+    }
+
+    static constexpr std::array<std::array<uint8_t, 16>, 7> ss_schedule = make_schedule();
+
+    /**
+     * @brief Load 32
+     *
+     * Küçük sonlu (little endian) 4 bayt okur
+     *
+     * @param uint8_t* Data
+     * @return uint32_t
+     */
+    static inline uint32_t load32(
+        const uint8_t* ar_data
+    ) noexcept
+    {
+        return static_cast<uint32_t>(ar_data[0]) | (static_cast<uint32_t>(ar_data[1]) << 8)
+            | (static_cast<uint32_t>(ar_data[2]) << 16) | (static_cast<uint32_t>(ar_data[3]) << 24);
+    }
+
+    /**
+     * @brief Store 32
+     *
+     * Küçük sonlu (little endian) 4 bayt yazar
+     *
+     * @param uint8_t* Out
+     * @param uint32_t Value
+     */
+    static inline void store32(
+        uint8_t* ar_out,
+        const uint32_t ar_value
+    ) noexcept
+    {
+        ar_out[0] = static_cast<uint8_t>(ar_value);
+        ar_out[1] = static_cast<uint8_t>(ar_value >> 8);
+        ar_out[2] = static_cast<uint8_t>(ar_value >> 16);
+        ar_out[3] = static_cast<uint8_t>(ar_value >> 24);
+    }
+
+    /**
+     * @brief Store Cv
+     *
+     * 8 kelimelik zincir değerini 32 bayt olarak yazar
+     *
+     * @param uint8_t* Out
+     * @param uint32_t* Cv
+     */
+    static inline void store_cv(
+        uint8_t* ar_out,
+        const uint32_t* ar_cv
+    ) noexcept
+    {
+        for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+            store32(ar_out + tm_word * 4, ar_cv[tm_word]);
+    }
+
+    /**
+     * @brief Load Key
+     *
+     * 32 baytlık anahtarı 8 kelimeye çevirir
+     *
+     * @param uint32_t* Out
+     * @param uint8_t* Key
+     */
+    static inline void load_key(
+        uint32_t* ar_out,
+        const uint8_t* ar_key
+    ) noexcept
+    {
+        for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+            ar_out[tm_word] = load32(ar_key + tm_word * 4);
+    }
+
+    /**
+     * @brief Rotate Right
+     *
+     * @param uint32_t Value
+     * @param int Count
+     * @return uint32_t
+     */
+    static inline constexpr uint32_t rotr(const uint32_t ar_value, const int ar_count) noexcept
+    {
+        return (ar_value >> ar_count) | (ar_value << (32 - ar_count));
+    }
+
+    /**
+     * @brief G
+     *
+     * Durumun dört kelimesini iki mesaj kelimesi ile karıştırır
+     *
+     * @param uint32_t* State
+     * @param size_t A
+     * @param size_t B
+     * @param size_t C
+     * @param size_t D
+     * @param uint32_t X
+     * @param uint32_t Y
+     */
+    static inline void g(
+        uint32_t* ar_state,
+        const std::size_t ar_a,
+        const std::size_t ar_b,
+        const std::size_t ar_c,
+        const std::size_t ar_d,
+        const uint32_t ar_x,
+        const uint32_t ar_y
+    ) noexcept
+    {
+        ar_state[ar_a] = ar_state[ar_a] + ar_state[ar_b] + ar_x;
+        ar_state[ar_d] = rotr(ar_state[ar_d] ^ ar_state[ar_a], 16);
+        ar_state[ar_c] = ar_state[ar_c] + ar_state[ar_d];
+        ar_state[ar_b] = rotr(ar_state[ar_b] ^ ar_state[ar_c], 12);
+        ar_state[ar_a] = ar_state[ar_a] + ar_state[ar_b] + ar_y;
+        ar_state[ar_d] = rotr(ar_state[ar_d] ^ ar_state[ar_a], 8);
+        ar_state[ar_c] = ar_state[ar_c] + ar_state[ar_d];
+        ar_state[ar_b] = rotr(ar_state[ar_b] ^ ar_state[ar_c], 7);
+    }
+
+    /**
+     * @brief Compress Pre
+     *
+     * Zincir değeri ve 64 baytlık blok ile durumu hazırlayıp
+     * 7 tur uygular. Çıktı, çağırana göre katlanır
+     *
+     * @param uint32_t* State
+     * @param uint32_t* Cv
+     * @param uint8_t* Block
+     * @param uint8_t Block Length
+     * @param uint64_t Counter
+     * @param uint8_t Flags
+     */
+    static inline void compress_pre(
+        uint32_t* ar_state,
+        const uint32_t* ar_cv,
+        const uint8_t* ar_block,
+        const uint8_t ar_block_len,
+        const uint64_t ar_counter,
+        const uint8_t ar_flags
+    ) noexcept
+    {
+        uint32_t tm_msg[16];
+        for(std::size_t tm_word = 0; tm_word < 16; ++tm_word)
+            tm_msg[tm_word] = load32(ar_block + tm_word * 4);
+
+        for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+            ar_state[tm_word] = ar_cv[tm_word];
+
+        ar_state[8] = ss_iv[0];
+        ar_state[9] = ss_iv[1];
+        ar_state[10] = ss_iv[2];
+        ar_state[11] = ss_iv[3];
+        ar_state[12] = static_cast<uint32_t>(ar_counter);
+        ar_state[13] = static_cast<uint32_t>(ar_counter >> 32);
+        ar_state[14] = ar_block_len;
+        ar_state[15] = ar_flags;
+
+        for(const auto& tm_order : ss_schedule)
+        {
+            // COLUMNS
+            g(ar_state, 0, 4, 8, 12, tm_msg[tm_order[0]], tm_msg[tm_order[1]]);
+            g(ar_state, 1, 5, 9, 13, tm_msg[tm_order[2]], tm_msg[tm_order[3]]);
+            g(ar_state, 2, 6, 10, 14, tm_msg[tm_order[4]], tm_msg[tm_order[5]]);
+            g(ar_state, 3, 7, 11, 15, tm_msg[tm_order[6]], tm_msg[tm_order[7]]);
+
+            // DIAGONALS
+            g(ar_state, 0, 5, 10, 15, tm_msg[tm_order[8]], tm_msg[tm_order[9]]);
+            g(ar_state, 1, 6, 11, 12, tm_msg[tm_order[10]], tm_msg[tm_order[11]]);
+            g(ar_state, 2, 7, 8, 13, tm_msg[tm_order[12]], tm_msg[tm_order[13]]);
+            g(ar_state, 3, 4, 9, 14, tm_msg[tm_order[14]], tm_msg[tm_order[15]]);
+        }
+    }
+
+    /**
+     * @brief Compress In Place
+     *
+     * Bloğu sıkıştırıp yeni zincir değerini verilen değerin
+     * üzerine yazar
+     *
+     * @param uint32_t* Cv
+     * @param uint8_t* Block
+     * @param uint8_t Block Length
+     * @param uint64_t Counter
+     * @param uint8_t Flags
+     */
+    static inline void compress_in_place(
+        uint32_t* ar_cv,
+        const uint8_t* ar_block,
+        const uint8_t ar_block_len,
+        const uint64_t ar_counter,
+        const uint8_t ar_flags
+    ) noexcept
+    {
+        uint32_t tm_state[16];
+        compress_pre(tm_state, ar_cv, ar_block, ar_block_len, ar_counter, ar_flags);
+
+        for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+            ar_cv[tm_word] = tm_state[tm_word] ^ tm_state[tm_word + 8];
+    }
+
+    /**
+     * @brief Compress Xof
+     *
+     * Bloğu sıkıştırıp 64 baytlık genişletilmiş çıktı üretir,
+     * kök düğümden istenen uzunlukta çıktı almak için kullanılır
+     *
+     * @param uint32_t* Cv
+     * @param uint8_t* Block
+     * @param uint8_t Block Length
+     * @param uint64_t Counter
+     * @param uint8_t Flags
+     * @param uint8_t* Out
+     */
+    static inline void compress_xof(
+        const uint32_t* ar_cv,
+        const uint8_t* ar_block,
+        const uint8_t ar_block_len,
+        const uint64_t ar_counter,
+        const uint8_t ar_flags,
+        uint8_t* ar_out
+    ) noexcept
+    {
+        uint32_t tm_state[16];
+        compress_pre(tm_state, ar_cv, ar_block, ar_block_len, ar_counter, ar_flags);
+
+        for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+        {
+            store32(ar_out + tm_word * 4, tm_state[tm_word] ^ tm_state[tm_word + 8]);
+            store32(ar_out + (tm_word + 8) * 4, tm_state[tm_word + 8] ^ ar_cv[tm_word]);
+        }
+    }
+
+    /**
+     * @brief Kernel Portable
+     *
+     * Girdileri sıra ile tek tek sıkıştırır. Her girdi verilen
+     * sayıda tam bloktur; ilk bloğa başlangıç, son bloğa bitiş
+     * bayrağı eklenir. Parça girdilerinde sayaç girdi başına
+     * artar, üst düğümlerde sabit kalır
+     *
+     * @param uint8_t** Inputs
+     * @param size_t Input Count
+     * @param size_t Blocks
+     * @param uint32_t* Key
+     * @param uint64_t Counter
+     * @param bool Increment Counter
+     * @param uint8_t Flags
+     * @param uint8_t Flags Start
+     * @param uint8_t Flags End
+     * @param uint8_t* Out
+     */
+    static void kernel_portable(
+        const uint8_t* const* ar_inputs,
+        std::size_t ar_count,
+        const std::size_t ar_blocks,
+        const uint32_t* ar_key,
+        uint64_t ar_counter,
+        const bool ar_increment,
+        const uint8_t ar_flags,
+        const uint8_t ar_flags_start,
+        const uint8_t ar_flags_end,
+        uint8_t* ar_out
+    ) noexcept
+    {
+        while( ar_count-- )
+        {
+            uint32_t tm_cv[8];
+            std::memcpy(tm_cv, ar_key, sizeof(tm_cv));
+
+            const uint8_t* tm_input = *ar_inputs++;
+            uint8_t tm_flags = ar_flags | ar_flags_start;
+
+            for(std::size_t tm_block = 0; tm_block < ar_blocks; ++tm_block)
+            {
+                if( tm_block + 1 == ar_blocks )
+                    tm_flags |= ar_flags_end;
+
+                compress_in_place(tm_cv, tm_input, _SIZE_BLOCK, ar_counter, tm_flags);
+                tm_input += _SIZE_BLOCK;
+                tm_flags = ar_flags;
+            }
+
+            store_cv(ar_out, tm_cv);
+            ar_out += _SIZE_CV;
+
+            if( ar_increment )
+                ++ar_counter;
+        }
+    }
+
+    #if __BLAKE3_X86__
+        /**
+         * @brief G SSE4.1
+         *
+         * Durumun dört kelime vektörünü iki mesaj vektörü ile
+         * karıştırır. 16 ve 8 bitlik döndürme bayt karıştırma ile
+         * yapılır
+         *
+         * @param __m128i& A
+         * @param __m128i& B
+         * @param __m128i& C
+         * @param __m128i& D
+         * @param __m128i X
+         * @param __m128i Y
+         */
+        __attribute__((target("sse4.1")))
+        static inline void g_sse41(
+            __m128i& ar_a,
+            __m128i& ar_b,
+            __m128i& ar_c,
+            __m128i& ar_d,
+            const __m128i ar_x,
+            const __m128i ar_y
+        ) noexcept
+        {
+            const __m128i tm_rot16 = _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+            const __m128i tm_rot8 = _mm_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1);
+
+            ar_a = _mm_add_epi32(_mm_add_epi32(ar_a, ar_b), ar_x);
+            ar_d = _mm_shuffle_epi8(_mm_xor_si128(ar_d, ar_a), tm_rot16);
+            ar_c = _mm_add_epi32(ar_c, ar_d);
+            ar_b = _mm_xor_si128(ar_b, ar_c);
+            ar_b = _mm_or_si128(_mm_srli_epi32(ar_b, 12), _mm_slli_epi32(ar_b, 20));
+            ar_a = _mm_add_epi32(_mm_add_epi32(ar_a, ar_b), ar_y);
+            ar_d = _mm_shuffle_epi8(_mm_xor_si128(ar_d, ar_a), tm_rot8);
+            ar_c = _mm_add_epi32(ar_c, ar_d);
+            ar_b = _mm_xor_si128(ar_b, ar_c);
+            ar_b = _mm_or_si128(_mm_srli_epi32(ar_b, 7), _mm_slli_epi32(ar_b, 25));
+        }
+
+        /**
+         * @brief Round SSE4.1
+         *
+         * 4 girdinin aynı kelimeleri tek vektörde olacak şekilde
+         * (16 kelime x 4 şerit) bir tur uygular
+         *
+         * @param __m128i* State
+         * @param __m128i* Message
+         * @param array<uint8_t, 16>& Order
+         */
+        __attribute__((target("sse4.1")))
+        static inline void round_sse41(
+            __m128i* ar_v,
+            const __m128i* ar_m,
+            const std::array<uint8_t, 16>& ar_order
+        ) noexcept
+        {
+            g_sse41(ar_v[0], ar_v[4], ar_v[8], ar_v[12], ar_m[ar_order[0]], ar_m[ar_order[1]]);
+            g_sse41(ar_v[1], ar_v[5], ar_v[9], ar_v[13], ar_m[ar_order[2]], ar_m[ar_order[3]]);
+            g_sse41(ar_v[2], ar_v[6], ar_v[10], ar_v[14], ar_m[ar_order[4]], ar_m[ar_order[5]]);
+            g_sse41(ar_v[3], ar_v[7], ar_v[11], ar_v[15], ar_m[ar_order[6]], ar_m[ar_order[7]]);
+
+            g_sse41(ar_v[0], ar_v[5], ar_v[10], ar_v[15], ar_m[ar_order[8]], ar_m[ar_order[9]]);
+            g_sse41(ar_v[1], ar_v[6], ar_v[11], ar_v[12], ar_m[ar_order[10]], ar_m[ar_order[11]]);
+            g_sse41(ar_v[2], ar_v[7], ar_v[8], ar_v[13], ar_m[ar_order[12]], ar_m[ar_order[13]]);
+            g_sse41(ar_v[3], ar_v[4], ar_v[9], ar_v[14], ar_m[ar_order[14]], ar_m[ar_order[15]]);
+        }
+
+        /**
+         * @brief Transpose 4
+         *
+         * 4x4 kelimelik matrisin satır ve sütunlarını değiştirir
+         *
+         * @param __m128i* Rows
+         */
+        __attribute__((target("sse4.1")))
+        static inline void transpose4(
+            __m128i* ar_rows
+        ) noexcept
+        {
+            const __m128i tm_ab_01 = _mm_unpacklo_epi32(ar_rows[0], ar_rows[1]);
+            const __m128i tm_ab_23 = _mm_unpackhi_epi32(ar_rows[0], ar_rows[1]);
+            const __m128i tm_cd_01 = _mm_unpacklo_epi32(ar_rows[2], ar_rows[3]);
+            const __m128i tm_cd_23 = _mm_unpackhi_epi32(ar_rows[2], ar_rows[3]);
+
+            ar_rows[0] = _mm_unpacklo_epi64(tm_ab_01, tm_cd_01);
+            ar_rows[1] = _mm_unpackhi_epi64(tm_ab_01, tm_cd_01);
+            ar_rows[2] = _mm_unpacklo_epi64(tm_ab_23, tm_cd_23);
+            ar_rows[3] = _mm_unpackhi_epi64(tm_ab_23, tm_cd_23);
+        }
+
+        /**
+         * @brief Hash 4 SSE4.1
+         *
+         * 4 girdinin tüm bloklarını birlikte sıkıştırır. Her
+         * bloğun mesajı devrik olarak okunur, sonuçlar tekrar
+         * devrik edilip girdi başına 32 bayt olarak yazılır
+         *
+         * @param uint8_t** Inputs
+         * @param size_t Blocks
+         * @param uint32_t* Key
+         * @param uint64_t Counter
+         * @param bool Increment Counter
+         * @param uint8_t Flags
+         * @param uint8_t Flags Start
+         * @param uint8_t Flags End
+         * @param uint8_t* Out
+         */
+        __attribute__((target("sse4.1")))
+        static inline void hash4_sse41(
+            const uint8_t* const* ar_inputs,
+            const std::size_t ar_blocks,
+            const uint32_t* ar_key,
+            const uint64_t ar_counter,
+            const bool ar_increment,
+            const uint8_t ar_flags,
+            const uint8_t ar_flags_start,
+            const uint8_t ar_flags_end,
+            uint8_t* ar_out
+        ) noexcept
+        {
+            alignas(16) uint32_t tm_lo[4];
+            alignas(16) uint32_t tm_hi[4];
+            for(std::size_t tm_lane = 0; tm_lane < 4; ++tm_lane)
+            {
+                const uint64_t tm_counter = ar_counter + (ar_increment ? tm_lane : 0);
+                tm_lo[tm_lane] = static_cast<uint32_t>(tm_counter);
+                tm_hi[tm_lane] = static_cast<uint32_t>(tm_counter >> 32);
+            }
+
+            __m128i tm_h[8];
+            for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                tm_h[tm_word] = _mm_set1_epi32(static_cast<int>(ar_key[tm_word]));
+
+            const __m128i tm_counter_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(tm_lo));
+            const __m128i tm_counter_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(tm_hi));
+            uint8_t tm_flags = ar_flags | ar_flags_start;
+
+            for(std::size_t tm_block = 0; tm_block < ar_blocks; ++tm_block)
+            {
+                if( tm_block + 1 == ar_blocks )
+                    tm_flags |= ar_flags_end;
+
+                // LOAD 4 X 16 WORDS, TRANSPOSE TO 16 X 4 LANES
+                __m128i tm_m[16];
+                for(std::size_t tm_group = 0; tm_group < 4; ++tm_group)
+                {
+                    for(std::size_t tm_lane = 0; tm_lane < 4; ++tm_lane)
+                        tm_m[tm_group * 4 + tm_lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ar_inputs[tm_lane] + tm_block * _SIZE_BLOCK + tm_group * 16));
+
+                    transpose4(tm_m + tm_group * 4);
+                }
+
+                __m128i tm_v[16];
+                for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                    tm_v[tm_word] = tm_h[tm_word];
+
+                tm_v[8] = _mm_set1_epi32(static_cast<int>(ss_iv[0]));
+                tm_v[9] = _mm_set1_epi32(static_cast<int>(ss_iv[1]));
+                tm_v[10] = _mm_set1_epi32(static_cast<int>(ss_iv[2]));
+                tm_v[11] = _mm_set1_epi32(static_cast<int>(ss_iv[3]));
+                tm_v[12] = tm_counter_lo;
+                tm_v[13] = tm_counter_hi;
+                tm_v[14] = _mm_set1_epi32(static_cast<int>(_SIZE_BLOCK));
+                tm_v[15] = _mm_set1_epi32(tm_flags);
+
+                for(const auto& tm_order : ss_schedule)
+                    round_sse41(tm_v, tm_m, tm_order);
+
+                for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                    tm_h[tm_word] = _mm_xor_si128(tm_v[tm_word], tm_v[tm_word + 8]);
+
+                tm_flags = ar_flags;
+            }
+
+            transpose4(tm_h);
+            transpose4(tm_h + 4);
+
+            for(std::size_t tm_lane = 0; tm_lane < 4; ++tm_lane)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(ar_out + tm_lane * _SIZE_CV), tm_h[tm_lane]);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(ar_out + tm_lane * _SIZE_CV + 16), tm_h[tm_lane + 4]);
+            }
+        }
+
+        /**
+         * @brief Kernel SSE4.1
+         *
+         * Girdileri 4'lü gruplar halinde sıkıştırır, kalanlar
+         * sıralı yoldan geçer
+         *
+         * @param uint8_t** Inputs
+         * @param size_t Input Count
+         * @param size_t Blocks
+         * @param uint32_t* Key
+         * @param uint64_t Counter
+         * @param bool Increment Counter
+         * @param uint8_t Flags
+         * @param uint8_t Flags Start
+         * @param uint8_t Flags End
+         * @param uint8_t* Out
+         */
+        __attribute__((target("sse4.1")))
+        static void kernel_sse41(
+            const uint8_t* const* ar_inputs,
+            std::size_t ar_count,
+            const std::size_t ar_blocks,
+            const uint32_t* ar_key,
+            uint64_t ar_counter,
+            const bool ar_increment,
+            const uint8_t ar_flags,
+            const uint8_t ar_flags_start,
+            const uint8_t ar_flags_end,
+            uint8_t* ar_out
+        ) noexcept
+        {
+            while( ar_count >= 4 )
+            {
+                hash4_sse41(ar_inputs, ar_blocks, ar_key, ar_counter, ar_increment, ar_flags, ar_flags_start, ar_flags_end, ar_out);
+
+                if( ar_increment )
+                    ar_counter += 4;
+
+                ar_inputs += 4;
+                ar_count -= 4;
+                ar_out += 4 * _SIZE_CV;
+            }
+
+            kernel_portable(ar_inputs, ar_count, ar_blocks, ar_key, ar_counter, ar_increment, ar_flags, ar_flags_start, ar_flags_end, ar_out);
+        }
+
+        /**
+         * @brief G AVX2
+         *
+         * Durumun dört kelime vektörünü iki mesaj vektörü ile
+         * karıştırır. 16 ve 8 bitlik döndürme bayt karıştırma ile
+         * yapılır
+         *
+         * @param __m256i& A
+         * @param __m256i& B
+         * @param __m256i& C
+         * @param __m256i& D
+         * @param __m256i X
+         * @param __m256i Y
+         */
+        __attribute__((target("avx2")))
+        static inline void g_avx2(
+            __m256i& ar_a,
+            __m256i& ar_b,
+            __m256i& ar_c,
+            __m256i& ar_d,
+            const __m256i ar_x,
+            const __m256i ar_y
+        ) noexcept
+        {
+            const __m256i tm_rot16 = _mm256_set_epi8(
+                13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2
+            );
+            const __m256i tm_rot8 = _mm256_set_epi8(
+                12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1,
+                12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1
+            );
+
+            ar_a = _mm256_add_epi32(_mm256_add_epi32(ar_a, ar_b), ar_x);
+            ar_d = _mm256_shuffle_epi8(_mm256_xor_si256(ar_d, ar_a), tm_rot16);
+            ar_c = _mm256_add_epi32(ar_c, ar_d);
+            ar_b = _mm256_xor_si256(ar_b, ar_c);
+            ar_b = _mm256_or_si256(_mm256_srli_epi32(ar_b, 12), _mm256_slli_epi32(ar_b, 20));
+            ar_a = _mm256_add_epi32(_mm256_add_epi32(ar_a, ar_b), ar_y);
+            ar_d = _mm256_shuffle_epi8(_mm256_xor_si256(ar_d, ar_a), tm_rot8);
+            ar_c = _mm256_add_epi32(ar_c, ar_d);
+            ar_b = _mm256_xor_si256(ar_b, ar_c);
+            ar_b = _mm256_or_si256(_mm256_srli_epi32(ar_b, 7), _mm256_slli_epi32(ar_b, 25));
+        }
+
+        /**
+         * @brief Round AVX2
+         *
+         * 8 girdinin aynı kelimeleri tek vektörde olacak şekilde
+         * (16 kelime x 8 şerit) bir tur uygular
+         *
+         * @param __m256i* State
+         * @param __m256i* Message
+         * @param array<uint8_t, 16>& Order
+         */
+        __attribute__((target("avx2")))
+        static inline void round_avx2(
+            __m256i* ar_v,
+            const __m256i* ar_m,
+            const std::array<uint8_t, 16>& ar_order
+        ) noexcept
+        {
+            g_avx2(ar_v[0], ar_v[4], ar_v[8], ar_v[12], ar_m[ar_order[0]], ar_m[ar_order[1]]);
+            g_avx2(ar_v[1], ar_v[5], ar_v[9], ar_v[13], ar_m[ar_order[2]], ar_m[ar_order[3]]);
+            g_avx2(ar_v[2], ar_v[6], ar_v[10], ar_v[14], ar_m[ar_order[4]], ar_m[ar_order[5]]);
+            g_avx2(ar_v[3], ar_v[7], ar_v[11], ar_v[15], ar_m[ar_order[6]], ar_m[ar_order[7]]);
+
+            g_avx2(ar_v[0], ar_v[5], ar_v[10], ar_v[15], ar_m[ar_order[8]], ar_m[ar_order[9]]);
+            g_avx2(ar_v[1], ar_v[6], ar_v[11], ar_v[12], ar_m[ar_order[10]], ar_m[ar_order[11]]);
+            g_avx2(ar_v[2], ar_v[7], ar_v[8], ar_v[13], ar_m[ar_order[12]], ar_m[ar_order[13]]);
+            g_avx2(ar_v[3], ar_v[4], ar_v[9], ar_v[14], ar_m[ar_order[14]], ar_m[ar_order[15]]);
+        }
+
+        /**
+         * @brief Transpose 8
+         *
+         * 8x8 kelimelik matrisin satır ve sütunlarını değiştirir.
+         * Önce 128 bitlik yarılar içinde 4x4 devrik alınır, sonra
+         * yarılar yer değiştirir
+         *
+         * @param __m256i* Rows
+         */
+        __attribute__((target("avx2")))
+        static inline void transpose8(
+            __m256i* ar_rows
+        ) noexcept
+        {
+            const __m256i tm_ab_lo = _mm256_unpacklo_epi32(ar_rows[0], ar_rows[1]);
+            const __m256i tm_ab_hi = _mm256_unpackhi_epi32(ar_rows[0], ar_rows[1]);
+            const __m256i tm_cd_lo = _mm256_unpacklo_epi32(ar_rows[2], ar_rows[3]);
+            const __m256i tm_cd_hi = _mm256_unpackhi_epi32(ar_rows[2], ar_rows[3]);
+            const __m256i tm_ef_lo = _mm256_unpacklo_epi32(ar_rows[4], ar_rows[5]);
+            const __m256i tm_ef_hi = _mm256_unpackhi_epi32(ar_rows[4], ar_rows[5]);
+            const __m256i tm_gh_lo = _mm256_unpacklo_epi32(ar_rows[6], ar_rows[7]);
+            const __m256i tm_gh_hi = _mm256_unpackhi_epi32(ar_rows[6], ar_rows[7]);
+
+            const __m256i tm_abcd_0 = _mm256_unpacklo_epi64(tm_ab_lo, tm_cd_lo);
+            const __m256i tm_abcd_1 = _mm256_unpackhi_epi64(tm_ab_lo, tm_cd_lo);
+            const __m256i tm_abcd_2 = _mm256_unpacklo_epi64(tm_ab_hi, tm_cd_hi);
+            const __m256i tm_abcd_3 = _mm256_unpackhi_epi64(tm_ab_hi, tm_cd_hi);
+            const __m256i tm_efgh_0 = _mm256_unpacklo_epi64(tm_ef_lo, tm_gh_lo);
+            const __m256i tm_efgh_1 = _mm256_unpackhi_epi64(tm_ef_lo, tm_gh_lo);
+            const __m256i tm_efgh_2 = _mm256_unpacklo_epi64(tm_ef_hi, tm_gh_hi);
+            const __m256i tm_efgh_3 = _mm256_unpackhi_epi64(tm_ef_hi, tm_gh_hi);
+
+            ar_rows[0] = _mm256_permute2x128_si256(tm_abcd_0, tm_efgh_0, 0x20);
+            ar_rows[1] = _mm256_permute2x128_si256(tm_abcd_1, tm_efgh_1, 0x20);
+            ar_rows[2] = _mm256_permute2x128_si256(tm_abcd_2, tm_efgh_2, 0x20);
+            ar_rows[3] = _mm256_permute2x128_si256(tm_abcd_3, tm_efgh_3, 0x20);
+            ar_rows[4] = _mm256_permute2x128_si256(tm_abcd_0, tm_efgh_0, 0x31);
+            ar_rows[5] = _mm256_permute2x128_si256(tm_abcd_1, tm_efgh_1, 0x31);
+            ar_rows[6] = _mm256_permute2x128_si256(tm_abcd_2, tm_efgh_2, 0x31);
+            ar_rows[7] = _mm256_permute2x128_si256(tm_abcd_3, tm_efgh_3, 0x31);
+        }
+
+        /**
+         * @brief Hash 8 AVX2
+         *
+         * 8 girdinin tüm bloklarını birlikte sıkıştırır. Her
+         * bloğun mesajı devrik olarak okunur, sonuçlar tekrar
+         * devrik edilip girdi başına 32 bayt olarak yazılır
+         *
+         * @param uint8_t** Inputs
+         * @param size_t Blocks
+         * @param uint32_t* Key
+         * @param uint64_t Counter
+         * @param bool Increment Counter
+         * @param uint8_t Flags
+         * @param uint8_t Flags Start
+         * @param uint8_t Flags End
+         * @param uint8_t* Out
+         */
+        __attribute__((target("avx2")))
+        static inline void hash8_avx2(
+            const uint8_t* const* ar_inputs,
+            const std::size_t ar_blocks,
+            const uint32_t* ar_key,
+            const uint64_t ar_counter,
+            const bool ar_increment,
+            const uint8_t ar_flags,
+            const uint8_t ar_flags_start,
+            const uint8_t ar_flags_end,
+            uint8_t* ar_out
+        ) noexcept
+        {
+            alignas(32) uint32_t tm_lo[8];
+            alignas(32) uint32_t tm_hi[8];
+            for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+            {
+                const uint64_t tm_counter = ar_counter + (ar_increment ? tm_lane : 0);
+                tm_lo[tm_lane] = static_cast<uint32_t>(tm_counter);
+                tm_hi[tm_lane] = static_cast<uint32_t>(tm_counter >> 32);
+            }
+
+            __m256i tm_h[8];
+            for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                tm_h[tm_word] = _mm256_set1_epi32(static_cast<int>(ar_key[tm_word]));
+
+            const __m256i tm_counter_lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(tm_lo));
+            const __m256i tm_counter_hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(tm_hi));
+            uint8_t tm_flags = ar_flags | ar_flags_start;
+
+            for(std::size_t tm_block = 0; tm_block < ar_blocks; ++tm_block)
+            {
+                if( tm_block + 1 == ar_blocks )
+                    tm_flags |= ar_flags_end;
+
+                // LOAD 8 X 16 WORDS, TRANSPOSE TO 16 X 8 LANES
+                __m256i tm_m[16];
+                for(std::size_t tm_half = 0; tm_half < 2; ++tm_half)
+                {
+                    for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+                        tm_m[tm_half * 8 + tm_lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ar_inputs[tm_lane] + tm_block * _SIZE_BLOCK + tm_half * 32));
+
+                    transpose8(tm_m + tm_half * 8);
+                }
+
+                __m256i tm_v[16];
+                for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                    tm_v[tm_word] = tm_h[tm_word];
+
+                tm_v[8] = _mm256_set1_epi32(static_cast<int>(ss_iv[0]));
+                tm_v[9] = _mm256_set1_epi32(static_cast<int>(ss_iv[1]));
+                tm_v[10] = _mm256_set1_epi32(static_cast<int>(ss_iv[2]));
+                tm_v[11] = _mm256_set1_epi32(static_cast<int>(ss_iv[3]));
+                tm_v[12] = tm_counter_lo;
+                tm_v[13] = tm_counter_hi;
+                tm_v[14] = _mm256_set1_epi32(static_cast<int>(_SIZE_BLOCK));
+                tm_v[15] = _mm256_set1_epi32(tm_flags);
+
+                for(const auto& tm_order : ss_schedule)
+                    round_avx2(tm_v, tm_m, tm_order);
+
+                for(std::size_t tm_word = 0; tm_word < 8; ++tm_word)
+                    tm_h[tm_word] = _mm256_xor_si256(tm_v[tm_word], tm_v[tm_word + 8]);
+
+                tm_flags = ar_flags;
+            }
+
+            transpose8(tm_h);
+
+            for(std::size_t tm_lane = 0; tm_lane < 8; ++tm_lane)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(ar_out + tm_lane * _SIZE_CV), tm_h[tm_lane]);
+        }
+
+        /**
+         * @brief Kernel AVX2
+         *
+         * Girdileri 8'li gruplar halinde sıkıştırır, kalanlar
+         * SSE4.1 yolundan geçer
+         *
+         * @param uint8_t** Inputs
+         * @param size_t Input Count
+         * @param size_t Blocks
+         * @param uint32_t* Key
+         * @param uint64_t Counter
+         * @param bool Increment Counter
+         * @param uint8_t Flags
+         * @param uint8_t Flags Start
+         * @param uint8_t Flags End
+         * @param uint8_t* Out
+         */
+        __attribute__((target("avx2")))
+        static void kernel_avx2(
+            const uint8_t* const* ar_inputs,
+            std::size_t ar_count,
+            const std::size_t ar_blocks,
+            const uint32_t* ar_key,
+            uint64_t ar_counter,
+            const bool ar_increment,
+            const uint8_t ar_flags,
+            const uint8_t ar_flags_start,
+            const uint8_t ar_flags_end,
+            uint8_t* ar_out
+        ) noexcept
+        {
+            while( ar_count >= 8 )
+            {
+                hash8_avx2(ar_inputs, ar_blocks, ar_key, ar_counter, ar_increment, ar_flags, ar_flags_start, ar_flags_end, ar_out);
+
+                if( ar_increment )
+                    ar_counter += 8;
+
+                ar_inputs += 8;
+                ar_count -= 8;
+                ar_out += 8 * _SIZE_CV;
+            }
+
+            kernel_sse41(ar_inputs, ar_count, ar_blocks, ar_key, ar_counter, ar_increment, ar_flags, ar_flags_start, ar_flags_end, ar_out);
+        }
+    #endif
+
+    /**
+     * @brief Is Supported
+     *
+     * Verilen çekirdeğin bu işlemcide çalışıp çalışamayacağını
+     * döndürür. İşlemci seviyesi sınırı da uygulanır
+     *
+     * @param kernel_t Kernel
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    bool is_supported(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        return core::platform::has_variant(ss_variants, ar_kernel);
+    }
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemcinin desteklediği en geniş şeritli yolu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+        return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan çekirdeği döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Verilen çekirdeğin fonksiyonunu döndürür. Çekirdek bu
+     * işlemcide desteklenmiyorsa sıralı yol döner
+     *
+     * @param kernel_t Kernel
+     * @return many_fn_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    many_fn_t get_function(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return &kernel_portable;
+
+        switch( ar_kernel )
+        {
+            #if __BLAKE3_X86__
+                case kernel_t::avx2: return &kernel_avx2;
+                case kernel_t::sse41: return &kernel_sse41;
+            #endif
+            case kernel_t::portable:
+            default:
+                return &kernel_portable;
+        }
+    }
+
+    /**
+     * @brief Get Degree
+     *
+     * Çekirdeğin aynı anda sıkıştırdığı parça sayısını döndürür.
+     * Çekirdek bu işlemcide desteklenmiyorsa 1 döner
+     *
+     * @param kernel_t Kernel
+     * @return size_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    std::size_t get_degree(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        if( !is_supported(ar_kernel) )
+            return 1;
+
+        switch( ar_kernel )
+        {
+            #if __BLAKE3_X86__
+                case kernel_t::avx2: return 8;
+                case kernel_t::sse41: return 4;
+            #endif
+            case kernel_t::portable:
+            default:
+                return 1;
+        }
+    }
+
+    /**
+     * @brief Round Down Power Of 2
+     *
+     * Sıfırdan büyük değeri kendisinden küçük ya da eşit en
+     * büyük ikinin kuvvetine yuvarlar
+     *
+     * @param uint64_t Value
+     * @return uint64_t
+     */
+    static inline uint64_t round_down_pow2(
+        const uint64_t ar_value
+    ) noexcept
+    {
+        uint64_t tm_pow = 1;
+        while( tm_pow <= (ar_value >> 1) )
+            tm_pow <<= 1;
+
+        return tm_pow;
+    }
+
+    /**
+     * @brief Popcount
+     *
+     * @param uint64_t Value
+     * @return size_t
+     */
+    static inline std::size_t popcount(
+        uint64_t ar_value
+    ) noexcept
+    {
+        std::size_t tm_count = 0;
+        for(; ar_value; ar_value &= ar_value - 1)
+            ++tm_count;
+
+        return tm_count;
+    }
+
+    // Struct
+    struct Output
+    {
+        uint32_t m_cv[8] {};
+        uint8_t m_block[_SIZE_BLOCK] {};
+        uint8_t m_block_len { 0 };
+        uint64_t m_counter { 0 };
+        uint8_t m_flags { 0 };
+    };
+
+    // Struct
+    struct ChunkState
+    {
+        uint32_t m_cv[8] {};
+        uint64_t m_counter { 0 };
+        uint8_t m_buffer[_SIZE_BLOCK] {};
+        uint8_t m_buffer_len { 0 };
+        uint8_t m_blocks { 0 };
+        uint8_t m_flags { 0 };
+    };
+
+    /**
+     * @brief Output Cv
+     *
+     * Düğümün kök olmayan zincir değerini 32 bayt yazar
+     *
+     * @param Output& Output
+     * @param uint8_t* Out
+     */
+    static inline void output_cv(
+        const Output& ar_output,
+        uint8_t* ar_out
+    ) noexcept
+    {
+        uint32_t tm_cv[8];
+        std::memcpy(tm_cv, ar_output.m_cv, sizeof(tm_cv));
+
+        compress_in_place(tm_cv, ar_output.m_block, ar_output.m_block_len, ar_output.m_counter, ar_output.m_flags);
+        store_cv(ar_out, tm_cv);
+    }
+
+    /**
+     * @brief Output Root
+     *
+     * Kök düğümden verilen konumdan başlayarak istenen uzunlukta
+     * çıktı üretir. Her 64 bayt sayacı bir artırılmış ayrı
+     * sıkıştırmadır
+     *
+     * @param Output& Output
+     * @param uint64_t Seek
+     * @param uint8_t* Out
+     * @param size_t Length
+     */
+    static inline void output_root(
+        const Output& ar_output,
+        const uint64_t ar_seek,
+        uint8_t* ar_out,
+        std::size_t ar_len
+    ) noexcept
+    {
+        uint64_t tm_counter = ar_seek / _SIZE_BLOCK;
+        std::size_t tm_offset = static_cast<std::size_t>(ar_seek % _SIZE_BLOCK);
+        uint8_t tm_wide[_SIZE_BLOCK];
+
+        while( ar_len )
+        {
+            compress_xof(ar_output.m_cv, ar_output.m_block, ar_output.m_block_len, tm_counter++, ar_output.m_flags | _FLAG_ROOT, tm_wide);
+
+            const std::size_t tm_take = std::min(_SIZE_BLOCK - tm_offset, ar_len);
+            std::memcpy(ar_out, tm_wide + tm_offset, tm_take);
+
+            ar_out += tm_take;
+            ar_len -= tm_take;
+            tm_offset = 0;
+        }
+    }
+
+    /**
+     * @brief Parent Output
+     *
+     * İki çocuk zincir değerinden (64 bayt) üst düğüm üretir
+     *
+     * @param uint8_t* Block
+     * @param uint32_t* Key
+     * @param uint8_t Flags
+     * @return Output
+     */
+    static inline Output parent_output(
+        const uint8_t* ar_block,
+        const uint32_t* ar_key,
+        const uint8_t ar_flags
+    ) noexcept
+    {
+        Output tm_output;
+        std::memcpy(tm_output.m_cv, ar_key, sizeof(tm_output.m_cv));
+        std::memcpy(tm_output.m_block, ar_block, _SIZE_BLOCK);
+        tm_output.m_block_len = _SIZE_BLOCK;
+        tm_output.m_flags = ar_flags | _FLAG_PARENT;
+        return tm_output;
+    }
+
+    /**
+     * @brief Chunk Reset
+     *
+     * Parça durumunu verilen parça numarası ile boşaltır
+     *
+     * @param ChunkState& State
+     * @param uint32_t* Key
+     * @param uint64_t Counter
+     * @param uint8_t Flags
+     */
+    static inline void chunk_reset(
+        ChunkState& ar_state,
+        const uint32_t* ar_key,
+        const uint64_t ar_counter,
+        const uint8_t ar_flags
+    ) noexcept
+    {
+        std::memcpy(ar_state.m_cv, ar_key, sizeof(ar_state.m_cv));
+        std::memset(ar_state.m_buffer, 0, sizeof(ar_state.m_buffer));
+        ar_state.m_counter = ar_counter;
+        ar_state.m_buffer_len = 0;
+        ar_state.m_blocks = 0;
+        ar_state.m_flags = ar_flags;
+    }
+
+    /**
+     * @brief Chunk Length
+     *
+     * Parçaya şu ana kadar verilen bayt sayısını döndürür
+     *
+     * @param ChunkState& State
+     * @return size_t
+     */
+    static inline std::size_t chunk_len(
+        const ChunkState& ar_state
+    ) noexcept
+    {
+        return _SIZE_BLOCK * ar_state.m_blocks + ar_state.m_buffer_len;
+    }
+
+    /**
+     * @brief Chunk Start Flag
+     *
+     * @param ChunkState& State
+     * @return uint8_t
+     */
+    static inline uint8_t chunk_start_flag(
+        const ChunkState& ar_state
+    ) noexcept
+    {
+        return ar_state.m_blocks == 0 ? _FLAG_CHUNK_START : 0;
+    }
+
+    /**
+     * @brief Chunk Update
+     *
+     * Parçaya veri ekler. Son blok bitiş bayrağı alacağı için
+     * dolu blok ancak arkasından veri gelirse sıkıştırılır
+     *
+     * @param ChunkState& State
+     * @param uint8_t* Input
+     * @param size_t Length
+     */
+    static inline void chunk_update(
+        ChunkState& ar_state,
+        const uint8_t* ar_input,
+        std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_state.m_buffer_len > 0 )
+        {
+            const std::size_t tm_take = std::min(_SIZE_BLOCK - ar_state.m_buffer_len, ar_len);
+            std::memcpy(ar_state.m_buffer + ar_state.m_buffer_len, ar_input, tm_take);
+            ar_state.m_buffer_len = static_cast<uint8_t>(ar_state.m_buffer_len + tm_take);
+
+            ar_input += tm_take;
+            ar_len -= tm_take;
+
+            if( ar_len == 0 )
+                return;
+
+            compress_in_place(ar_state.m_cv, ar_state.m_buffer, _SIZE_BLOCK, ar_state.m_counter, ar_state.m_flags | chunk_start_flag(ar_state));
+            ++ar_state.m_blocks;
+            ar_state.m_buffer_len = 0;
+            std::memset(ar_state.m_buffer, 0, sizeof(ar_state.m_buffer));
+        }
+
+        while( ar_len > _SIZE_BLOCK )
+        {
+            compress_in_place(ar_state.m_cv, ar_input, _SIZE_BLOCK, ar_state.m_counter, ar_state.m_flags | chunk_start_flag(ar_state));
+            ++ar_state.m_blocks;
+
+            ar_input += _SIZE_BLOCK;
+            ar_len -= _SIZE_BLOCK;
+        }
+
+        std::memcpy(ar_state.m_buffer, ar_input, ar_len);
+        ar_state.m_buffer_len = static_cast<uint8_t>(ar_len);
+    }
+
+    /**
+     * @brief Chunk Output
+     *
+     * Parçanın son bloğunu bitiş bayrağı ile düğüm yapar
+     *
+     * @param ChunkState& State
+     * @return Output
+     */
+    static inline Output chunk_output(
+        const ChunkState& ar_state
+    ) noexcept
+    {
+        Output tm_output;
+        std::memcpy(tm_output.m_cv, ar_state.m_cv, sizeof(tm_output.m_cv));
+        std::memcpy(tm_output.m_block, ar_state.m_buffer, _SIZE_BLOCK);
+        tm_output.m_block_len = ar_state.m_buffer_len;
+        tm_output.m_counter = ar_state.m_counter;
+        tm_output.m_flags = ar_state.m_flags | chunk_start_flag(ar_state) | _FLAG_CHUNK_END;
+        return tm_output;
+    }
+
+    // Class
+    class Hasher final
+    {
+        private:
+            uint32_t m_key[8] {};
+            ChunkState m_chunk {};
+
+            uint8_t m_cv_stack[(_MAX_DEPTH + 1) * _SIZE_CV] {};
+            std::size_t m_cv_stack_len { 0 };
+
+            many_fn_t m_fn { &kernel_portable };
+            std::size_t m_degree { 1 };
+
+        private:
+            std::size_t compress_chunks(const uint8_t* ar_input, const std::size_t ar_len, const uint64_t ar_counter, uint8_t* ar_out) const noexcept;
+            std::size_t compress_parents(const uint8_t* ar_cvs, const std::size_t ar_count, uint8_t* ar_out) const noexcept;
+            std::size_t compress_subtree_wide(const uint8_t* ar_input, const std::size_t ar_len, const uint64_t ar_counter, uint8_t* ar_out) const noexcept;
+            void compress_subtree(const uint8_t* ar_input, const std::size_t ar_len, const uint64_t ar_counter, uint8_t* ar_out) const noexcept;
+
+            template<class Runner>
+            void compress_pieces(const uint8_t* ar_input, const std::size_t ar_len, const uint64_t ar_counter, const std::size_t ar_parts, Runner&& ar_run, uint8_t* ar_out) const noexcept;
+
+            void merge_cv_stack(const uint64_t ar_total) noexcept;
+            void push_cv(const uint8_t* ar_cv, const uint64_t ar_counter) noexcept;
+
+        public:
+            Hasher() noexcept;
+            explicit Hasher(const key_t& ar_key) noexcept;
+            ~Hasher();
+
+            Hasher(const Hasher&) = default;
+            Hasher& operator=(const Hasher&) = default;
+
+            void reset() noexcept;
+            void reset(const key_t& ar_key) noexcept;
+            void set_kernel(const kernel_t ar_kernel) noexcept;
+
+            void update(const void* ar_data, const std::size_t ar_len) noexcept;
+
+            template<class Runner>
+            void update(const void* ar_data, std::size_t ar_len, const std::size_t ar_parts, Runner&& ar_run) noexcept;
+
+            void finish(uint8_t* ar_out, const std::size_t ar_len = _SIZE_DIGEST, const uint64_t ar_seek = 0) const noexcept;
+            [[nodiscard]] digest_t finish() const noexcept;
+    };
+
+    /**
+     * @brief Hasher
+     *
+     * Anahtarsız kip ve en hızlı çekirdek ile özeti hazırlar
+     */
+    Hasher::Hasher() noexcept
+    {
+        this->set_kernel(get_kernel());
+        this->reset();
+    }
+
+    /**
+     * @brief Hasher
+     *
+     * Anahtarlı kip ile özeti hazırlar
+     *
+     * @param key_t& Key
+     */
+    Hasher::Hasher(
+        const key_t& ar_key
+    ) noexcept
+    {
+        this->set_kernel(get_kernel());
+        this->reset(ar_key);
+    }
+
+    /**
+     * @brief ~Hasher
+     *
+     * Anahtar ve ara değerler yıkımda sıfırlanır
+     */
+    Hasher::~Hasher()
+    {
+        volatile uint8_t* tm_ptr = reinterpret_cast<volatile uint8_t*>(this);
+        for(std::size_t tm_count = 0; tm_count < sizeof(*this); ++tm_count)
+            tm_ptr[tm_count] = 0;
+    }
+
+    /**
+     * @brief Reset
+     *
+     * Özeti anahtarsız kipte ilk durumuna döndürür
+     */
+    void Hasher::reset() noexcept
+    {
+        std::memcpy(this->m_key, ss_iv, sizeof(this->m_key));
+        chunk_reset(this->m_chunk, this->m_key, 0, 0);
+        this->m_cv_stack_len = 0;
+    }
+
+    /**
+     * @brief Reset
+     *
+     * Özeti anahtarlı kipte ilk durumuna döndürür
+     *
+     * @param key_t& Key
+     */
+    void Hasher::reset(
+        const key_t& ar_key
+    ) noexcept
+    {
+        load_key(this->m_key, ar_key.data());
+        chunk_reset(this->m_chunk, this->m_key, 0, _FLAG_KEYED_HASH);
+        this->m_cv_stack_len = 0;
+    }
+
+    /**
+     * @brief Set Kernel
+     *
+     * Özetin kullanacağı çekirdeği değiştirir, karşılaştırma
+     * ve test için. Desteklenmeyen çekirdekte sıralı yol kullanılır
+     *
+     * @param kernel_t Kernel
+     */
+    void Hasher::set_kernel(
+        const kernel_t ar_kernel
+    ) noexcept
+    {
+        this->m_fn = get_function(ar_kernel);
+        this->m_degree = get_degree(ar_kernel);
+    }
+
+    /**
+     * @brief Compress Chunks
+     *
+     * Tam parçaları çekirdek ile birlikte sıkıştırır, varsa
+     * eksik son parçayı ayrıca işler. Yazılan zincir değeri
+     * sayısını döndürür
+     *
+     * @param uint8_t* Input
+     * @param size_t Length
+     * @param uint64_t Counter
+     * @param uint8_t* Out
+     * @return size_t
+     */
+    std::size_t Hasher::compress_chunks(
+        const uint8_t* ar_input,
+        const std::size_t ar_len,
+        const uint64_t ar_counter,
+        uint8_t* ar_out
+    ) const noexcept
+    {
+        const uint8_t* tm_chunks[_MAX_LANE];
+        std::size_t tm_count = 0;
+        std::size_t tm_pos = 0;
+
+        while( ar_len - tm_pos >= _SIZE_CHUNK )
+        {
+            tm_chunks[tm_count++] = ar_input + tm_pos;
+            tm_pos += _SIZE_CHUNK;
+        }
+
+        this->m_fn(tm_chunks, tm_count, _SIZE_CHUNK / _SIZE_BLOCK, this->m_key, ar_counter, true, this->m_chunk.m_flags, _FLAG_CHUNK_START, _FLAG_CHUNK_END, ar_out);
+
+        if( ar_len > tm_pos )
+        {
+            ChunkState tm_state;
+            chunk_reset(tm_state, this->m_key, ar_counter + tm_count, this->m_chunk.m_flags);
+            chunk_update(tm_state, ar_input + tm_pos, ar_len - tm_pos);
+            output_cv(chunk_output(tm_state), ar_out + tm_count * _SIZE_CV);
+            return tm_count + 1;
+        }
+
+        return tm_count;
+    }
+
+    /**
+     * @brief Compress Parents
+     *
+     * Zincir değerlerini ikişer ikişer üst düğümlerde birleştirir,
+     * tek kalan değer olduğu gibi aktarılır. Yazılan zincir
+     * değeri sayısını döndürür
+     *
+     * @param uint8_t* Cvs
+     * @param size_t Count
+     * @param uint8_t* Out
+     * @return size_t
+     */
+    std::size_t Hasher::compress_parents(
+        const uint8_t* ar_cvs,
+        const std::size_t ar_count,
+        uint8_t* ar_out
+    ) const noexcept
+    {
+        const uint8_t* tm_parents[_MAX_LANE];
+        std::size_t tm_count = 0;
+
+        while( ar_count - 2 * tm_count >= 2 )
+        {
+            tm_parents[tm_count] = ar_cvs + 2 * tm_count * _SIZE_CV;
+            ++tm_count;
+        }
+
+        this->m_fn(tm_parents, tm_count, 1, this->m_key, 0, false, this->m_chunk.m_flags | _FLAG_PARENT, 0, 0, ar_out);
+
+        if( ar_count > 2 * tm_count )
+        {
+            std::memcpy(ar_out + tm_count * _SIZE_CV, ar_cvs + 2 * tm_count * _SIZE_CV, _SIZE_CV);
+            return tm_count + 1;
+        }
+
+        return tm_count;
+    }
+
+    /**
+     * @brief Compress Subtree Wide
+     *
+     * Alt ağacı sol tarafı ikinin kuvveti kadar parça olacak
+     * şekilde bölerek işler. Şerit sayısı kadar parça kalınca
+     * çekirdeğe verilir. Kök yerine şerit sayısı kadar zincir
+     * değeri döndürür ki üst düğümler de birlikte sıkıştırılsın
+     *
+     * @param uint8_t* Input
+     * @param size_t Length
+     * @param uint64_t Counter
+     * @param uint8_t* Out
+     * @return size_t
+     */
+    std::size_t Hasher::compress_subtree_wide(
+        const uint8_t* ar_input,
+        const std::size_t ar_len,
+        const uint64_t ar_counter,
+        uint8_t* ar_out
+    ) const noexcept
+    {
+        if( ar_len <= this->m_degree * _SIZE_CHUNK )
+            return this->compress_chunks(ar_input, ar_len, ar_counter, ar_out);
+
+        const std::size_t tm_left_len = static_cast<std::size_t>(round_down_pow2((ar_len - 1) / _SIZE_CHUNK)) * _SIZE_CHUNK;
+        const std::size_t tm_degree = (tm_left_len > _SIZE_CHUNK && this->m_degree == 1) ? 2 : this->m_degree;
+
+        uint8_t tm_cvs[2 * _MAX_LANE * _SIZE_CV];
+        const std::size_t tm_left = this->compress_subtree_wide(ar_input, tm_left_len, ar_counter, tm_cvs);
+        const std::size_t tm_right = this->compress_subtree_wide(ar_input + tm_left_len, ar_len - tm_left_len, ar_counter + tm_left_len / _SIZE_CHUNK, tm_cvs + tm_degree * _SIZE_CV);
+
+        // SINGLE CHUNK ON THE LEFT, PASS BOTH CHILDREN UP
+        if( tm_left == 1 )
+        {
+            std::memcpy(ar_out, tm_cvs, 2 * _SIZE_CV);
+            return 2;
+        }
+
+        return this->compress_parents(tm_cvs, tm_left + tm_right, ar_out);
+    }
+
+    /**
+     * @brief Compress Subtree
+     *
+     * Birden fazla parçalık alt ağacı kök düğümün iki çocuk
+     * zincir değerine (64 bayt) indirger
+     *
+     * @param uint8_t* Input
+     * @param size_t Length
+     * @param uint64_t Counter
+     * @param uint8_t* Out
+     */
+    void Hasher::compress_subtree(
+        const uint8_t* ar_input,
+        const std::size_t ar_len,
+        const uint64_t ar_counter,
+        uint8_t* ar_out
+    ) const noexcept
+    {
+        uint8_t tm_cvs[2 * _MAX_LANE * _SIZE_CV];
+        uint8_t tm_next[_MAX_LANE * _SIZE_CV];
+
+        std::size_t tm_count = this->compress_subtree_wide(ar_input, ar_len, ar_counter, tm_cvs);
+        while( tm_count > 2 )
+        {
+            tm_count = this->compress_parents(tm_cvs, tm_count, tm_next);
+            std::memcpy(tm_cvs, tm_next, tm_count * _SIZE_CV);
+        }
+
+        std::memcpy(ar_out, tm_cvs, 2 * _SIZE_CV);
+    }
+
+    /**
+     * @brief Compress Pieces
+     *
+     * Tam (ikinin kuvveti kadar parçalık) alt ağacı eşit
+     * büyüklükte ikinin kuvveti kadar alt ağaca böler. Her alt
+     * ağacın zincir değeri çalıştırıcı ile ayrı hesaplanır,
+     * sonra değerler ikişer ikişer birleştirilip kökün iki
+     * çocuğuna indirgenir. Sonuç tek geçişte hesaplamak ile aynıdır
+     *
+     * Çalıştırıcı (count, task) ile çağrılır, 0 ile count arası
+     * her sıra için task(index) çalıştırıp hepsi bitince döner
+     *
+     * @tparam Runner Runner
+     * @param uint8_t* Input
+     * @param size_t Length
+     * @param uint64_t Counter
+     * @param size_t Parts
+     * @param Runner&& Runner
+     * @param uint8_t* Out
+     */
+    template<class Runner>
+    void Hasher::compress_pieces(
+        const uint8_t* ar_input,
+        const std::size_t ar_len,
+        const uint64_t ar_counter,
+        const std::size_t ar_parts,
+        Runner&& ar_run,
+        uint8_t* ar_out
+    ) const noexcept
+    {
+        std::size_t tm_piece = _MIN_SIZE_PIECE;
+        while( ar_len / tm_piece > std::min(ar_parts, _MAX_PIECE) )
+            tm_piece <<= 1;
+
+        std::size_t tm_count = ar_len / tm_piece;
+        uint8_t tm_cvs[_MAX_PIECE * _SIZE_CV];
+
+        auto tm_task = [this, ar_input, ar_counter, tm_piece, &tm_cvs](const std::size_t ar_index) noexcept
+        {
+            uint8_t tm_pair[2 * _SIZE_CV];
+            this->compress_subtree(ar_input + ar_index * tm_piece, tm_piece, ar_counter + ar_index * (tm_piece / _SIZE_CHUNK), tm_pair);
+            output_cv(parent_output(tm_pair, this->m_key, this->m_chunk.m_flags), tm_cvs + ar_index * _SIZE_CV);
+        };
+
+        ar_run(tm_count, tm_task);
+
+        // PIECES ARE EQUAL SIZED, MERGE LEVEL BY LEVEL
+        while( tm_count > 2 )
+        {
+            for(std::size_t tm_index = 0; tm_index < tm_count / 2; ++tm_index)
+                output_cv(parent_output(tm_cvs + 2 * tm_index * _SIZE_CV, this->m_key, this->m_chunk.m_flags), tm_cvs + tm_index * _SIZE_CV);
+
+            tm_count /= 2;
+        }
+
+        std::memcpy(ar_out, tm_cvs, 2 * _SIZE_CV);
+    }
+
+    /**
+     * @brief Merge Cv Stack
+     *
+     * Toplam parça sayısının bit sayısı kadar değer kalana
+     * kadar yığının üstündeki iki değeri birleştirir. Sağ
+     * tarafına başka parça gelebilecek değerler bekletilir
+     *
+     * @param uint64_t Total Chunks
+     */
+    void Hasher::merge_cv_stack(
+        const uint64_t ar_total
+    ) noexcept
+    {
+        const std::size_t tm_keep = popcount(ar_total);
+
+        while( this->m_cv_stack_len > tm_keep )
+        {
+            uint8_t* tm_node = this->m_cv_stack + (this->m_cv_stack_len - 2) * _SIZE_CV;
+            output_cv(parent_output(tm_node, this->m_key, this->m_chunk.m_flags), tm_node);
+            --this->m_cv_stack_len;
+        }
+    }
+
+    /**
+     * @brief Push Cv
+     *
+     * Önce kesinleşen birleştirmeleri yapıp yeni zincir
+     * değerini yığına ekler
+     *
+     * @param uint8_t* Cv
+     * @param uint64_t Counter
+     */
+    void Hasher::push_cv(
+        const uint8_t* ar_cv,
+        const uint64_t ar_counter
+    ) noexcept
+    {
+        this->merge_cv_stack(ar_counter);
+        std::memcpy(this->m_cv_stack + this->m_cv_stack_len * _SIZE_CV, ar_cv, _SIZE_CV);
+        ++this->m_cv_stack_len;
+    }
+
+    /**
+     * @brief Update
+     *
+     * Özete veri ekler, çağıran iş parçacığında çalışır
+     *
+     * @param void* Data
+     * @param size_t Length
+     */
+    void Hasher::update(
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        this->update(ar_data, ar_len, 1, [](const std::size_t ar_count, auto& ar_task) noexcept {
+            for(std::size_t tm_index = 0; tm_index < ar_count; ++tm_index)
+                ar_task(tm_index);
+        });
+    }
+
+    /**
+     * @brief Update
+     *
+     * Özete veri ekler. Önce yarım kalan parça tamamlanır,
+     * sonra veri konumuna göre hizalı en büyük tam alt ağaçlar
+     * alınır. Alt ağaç yeterince büyükse ve birden fazla bölüm
+     * istenmişse çalıştırıcı ile bölümler halinde hesaplanır.
+     * Son parça, arkasından veri gelebileceği için bekletilir
+     *
+     * @tparam Runner Runner
+     * @param void* Data
+     * @param size_t Length
+     * @param size_t Parts
+     * @param Runner&& Runner
+     */
+    template<class Runner>
+    void Hasher::update(
+        const void* ar_data,
+        std::size_t ar_len,
+        const std::size_t ar_parts,
+        Runner&& ar_run
+    ) noexcept
+    {
+        const uint8_t* tm_input = static_cast<const uint8_t*>(ar_data);
+        if( ar_len == 0 )
+            return;
+
+        // FINISH THE PARTIAL CHUNK
+        if( chunk_len(this->m_chunk) > 0 )
+        {
+            const std::size_t tm_take = std::min(_SIZE_CHUNK - chunk_len(this->m_chunk), ar_len);
+            chunk_update(this->m_chunk, tm_input, tm_take);
+
+            tm_input += tm_take;
+            ar_len -= tm_take;
+
+            if( ar_len == 0 )
+                return;
+
+            uint8_t tm_cv[_SIZE_CV];
+            output_cv(chunk_output(this->m_chunk), tm_cv);
+            this->push_cv(tm_cv, this->m_chunk.m_counter);
+            chunk_reset(this->m_chunk, this->m_key, this->m_chunk.m_counter + 1, this->m_chunk.m_flags);
+        }
+
+        // WHOLE SUBTREES, ALIGNED TO THE CHUNKS SO FAR
+        while( ar_len > _SIZE_CHUNK )
+        {
+            std::size_t tm_subtree = static_cast<std::size_t>(round_down_pow2(ar_len));
+            const uint64_t tm_so_far = this->m_chunk.m_counter * _SIZE_CHUNK;
+
+            while( ((tm_subtree - 1) & tm_so_far) != 0 )
+                tm_subtree >>= 1;
+
+            const uint64_t tm_chunks = tm_subtree / _SIZE_CHUNK;
+            if( tm_subtree <= _SIZE_CHUNK )
+            {
+                ChunkState tm_state;
+                chunk_reset(tm_state, this->m_key, this->m_chunk.m_counter, this->m_chunk.m_flags);
+                chunk_update(tm_state, tm_input, tm_subtree);
+
+                uint8_t tm_cv[_SIZE_CV];
+                output_cv(chunk_output(tm_state), tm_cv);
+                this->push_cv(tm_cv, tm_state.m_counter);
+            }
+            else
+            {
+                uint8_t tm_pair[2 * _SIZE_CV];
+                if( ar_parts > 1 && tm_subtree >= 2 * _MIN_SIZE_PIECE )
+                    this->compress_pieces(tm_input, tm_subtree, this->m_chunk.m_counter, ar_parts, ar_run, tm_pair);
+                else
+                    this->compress_subtree(tm_input, tm_subtree, this->m_chunk.m_counter, tm_pair);
+
+                this->push_cv(tm_pair, this->m_chunk.m_counter);
+                this->push_cv(tm_pair + _SIZE_CV, this->m_chunk.m_counter + tm_chunks / 2);
+            }
+
+            this->m_chunk.m_counter += tm_chunks;
+            tm_input += tm_subtree;
+            ar_len -= tm_subtree;
+        }
+
+        if( ar_len > 0 )
+        {
+            chunk_update(this->m_chunk, tm_input, ar_len);
+            this->merge_cv_stack(this->m_chunk.m_counter);
+        }
+    }
+
+    /**
+     * @brief Finish
+     *
+     * Verilen konumdan başlayarak istenen uzunlukta özet
+     * yazar. Durum değişmez, sonrasında veri eklemeye devam
+     * edilebilir
+     *
+     * @param uint8_t* Out
+     * @param size_t Length
+     * @param uint64_t Seek
+     */
+    void Hasher::finish(
+        uint8_t* ar_out,
+        const std::size_t ar_len,
+        const uint64_t ar_seek
+    ) const noexcept
+    {
+        if( this->m_cv_stack_len == 0 )
+        {
+            output_root(chunk_output(this->m_chunk), ar_seek, ar_out, ar_len);
+            return;
+        }
+
+        // FOLD THE STACK FROM THE RIGHT, THE LAST NODE IS THE ROOT
+        Output tm_output;
+        std::size_t tm_left;
+
+        if( chunk_len(this->m_chunk) > 0 )
+        {
+            tm_left = this->m_cv_stack_len;
+            tm_output = chunk_output(this->m_chunk);
+        }
+        else
+        {
+            tm_left = this->m_cv_stack_len - 2;
+            tm_output = parent_output(this->m_cv_stack + tm_left * _SIZE_CV, this->m_key, this->m_chunk.m_flags);
+        }
+
+        while( tm_left > 0 )
+        {
+            --tm_left;
+
+            uint8_t tm_block[_SIZE_BLOCK];
+            std::memcpy(tm_block, this->m_cv_stack + tm_left * _SIZE_CV, _SIZE_CV);
+            output_cv(tm_output, tm_block + _SIZE_CV);
+            tm_output = parent_output(tm_block, this->m_key, this->m_chunk.m_flags);
+        }
+
+        output_root(tm_output, ar_seek, ar_out, ar_len);
+    }
+
+    /**
+     * @brief Finish
+     *
+     * 32 baytlık özeti döndürür
+     *
+     * @return digest_t
+     */
+    digest_t Hasher::finish() const noexcept
+    {
+        digest_t tm_digest {};
+        this->finish(tm_digest.data(), tm_digest.size());
+        return tm_digest;
+    }
+
+    /**
+     * @brief Digest
+     *
+     * Verinin 32 baytlık özetini tek seferde hesaplar
+     *
+     * @param void* Data
+     * @param size_t Length
+     * @return digest_t
+     */
+    static inline digest_t digest(
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        Hasher tm_hasher;
+        tm_hasher.update(ar_data, ar_len);
+        return tm_hasher.finish();
+    }
+
+    /**
+     * @brief Digest
+     *
+     * Verinin anahtarlı 32 baytlık özetini tek seferde hesaplar
+     *
+     * @param key_t& Key
+     * @param void* Data
+     * @param size_t Length
+     * @return digest_t
+     */
+    static inline digest_t digest(
+        const key_t& ar_key,
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        Hasher tm_hasher(ar_key);
+        tm_hasher.update(ar_data, ar_len);
+        return tm_hasher.finish();
+    }
+}
@@ -0,0 +1,378 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * CRC32C (Castagnoli Döngüsel Artıklık Denetimi)
+ *
+ * Ağdan gelen çerçevelerin bozulup bozulmadığını anlamak için
+ * kullanılan 32 bitlik kontrol değeri. Destekleyen x86-64 işlemcilerde
+ * SSE4.2 crc32 komutu ile hesaplanır, büyük verilerde üç ayrı şerit
+ * paralel işlenip PCLMUL çarpımı ile birleştirilir. Desteklemeyen
+ * sistemlerde derleme zamanında üretilen tablolar ile 8 baytlık
+ * dilimler halinde yazılımsal hesaplama yapılır. Hangi yolun
+ * kullanılacağı ilk çağrıda çalışma zamanında belirlenir
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+
+#include <core/cpu.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__))
+    #define __CRC32C_X86__ 1
+    #include <immintrin.h>
+#else
+    #define __CRC32C_X86__ 0
+#endif
+
+// Namespace
+namespace tools::hash::crc32c
+{
+    // Type Definition
+    using crc_t = uint32_t;
+    using crc_fn_t = crc_t (*)(crc_t, const unsigned char*, std::size_t) noexcept;
+
+    // Limit
+    static constexpr crc_t _POLY = 0x82f63b78u; // reflected castagnoli
+    static constexpr std::size_t _SIZE_LANE = 256; // byte
+
+    // Enum
+    enum class kernel_t : uint8_t
+    {
+        table = 0,
+        sse42,
+        sse42_pclmul
+    };
+
+    // Variant (Best First)
+    static inline constexpr core::platform::Variant<kernel_t> ss_variants[] = {
+        { core::platform::_CPU_SSE42 | core::platform::_CPU_PCLMUL, kernel_t::sse42_pclmul },
+        { core::platform::_CPU_SSE42, kernel_t::sse42 },
+        { core::platform::_CPU_NULL, kernel_t::table }
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] crc_t crc32c(const void* ar_data, const std::size_t ar_len, const crc_t ar_crc = 0) noexcept;
+    [[maybe_unused]] [[nodiscard]] crc_t crc32c_table(const void* ar_data, const std::size_t ar_len, const crc_t ar_crc = 0) noexcept;
+    [[maybe_unused]] [[nodiscard]] kernel_t get_kernel() noexcept;
+
+    /**
+     * @brief Mult Mod P
+     *
+     * Yansıtılmış gösterimdeki iki polinomu çarpıp CRC
+     * polinomuna göre modunu alır
+     *
+     * @param crc_t A
+     * @param crc_t B
+     * @return crc_t
+     */
+    static inline constexpr crc_t multmodp(crc_t ar_a, crc_t ar_b) noexcept
+    {
+        crc_t tm_mask = crc_t{ 1 } << 31;
+        crc_t tm_prod = 0;
+
+        for(;;)
+        {
+            if( ar_a & tm_mask )
+            {
+                tm_prod ^= ar_b;
+                if( (ar_a & (tm_mask - 1)) == 0 )
+                    break;
+            }
+
+            tm_mask >>= 1;
+            ar_b = (ar_b & 1) ? (ar_b >> 1) ^ _POLY : ar_b >> 1;
+        }
+
+        return tm_prod;
+    }
+
+    /**
+     * @brief X Pow Mod P
+     *
+     * x üzeri verilen sayının CRC polinomuna göre modunu
+     * kare alarak hızlıca hesaplar
+     *
+     * @param uint64_t Exponent
+     * @return crc_t
+     */
+    static inline constexpr crc_t xpowmodp(uint64_t ar_exp) noexcept
+    {
+        crc_t tm_result = crc_t{ 1 } << 31; // x^0
+        crc_t tm_square = crc_t{ 1 } << 30; // x^1
+
+        while( ar_exp )
+        {
+            if( ar_exp & 1 )
+                tm_result = multmodp(tm_square, tm_result);
+
+            tm_square = multmodp(tm_square, tm_square);
+            ar_exp >>= 1;
+        }
+
+        return tm_result;
+    }
+
+    /**
+     * @brief Make Table
+     *
+     * 8 baytlık dilimleme için gerekli tabloları
+     * derleme zamanında üretir
+     *
+     * @return array<array<crc_t, 256>, 8>
+     */
+    static inline constexpr std::array<std::array<crc_t, 256>, 8> make_table() noexcept
+    {
+        std::array<std::array<crc_t, 256>, 8> tm_table {};
+
+        for(crc_t tm_byte = 0; tm_byte < 256; ++tm_byte)
+        {
+            crc_t tm_crc = tm_byte;
+            for(uint8_t tm_bit = 0; tm_bit < 8; ++tm_bit)
+                tm_crc = (tm_crc & 1) ? (tm_crc >> 1) ^ _POLY : tm_crc >> 1;
+
+            tm_table[0][tm_byte] = tm_crc;
+        }
+
+        for(crc_t tm_byte = 0; tm_byte < 256; ++tm_byte)
+            for(uint8_t tm_slice = 1; tm_slice < 8; ++tm_slice)
+                tm_table[tm_slice][tm_byte] = (tm_table[tm_slice - 1][tm_byte] >> 8) ^ tm_table[0][tm_table[tm_slice - 1][tm_byte] & 0xFF];
+
+        return tm_table;
+    }
+
+    static constexpr std::array<std::array<crc_t, 256>, 8> ss_table = make_table();
+
+    // SHIFT CONSTANTS FOR LANE COMBINE: x^(8n - 33) mod P
+    static constexpr crc_t ss_shift_lane_1 = xpowmodp(8 * _SIZE_LANE - 33);
+    static constexpr crc_t ss_shift_lane_2 = xpowmodp(16 * _SIZE_LANE - 33);
+
+    /**
+     * @brief Kernel Table
+     *
+     * Tablo ile 8 baytlık dilimler halinde yazılımsal
+     * hesaplama yapar, her işlemcide çalışır
+     *
+     * @param crc_t Crc
+     * @param uchar* Data
+     * @param size_t Length
+     * @return crc_t
+     */
+    static crc_t kernel_table(crc_t ar_crc, const unsigned char* ar_data, std::size_t ar_len) noexcept
+    {
+        while( ar_len >= 8 )
+        {
+            // LITTLE ENDIAN ORDER
+            uint32_t tm_lo = static_cast<uint32_t>(ar_data[0]) | (static_cast<uint32_t>(ar_data[1]) << 8) | (static_cast<uint32_t>(ar_data[2]) << 16) | (static_cast<uint32_t>(ar_data[3]) << 24);
+            uint32_t tm_hi = static_cast<uint32_t>(ar_data[4]) | (static_cast<uint32_t>(ar_data[5]) << 8) | (static_cast<uint32_t>(ar_data[6]) << 16) | (static_cast<uint32_t>(ar_data[7]) << 24);
+            tm_lo ^= ar_crc;
+
+            ar_crc = ss_table[7][tm_lo & 0xFF] ^ ss_table[6][(tm_lo >> 8) & 0xFF]
+                ^ ss_table[5][(tm_lo >> 16) & 0xFF] ^ ss_table[4][tm_lo >> 24]
+                ^ ss_table[3][tm_hi & 0xFF] ^ ss_table[2][(tm_hi >> 8) & 0xFF]
+                ^ ss_table[1][(tm_hi >> 16) & 0xFF] ^ ss_table[0][tm_hi >> 24];
+
+            ar_data += 8;
+            ar_len -= 8;
+        }
+
+        while( ar_len-- )
+            ar_crc = (ar_crc >> 8) ^ ss_table[0][(ar_crc ^ *ar_data++) & 0xFF];
+
+        return ar_crc;
+    }
+
+    #if __CRC32C_X86__
+        /**
+         * @brief Kernel SSE4.2
+         *
+         * Donanımsal crc32 komutu ile 8 baytlık adımlarla
+         * hesaplama yapar
+         *
+         * @param crc_t Crc
+         * @param uchar* Data
+         * @param size_t Length
+         * @return crc_t
+         */
+        __attribute__((target("sse4.2")))
+        static crc_t kernel_sse42(crc_t ar_crc, const unsigned char* ar_data, std::size_t ar_len) noexcept
+        {
+            uint64_t tm_crc = ar_crc;
+
+            while( ar_len >= 8 )
+            {
+                uint64_t tm_word;
+                std::memcpy(&tm_word, ar_data, 8);
+                tm_crc = _mm_crc32_u64(tm_crc, tm_word);
+
+                ar_data += 8;
+                ar_len -= 8;
+            }
+
+            while( ar_len-- )
+                tm_crc = _mm_crc32_u8(static_cast<uint32_t>(tm_crc), *ar_data++);
+
+            return static_cast<crc_t>(tm_crc);
+        }
+
+        /**
+         * @brief Shift Pclmul
+         *
+         * Şerit sonucunu PCLMUL çarpımı ve crc32 indirgemesi
+         * ile verilen sabit kadar ileri kaydırır
+         *
+         * @param crc_t Crc
+         * @param crc_t Constant
+         * @return crc_t
+         */
+        __attribute__((target("sse4.2,pclmul")))
+        static inline crc_t shift_pclmul(const crc_t ar_crc, const crc_t ar_const) noexcept
+        {
+            const __m128i tm_prod = _mm_clmulepi64_si128(
+                _mm_cvtsi32_si128(static_cast<int>(ar_crc)),
+                _mm_cvtsi32_si128(static_cast<int>(ar_const)),
+                0x00
+            );
+
+            return static_cast<crc_t>(_mm_crc32_u64(0, static_cast<uint64_t>(_mm_cvtsi128_si64(tm_prod))));
+        }
+
+        /**
+         * @brief Kernel SSE4.2 Pclmul
+         *
+         * crc32 komutunun gecikmesini gizlemek için veriyi üç
+         * şeride bölüp aynı anda işler, sonra şeritleri PCLMUL
+         * ile birleştirir. Kalan kısım tek şerit ile bitirilir
+         *
+         * @param crc_t Crc
+         * @param uchar* Data
+         * @param size_t Length
+         * @return crc_t
+         */
+        __attribute__((target("sse4.2,pclmul")))
+        static crc_t kernel_sse42_pclmul(crc_t ar_crc, const unsigned char* ar_data, std::size_t ar_len) noexcept
+        {
+            while( ar_len >= 3 * _SIZE_LANE )
+            {
+                uint64_t tm_crc0 = ar_crc;
+                uint64_t tm_crc1 = 0;
+                uint64_t tm_crc2 = 0;
+
+                for(std::size_t tm_pos = 0; tm_pos < _SIZE_LANE; tm_pos += 8)
+                {
+                    uint64_t tm_w0, tm_w1, tm_w2;
+                    std::memcpy(&tm_w0, ar_data + tm_pos, 8);
+                    std::memcpy(&tm_w1, ar_data + _SIZE_LANE + tm_pos, 8);
+                    std::memcpy(&tm_w2, ar_data + 2 * _SIZE_LANE + tm_pos, 8);
+
+                    tm_crc0 = _mm_crc32_u64(tm_crc0, tm_w0);
+                    tm_crc1 = _mm_crc32_u64(tm_crc1, tm_w1);
+                    tm_crc2 = _mm_crc32_u64(tm_crc2, tm_w2);
+                }
+
+                ar_crc = shift_pclmul(static_cast<crc_t>(tm_crc0), ss_shift_lane_2)
+                    ^ shift_pclmul(static_cast<crc_t>(tm_crc1), ss_shift_lane_1)
+                    ^ static_cast<crc_t>(tm_crc2);
+
+                ar_data += 3 * _SIZE_LANE;
+                ar_len -= 3 * _SIZE_LANE;
+            }
+
+            return kernel_sse42(ar_crc, ar_data, ar_len);
+        }
+    #endif
+
+    /**
+     * @brief Select Kernel
+     *
+     * İşlemcinin desteklediği en hızlı hesaplama yolunu seçer
+     *
+     * @return kernel_t
+     */
+    static inline kernel_t select_kernel() noexcept
+    {
+return core::platform::bind_variant(ss_variants);
+    }
+
+    /**
+     * @brief Get Kernel
+     *
+     * Kullanılan hesaplama yolunu döndürür
+     *
+     * @return kernel_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    kernel_t get_kernel() noexcept
+    {
+        static const kernel_t ss_kernel = select_kernel();
+        return ss_kernel;
+    }
+
+    /**
+     * @brief Get Function
+     *
+     * Seçilen hesaplama yolunun fonksiyonunu döndürür
+     *
+     * @return crc_fn_t
+     */
+    static inline crc_fn_t get_function() noexcept
+    {
+        switch( get_kernel() )
+        {
+            #if __CRC32C_X86__
+                case kernel_t::sse42_pclmul: return &kernel_sse42_pclmul;
+                case kernel_t::sse42: return &kernel_sse42;
+            #endif
+            case kernel_t::table:
+            default:
+                return &kernel_table;
+        }
+    }
+
+    /**
+     * @brief Crc32c
+     *
+     * Verinin CRC32C değerini hesaplar. Önceki sonuç verilirse
+     * hesaplama kaldığı yerden devam eder, bu sayede parçalı
+     * veri tek seferde hesaplanmış gibi sonuç verir
+     *
+     * @param void* Data
+     * @param size_t Length
+     * @param crc_t Previous Crc
+     * @return crc_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    crc_t crc32c(
+        const void* ar_data,
+        const std::size_t ar_len,
+        const crc_t ar_crc
+    ) noexcept
+    {
+        static const crc_fn_t ss_fn = get_function();
+        return ~ss_fn(~ar_crc, static_cast<const unsigned char*>(ar_data), ar_len);
+    }
+
+    /**
+     * @brief Crc32c Table
+     *
+     * Donanım desteğinden bağımsız olarak her zaman yazılımsal
+     * yolu kullanır, karşılaştırma ve test için
+     *
+     * @param void* Data
+     * @param size_t Length
+     * @param crc_t Previous Crc
+     * @return crc_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    crc_t crc32c_table(
+        const void* ar_data,
+        const std::size_t ar_len,
+        const crc_t ar_crc
+    ) noexcept
+    {
+        return ~kernel_table(~ar_crc, static_cast<const unsigned char*>(ar_data), ar_len);
+    }
+}
@@ -0,0 +1,443 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Fast Hash (Hızlı Karma)
+ *
+ * Kriptografik olmayan, wyhash ailesinden 64 bitlik karma.
+ * Sıcak kaplarda (ip adresi ve metin anahtarlı tablolar)
+ * std::hash yerine kullanılır. 64x64 -> 128 bitlik çarpımın
+ * iki yarısının xor ile katlanması (mix) temel işlemdir
+ *
+ * 16 bayta kadar olan girdiler (IPv4 metni, 4 ve 16 baytlık
+ * ikili adresler) döngüsüz tek bir yoldan geçer, uzun girdiler
+ * 48 baytlık üç şeritli döngü ile işlenir. Tamsayı anahtarlar
+ * için iki çarpımlı ayrı bir yol vardır
+ *
+ * Saldırganın seçtiği anahtarlara karşı dayanıklılık için
+ * metin ve bayt anahtarlı tablolarda (StringHash, BytesHash)
+ * tohum (seed) değeri süreç başına bir kez rastgele üretilir
+ * (get_process_seed), fakat bu karma güvenlik amaçlı (imza,
+ * şifre) kullanılmamalıdır
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <chrono>
+#include <random>
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+// Namespace
+namespace tools::hash::fasthash
+{
+    // Type Definition
+    using hash_t = uint64_t;
+
+    // Limit
+    static constexpr std::size_t _SIZE_SHORT = 16; // byte
+    static constexpr std::size_t _SIZE_STRIPE = 48; // byte
+
+    static constexpr hash_t _SEED = 0;
+
+    // Secret
+    static constexpr hash_t ss_secret[4] =
+    {
+        0x2d358dccaa6c78a5ull,
+        0x8bb84b93962eacc9ull,
+        0x4b33a62ed433d4a3ull,
+        0x4d5a2da51de1aa47ull
+    };
+
+    // Function Define
+    [[maybe_unused]] [[nodiscard]] hash_t hash(const void* ar_data, const std::size_t ar_len, const hash_t ar_seed = _SEED) noexcept;
+    [[maybe_unused]] [[nodiscard]] hash_t hash_int(const uint64_t ar_value, const hash_t ar_seed = _SEED) noexcept;
+    [[maybe_unused]] [[nodiscard]] hash_t hash_addr4(const void* ar_addr, const hash_t ar_seed = _SEED) noexcept;
+    [[maybe_unused]] [[nodiscard]] hash_t hash_addr16(const void* ar_addr, const hash_t ar_seed = _SEED) noexcept;
+    [[maybe_unused]] [[nodiscard]] hash_t get_process_seed() noexcept;
+
+    /**
+     * @brief Mum
+     *
+     * İki 64 bitlik değeri çarpıp sonucun alt yarısını A'ya
+     * üst yarısını B'ye yazar
+     *
+     * @param uint64_t& A
+     * @param uint64_t& B
+     */
+    static inline void mum(
+        uint64_t& ar_a,
+        uint64_t& ar_b
+    ) noexcept
+    {
+        #if defined(__SIZEOF_INT128__)
+            const __uint128_t tm_product = static_cast<__uint128_t>(ar_a) * ar_b;
+            ar_a = static_cast<uint64_t>(tm_product);
+            ar_b = static_cast<uint64_t>(tm_product >> 64);
+        #elif defined(_MSC_VER) && defined(_M_X64)
+            ar_a = _umul128(ar_a, ar_b, &ar_b);
+        #else
+            const uint64_t tm_ha = ar_a >> 32, tm_hb = ar_b >> 32;
+            const uint64_t tm_la = static_cast<uint32_t>(ar_a), tm_lb = static_cast<uint32_t>(ar_b);
+
+            const uint64_t tm_hh = tm_ha * tm_hb, tm_hl = tm_ha * tm_lb;
+            const uint64_t tm_lh = tm_la * tm_hb, tm_ll = tm_la * tm_lb;
+
+            const uint64_t tm_mid = (tm_ll >> 32) + static_cast<uint32_t>(tm_hl) + static_cast<uint32_t>(tm_lh);
+            ar_a = (tm_mid << 32) | static_cast<uint32_t>(tm_ll);
+            ar_b = tm_hh + (tm_hl >> 32) + (tm_lh >> 32) + (tm_mid >> 32);
+        #endif
+    }
+
+    /**
+     * @brief Mix
+     *
+     * Çarpımın iki yarısını xor ile katlar
+     *
+     * @param uint64_t A
+     * @param uint64_t B
+     * @return uint64_t
+     */
+    static inline uint64_t mix(
+        uint64_t ar_a,
+        uint64_t ar_b
+    ) noexcept
+    {
+        mum(ar_a, ar_b);
+        return ar_a ^ ar_b;
+    }
+
+    /**
+     * @brief Read 8
+     *
+     * Küçük sonlu (little endian) 8 bayt okur
+     *
+     * @param uint8_t* Data
+     * @return uint64_t
+     */
+    static inline uint64_t read8(
+        const uint8_t* ar_data
+    ) noexcept
+    {
+        uint64_t tm_value = 0;
+        #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+                tm_value |= static_cast<uint64_t>(ar_data[tm_count]) << (8 * tm_count);
+        #else
+            std::memcpy(&tm_value, ar_data, 8);
+        #endif
+        return tm_value;
+    }
+
+    /**
+     * @brief Read 4
+     *
+     * Küçük sonlu (little endian) 4 bayt okur
+     *
+     * @param uint8_t* Data
+     * @return uint64_t
+     */
+    static inline uint64_t read4(
+        const uint8_t* ar_data
+    ) noexcept
+    {
+        uint32_t tm_value = 0;
+        #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            for(std::size_t tm_count = 0; tm_count < 4; ++tm_count)
+                tm_value |= static_cast<uint32_t>(ar_data[tm_count]) << (8 * tm_count);
+        #else
+            std::memcpy(&tm_value, ar_data, 4);
+        #endif
+        return tm_value;
+    }
+
+    /**
+     * @brief Read 3
+     *
+     * 1 ile 3 bayt arasındaki girdiyi ilk, orta ve son
+     * baytlardan tek değere toplar
+     *
+     * @param uint8_t* Data
+     * @param size_t Length
+     * @return uint64_t
+     */
+    static inline uint64_t read3(
+        const uint8_t* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        return (static_cast<uint64_t>(ar_data[0]) << 16) | (static_cast<uint64_t>(ar_data[ar_len >> 1]) << 8) | ar_data[ar_len - 1];
+    }
+
+    /**
+     * @brief Finish
+     *
+     * İki yarı değeri tohum ve uzunluk ile son kez karıştırır
+     *
+     * @param uint64_t A
+     * @param uint64_t B
+     * @param uint64_t Seed
+     * @param size_t Length
+     * @return hash_t
+     */
+    static inline hash_t finish(
+        uint64_t ar_a,
+        uint64_t ar_b,
+        const uint64_t ar_seed,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        ar_a ^= ss_secret[1];
+        ar_b ^= ar_seed;
+        mum(ar_a, ar_b);
+
+        return mix(ar_a ^ ss_secret[0] ^ ar_len, ar_b ^ ss_secret[1]);
+    }
+
+    /**
+     * @brief Hash
+     *
+     * Verilen tamponun 64 bitlik karmasını döndürür. 16 bayta
+     * kadar olan girdiler döngüsüz, uzun girdiler 48 baytlık
+     * şeritler ile işlenir
+     *
+     * @param void* Data
+     * @param size_t Length
+     * @param hash_t Seed
+     * @return hash_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    inline hash_t hash(
+        const void* ar_data,
+        const std::size_t ar_len,
+        const hash_t ar_seed
+    ) noexcept
+    {
+        const uint8_t* tm_ptr = static_cast<const uint8_t*>(ar_data);
+        uint64_t tm_seed = ar_seed ^ mix(ar_seed ^ ss_secret[0], ss_secret[1]);
+        uint64_t tm_a = 0;
+        uint64_t tm_b = 0;
+
+        // SHORT: TWO OVERLAPPING READS FROM BOTH ENDS
+        if( ar_len <= _SIZE_SHORT )
+        {
+            if( ar_len >= 4 )
+            {
+                const std::size_t tm_shift = (ar_len >> 3) << 2;
+                tm_a = (read4(tm_ptr) << 32) | read4(tm_ptr + tm_shift);
+                tm_b = (read4(tm_ptr + ar_len - 4) << 32) | read4(tm_ptr + ar_len - 4 - tm_shift);
+            }
+            else if( ar_len > 0 )
+                tm_a = read3(tm_ptr, ar_len);
+
+            return finish(tm_a, tm_b, tm_seed, ar_len);
+        }
+
+        // LONG: THREE INDEPENDENT LANES OVER 48 BYTE STRIPES
+        std::size_t tm_left = ar_len;
+        if( tm_left >= _SIZE_STRIPE )
+        {
+            uint64_t tm_lane1 = tm_seed;
+            uint64_t tm_lane2 = tm_seed;
+
+            do
+            {
+                tm_seed = mix(read8(tm_ptr) ^ ss_secret[1], read8(tm_ptr + 8) ^ tm_seed);
+                tm_lane1 = mix(read8(tm_ptr + 16) ^ ss_secret[2], read8(tm_ptr + 24) ^ tm_lane1);
+                tm_lane2 = mix(read8(tm_ptr + 32) ^ ss_secret[3], read8(tm_ptr + 40) ^ tm_lane2);
+
+                tm_ptr += _SIZE_STRIPE;
+                tm_left -= _SIZE_STRIPE;
+            } while( tm_left >= _SIZE_STRIPE );
+
+            tm_seed ^= tm_lane1 ^ tm_lane2;
+        }
+
+        while( tm_left > _SIZE_SHORT )
+        {
+            tm_seed = mix(read8(tm_ptr) ^ ss_secret[1], read8(tm_ptr + 8) ^ tm_seed);
+            tm_ptr += _SIZE_SHORT;
+            tm_left -= _SIZE_SHORT;
+        }
+
+        // LAST 16 BYTES, MAY OVERLAP THE PREVIOUS BLOCK
+        tm_a = read8(tm_ptr + tm_left - 16);
+        tm_b = read8(tm_ptr + tm_left - 8);
+
+        return finish(tm_a, tm_b, tm_seed, ar_len);
+    }
+
+    /**
+     * @brief Hash Int
+     *
+     * Tamsayı anahtarlar için iki çarpımlı karma. Ardışık ya
+     * da düzenli aralıklı değerler tüm bitlere yayılır
+     *
+     * @param uint64_t Value
+     * @param hash_t Seed
+     * @return hash_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    inline hash_t hash_int(
+        const uint64_t ar_value,
+        const hash_t ar_seed
+    ) noexcept
+    {
+        return mix(mix(ar_value ^ ss_secret[0], ar_seed ^ ss_secret[1]) ^ ss_secret[2], ss_secret[3]);
+    }
+
+    /**
+     * @brief Hash Addr 4
+     *
+     * 4 baytlık ikili IPv4 adresinin karması. Genel yolun
+     * 4 bayt için açılmış halidir, aynı sonucu verir
+     *
+     * @param void* Address
+     * @param hash_t Seed
+     * @return hash_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    inline hash_t hash_addr4(
+        const void* ar_addr,
+        const hash_t ar_seed
+    ) noexcept
+    {
+        const uint64_t tm_word = read4(static_cast<const uint8_t*>(ar_addr));
+        const uint64_t tm_seed = ar_seed ^ mix(ar_seed ^ ss_secret[0], ss_secret[1]);
+
+        return finish((tm_word << 32) | tm_word, (tm_word << 32) | tm_word, tm_seed, 4);
+    }
+
+    /**
+     * @brief Hash Addr 16
+     *
+     * 16 baytlık ikili IPv6 adresinin karması. Genel yolun
+     * 16 bayt için açılmış halidir, aynı sonucu verir
+     *
+     * @param void* Address
+     * @param hash_t Seed
+     * @return hash_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    inline hash_t hash_addr16(
+        const void* ar_addr,
+        const hash_t ar_seed
+    ) noexcept
+    {
+        const uint8_t* tm_ptr = static_cast<const uint8_t*>(ar_addr);
+        const uint64_t tm_seed = ar_seed ^ mix(ar_seed ^ ss_secret[0], ss_secret[1]);
+
+        return finish((read4(tm_ptr) << 32) | read4(tm_ptr + 8), (read4(tm_ptr + 12) << 32) | read4(tm_ptr + 4), tm_seed, 16);
+    }
+
+    /**
+     * @brief Get Process Seed
+     *
+     * Süreç başına bir kez üretilen tohum değerini döndürür.
+     * Rastgele kaynak çalışmazsa saat ve adres ile karıştırılmış
+     * bir değere düşülür; karma güvenlik amaçlı olmadığı için
+     * bu sadece tahmin edilebilirliği artırır
+     *
+     * @return hash_t
+     */
+    inline hash_t get_process_seed() noexcept
+    {
+        static const hash_t ss_seed = []() noexcept {
+            hash_t tm_seed = static_cast<hash_t>(std::chrono::steady_clock::now().time_since_epoch().count())
+                ^ static_cast<hash_t>(reinterpret_cast<std::uintptr_t>(&tm_seed));
+
+            try {
+                std::random_device tm_device;
+                tm_seed ^= (static_cast<hash_t>(tm_device()) << 32) | tm_device();
+            } catch(...) {}
+
+            return mix(tm_seed ^ ss_secret[2], ss_secret[3]);
+        }();
+
+        return ss_seed;
+    }
+
+    // Struct
+    struct StringHash
+    {
+        /**
+         * @brief Operator
+         *
+         * Metin anahtarlar (ip adresi, kullanıcı adı) için
+         * std::hash<std::string> yerine süreç tohumu ile kullanılır
+         *
+         * @param string_view Text
+         * @return size_t
+         */
+        std::size_t operator()(const std::string_view ar_text) const noexcept
+        {
+            return static_cast<std::size_t>(hash(ar_text.data(), ar_text.size(), get_process_seed()));
+        }
+
+        std::size_t operator()(const std::string& ar_text) const noexcept
+        {
+            return static_cast<std::size_t>(hash(ar_text.data(), ar_text.size(), get_process_seed()));
+        }
+    };
+
+    // Struct
+    template<class T>
+    struct IntHash
+    {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>, "IntHash needs an integral, enum or pointer key");
+
+        /**
+         * @brief Operator
+         *
+         * Tamsayı anahtarlar için karma. std::hash tamsayıyı
+         * olduğu gibi döndürür, bu asal sayıda kova kullanan
+         * tablolarda küçük ardışık soket numaraları için en
+         * iyisidir. Düzenli aralıklı ya da dışarıdan gelen
+         * anahtarlarda ve 2^N kovalı tablolarda bu kullanılır
+         *
+         * @param T Value
+         * @return size_t
+         */
+        std::size_t operator()(const T ar_value) const noexcept
+        {
+            if constexpr( std::is_pointer_v<T> )
+                return static_cast<std::size_t>(hash_int(reinterpret_cast<std::uintptr_t>(ar_value)));
+            else if constexpr( std::is_enum_v<T> )
+                return static_cast<std::size_t>(hash_int(static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(ar_value))));
+            else
+                return static_cast<std::size_t>(hash_int(static_cast<uint64_t>(ar_value)));
+        }
+    };
+
+    // Struct
+    template<std::size_t N>
+    struct BytesHash
+    {
+        /**
+         * @brief Operator
+         *
+         * Sabit boyutlu ikili anahtarlar için süreç tohumu ile
+         * karma. 4 ve 16 baytlık adresler açılmış yoldan geçer
+         *
+         * @param array<uint8_t, N> Bytes
+         * @return size_t
+         */
+        std::size_t operator()(const std::array<uint8_t, N>& ar_bytes) const noexcept
+        {
+            if constexpr( N == 4 )
+                return static_cast<std::size_t>(hash_addr4(ar_bytes.data(), get_process_seed()));
+            else if constexpr( N == 16 )
+                return static_cast<std::size_t>(hash_addr16(ar_bytes.data(), get_process_seed()));
+            else
+                return static_cast<std::size_t>(hash(ar_bytes.data(), N, get_process_seed()));
+        }
+    };
+}
@@ -0,0 +1,529 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * SHA-256 (Güvenli Özet Algoritması)
+ *
+ * FIPS 180-4'te tanımlanan 256 bitlik kriptografik özet.
+ * Üzerine RFC 2104 HMAC, RFC 5869 HKDF ve RFC 8018 PBKDF2
+ * kurulur; ana anahtardan ve el sıkışmada gelen rastgele
+ * değerlerden bağlantıya ait anahtar türetmek ve şifreleri
+ * tuzlu özet olarak saklamak için kullanılır
+ *
+ * Özet sınıfı veriyi parça parça alabilir, tam bloklar
+ * hemen işlenir, eksik kalan baytlar tamponda bekler.
+ * Sınıf yıkımda ara değerleri sıfırlar
+ */
+
+// Include
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+// Namespace
+namespace tools::hash::sha256
+{
+    // Limit
+    static constexpr std::size_t _SIZE_BLOCK = 64; // byte
+    static constexpr std::size_t _SIZE_DIGEST = 32; // byte
+    static constexpr std::size_t _MAX_LEN_EXPAND = 255 * _SIZE_DIGEST; // byte
+
+    // Type Definition
+    using digest_t = std::array<uint8_t, _SIZE_DIGEST>;
+
+    // Round Constant
+    static constexpr uint32_t ss_round[64] =
+    {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    // Class
+    class Sha256 final
+    {
+        private:
+            uint32_t m_state[8] {};
+            uint8_t m_buffer[_SIZE_BLOCK] {};
+            std::size_t m_leftover { 0 };
+            uint64_t m_total { 0 };
+
+        private:
+            static inline constexpr uint32_t rotr(const uint32_t ar_value, const int ar_count) noexcept;
+            void compress(const uint8_t* ar_block) noexcept;
+
+        public:
+            Sha256() noexcept;
+            ~Sha256();
+
+            Sha256(const Sha256&) = default;
+            Sha256& operator=(const Sha256&) = default;
+
+            void reset() noexcept;
+            void update(const void* ar_data, std::size_t ar_len) noexcept;
+            void finish(uint8_t* ar_digest) noexcept;
+    };
+
+    /**
+     * @brief Sha256
+     *
+     * Başlangıç değerleri ile özeti hazırlar
+     */
+    Sha256::Sha256() noexcept
+    {
+        this->reset();
+    }
+
+    /**
+     * @brief ~Sha256
+     *
+     * Ara değerler yıkımda sıfırlanır, anahtar türetmede
+     * kullanıldığında bellekte iz kalmaz
+     */
+    Sha256::~Sha256()
+    {
+        volatile uint8_t* tm_ptr = reinterpret_cast<volatile uint8_t*>(this);
+        for(std::size_t tm_count = 0; tm_count < sizeof(*this); ++tm_count)
+            tm_ptr[tm_count] = 0;
+    }
+
+    /**
+     * @brief Reset
+     *
+     * Özeti ilk durumuna döndürür, nesne yeniden kullanılabilir
+     */
+    void Sha256::reset() noexcept
+    {
+        const uint32_t tm_init[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        std::memcpy(this->m_state, tm_init, sizeof(tm_init));
+
+        this->m_leftover = 0;
+        this->m_total = 0;
+    }
+
+    /**
+     * @brief Rotate Right
+     *
+     * @param uint32_t Value
+     * @param int Count
+     * @return uint32_t
+     */
+    constexpr uint32_t Sha256::rotr(const uint32_t ar_value, const int ar_count) noexcept
+    {
+        return (ar_value >> ar_count) | (ar_value << (32 - ar_count));
+    }
+
+    /**
+     * @brief Compress
+     *
+     * 64 baytlık bir bloğu büyük uçlu kelimeler olarak
+     * okuyup 64 tur ile duruma ekler
+     *
+     * @param uint8_t* Block
+     */
+    void Sha256::compress(
+        const uint8_t* ar_block
+    ) noexcept
+    {
+        uint32_t tm_word[64];
+        for(std::size_t tm_count = 0; tm_count < 16; ++tm_count)
+        {
+            tm_word[tm_count] = (static_cast<uint32_t>(ar_block[tm_count * 4]) << 24)
+                | (static_cast<uint32_t>(ar_block[tm_count * 4 + 1]) << 16)
+                | (static_cast<uint32_t>(ar_block[tm_count * 4 + 2]) << 8)
+                | static_cast<uint32_t>(ar_block[tm_count * 4 + 3]);
+        }
+
+        // MESSAGE SCHEDULE
+        for(std::size_t tm_count = 16; tm_count < 64; ++tm_count)
+        {
+            const uint32_t tm_s0 = rotr(tm_word[tm_count - 15], 7) ^ rotr(tm_word[tm_count - 15], 18) ^ (tm_word[tm_count - 15] >> 3);
+            const uint32_t tm_s1 = rotr(tm_word[tm_count - 2], 17) ^ rotr(tm_word[tm_count - 2], 19) ^ (tm_word[tm_count - 2] >> 10);
+            tm_word[tm_count] = tm_word[tm_count - 16] + tm_s0 + tm_word[tm_count - 7] + tm_s1;
+        }
+
+        uint32_t tm_a = this->m_state[0], tm_b = this->m_state[1], tm_c = this->m_state[2], tm_d = this->m_state[3];
+        uint32_t tm_e = this->m_state[4], tm_f = this->m_state[5], tm_g = this->m_state[6], tm_h = this->m_state[7];
+
+        // ROUNDS
+        for(std::size_t tm_count = 0; tm_count < 64; ++tm_count)
+        {
+            const uint32_t tm_t1 = tm_h + (rotr(tm_e, 6) ^ rotr(tm_e, 11) ^ rotr(tm_e, 25)) + ((tm_e & tm_f) ^ (~tm_e & tm_g)) + ss_round[tm_count] + tm_word[tm_count];
+            const uint32_t tm_t2 = (rotr(tm_a, 2) ^ rotr(tm_a, 13) ^ rotr(tm_a, 22)) + ((tm_a & tm_b) ^ (tm_a & tm_c) ^ (tm_b & tm_c));
+
+            tm_h = tm_g; tm_g = tm_f; tm_f = tm_e; tm_e = tm_d + tm_t1;
+            tm_d = tm_c; tm_c = tm_b; tm_b = tm_a; tm_a = tm_t1 + tm_t2;
+        }
+
+        this->m_state[0] += tm_a; this->m_state[1] += tm_b; this->m_state[2] += tm_c; this->m_state[3] += tm_d;
+        this->m_state[4] += tm_e; this->m_state[5] += tm_f; this->m_state[6] += tm_g; this->m_state[7] += tm_h;
+    }
+
+    /**
+     * @brief Update
+     *
+     * Veriyi özete ekler. Önce tamponda bekleyen blok
+     * tamamlanır, sonra tam bloklar doğrudan işlenir,
+     * artan kısım tampona alınır
+     *
+     * @param void* Data
+     * @param size_t Length
+     */
+    void Sha256::update(
+        const void* ar_data,
+        std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_len == 0 )
+            return;
+
+        const uint8_t* tm_data = static_cast<const uint8_t*>(ar_data);
+        this->m_total += ar_len;
+
+        // COMPLETE PENDING BLOCK
+        if( this->m_leftover )
+        {
+            const std::size_t tm_want = std::min(_SIZE_BLOCK - this->m_leftover, ar_len);
+            std::memcpy(this->m_buffer + this->m_leftover, tm_data, tm_want);
+
+            this->m_leftover += tm_want;
+            tm_data += tm_want;
+            ar_len -= tm_want;
+
+            if( this->m_leftover < _SIZE_BLOCK )
+                return;
+
+            this->compress(this->m_buffer);
+            this->m_leftover = 0;
+        }
+
+        // FULL BLOCKS
+        for(; ar_len >= _SIZE_BLOCK; tm_data += _SIZE_BLOCK, ar_len -= _SIZE_BLOCK)
+            this->compress(tm_data);
+
+        // KEEP REST
+        if( ar_len )
+        {
+            std::memcpy(this->m_buffer, tm_data, ar_len);
+            this->m_leftover = ar_len;
+        }
+    }
+
+    /**
+     * @brief Finish
+     *
+     * 0x80 baytı, sıfır dolgu ve bit cinsinden büyük uçlu
+     * uzunluk eklenerek son blok işlenir ve 32 baytlık özet
+     * yazılır. Sonrasında özet ilk durumuna döner
+     *
+     * @param uint8_t* Digest
+     */
+    void Sha256::finish(
+        uint8_t* ar_digest
+    ) noexcept
+    {
+        const uint64_t tm_bits = this->m_total * 8;
+
+        this->m_buffer[this->m_leftover++] = 0x80;
+        if( this->m_leftover > _SIZE_BLOCK - 8 )
+        {
+            std::memset(this->m_buffer + this->m_leftover, 0, _SIZE_BLOCK - this->m_leftover);
+            this->compress(this->m_buffer);
+            this->m_leftover = 0;
+        }
+
+        std::memset(this->m_buffer + this->m_leftover, 0, _SIZE_BLOCK - 8 - this->m_leftover);
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+            this->m_buffer[_SIZE_BLOCK - 1 - tm_count] = static_cast<uint8_t>(tm_bits >> (8 * tm_count));
+        this->compress(this->m_buffer);
+
+        for(std::size_t tm_count = 0; tm_count < 8; ++tm_count)
+        {
+            ar_digest[tm_count * 4] = static_cast<uint8_t>(this->m_state[tm_count] >> 24);
+            ar_digest[tm_count * 4 + 1] = static_cast<uint8_t>(this->m_state[tm_count] >> 16);
+            ar_digest[tm_count * 4 + 2] = static_cast<uint8_t>(this->m_state[tm_count] >> 8);
+            ar_digest[tm_count * 4 + 3] = static_cast<uint8_t>(this->m_state[tm_count]);
+        }
+
+        this->reset();
+    }
+
+    /**
+     * @brief Digest
+     *
+     * Verinin tek seferde özetini döndürür
+     *
+     * @param void* Data
+     * @param size_t Length
+     * @return digest_t
+     */
+    [[maybe_unused]] [[nodiscard]]
+    static inline digest_t digest(
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        digest_t tm_digest {};
+
+        Sha256 tm_sha;
+        tm_sha.update(ar_data, ar_len);
+        tm_sha.finish(tm_digest.data());
+
+        return tm_digest;
+    }
+
+    // Class
+    class Hmac final
+    {
+        private:
+            Sha256 m_inner;
+            Sha256 m_outer;
+
+        public:
+            Hmac(const void* ar_key, std::size_t ar_len) noexcept;
+
+            void update(const void* ar_data, const std::size_t ar_len) noexcept;
+            void finish(uint8_t* ar_mac) noexcept;
+    };
+
+    /**
+     * @brief Hmac
+     *
+     * Bloktan uzun anahtar önce özetlenir, anahtar blok
+     * boyutuna sıfır ile tamamlanıp iç (0x36) ve dış (0x5c)
+     * dolgular ile iki özet başlatılır
+     *
+     * @param void* Key
+     * @param size_t Length
+     */
+    Hmac::Hmac(
+        const void* ar_key,
+        std::size_t ar_len
+    ) noexcept
+    {
+        uint8_t tm_key[_SIZE_BLOCK] {};
+
+        if( ar_len > _SIZE_BLOCK )
+        {
+            const digest_t tm_digest = digest(ar_key, ar_len);
+            std::memcpy(tm_key, tm_digest.data(), _SIZE_DIGEST);
+        }
+        else if( ar_len )
+            std::memcpy(tm_key, ar_key, ar_len);
+
+        uint8_t tm_pad[_SIZE_BLOCK];
+        for(std::size_t tm_count = 0; tm_count < _SIZE_BLOCK; ++tm_count)
+            tm_pad[tm_count] = tm_key[tm_count] ^ 0x36;
+        this->m_inner.update(tm_pad, _SIZE_BLOCK);
+
+        for(std::size_t tm_count = 0; tm_count < _SIZE_BLOCK; ++tm_count)
+            tm_pad[tm_count] = tm_key[tm_count] ^ 0x5c;
+        this->m_outer.update(tm_pad, _SIZE_BLOCK);
+
+        volatile uint8_t* tm_ptr = tm_key;
+        for(std::size_t tm_count = 0; tm_count < _SIZE_BLOCK; ++tm_count)
+            tm_ptr[tm_count] = 0;
+    }
+
+    /**
+     * @brief Update
+     *
+     * @param void* Data
+     * @param size_t Length
+     */
+    void Hmac::update(
+        const void* ar_data,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        this->m_inner.update(ar_data, ar_len);
+    }
+
+    /**
+     * @brief Finish
+     *
+     * İç özet dış özete verilir ve 32 baytlık doğrulama
+     * kodu yazılır
+     *
+     * @param uint8_t* Mac
+     */
+    void Hmac::finish(
+        uint8_t* ar_mac
+    ) noexcept
+    {
+        digest_t tm_inner {};
+        this->m_inner.finish(tm_inner.data());
+
+        this->m_outer.update(tm_inner.data(), _SIZE_DIGEST);
+        this->m_outer.finish(ar_mac);
+    }
+
+    /**
+     * @brief Hkdf
+     *
+     * RFC 5869 HKDF. Önce tuz ile giriş anahtarından sözde
+     * rastgele anahtar (PRK) çıkarılır, sonra bağlam bilgisi
+     * ile istenen uzunlukta anahtar üretilir. Uzunluk
+     * 255 * 32 baytı geçemez
+     *
+     * @param string_view Key
+     * @param string_view Salt
+     * @param string_view Info
+     * @param uint8_t* Out
+     * @param size_t Length
+     * @return bool
+     */
+    [[maybe_unused]]
+    static inline bool hkdf(
+        const std::string_view ar_key,
+        const std::string_view ar_salt,
+        const std::string_view ar_info,
+        uint8_t* ar_out,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_len > _MAX_LEN_EXPAND )
+            return false;
+
+        // EXTRACT
+        digest_t tm_prk {};
+        {
+            Hmac tm_hmac(ar_salt.data(), ar_salt.size());
+            tm_hmac.update(ar_key.data(), ar_key.size());
+            tm_hmac.finish(tm_prk.data());
+        }
+
+        // EXPAND: T(N) = HMAC(PRK, T(N-1) | INFO | N)
+        digest_t tm_block {};
+        std::size_t tm_done = 0;
+        for(uint8_t tm_index = 1; tm_done < ar_len; ++tm_index)
+        {
+            Hmac tm_hmac(tm_prk.data(), _SIZE_DIGEST);
+            if( tm_index > 1 )
+                tm_hmac.update(tm_block.data(), _SIZE_DIGEST);
+            tm_hmac.update(ar_info.data(), ar_info.size());
+            tm_hmac.update(&tm_index, 1);
+            tm_hmac.finish(tm_block.data());
+
+            const std::size_t tm_chunk = std::min(_SIZE_DIGEST, ar_len - tm_done);
+            std::memcpy(ar_out + tm_done, tm_block.data(), tm_chunk);
+            tm_done += tm_chunk;
+        }
+
+        volatile uint8_t* tm_ptr = tm_prk.data();
+        volatile uint8_t* tm_last = tm_block.data();
+        for(std::size_t tm_count = 0; tm_count < _SIZE_DIGEST; ++tm_count)
+        {
+            tm_ptr[tm_count] = 0;
+            tm_last[tm_count] = 0;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Pbkdf2
+     *
+     * RFC 8018 PBKDF2-HMAC-SHA256. Şifreden tuz ve tur sayısı
+     * ile istenen uzunlukta anahtar üretir. Şifre ile anahtarlanan
+     * HMAC bir kez hazırlanır ve her turda kopyalanır; böylece
+     * tur başına anahtar dolgusu yeniden özetlenmez
+     *
+     * @param string_view Password
+     * @param string_view Salt
+     * @param uint32_t Rounds
+     * @param uint8_t* Out
+     * @param size_t Length
+     * @return bool
+     */
+    [[maybe_unused]]
+    static inline bool pbkdf2(
+        const std::string_view ar_password,
+        const std::string_view ar_salt,
+        const uint32_t ar_rounds,
+        uint8_t* ar_out,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        if( ar_rounds == 0 || ar_len > _MAX_LEN_EXPAND )
+            return false;
+
+        const Hmac tm_keyed(ar_password.data(), ar_password.size());
+
+        // T(N) = U(1) ^ U(2) ^ ... ^ U(C), U(1) = HMAC(P, S | N), U(I) = HMAC(P, U(I-1))
+        digest_t tm_block {};
+        digest_t tm_sum {};
+        std::size_t tm_done = 0;
+        for(uint32_t tm_index = 1; tm_done < ar_len; ++tm_index)
+        {
+            const uint8_t tm_be[4] = {
+                static_cast<uint8_t>(tm_index >> 24), static_cast<uint8_t>(tm_index >> 16),
+                static_cast<uint8_t>(tm_index >> 8), static_cast<uint8_t>(tm_index)
+            };
+
+            Hmac tm_hmac = tm_keyed;
+            tm_hmac.update(ar_salt.data(), ar_salt.size());
+            tm_hmac.update(tm_be, sizeof(tm_be));
+            tm_hmac.finish(tm_block.data());
+            tm_sum = tm_block;
+
+            for(uint32_t tm_round = 1; tm_round < ar_rounds; ++tm_round)
+            {
+                tm_hmac = tm_keyed;
+                tm_hmac.update(tm_block.data(), _SIZE_DIGEST);
+                tm_hmac.finish(tm_block.data());
+
+                for(std::size_t tm_count = 0; tm_count < _SIZE_DIGEST; ++tm_count)
+                    tm_sum[tm_count] ^= tm_block[tm_count];
+            }
+
+            const std::size_t tm_chunk = std::min(_SIZE_DIGEST, ar_len - tm_done);
+            std::memcpy(ar_out + tm_done, tm_sum.data(), tm_chunk);
+            tm_done += tm_chunk;
+        }
+
+        volatile uint8_t* tm_ptr = tm_sum.data();
+        volatile uint8_t* tm_last = tm_block.data();
+        for(std::size_t tm_count = 0; tm_count < _SIZE_DIGEST; ++tm_count)
+        {
+            tm_ptr[tm_count] = 0;
+            tm_last[tm_count] = 0;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Verify
+     *
+     * İki bayt dizisini sabit zamanda karşılaştırır; ilk farklı
+     * baytta erken çıkmadığından süre içeriği sızdırmaz
+     *
+     * @param uint8_t* Left
+     * @param uint8_t* Right
+     * @param size_t Length
+     * @return bool
+     */
+    [[maybe_unused]] [[nodiscard]]
+    static inline bool verify(
+        const uint8_t* ar_left,
+        const uint8_t* ar_right,
+        const std::size_t ar_len
+    ) noexcept
+    {
+        uint8_t tm_diff = 0;
+        for(std::size_t tm_count = 0; tm_count < ar_len; ++tm_count)
+            tm_diff |= ar_left[tm_count] ^ ar_right[tm_count];
+
+        return tm_diff == 0;
+    }
+}
@@ -74,7 +74,7 @@ int main(void)
     ss_socket.get_policy().set_password("new-pwd-2026-netsocket");
 
     ss_testlog.write(level_t::Info, "Socket Password: " + ss_socket.get_policy().get_password(), GET_SOURCE);
-    ss_testlog.write(level_t::Info, "Socket Old Password: " + ss_socket.get_policy().get_old_password(), GET_SOURCE);
+    ss_testlog.write(level_t::Info, "Socket Old Password Rounds: " + std::to_string(ss_socket.get_policy().get_old_password_hash().m_rounds), GET_SOURCE);
 
     ss_socket.print();
     ss_testlog.print();
@@ -0,0 +1,500 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * AEAD Frame (Doğrulamalı Çerçeve)
+ *
+ * Poly1305 ve ChaCha20-Poly1305 için RFC 8439 test vektörlerini,
+ * vektör çekirdeği ile yazılımsal yolun aynı etiketi ürettiğini
+ * ve tek geçişli şifrelemenin iki geçişli referans ile aynı
+ * sonucu verdiğini, tampon arayüzünün desteklenmiyor olarak
+ * bildirildiğini kontrol edeceğiz. Soket üzerinden giden
+ * çerçevenin doğrulandığı; gövdesi, başlığı ya da nonce değeri
+ * değiştirilen çerçevenin ve doğrulamasız çerçeveye düşürme
+ * girişiminin reddedildiği denenir. Çıplak ChaCha20, iki geçiş
+ * ve tek geçiş hızları ile Poly1305 çekirdek hızları ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 aead-frame.cpp -pthread -o bsd/aead-frame.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 aead-frame.cpp -pthread -o linux/aead-frame.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/aead-frame.bsd
+ *  Linux   :: ./linux/aead-frame.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include "../socket-link.hpp"
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace cipher::mac;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "aead-frame-" + ss_osname;
+
+static const std::string ss_key = "0123456789abcdef0123456789abcdef";
+
+/**
+ * @brief From Hex
+ *
+ * @param char* Hex
+ * @return string
+ */
+std::string from_hex(const char* ar_hex)
+{
+    std::string tm_out;
+    for(std::size_t tm_count = 0; ar_hex[tm_count] && ar_hex[tm_count + 1]; tm_count += 2)
+        tm_out.push_back(static_cast<char>(std::stoi(std::string(ar_hex + tm_count, 2), nullptr, 16)));
+    return tm_out;
+}
+
+/**
+ * @brief To Array
+ *
+ * @tparam size_t Size
+ * @param string& Bytes
+ * @return array<uint8_t, Size>
+ */
+template<std::size_t Size>
+std::array<uint8_t, Size> to_array(const std::string& ar_bytes)
+{
+    std::array<uint8_t, Size> tm_out {};
+    std::memcpy(tm_out.data(), ar_bytes.data(), std::min(Size, ar_bytes.size()));
+    return tm_out;
+}
+
+/**
+ * @brief Compute Tag
+ *
+ * Veriyi verilen parça boyutu ile Poly1305'e verir.
+ * 16 baytlık parçalar her zaman yazılımsal yoldan geçer
+ *
+ * @param string& Key
+ * @param string& Data
+ * @param size_t Step
+ * @return Poly1305::tag_t
+ */
+Poly1305::tag_t compute_tag(const std::string& ar_key, const std::string& ar_data, const std::size_t ar_step)
+{
+    Poly1305 tm_mac(reinterpret_cast<const uint8_t*>(ar_key.data()));
+    for(std::size_t tm_offset = 0; tm_offset < ar_data.size(); tm_offset += ar_step)
+        tm_mac.update(reinterpret_cast<const uint8_t*>(ar_data.data()) + tm_offset, std::min(ar_step, ar_data.size() - tm_offset));
+
+    Poly1305::tag_t tm_tag;
+    tm_mac.finish(tm_tag.data());
+    return tm_tag;
+}
+
+/**
+ * @brief Check Poly1305
+ *
+ * RFC 8439 bölüm 2.5.2 ve ek A.3 #3 vektörlerini kontrol eder.
+ * Rastgele anahtar ve uzunluklarda tek seferde verilen veri
+ * (vektör çekirdeği) ile 16 baytlık parçalar halinde verilen
+ * verinin (yazılımsal yol) etiketleri karşılaştırılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_poly1305(Logger<Args...>& ar_logger)
+{
+    const std::string tm_text = "Any submission to the IETF intended by the Contributor for publication as all or part of an IETF Internet-Draft or RFC and any statement made within the context of an IETF activity is considered an \"IETF Contribution\". Such statements include oral statements in IETF sessions, as well as written and electronic communications made at any time or place, which are addressed to";
+
+    struct Vector { const char* m_title; std::string m_key; std::string m_data; std::string m_tag; };
+    const Vector tm_vectors[] =
+    {
+        { "RFC 8439 2.5.2", from_hex("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b"),
+            "Cryptographic Forum Research Group", from_hex("a8061dc1305136c6c22b8baf0c0127a9") },
+        { "RFC 8439 A.3#3", from_hex("36e5f6b5c5e06070f0efca96227a863e00000000000000000000000000000000"),
+            tm_text, from_hex("f3477e7cd95417af89a6b8794c310cf0") }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_vector : tm_vectors)
+    {
+        const Poly1305::tag_t tm_tag = compute_tag(tm_vector.m_key, tm_vector.m_data, tm_vector.m_data.size() + 1);
+        const bool tm_pass = std::memcmp(tm_tag.data(), tm_vector.m_tag.data(), Poly1305::_SIZE_TAG) == 0;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string(tm_vector.m_title) + " | Poly1305: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // VECTOR KERNEL AGAINST BLOCK BY BLOCK SCALAR PATH
+    std::mt19937 tm_random(20261018);
+    bool tm_same = true;
+    for(std::size_t tm_round = 0; tm_round < 500; ++tm_round)
+    {
+        std::string tm_key(Poly1305::_SIZE_KEY, '\0');
+        std::string tm_data(tm_random() % 4096, '\0');
+        for(auto& tm_byte : tm_key) tm_byte = static_cast<char>(tm_random());
+        for(auto& tm_byte : tm_data) tm_byte = static_cast<char>(tm_random());
+
+        // WORST CASE LIMBS: ALL BYTES 0xFF
+        if( tm_round % 50 == 0 )
+            std::fill(tm_data.begin(), tm_data.end(), static_cast<char>(0xFF));
+
+        tm_same = tm_same && compute_tag(tm_key, tm_data, tm_data.size() + 1) == compute_tag(tm_key, tm_data, Poly1305::_SIZE_BLOCK)
+            && compute_tag(tm_key, tm_data, 1 + tm_round % 200) == compute_tag(tm_key, tm_data, Poly1305::_SIZE_BLOCK);
+    }
+
+    const std::string tm_kernel = polykernel::get_kernel() == polykernel::kernel_t::avx2 ? "AVX2" : "Scalar";
+    ar_logger.write(tm_same ? level_t::Info : level_t::Err, "Poly1305 " + tm_kernel + " vs Scalar (500 Random): " + (tm_same ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_same;
+}
+
+/**
+ * @brief Check AEAD
+ *
+ * RFC 8439 bölüm 2.8.2 vektörünü, değiştirilmiş veri/ek veri/
+ * etiketin reddedildiğini ve tek geçişli seal sonucunun
+ * ChaCha20 + Poly1305 ile iki geçişte hesaplanan sonuç ile
+ * aynı olduğunu kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_aead(Logger<Args...>& ar_logger)
+{
+    const std::string tm_key = from_hex("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+    const auto tm_nonce = to_array<ChaCha20Poly1305::_SIZE_NONCE>(from_hex("070000004041424344454647"));
+    const std::string tm_aad = from_hex("50515253c0c1c2c3c4c5c6c7");
+    const std::string tm_plain = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.";
+    const std::string tm_expect = from_hex(
+        "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+        "3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+        "92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+        "3ff4def08e4b7a9de576d26586cec64b6116");
+    const auto tm_expect_tag = to_array<ChaCha20Poly1305::_SIZE_TAG>(from_hex("1ae10b594f09e26a7e902ecbd0600691"));
+
+    ChaCha20Poly1305 tm_aead("aead-vector", tm_key);
+    const auto* tm_aad_ptr = reinterpret_cast<const uint8_t*>(tm_aad.data());
+
+    std::string tm_text = tm_plain;
+    ChaCha20Poly1305::tag_t tm_tag {};
+    bool tm_ok = tm_aead.seal(reinterpret_cast<uint8_t*>(tm_text.data()), tm_text.size(), tm_aad_ptr, tm_aad.size(), tm_nonce, tm_tag)
+        && tm_text == tm_expect && tm_tag == tm_expect_tag;
+
+    const std::string tm_sealed = tm_text;
+    tm_ok = tm_ok && tm_aead.open(reinterpret_cast<uint8_t*>(tm_text.data()), tm_text.size(), tm_aad_ptr, tm_aad.size(), tm_nonce, tm_tag)
+        && tm_text == tm_plain;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("RFC 8439 2.8.2 | Seal/Open: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    // TAMPERED DATA, AAD OR TAG MUST FAIL AND LEAVE NO PLAINTEXT
+    bool tm_reject = true;
+    for(int tm_case = 0; tm_case < 3; ++tm_case)
+    {
+        std::string tm_data = tm_sealed;
+        std::string tm_bad_aad = tm_aad;
+        ChaCha20Poly1305::tag_t tm_bad_tag = tm_tag;
+
+        if( tm_case == 0 ) tm_data[40] ^= 0x01;
+        if( tm_case == 1 ) tm_bad_aad[0] ^= 0x01;
+        if( tm_case == 2 ) tm_bad_tag[15] ^= 0x80;
+
+        const bool tm_open = tm_aead.open(reinterpret_cast<uint8_t*>(tm_data.data()), tm_data.size(),
+            reinterpret_cast<const uint8_t*>(tm_bad_aad.data()), tm_bad_aad.size(), tm_nonce, tm_bad_tag);
+
+        tm_reject = tm_reject && !tm_open && tm_data == std::string(tm_data.size(), '\0');
+    }
+
+    ar_logger.write(tm_reject ? level_t::Info : level_t::Err, std::string("Tampered Data/AAD/Tag | Rejected: ") + (tm_reject ? "Passed" : "Failed"), GET_SOURCE);
+
+    // ONE PASS AGAINST TWO PASS REFERENCE ACROSS CHUNK BOUNDARIES
+    std::mt19937 tm_random(1018);
+    bool tm_same = true;
+    for(const std::size_t tm_size : { std::size_t(0), std::size_t(1), std::size_t(63), std::size_t(1023), std::size_t(1024), std::size_t(1025), std::size_t(2100), std::size_t(5000), std::size_t(16411) })
+    {
+        std::string tm_data(tm_size, '\0');
+        for(auto& tm_byte : tm_data) tm_byte = static_cast<char>(tm_random());
+
+        const auto tm_random_nonce = to_array<ChaCha20Poly1305::_SIZE_NONCE>(std::to_string(tm_random()) + "nonce-pad-12");
+
+        std::string tm_one = tm_data;
+        ChaCha20Poly1305::tag_t tm_one_tag {};
+        tm_aead.seal(reinterpret_cast<uint8_t*>(tm_one.data()), tm_one.size(), tm_aad_ptr, tm_aad.size(), tm_random_nonce, tm_one_tag);
+
+        // REFERENCE: POLY KEY FROM BLOCK 0, CIPHER FROM BLOCK 1, MAC OVER AAD|PAD|C|PAD|LENGTHS
+        std::string tm_block(64, '\0');
+        ChaCha20 tm_zero("aead-ref", tm_key, tm_random_nonce, 0);
+        tm_zero.encrypt(tm_block);
+
+        std::string tm_two = tm_data;
+        ChaCha20 tm_stream("aead-ref", tm_key, tm_random_nonce, 1);
+        tm_stream.encrypt(tm_two);
+
+        std::string tm_mac_data = tm_aad + std::string((16 - tm_aad.size() % 16) % 16, '\0') + tm_two + std::string((16 - tm_two.size() % 16) % 16, '\0');
+        for(const uint64_t tm_len : { uint64_t(tm_aad.size()), uint64_t(tm_two.size()) })
+            for(int tm_shift = 0; tm_shift < 64; tm_shift += 8)
+                tm_mac_data.push_back(static_cast<char>(tm_len >> tm_shift));
+
+        const Poly1305::tag_t tm_two_tag = compute_tag(tm_block.substr(0, 32), tm_mac_data, Poly1305::_SIZE_BLOCK);
+
+        std::string tm_back = tm_one;
+        const bool tm_open = tm_aead.open(reinterpret_cast<uint8_t*>(tm_back.data()), tm_back.size(), tm_aad_ptr, tm_aad.size(), tm_random_nonce, tm_one_tag);
+
+        tm_same = tm_same && tm_one == tm_two && tm_one_tag == tm_two_tag && tm_open && tm_back == tm_data;
+    }
+
+    ar_logger.write(tm_same ? level_t::Info : level_t::Err, std::string("One Pass vs Two Pass (Chunk Edges) | Equal: ") + (tm_same ? "Passed" : "Failed"), GET_SOURCE);
+
+    // TEXT INTERFACE: NONCE + CIPHER + TAG, FRESH NONCE EACH CALL
+    std::string tm_first = tm_plain, tm_second = tm_plain;
+    bool tm_text_ok = tm_aead.encrypt(tm_first) && tm_aead.encrypt(tm_second)
+        && tm_first.size() == tm_plain.size() + ChaCha20Poly1305::_SIZE_SEAL && tm_first != tm_second;
+    tm_text_ok = tm_text_ok && tm_aead.decrypt(tm_first) && tm_first == tm_plain;
+
+    ar_logger.write(tm_text_ok ? level_t::Info : level_t::Err, std::string("Text Interface | Fresh Nonce + Round Trip: ") + (tm_text_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    // BUFFER INTERFACE IS REPORTED AS UNSUPPORTED, NOT AS A CIPHER ERROR
+    std::string tm_buffer = tm_plain;
+    ChaCha20 tm_plain_stream("aead-buffer", tm_key);
+    const bool tm_buffer_ok = !tm_aead.has_buffer() && tm_plain_stream.has_buffer()
+        && !tm_aead.encrypt(reinterpret_cast<std::byte*>(tm_buffer.data()), tm_buffer.size())
+        && !tm_aead.decrypt(reinterpret_cast<std::byte*>(tm_buffer.data()), tm_buffer.size())
+        && tm_buffer == tm_plain;
+
+    ar_logger.write(tm_buffer_ok ? level_t::Info : level_t::Err, std::string("Buffer Interface | Reported Unsupported: ") + (tm_buffer_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_reject && tm_same && tm_text_ok && tm_buffer_ok;
+}
+
+/**
+ * @brief Check Socket
+ *
+ * Çerçeve soket çifti üzerinden gönderilir. Kuyruğun (nonce +
+ * etiket) eklendiği ve bayrağın işaretlendiği, değiştirilmemiş
+ * çerçevenin açıldığı, gövdesi/başlığı/nonce değeri değiştirilen
+ * çerçevenin packet_not_auth ile, doğrulamasız şifreleyicinin
+ * gönderdiği çerçevenin packet_corrupt ile reddedildiği denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_socket(Logger<Args...>& ar_logger)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    ChaCha20Poly1305 tm_send_cipher("aead-send", ss_key);
+    ChaCha20Poly1305 tm_recv_cipher("aead-recv", ss_key);
+    Xor tm_plain_cipher("aead-xor", ss_key);
+
+    Socket tm_sender(tm_send_cipher, "logs/socket-" + ss_logname, "aead-frame", "pwd@aead", 5080, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+    Socket tm_receiver(tm_recv_cipher, "logs/socket-" + ss_logname, "aead-frame", "pwd@aead", 5081, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+    Socket tm_downgrade(tm_plain_cipher, "logs/socket-" + ss_logname, "aead-frame", "pwd@aead", 5082, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+
+    const DataPacket tm_out { "pwd@aead", "tester", "header is associated data, fields are ciphertext" };
+
+    netpacket::buffer_t tm_plain {};
+    const std::size_t tm_plain_len = netpacket::NetPacket::layout(tm_plain.data(), tm_plain.size(), tm_out.m_pwd, tm_out.m_name, tm_out.m_msg, netpacket::_FRAME_AEAD);
+    const std::size_t tm_wire_len = tm_plain_len + ChaCha20Poly1305::_SIZE_SEAL;
+
+    // CLEAN FRAME
+    DataPacket tm_in {};
+    const bool tm_sent = tm_sender.send(tm_pair[0], tm_out).is_ok();
+    const std::string tm_raw = read_frame(tm_pair[1], tm_wire_len);
+    bool tm_ok = tm_sent && tm_raw.size() == tm_wire_len
+        && std::memcmp(tm_raw.data(), tm_plain.data(), netpacket::_SIZE_HEADER) == 0;
+
+    tm_ok = tm_ok && write_frame(tm_pair[1], tm_raw) && tm_receiver.recv(tm_pair[0], tm_in).is_ok() && tm_in.m_msg == tm_out.m_msg && tm_in.m_name == tm_out.m_name;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, "Frame " + std::to_string(tm_plain_len) + " B + Seal " + std::to_string(ChaCha20Poly1305::_SIZE_SEAL) + " B | Round Trip: " + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    // TAMPERED BODY, HEADER (PASSWORD LENGTH LOW BYTE KEEPS SIZES) AND NONCE
+    struct Tamper { const char* m_title; std::size_t m_pos; };
+    const Tamper tm_tampers[] =
+    {
+        { "Body  ", netpacket::_SIZE_HEADER + 3 },
+        { "Header", netpacket::_PACK_START_LEN_USERNAME + netpacket::_PACK_LEN_USERNAME - 1 },
+        { "Nonce ", tm_plain_len + 5 }
+    };
+
+    for(const auto& tm_tamper : tm_tampers)
+    {
+        std::string tm_bad = tm_raw;
+        if( tm_tamper.m_pos >= netpacket::_SIZE_HEADER )
+            tm_bad[tm_tamper.m_pos] ^= 0x01;
+        else
+        {
+            // MOVE ONE BYTE FROM USERNAME LENGTH TO MESSAGE LENGTH, TOTAL STAYS THE SAME
+            tm_bad[tm_tamper.m_pos] = static_cast<char>(tm_bad[tm_tamper.m_pos] - 1);
+            tm_bad[netpacket::_PACK_START_LEN_MESSAGE + netpacket::_PACK_LEN_MESSAGE - 1] = static_cast<char>(tm_bad[netpacket::_PACK_START_LEN_MESSAGE + netpacket::_PACK_LEN_MESSAGE - 1] + 1);
+        }
+
+        DataPacket tm_reject {};
+        const bool tm_written = write_frame(tm_pair[1], tm_bad);
+        const Status tm_status = tm_receiver.recv(tm_pair[0], tm_reject);
+        const bool tm_pass = tm_written && tm_status.get_code() == status::to_underlying(socket_code_t::packet_not_auth) && tm_reject.m_msg.empty();
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("Tampered ") + tm_tamper.m_title + " | Rejected: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // PLAIN CIPHER FRAME TO AN AEAD RECEIVER IS A DOWNGRADE
+    const bool tm_plain_sent = tm_downgrade.send(tm_pair[1], tm_out).is_ok();
+    DataPacket tm_plain_in {};
+    const Status tm_plain_status = tm_receiver.recv(tm_pair[0], tm_plain_in);
+    const bool tm_no_downgrade = tm_plain_sent && tm_plain_status.get_code() == status::to_underlying(socket_code_t::packet_corrupt);
+
+    ar_logger.write(tm_no_downgrade ? level_t::Info : level_t::Err, std::string("Plain Frame To AEAD Receiver | Rejected: ") + (tm_no_downgrade ? "Passed" : "Failed"), GET_SOURCE);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    return tm_ok && tm_no_downgrade;
+}
+
+/**
+ * @brief Measure
+ *
+ * Verilen işlemi yaklaşık 64 MB veri işlenecek kadar
+ * tekrarlar ve GB/s döndürür
+ *
+ * @tparam FuncT Function
+ * @param size_t Size
+ * @param FuncT&& Function
+ * @return double
+ */
+template<class FuncT>
+double measure(const std::size_t ar_size, FuncT&& ar_func)
+{
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{64} << 20) / ar_size);
+
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_count = 0; tm_count < tm_rounds; ++tm_count)
+        ar_func();
+    const double tm_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    return static_cast<double>(ar_size * tm_rounds) / tm_seconds / 1e9;
+}
+
+/**
+ * @brief Bench
+ *
+ * Verilen boyut için çıplak ChaCha20, iki geçişli (0. bloktan
+ * Poly1305 anahtarı çıkarılır, tamamı şifrelenir, sonra tamamı
+ * doğrulanır) ve tek geçişli seal ile her Poly1305 çekirdeğinin
+ * hızını ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    std::vector<uint8_t> tm_data(ar_size, 0x5A);
+    const std::array<uint8_t, netpacket::_SIZE_HEADER> tm_aad {};
+
+    ChaCha20 tm_chacha("bench-chacha", ss_key);
+    ChaCha20Poly1305 tm_aead("bench-aead", ss_key);
+    const ChaCha20Poly1305::nonce_t tm_nonce = tm_aead.next_nonce();
+    ChaCha20Poly1305::tag_t tm_tag {};
+
+    const double tm_bare = measure(ar_size, [&]{ tm_chacha.apply(tm_data.data(), tm_data.size()); });
+
+    // TRUE TWO PASS: POLY KEY FROM BLOCK 0, WHOLE CIPHER FROM BLOCK 1, THEN WHOLE MAC
+    ChaCha20 tm_stream("bench-stream", ss_key, tm_nonce, 0);
+    const double tm_two = measure(ar_size, [&]{
+        uint8_t tm_block[ChaCha20::_SIZE_BLOCK] {};
+        tm_stream.apply(tm_block, sizeof(tm_block));
+        tm_stream.apply(tm_data.data(), tm_data.size(), 1);
+
+        uint8_t tm_lengths[16] {};
+        for(int tm_shift = 0; tm_shift < 64; tm_shift += 8)
+        {
+            tm_lengths[tm_shift / 8] = static_cast<uint8_t>(uint64_t(tm_aad.size()) >> tm_shift);
+            tm_lengths[8 + tm_shift / 8] = static_cast<uint8_t>(uint64_t(tm_data.size()) >> tm_shift);
+        }
+
+        Poly1305 tm_mac(tm_block);
+        tm_mac.update(tm_aad.data(), tm_aad.size());
+        tm_mac.pad();
+        tm_mac.update(tm_data.data(), tm_data.size());
+        tm_mac.pad();
+        tm_mac.update(tm_lengths, sizeof(tm_lengths));
+        tm_mac.finish(tm_tag.data());
+    });
+
+    const double tm_one = measure(ar_size, [&]{ tm_aead.seal(tm_data.data(), tm_data.size(), tm_aad.data(), tm_aad.size(), tm_nonce, tm_tag); });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2)
+        << std::setw(6) << ar_size << " B | ChaCha20: " << tm_bare << " GB/s"
+        << " | Two Pass: " << tm_two << " GB/s"
+        << " | One Pass Seal: " << tm_one << " GB/s (" << std::setprecision(0) << (100.0 * tm_one / tm_bare) << "%)";
+
+    // RAW POLY1305 KERNELS
+    polykernel::PolyKey tm_key;
+    polykernel::init(reinterpret_cast<const uint8_t*>(ss_key.data()), tm_key);
+    polykernel::power(tm_key);
+    const std::size_t tm_blocks = ar_size & ~(polykernel::_SIZE_BLOCK - 1);
+
+    for(const auto tm_kernel : { polykernel::kernel_t::scalar, polykernel::kernel_t::avx2 })
+    {
+        if( !polykernel::is_supported(tm_kernel) )
+            continue;
+
+        const polykernel::poly_fn_t tm_fn = polykernel::get_function(tm_kernel);
+        uint32_t tm_state[polykernel::_SIZE_LIMB] {};
+        const double tm_rate = measure(ar_size, [&]{ tm_fn(tm_key, tm_state, tm_data.data(), tm_blocks, polykernel::_FLAG_HIBIT); });
+
+        tm_sstream << std::setprecision(2) << " | Poly1305 " << (tm_kernel == polykernel::kernel_t::avx2 ? "AVX2" : "Scalar") << ": " << tm_rate << " GB/s";
+    }
+
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_poly1305(vv_testlog);
+    vv_ok = check_aead(vv_testlog) && vv_ok;
+    vv_ok = check_socket(vv_testlog) && vv_ok;
+
+    for(const std::size_t vv_size : { std::size_t(64), std::size_t(256), std::size_t(2048), std::size_t(16384) })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
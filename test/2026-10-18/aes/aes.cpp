@@ -0,0 +1,542 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Aes
+ *
+ * AES-CTR ve AES-GCM kiplerinin FIPS-197, NIST SP 800-38A ve
+ * GCM test vektörlerini sağladığını, AES-NI ve PCLMULQDQ
+ * yollarının yazılımsal yol ile aynı sonucu verdiğini,
+ * değiştirilmiş şifreli metin ya da etiketin reddedildiğini
+ * ve AES-CTR çerçeve yolunun her çerçeve için yeni sayaç
+ * bloğu kullandığını kontrol edeceğiz. Her yol için bayt başına çevrim
+ * (cycles/byte) ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 aes.cpp -pthread -o bsd/aes.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 aes.cpp -pthread -o linux/aes.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 aes.cpp -o windows/aes.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/aes.bsd
+ *  Linux   :: ./linux/aes.linux
+ *  Windows :: ./windows/aes.exe
+ *
+ * Not: Çevrim sayısı x86-64 üzerinde zaman damgası sayacı (TSC)
+ *  ile ölçülür, diğer sistemlerde nanosaniye yazılır
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <x86intrin.h>
+#endif
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "aes-" + ss_osname;
+
+// Struct
+struct GcmVector
+{
+    const char* m_title;
+    const char* m_key;
+    const char* m_nonce;
+    const char* m_aad;
+    const char* m_plain;
+    const char* m_cipher;
+    const char* m_tag;
+};
+
+/**
+ * @brief From Hex
+ *
+ * @param char* Hex
+ * @return string
+ */
+std::string from_hex(const char* ar_hex)
+{
+    std::string tm_out;
+    for(std::size_t tm_count = 0; ar_hex[tm_count] && ar_hex[tm_count + 1]; tm_count += 2)
+        tm_out.push_back(static_cast<char>(std::stoi(std::string(ar_hex + tm_count, 2), nullptr, 16)));
+    return tm_out;
+}
+
+/**
+ * @brief To Array
+ *
+ * @tparam Size
+ * @param string& Bytes
+ * @return std::array<uint8_t, Size>
+ */
+template<std::size_t Size>
+std::array<uint8_t, Size> to_array(const std::string& ar_bytes)
+{
+    std::array<uint8_t, Size> tm_out {};
+    std::copy_n(ar_bytes.begin(), std::min(Size, ar_bytes.size()), tm_out.begin());
+    return tm_out;
+}
+
+/**
+ * @brief Cycles
+ *
+ * @return uint64_t
+ */
+uint64_t cycles()
+{
+    #if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+    #else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    #endif
+}
+
+/**
+ * @brief Check Block
+ *
+ * FIPS-197 ek C blok vektörleri. Düz metin sayaç bloğu
+ * olarak verilip sıfır veri şifrelenir, böylece anahtar
+ * akışı E(K, P) olur. Her iki yol da denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_block(Logger<Args...>& ar_logger)
+{
+    const char* tm_vectors[][3] =
+    {
+        { "000102030405060708090a0b0c0d0e0f", "00112233445566778899aabbccddeeff", "69c4e0d86a7b0430d8cdb78070b4c55a" },
+        { "000102030405060708090a0b0c0d0e0f1011121314151617", "00112233445566778899aabbccddeeff", "dda97ca4864cdfe06eaf70a0ec0d7191" },
+        { "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "00112233445566778899aabbccddeeff", "8ea2b7ca516745bfeafc49904b496089" }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_vector : tm_vectors)
+    {
+        const std::string tm_key = from_hex(tm_vector[0]);
+        const std::string tm_plain = from_hex(tm_vector[1]);
+        const std::string tm_expect = from_hex(tm_vector[2]);
+
+        aeskernel::KeySchedule tm_schedule;
+        bool tm_pass = aeskernel::expand_key(reinterpret_cast<const uint8_t*>(tm_key.data()), tm_key.size(), tm_schedule);
+
+        for(const auto tm_kernel : { aeskernel::kernel_t::portable, aeskernel::kernel_t::aesni })
+        {
+            if( !aeskernel::is_supported(tm_kernel) )
+                continue;
+
+            std::string tm_out(16, '\0');
+            aeskernel::get_function(tm_kernel)(tm_schedule, reinterpret_cast<const uint8_t*>(tm_plain.data()), reinterpret_cast<uint8_t*>(tm_out.data()), tm_out.size());
+            tm_pass = tm_pass && tm_out == tm_expect;
+        }
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, "FIPS-197 AES-" + std::to_string(tm_key.size() * 8) + " | " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Ctr
+ *
+ * NIST SP 800-38A F.5.1 (AES-128) ve F.5.5 (AES-256)
+ * sayaç kipi vektörleri, 128 bitlik sayaç taşması ve
+ * aynı çerçevenin iki kez farklı sayaç bloğu ile
+ * mühürlendiği
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_ctr(Logger<Args...>& ar_logger)
+{
+    const char* tm_counter = "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+    const char* tm_plain =
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710";
+
+    const char* tm_vectors[][3] =
+    {
+        {
+            "SP 800-38A F.5.1", "2b7e151628aed2a6abf7158809cf4f3c",
+            "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+            "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee"
+        },
+        {
+            "SP 800-38A F.5.5", "603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4",
+            "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c5"
+            "2b0930daa23de94ce87017ba2d84988ddfc9c58db67aada613c2dd08457941a6"
+        }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_vector : tm_vectors)
+    {
+        AesCtr tm_cipher("aes-ctr", from_hex(tm_vector[1]), to_array<16>(from_hex(tm_counter)));
+
+        std::string tm_text = from_hex(tm_plain);
+        bool tm_pass = tm_cipher.encrypt(tm_text) && tm_text == from_hex(tm_vector[2]);
+        tm_pass = tm_pass && tm_cipher.decrypt(tm_text) && tm_text == from_hex(tm_plain);
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string(tm_vector[0]) + " | " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // 128-BIT CARRY: 3 BLOCKS BEFORE THE LOW 32 BITS WRAP
+    {
+        AesCtr::nonce_t tm_start {};
+        tm_start.fill(0xFF);
+        tm_start[15] = 0xFD;
+        tm_start[0] = 0x00;
+
+        AesCtr tm_cipher("aes-ctr", from_hex("2b7e151628aed2a6abf7158809cf4f3c"), tm_start);
+        std::string tm_whole(6 * 16, '\0');
+        tm_cipher.encrypt(tm_whole);
+
+        // BLOCK BY BLOCK WITH AN EXPLICIT 128-BIT INCREMENT
+        std::string tm_manual;
+        AesCtr::nonce_t tm_block = tm_start;
+        for(int tm_count = 0; tm_count < 6; ++tm_count)
+        {
+            tm_cipher.set_nonce(tm_block);
+            std::string tm_part(16, '\0');
+            tm_cipher.encrypt(tm_part);
+            tm_manual += tm_part;
+
+            for(std::size_t tm_index = 16; tm_index-- > 0 && ++tm_block[tm_index] == 0;) {}
+        }
+
+        const bool tm_pass = tm_whole == tm_manual;
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("CTR 128-Bit Carry | ") + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // FRAME: FRESH COUNTER BLOCK PER SEAL, CARRIED IN THE TRAILER
+    {
+        constexpr std::size_t tm_header = 8;
+        const std::string tm_frame_plain = std::string(tm_header, 'h') + std::string(100, 'p');
+        const std::size_t tm_body = tm_frame_plain.size() - tm_header;
+
+        AesCtr tm_cipher("aes-ctr", from_hex("2b7e151628aed2a6abf7158809cf4f3c"));
+        const auto tm_peer = tm_cipher.clone(from_hex("2b7e151628aed2a6abf7158809cf4f3c"));
+
+        std::string tm_first = tm_frame_plain + std::string(AesCtr::_SIZE_SEAL, '\0');
+        std::string tm_second = tm_first;
+
+        auto tm_frame = [&](std::string& ar_text) { return Frame{ reinterpret_cast<std::byte*>(ar_text.data()), tm_header, tm_body }; };
+        auto tm_trailer = [&](std::string& ar_text) { return reinterpret_cast<std::byte*>(ar_text.data() + tm_frame_plain.size()); };
+
+        const bool tm_sealed = tm_cipher.get_seal_size() == AesCtr::_SIZE_SEAL
+            && tm_cipher.seal(tm_frame(tm_first), tm_trailer(tm_first))
+            && tm_cipher.seal(tm_frame(tm_second), tm_trailer(tm_second));
+
+        const bool tm_differ = tm_sealed
+            && tm_first.compare(tm_header, tm_body, tm_second, tm_header, tm_body) != 0
+            && tm_first.compare(tm_frame_plain.size(), AesCtr::_SIZE_SEAL, tm_second, tm_frame_plain.size(), AesCtr::_SIZE_SEAL) != 0
+            && tm_first.compare(0, tm_header, tm_frame_plain, 0, tm_header) == 0;
+
+        // SAME BYTES AS THE PLAIN CTR PATH WITH TRAILER || 0x00000000 AS COUNTER BLOCK
+        AesCtr::nonce_t tm_block {};
+        std::copy(tm_first.begin() + tm_frame_plain.size(), tm_first.end(), tm_block.begin());
+        std::string tm_manual = tm_frame_plain.substr(tm_header);
+        tm_cipher.set_nonce(tm_block);
+        const bool tm_layout = tm_differ && tm_cipher.encrypt(tm_manual) && tm_first.compare(tm_header, tm_body, tm_manual) == 0;
+
+        const bool tm_pass = tm_layout && tm_peer->open(tm_frame(tm_first), tm_trailer(tm_first))
+            && tm_first.compare(0, tm_frame_plain.size(), tm_frame_plain) == 0;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("CTR Frame Seal | Fresh Nonce: ") + (tm_differ ? "Passed" : "Failed") + " | Open: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Gcm
+ *
+ * GCM belirtimindeki (McGrew & Viega) test durumları 1-4
+ * ve 13-16. Etiket ya da şifreli metin değiştirilince
+ * açmanın reddedildiği de kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_gcm(Logger<Args...>& ar_logger)
+{
+    const char* tm_plain64 =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+        "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255";
+    const char* tm_plain60 =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+        "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+    const char* tm_aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+    const char* tm_key128 = "feffe9928665731c6d6a8f9467308308";
+    const char* tm_key256 = "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308";
+    const char* tm_nonce = "cafebabefacedbaddecaf888";
+
+    const GcmVector tm_vectors[] =
+    {
+        { "GCM Case 1 ", "00000000000000000000000000000000", "000000000000000000000000", "", "", "", "58e2fccefa7e3061367f1d57a4e7455a" },
+        { "GCM Case 2 ", "00000000000000000000000000000000", "000000000000000000000000", "", "00000000000000000000000000000000",
+            "0388dace60b6a392f328c2b971b2fe78", "ab6e47d42cec13bdf53a67b21257bddf" },
+        { "GCM Case 3 ", tm_key128, tm_nonce, "", tm_plain64,
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985", "4d5c2af327cd64a62cf35abd2ba6fab4" },
+        { "GCM Case 4 ", tm_key128, tm_nonce, tm_aad, tm_plain60,
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091", "5bc94fbc3221a5db94fae95ae7121a47" },
+        { "GCM Case 13", "0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "", "", "",
+            "530f8afbc74536b9a963b4f1c4cb738b" },
+        { "GCM Case 14", "0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "",
+            "00000000000000000000000000000000", "cea7403d4d606b6e074ec5d3baf39d18", "d0d1c8a799996bf0265b98b5d48ab919" },
+        { "GCM Case 15", tm_key256, tm_nonce, "", tm_plain64,
+            "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+            "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662898015ad", "b094dac5d93471bdec1a502270e3cc6c" },
+        { "GCM Case 16", tm_key256, tm_nonce, tm_aad, tm_plain60,
+            "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+            "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662", "76fc6ece0f4e1768cddf8853bb2d551b" }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_vector : tm_vectors)
+    {
+        AesGcm tm_cipher("aes-gcm", from_hex(tm_vector.m_key), to_array<12>(from_hex(tm_vector.m_nonce)));
+
+        const std::string tm_aad_bytes = from_hex(tm_vector.m_aad);
+        const std::string tm_plain = from_hex(tm_vector.m_plain);
+        const auto* tm_aad_ptr = reinterpret_cast<const uint8_t*>(tm_aad_bytes.data());
+
+        std::string tm_text = tm_plain;
+        AesGcm::tag_t tm_tag {};
+        bool tm_pass = tm_cipher.seal(reinterpret_cast<uint8_t*>(tm_text.data()), tm_text.size(), tm_aad_ptr, tm_aad_bytes.size(), tm_tag);
+        tm_pass = tm_pass && tm_text == from_hex(tm_vector.m_cipher) && tm_tag == to_array<16>(from_hex(tm_vector.m_tag));
+
+        // TAMPERED TAG AND CIPHERTEXT ARE REJECTED, DATA LEFT AS IS
+        AesGcm::tag_t tm_bad_tag = tm_tag;
+        tm_bad_tag[0] ^= 0x01;
+        tm_pass = tm_pass && !tm_cipher.open(reinterpret_cast<uint8_t*>(tm_text.data()), tm_text.size(), tm_aad_ptr, tm_aad_bytes.size(), tm_bad_tag);
+
+        if( !tm_text.empty() )
+        {
+            std::string tm_bad_text = tm_text;
+            tm_bad_text[tm_bad_text.size() / 2] ^= 0x80;
+            tm_pass = tm_pass && !tm_cipher.open(reinterpret_cast<uint8_t*>(tm_bad_text.data()), tm_bad_text.size(), tm_aad_ptr, tm_aad_bytes.size(), tm_tag);
+        }
+
+        tm_pass = tm_pass && tm_cipher.open(reinterpret_cast<uint8_t*>(tm_text.data()), tm_text.size(), tm_aad_ptr, tm_aad_bytes.size(), tm_tag) && tm_text == tm_plain;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string(tm_vector.m_title) + " | " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // TEXT INTERFACE APPENDS AND STRIPS THE TAG
+    {
+        AesGcm tm_cipher("aes-gcm", from_hex(tm_key128), to_array<12>(from_hex(tm_nonce)));
+        const std::string tm_plain = "text interface carries the tag at the end";
+
+        std::string tm_text = tm_plain;
+        bool tm_pass = tm_cipher.encrypt(tm_text) && tm_text.size() == tm_plain.size() + AesGcm::_SIZE_TAG;
+        tm_pass = tm_pass && tm_cipher.decrypt(tm_text) && tm_text == tm_plain;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("GCM Text Tag | ") + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Kernels
+ *
+ * AES-NI ve PCLMULQDQ yollarını yazılımsal yol ile rastgele
+ * anahtar, sayaç ve uzunluklarda karşılaştırır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_kernels(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(1018);
+    uint32_t tm_ctr_failed = 0;
+    uint32_t tm_ghash_failed = 0;
+
+    const bool tm_has_aesni = aeskernel::is_supported(aeskernel::kernel_t::aesni);
+    const bool tm_has_pclmul = ghashkernel::is_supported(ghashkernel::kernel_t::pclmul);
+
+    for(uint32_t tm_round = 0; tm_round < 300; ++tm_round)
+    {
+        std::string tm_key((tm_round % 3 + 2) * 8, '\0');
+        for(auto& tm_char : tm_key)
+            tm_char = static_cast<char>(tm_rng());
+
+        uint8_t tm_counter[16];
+        for(auto& tm_byte : tm_counter)
+            tm_byte = static_cast<uint8_t>(tm_rng());
+
+        const std::size_t tm_len = tm_rng() % 1500;
+        std::string tm_plain(tm_len, '\0');
+        for(auto& tm_char : tm_plain)
+            tm_char = static_cast<char>(tm_rng());
+
+        aeskernel::KeySchedule tm_schedule;
+        aeskernel::expand_key(reinterpret_cast<const uint8_t*>(tm_key.data()), tm_key.size(), tm_schedule);
+
+        if( tm_has_aesni )
+        {
+            std::string tm_fast = tm_plain;
+            std::string tm_slow = tm_plain;
+            aeskernel::get_function(aeskernel::kernel_t::aesni)(tm_schedule, tm_counter, reinterpret_cast<uint8_t*>(tm_fast.data()), tm_len);
+            aeskernel::get_function(aeskernel::kernel_t::portable)(tm_schedule, tm_counter, reinterpret_cast<uint8_t*>(tm_slow.data()), tm_len);
+            if( tm_fast != tm_slow )
+                ++tm_ctr_failed;
+        }
+
+        if( tm_has_pclmul )
+        {
+            ghashkernel::GhashKey tm_ghash;
+            ghashkernel::init(tm_counter, tm_ghash);
+
+            const std::size_t tm_full = tm_len - tm_len % 16;
+            uint8_t tm_fast[16] {};
+            uint8_t tm_slow[16] {};
+            ghashkernel::get_function(ghashkernel::kernel_t::pclmul)(tm_ghash, tm_fast, reinterpret_cast<const uint8_t*>(tm_plain.data()), tm_full);
+            ghashkernel::get_function(ghashkernel::kernel_t::portable)(tm_ghash, tm_slow, reinterpret_cast<const uint8_t*>(tm_plain.data()), tm_full);
+            if( std::memcmp(tm_fast, tm_slow, 16) != 0 )
+                ++tm_ghash_failed;
+        }
+    }
+
+    ar_logger.write(tm_ctr_failed ? level_t::Err : level_t::Info,
+        std::string("AES-NI   ") + (tm_has_aesni ? " | Compare Failed: " + std::to_string(tm_ctr_failed) + "/300" : " | Not Supported"), GET_SOURCE);
+    ar_logger.write(tm_ghash_failed ? level_t::Err : level_t::Info,
+        std::string("PCLMULQDQ") + (tm_has_pclmul ? " | Compare Failed: " + std::to_string(tm_ghash_failed) + "/300" : " | Not Supported"), GET_SOURCE);
+
+    return tm_ctr_failed == 0 && tm_ghash_failed == 0;
+}
+
+/**
+ * @brief Measure
+ *
+ * Verilen işlemi tekrar edip bayt başına çevrimi döndürür
+ *
+ * @tparam FuncT
+ * @param size_t Size
+ * @param size_t Rounds
+ * @param FuncT&& Function
+ * @return double
+ */
+template<class FuncT>
+double measure(const std::size_t ar_size, const std::size_t ar_rounds, FuncT&& ar_func)
+{
+    ar_func();
+
+    const uint64_t tm_start = cycles();
+    for(std::size_t tm_round = 0; tm_round < ar_rounds; ++tm_round)
+        ar_func();
+    return static_cast<double>(cycles() - tm_start) / static_cast<double>(ar_size * ar_rounds);
+}
+
+/**
+ * @brief Bench
+ *
+ * Her yol için verilen boyutta bayt başına çevrimi ölçer:
+ * sayaç kipi, GHASH ve seçilen yollar ile tam GCM
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    std::vector<uint8_t> tm_data(ar_size, 0x5A);
+    uint8_t tm_counter[16] {};
+
+    aeskernel::KeySchedule tm_schedule;
+    aeskernel::expand_key(tm_data.data(), 16, tm_schedule);
+
+    ghashkernel::GhashKey tm_ghash;
+    ghashkernel::init(tm_data.data(), tm_ghash);
+    uint8_t tm_state[16] {};
+
+    const std::size_t tm_fast_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 27) / ar_size);
+    const std::size_t tm_slow_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 20) / ar_size);
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: " << std::setw(6) << ar_size << " B | cycles/byte";
+
+    const auto tm_portable = aeskernel::get_function(aeskernel::kernel_t::portable);
+    tm_sstream << " | CTR Portable: " << measure(ar_size, tm_slow_rounds, [&]{ tm_portable(tm_schedule, tm_counter, tm_data.data(), ar_size); });
+
+    if( aeskernel::is_supported(aeskernel::kernel_t::aesni) )
+    {
+        const auto tm_aesni = aeskernel::get_function(aeskernel::kernel_t::aesni);
+        tm_sstream << " | CTR AES-NI: " << measure(ar_size, tm_fast_rounds, [&]{ tm_aesni(tm_schedule, tm_counter, tm_data.data(), ar_size); });
+    }
+
+    const std::size_t tm_full = ar_size - ar_size % 16;
+    const auto tm_ghash_portable = ghashkernel::get_function(ghashkernel::kernel_t::portable);
+    tm_sstream << " | GHASH Portable: " << measure(ar_size, tm_slow_rounds, [&]{ tm_ghash_portable(tm_ghash, tm_state, tm_data.data(), tm_full); });
+
+    if( ghashkernel::is_supported(ghashkernel::kernel_t::pclmul) )
+    {
+        const auto tm_pclmul = ghashkernel::get_function(ghashkernel::kernel_t::pclmul);
+        tm_sstream << " | GHASH PCLMUL: " << measure(ar_size, tm_fast_rounds, [&]{ tm_pclmul(tm_ghash, tm_state, tm_data.data(), tm_full); });
+    }
+
+    AesGcm tm_gcm("aes-gcm-bench", std::string(16, 'k'));
+    AesGcm::tag_t tm_tag {};
+    const bool tm_fast = aeskernel::get_kernel() == aeskernel::kernel_t::aesni;
+    tm_sstream << " | GCM Seal: " << measure(ar_size, tm_fast ? tm_fast_rounds : tm_slow_rounds, [&]{ (void)tm_gcm.seal(tm_data.data(), ar_size, nullptr, 0, tm_tag); });
+
+    tm_sstream << " | Check: " << static_cast<int>(tm_data[ar_size / 2] ^ tm_state[0] ^ tm_tag[0]);
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, std::string("Kernel: ")
+        + (aeskernel::get_kernel() == aeskernel::kernel_t::aesni ? "AES-NI" : "Portable") + " + "
+        + (ghashkernel::get_kernel() == ghashkernel::kernel_t::pclmul ? "PCLMULQDQ" : "Portable"), GET_SOURCE);
+
+    bool vv_ok = check_block(vv_testlog);
+    vv_ok = check_ctr(vv_testlog) && vv_ok;
+    vv_ok = check_gcm(vv_testlog) && vv_ok;
+    vv_ok = check_kernels(vv_testlog) && vv_ok;
+
+    for(const std::size_t vv_size : { 64, 1500, 16 * 1024 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,267 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * ChaCha Multi
+ *
+ * Çoklu tampon ChaCha20 yolunun her işi tek tek ChaCha20
+ * ile şifrelemek ile aynı sonucu verdiğini kontrol edeceğiz.
+ * İşler rastgele anahtar, nonce, sayaç ve uzunlukta olup
+ * boş işler ve 8'in katı olmayan iş sayıları da denenir.
+ * Kısa mesaj kümelerinde sıralı ve şeritli yolun hızı
+ * (GB/s) tek akışlı uzun veri hızı ile birlikte ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha-multi.cpp -pthread -o bsd/chacha-multi.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha-multi.cpp -pthread -o linux/chacha-multi.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha-multi.cpp -o windows/chacha-multi.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/chacha-multi.bsd
+ *  Linux   :: ./linux/chacha-multi.linux
+ *  Windows :: ./windows/chacha-multi.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "chacha-multi-" + ss_osname;
+
+static constexpr chachamulti::kernel_t ss_kernels[] =
+{
+    chachamulti::kernel_t::serial,
+    chachamulti::kernel_t::avx2
+};
+
+/**
+ * @brief Kernel Name
+ *
+ * @param kernel_t Kernel
+ * @return const char*
+ */
+const char* kernel_name(const chachamulti::kernel_t ar_kernel)
+{
+    switch( ar_kernel )
+    {
+        case chachamulti::kernel_t::avx2: return "AVX2  ";
+        case chachamulti::kernel_t::serial:
+        default:
+            return "Serial";
+    }
+}
+
+/**
+ * @brief Check Jobs
+ *
+ * Her çekirdekte rastgele iş kümelerini şifreleyip her işi
+ * kendi ChaCha20 nesnesi ile tek tek şifrelenmiş hali ile
+ * karşılaştırır. Kısa ve uzun işler karışık verilir, böylece
+ * şeritlerin yeniden doldurulması ve sondaki tek akışlı
+ * tamamlama da denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_jobs(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(1018);
+
+    bool tm_ok = true;
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !chachamulti::is_supported(tm_kernel) )
+        {
+            ar_logger.write(level_t::Info, std::string(kernel_name(tm_kernel)) + " | Not Supported", GET_SOURCE);
+            continue;
+        }
+
+        const chachamulti::multi_fn_t tm_fn = chachamulti::get_function(tm_kernel);
+        uint32_t tm_failed = 0;
+
+        for(uint32_t tm_round = 0; tm_round < 300; ++tm_round)
+        {
+            const std::size_t tm_count = tm_rng() % 40;
+
+            std::vector<std::string> tm_fast(tm_count);
+            std::vector<std::string> tm_slow(tm_count);
+            std::vector<chachamulti::Job> tm_jobs;
+
+            for(std::size_t tm_index = 0; tm_index < tm_count; ++tm_index)
+            {
+                std::string tm_key(ChaCha20::_SIZE_KEY, '\0');
+                for(auto& tm_char : tm_key)
+                    tm_char = static_cast<char>(tm_rng());
+
+                ChaCha20::nonce_t tm_nonce {};
+                for(auto& tm_byte : tm_nonce)
+                    tm_byte = static_cast<uint8_t>(tm_rng());
+
+                const uint32_t tm_counter = tm_index % 7 == 0 ? 0xFFFFFFFFu - (tm_rng() % 4) : tm_rng() % 16;
+                const std::size_t tm_len = tm_index % 5 == 0 ? tm_rng() % 4000 : tm_index % 9 == 0 ? 0 : tm_rng() % 300;
+
+                std::string tm_plain(tm_len, '\0');
+                for(auto& tm_char : tm_plain)
+                    tm_char = static_cast<char>(tm_rng());
+
+                tm_fast[tm_index] = tm_plain;
+                tm_slow[tm_index] = tm_plain;
+
+                ChaCha20 tm_cipher("chacha20", tm_key, tm_nonce, tm_counter);
+                tm_jobs.push_back(tm_cipher.make_job(reinterpret_cast<unsigned char*>(tm_fast[tm_index].data()), tm_len));
+                tm_cipher.encrypt(tm_slow[tm_index]);
+            }
+
+            tm_fn(tm_jobs.data(), tm_jobs.size());
+
+            for(std::size_t tm_index = 0; tm_index < tm_count; ++tm_index)
+            {
+                if( tm_fast[tm_index] != tm_slow[tm_index] )
+                {
+                    ++tm_failed;
+                    break;
+                }
+            }
+        }
+
+        ar_logger.write(tm_failed ? level_t::Err : level_t::Info, std::string(kernel_name(tm_kernel)) + " | Compare Failed: " + std::to_string(tm_failed) + "/300", GET_SOURCE);
+        tm_ok = tm_ok && tm_failed == 0;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Invalid
+ *
+ * Hatalı anahtarlı ChaCha20 nesnesinden alınan işin boş
+ * olduğunu ve veriye dokunulmadığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_invalid(Logger<Args...>& ar_logger)
+{
+    ChaCha20 tm_short("chacha20", std::string(16, 'k'));
+    ChaCha20 tm_valid("chacha20", std::string(32, 'k'));
+
+    std::string tm_first(100, 'x');
+    std::string tm_second(100, 'x');
+
+    chachamulti::Job tm_jobs[] =
+    {
+        tm_short.make_job(reinterpret_cast<unsigned char*>(tm_first.data()), tm_first.size()),
+        tm_valid.make_job(reinterpret_cast<unsigned char*>(tm_second.data()), tm_second.size())
+    };
+    chachamulti::apply(tm_jobs, 2);
+
+    const bool tm_ok = tm_jobs[0].m_len == 0 && tm_first == std::string(100, 'x') && tm_second != std::string(100, 'x');
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Invalid Key Job: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Verilen boyutta 64 mesajlık bir küme oluşturup her
+ * çekirdek için saniyedeki gigabayt miktarını ölçer. Aynı
+ * toplam boyutta tek akışlı şifreleme de karşılaştırma
+ * için ölçülür
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    constexpr std::size_t tm_count = 64;
+
+    std::vector<unsigned char> tm_data(tm_count * ar_size, 0x5A);
+    std::vector<chachamulti::Job> tm_jobs;
+
+    uint8_t tm_key[ChaCha20::_SIZE_KEY];
+    uint8_t tm_nonce[ChaCha20::_SIZE_NONCE] {};
+    std::fill(tm_key, tm_key + sizeof(tm_key), 0x42);
+
+    for(std::size_t tm_index = 0; tm_index < tm_count; ++tm_index)
+    {
+        tm_nonce[0] = static_cast<uint8_t>(tm_index);
+        tm_jobs.push_back(chachamulti::make_job(tm_key, tm_nonce, 1, tm_data.data() + tm_index * ar_size, ar_size));
+    }
+
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 28) / tm_data.size());
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: 64 x " << std::setw(5) << ar_size << " B";
+
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !chachamulti::is_supported(tm_kernel) )
+            continue;
+
+        const chachamulti::multi_fn_t tm_fn = chachamulti::get_function(tm_kernel);
+
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            tm_fn(tm_jobs.data(), tm_jobs.size());
+        const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+        tm_sstream << " | " << kernel_name(tm_kernel) << ": " << static_cast<double>(tm_rounds * tm_data.size()) / tm_sec / 1e9 << " GB/s";
+    }
+
+    // SINGLE STREAM OVER THE SAME TOTAL SIZE
+    {
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            chachakernel::apply(tm_jobs[0].m_state, tm_data.data(), tm_data.size());
+        const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+        tm_sstream << " | Bulk: " << static_cast<double>(tm_rounds * tm_data.size()) / tm_sec / 1e9 << " GB/s";
+    }
+
+    tm_sstream << " | Check: " << static_cast<int>(tm_data[tm_data.size() / 2]);
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, std::string("Kernel: ") + kernel_name(chachamulti::get_kernel()), GET_SOURCE);
+
+    bool vv_ok = check_jobs(vv_testlog);
+    vv_ok = check_invalid(vv_testlog) && vv_ok;
+
+    for(const std::size_t vv_size : { 64, 128, 256, 576, 1024, 1500 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,385 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * ChaCha20
+ *
+ * ChaCha20 şifreleyicisinin RFC 8439 test vektörlerini
+ * sağladığını, desteklenen her vektör çekirdeğin (SSE2, AVX2)
+ * yazılımsal yol ile aynı sonucu verdiğini, nonce
+ * değişince anahtar akışının değiştiğini ve çerçeve yolunda
+ * aynı metnin her seferinde farklı nonce ile şifrelendiğini
+ * kontrol edeceğiz.
+ * Farklı boyutlarda her çekirdek için hız (GB/s) ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha20.cpp -pthread -o bsd/chacha20.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha20.cpp -pthread -o linux/chacha20.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 chacha20.cpp -o windows/chacha20.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/chacha20.bsd
+ *  Linux   :: ./linux/chacha20.linux
+ *  Windows :: ./windows/chacha20.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "chacha20-" + ss_osname;
+
+static constexpr chachakernel::kernel_t ss_kernels[] =
+{
+    chachakernel::kernel_t::scalar,
+    chachakernel::kernel_t::sse2,
+    chachakernel::kernel_t::avx2
+};
+
+// Struct
+struct Vector
+{
+    const char* m_title;
+    const char* m_key;
+    const char* m_nonce;
+    uint32_t m_counter;
+    std::string m_plain;
+    const char* m_cipher;
+};
+
+/**
+ * @brief Kernel Name
+ *
+ * @param kernel_t Kernel
+ * @return const char*
+ */
+const char* kernel_name(const chachakernel::kernel_t ar_kernel)
+{
+    switch( ar_kernel )
+    {
+        case chachakernel::kernel_t::avx2: return "AVX2  ";
+        case chachakernel::kernel_t::sse2: return "SSE2  ";
+        case chachakernel::kernel_t::scalar:
+        default:
+            return "Scalar";
+    }
+}
+
+/**
+ * @brief From Hex
+ *
+ * @param char* Hex
+ * @return string
+ */
+std::string from_hex(const char* ar_hex)
+{
+    std::string tm_out;
+    for(std::size_t tm_count = 0; ar_hex[tm_count] && ar_hex[tm_count + 1]; tm_count += 2)
+        tm_out.push_back(static_cast<char>(std::stoi(std::string(ar_hex + tm_count, 2), nullptr, 16)));
+    return tm_out;
+}
+
+/**
+ * @brief To Nonce
+ *
+ * @param string& Bytes
+ * @return nonce_t
+ */
+ChaCha20::nonce_t to_nonce(const std::string& ar_bytes)
+{
+    ChaCha20::nonce_t tm_nonce {};
+    std::copy(ar_bytes.begin(), ar_bytes.begin() + tm_nonce.size(), tm_nonce.begin());
+    return tm_nonce;
+}
+
+/**
+ * @brief Check Vectors
+ *
+ * RFC 8439 bölüm 2.3.2 (blok), bölüm 2.4.2 (şifreleme) ve
+ * ek A.1 (sıfır anahtar) vektörlerini her çekirdek ile dener
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_vectors(Logger<Args...>& ar_logger)
+{
+    const Vector tm_vectors[] =
+    {
+        {
+            "RFC 8439 2.3.2",
+            "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+            "000000090000004a00000000", 1, std::string(64, '\0'),
+            "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+            "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e"
+        },
+        {
+            "RFC 8439 2.4.2",
+            "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+            "000000000000004a00000000", 1,
+            "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.",
+            "6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+            "f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+            "07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+            "5af90bbf74a35be6b40b8eedf2785e42874d"
+        },
+        {
+            "RFC 8439 A.1 #1",
+            "0000000000000000000000000000000000000000000000000000000000000000",
+            "000000000000000000000000", 0, std::string(64, '\0'),
+            "76b8e0ada0f13d90405d6ae55386bd28bdd219b8a08ded1aa836efcc8b770dc7"
+            "da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586"
+        }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_vector : tm_vectors)
+    {
+        const std::string tm_expect = from_hex(tm_vector.m_cipher);
+
+        ChaCha20 tm_cipher("chacha20", from_hex(tm_vector.m_key), to_nonce(from_hex(tm_vector.m_nonce)), tm_vector.m_counter);
+
+        std::string tm_text = tm_vector.m_plain;
+        bool tm_pass = tm_cipher.encrypt(tm_text) && tm_text == tm_expect;
+        tm_pass = tm_pass && tm_cipher.decrypt(tm_text) && tm_text == tm_vector.m_plain;
+
+        // SAME VECTOR ON EVERY SUPPORTED KERNEL
+        std::array<uint32_t, chachakernel::_SIZE_STATE> tm_state {};
+        {
+            const std::string tm_key = from_hex(tm_vector.m_key);
+            const std::string tm_nonce = from_hex(tm_vector.m_nonce);
+            const uint32_t tm_const[4] = { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+            std::copy(tm_const, tm_const + 4, tm_state.begin());
+            std::memcpy(tm_state.data() + 4, tm_key.data(), 32);
+            tm_state[chachakernel::_POS_COUNTER] = tm_vector.m_counter;
+            std::memcpy(tm_state.data() + 13, tm_nonce.data(), 12);
+        }
+
+        for(const auto tm_kernel : ss_kernels)
+        {
+            if( !chachakernel::is_supported(tm_kernel) )
+                continue;
+
+            std::string tm_run = tm_vector.m_plain;
+            chachakernel::get_function(tm_kernel)(tm_state.data(), reinterpret_cast<unsigned char*>(tm_run.data()), tm_run.size());
+            tm_pass = tm_pass && tm_run == tm_expect;
+        }
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string(tm_vector.m_title) + " | " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Kernels
+ *
+ * Desteklenen her çekirdeği yazılımsal yol ile rastgele
+ * uzunluk, anahtar ve sayaçlarda karşılaştırır. Sayacın
+ * taşma sınırı da denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_kernels(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(1018);
+    const chachakernel::chacha_fn_t tm_scalar = chachakernel::get_function(chachakernel::kernel_t::scalar);
+
+    bool tm_ok = true;
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !chachakernel::is_supported(tm_kernel) )
+        {
+            ar_logger.write(level_t::Info, std::string(kernel_name(tm_kernel)) + " | Not Supported", GET_SOURCE);
+            continue;
+        }
+
+        const chachakernel::chacha_fn_t tm_fn = chachakernel::get_function(tm_kernel);
+        uint32_t tm_failed = 0;
+
+        for(uint32_t tm_round = 0; tm_round < 1000; ++tm_round)
+        {
+            std::array<uint32_t, chachakernel::_SIZE_STATE> tm_state {};
+            for(auto& tm_word : tm_state)
+                tm_word = tm_rng();
+            if( tm_round % 10 == 0 )
+                tm_state[chachakernel::_POS_COUNTER] = 0xFFFFFFFFu - (tm_rng() % 8);
+
+            const std::size_t tm_len = tm_rng() % 5000;
+            std::string tm_plain(tm_len, '\0');
+            for(auto& tm_char : tm_plain)
+                tm_char = static_cast<char>(tm_rng());
+
+            std::string tm_fast = tm_plain;
+            std::string tm_slow = tm_plain;
+            tm_fn(tm_state.data(), reinterpret_cast<unsigned char*>(tm_fast.data()), tm_len);
+            tm_scalar(tm_state.data(), reinterpret_cast<unsigned char*>(tm_slow.data()), tm_len);
+
+            if( tm_fast != tm_slow )
+                ++tm_failed;
+        }
+
+        ar_logger.write(tm_failed ? level_t::Err : level_t::Info, std::string(kernel_name(tm_kernel)) + " | Compare Failed: " + std::to_string(tm_failed) + "/1000", GET_SOURCE);
+        tm_ok = tm_ok && tm_failed == 0;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Nonce
+ *
+ * Nonce değişince anahtar akışının değiştiğini ve
+ * 32 bayt olmayan anahtarın reddedildiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_nonce(Logger<Args...>& ar_logger)
+{
+    ChaCha20 tm_cipher("chacha20", std::string(32, 'k'));
+
+    std::string tm_first(128, '\0');
+    std::string tm_second(128, '\0');
+
+    bool tm_ok = tm_cipher.encrypt(tm_first);
+    tm_cipher.set_nonce(ChaCha20::nonce_t{ 1 });
+    tm_ok = tm_ok && tm_cipher.encrypt(tm_second) && tm_first != tm_second;
+
+    ChaCha20 tm_short("chacha20", std::string(16, 'k'));
+    std::string tm_text(16, 'x');
+    tm_ok = tm_ok && tm_short.has_error() && !tm_short.encrypt(tm_text) && tm_text == std::string(16, 'x');
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Nonce And Key Size: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Seal
+ *
+ * Aynı metin iki kez mühürlenince nonce ve şifreli metnin
+ * farklı olduğunu, kopyanın kendi tuzunu seçtiğini ve
+ * kuyruktaki nonce ile kopyanın çerçeveyi açtığını
+ * kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_seal(Logger<Args...>& ar_logger)
+{
+    constexpr std::size_t tm_header = 8;
+    const std::string tm_plain = std::string(tm_header, 'h') + std::string(100, 'p');
+
+    ChaCha20 tm_cipher("chacha20", std::string(32, 'k'));
+    const auto tm_clone = tm_cipher.clone(std::string(32, 'k'));
+
+    std::string tm_first = tm_plain + std::string(ChaCha20::_SIZE_SEAL, '\0');
+    std::string tm_second = tm_first;
+    std::string tm_third = tm_first;
+
+    auto tm_frame = [&](std::string& ar_text) { return Frame{ reinterpret_cast<std::byte*>(ar_text.data()), tm_header, tm_plain.size() - tm_header }; };
+    auto tm_trailer = [&](std::string& ar_text) { return reinterpret_cast<std::byte*>(ar_text.data() + tm_plain.size()); };
+
+    bool tm_ok = tm_cipher.get_seal_size() == ChaCha20::_SIZE_SEAL
+        && tm_cipher.seal(tm_frame(tm_first), tm_trailer(tm_first))
+        && tm_cipher.seal(tm_frame(tm_second), tm_trailer(tm_second))
+        && tm_clone->seal(tm_frame(tm_third), tm_trailer(tm_third));
+
+    const bool tm_differ = tm_ok && tm_first != tm_second
+        && tm_first.compare(tm_header, tm_plain.size() - tm_header, tm_second, tm_header, tm_plain.size() - tm_header) != 0
+        && tm_first.compare(tm_plain.size(), 4, tm_third, tm_plain.size(), 4) != 0
+        && tm_first.compare(0, tm_header, tm_plain, 0, tm_header) == 0;
+
+    tm_ok = tm_differ && tm_clone->open(tm_frame(tm_first), tm_trailer(tm_first)) && tm_first.compare(0, tm_plain.size(), tm_plain) == 0
+        && tm_cipher.open(tm_frame(tm_second), tm_trailer(tm_second)) && tm_second.compare(0, tm_plain.size(), tm_plain) == 0;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Frame Seal | Fresh Nonce: ") + (tm_differ ? "Passed" : "Failed") + " | Open: " + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Desteklenen her çekirdek için verilen boyutta
+ * saniyedeki gigabayt miktarını ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    std::vector<unsigned char> tm_data(ar_size, 0x5A);
+    std::array<uint32_t, chachakernel::_SIZE_STATE> tm_state {};
+    tm_state.fill(0x01020304);
+
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 29) / ar_size);
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: " << std::setw(8) << ar_size << " B";
+
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !chachakernel::is_supported(tm_kernel) )
+            continue;
+
+        const chachakernel::chacha_fn_t tm_fn = chachakernel::get_function(tm_kernel);
+
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            tm_fn(tm_state.data(), tm_data.data(), ar_size);
+        const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+        tm_sstream << " | " << kernel_name(tm_kernel) << ": " << static_cast<double>(tm_rounds * ar_size) / tm_sec / 1e9 << " GB/s";
+    }
+
+    tm_sstream << " | Check: " << static_cast<int>(tm_data[ar_size / 2]);
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, std::string("Kernel: ") + kernel_name(chachakernel::get_kernel()), GET_SOURCE);
+
+    bool vv_ok = check_vectors(vv_testlog);
+    vv_ok = check_kernels(vv_testlog) && vv_ok;
+    vv_ok = check_nonce(vv_testlog) && vv_ok;
+    vv_ok = check_seal(vv_testlog) && vv_ok;
+
+    for(const std::size_t vv_size : { 64, 1500, 64 * 1024, 16 * 1024 * 1024 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
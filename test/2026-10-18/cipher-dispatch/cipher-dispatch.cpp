@@ -0,0 +1,196 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Cipher Dispatch (Şifreleyici Çağrısı)
+ *
+ * Sokete verilen Xor algoritmasının kopyalanıp temel sınıfa
+ * indirgenmediğini, gönderilen baytların gerçekten şifreli
+ * olduğunu kontrol edeceğiz. Aynı anahtar ile alınan mesajın
+ * açıldığı, farklı anahtar ile açılamadığı denenir. Sanal
+ * çağrı üzerinden şifreleme ile doğrudan çekirdek çağrısı
+ * arasındaki süre farkı ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cipher-dispatch.cpp -pthread -o bsd/cipher-dispatch.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cipher-dispatch.cpp -pthread -o linux/cipher-dispatch.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/cipher-dispatch.bsd
+ *  Linux   :: ./linux/cipher-dispatch.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include "../socket-link.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "cipher-dispatch-" + ss_osname;
+
+static const std::string ss_key = utf::to_utf8(U"key-dispatch@20261018");
+static constexpr uint32_t ss_rounds = 1000000;
+
+/**
+ * @brief Check Wire
+ *
+ * Soketin gönderdiği baytları okur. Başlığın açık, gövdenin
+ * ise aynı anahtarlı Xor ile şifrelenmiş hali olduğunu kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_wire(Logger<Args...>& ar_logger)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    Xor tm_cipher("dispatch-cipher", ss_key);
+    Socket tm_socket(tm_cipher, "logs/socket-" + ss_logname, "cipher-dispatch", "pwd@dispatch", 5070, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+
+    const DataPacket tm_out { "pwd@dispatch", "tester", "sliced cipher would leave this readable" };
+
+    netpacket::buffer_t tm_plain {};
+    const std::size_t tm_len = netpacket::NetPacket::layout(tm_plain.data(), tm_plain.size(), tm_out.m_pwd, tm_out.m_name, tm_out.m_msg);
+
+    // EXPECTED CIPHERTEXT FROM A SEPARATE INSTANCE
+    Xor tm_reference("dispatch-cipher", ss_key);
+    netpacket::buffer_t tm_expect = tm_plain;
+    tm_reference.encrypt(Frame{ tm_expect.data(), netpacket::_SIZE_HEADER, tm_len - netpacket::_SIZE_HEADER });
+
+    const bool tm_sent = tm_socket.send(tm_pair[0], tm_out).is_ok();
+    const std::string tm_raw = read_frame(tm_pair[1], tm_len);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    const auto* tm_wire = reinterpret_cast<const std::byte*>(tm_raw.data());
+    const bool tm_ok = tm_sent && tm_raw.size() == tm_len
+        && std::equal(tm_wire, tm_wire + tm_len, tm_expect.begin())
+        && !std::equal(tm_wire + netpacket::_SIZE_HEADER, tm_wire + tm_len, tm_plain.begin() + netpacket::_SIZE_HEADER);
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Wire Is Encrypted: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Round Trip
+ *
+ * Gönderen ve alan soket ayrı şifreleyiciler ile kurulur.
+ * Anahtarlar aynı ise mesaj açılmalı, farklı ise açılmamalıdır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Receiver Key
+ * @param bool Expect Match
+ * @return bool
+ */
+template<class... Args>
+bool check_round_trip(Logger<Args...>& ar_logger, const std::string& ar_key, const bool ar_match)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    Xor tm_send_cipher("dispatch-send", ss_key);
+    Xor tm_recv_cipher("dispatch-recv", ar_key);
+    Socket tm_sender(tm_send_cipher, "logs/socket-" + ss_logname, "cipher-dispatch", "pwd@dispatch", 5070, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+    Socket tm_receiver(tm_recv_cipher, "logs/socket-" + ss_logname, "cipher-dispatch", "pwd@dispatch", 5071, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+
+    const DataPacket tm_out { "pwd@dispatch", "tester", "round trip through the real cipher" };
+    DataPacket tm_in {};
+
+    const bool tm_io = tm_sender.send(tm_pair[0], tm_out).is_ok() && tm_receiver.recv(tm_pair[1], tm_in).is_ok();
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    const bool tm_equal = tm_in.m_name == tm_out.m_name && tm_in.m_msg == tm_out.m_msg;
+    const bool tm_ok = tm_io && tm_equal == ar_match;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err,
+        std::string(ar_match ? "Same Key     " : "Different Key") + " | Round Trip: " + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Paket boyutundaki gövde için sanal çağrı üzerinden şifreleme
+ * ile çekirdeğin doğrudan çağrılması arasındaki farkı ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    Xor tm_xor("dispatch-bench", ss_key);
+    Algorithm& tm_cipher = tm_xor;
+
+    std::array<std::byte, 256> tm_body {};
+
+    auto tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+        tm_xor.apply(reinterpret_cast<unsigned char*>(tm_body.data()), tm_body.size());
+    const double tm_direct_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+        tm_cipher.encrypt(Frame{ tm_body.data(), 0, tm_body.size() });
+    const double tm_virtual_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(1)
+        << "Encrypt 256 B | Direct: " << tm_direct_ns << " ns"
+        << " | Through Algorithm&: " << tm_virtual_ns << " ns"
+        << " | Check: " << static_cast<int>(tm_body[0]);
+
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_wire(vv_testlog);
+    vv_ok = check_round_trip(vv_testlog, ss_key, true) && vv_ok;
+    vv_ok = check_round_trip(vv_testlog, utf::to_utf8(U"another-key@20261018"), false) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,612 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Cipher Suite (Şifreleme Yöntemi Anlaşması)
+ *
+ * El sıkışmada sunulan yöntemlerden iki işlemcide de en hızlı
+ * çalışanın seçildiğini, doğrulamalı (AEAD) yöntem varken
+ * doğrulamasız yönteme düşülmediğini kontrol edeceğiz. AES-GCM
+ * çerçeve arayüzünün başlığı ve veriyi doğruladığı, akış
+ * yöntemlerinde aynı mesajın her çerçevede farklı nonce ile
+ * şifrelendiği ve Xor'un sunulmadığı denenir.
+ * Kendi şifreleyicisi farklı türde olan iki uç soket çifti
+ * üzerinden aynı yöntemde anlaşıp mesajlaşır, anahtar
+ * değiştiğinde yöntem korunur. Yöntem sunmayan eski uç ile
+ * kendi şifreleyiciye dönüldüğü, ortak çerçeve sürümü yoksa
+ * oturumun açılmadığı denenir. Yöntemlerin soket üzerinden
+ * gönderme ve alma hızı ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cipher-suite.cpp -pthread -o bsd/cipher-suite.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cipher-suite.cpp -pthread -o linux/cipher-suite.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/cipher-suite.bsd
+ *  Linux   :: ./linux/cipher-suite.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include "../socket-link.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "cipher-suite-" + ss_osname;
+
+static const std::string ss_key = "0123456789abcdef0123456789abcdef";
+static const std::string ss_next_key = "fedcba9876543210fedcba9876543210";
+
+static constexpr flag::flag_t ss_flag = _FLAG_SOCKET_CIPHER_SUITE | _FLAG_SOCKET_SESSION_KEY | _FLAG_SOCKET_KEY_EPOCH;
+
+static constexpr std::size_t ss_bench_count = 4000;
+
+/**
+ * @brief Suite Name
+ *
+ * @param suite_t Suite
+ * @return string
+ */
+std::string suite_name(const suite_t ar_suite)
+{
+    switch( ar_suite )
+    {
+        case _SUITE_CHACHA20: return "ChaCha20";
+        case _SUITE_CHACHA20_POLY1305: return "ChaCha20-Poly1305";
+        case _SUITE_AES_CTR: return "AES-CTR";
+        case _SUITE_AES_GCM: return "AES-GCM";
+    }
+
+    return "None";
+}
+
+/**
+ * @brief Suite List
+ *
+ * @param suite_t Suites
+ * @return string
+ */
+std::string suite_list(const suite_t ar_suites)
+{
+    std::string tm_list;
+    for(suite_t tm_bit = 1; tm_bit && tm_bit <= _SUITE_ALL; tm_bit = static_cast<suite_t>(tm_bit << 1))
+        if( ar_suites & tm_bit )
+            tm_list += (tm_list.empty() ? "" : ", ") + suite_name(tm_bit);
+
+    return tm_list.empty() ? "None" : tm_list;
+}
+
+/**
+ * @brief Exchange
+ *
+ * Gönderen uçtan bir mesaj gönderip alan uçta aynı mesajın
+ * alındığını kontrol eder
+ *
+ * @param Socket& Sender
+ * @param socket_t Sender Socket
+ * @param Socket& Receiver
+ * @param socket_t Receiver Socket
+ * @param string& Message
+ * @return bool
+ */
+bool exchange(Socket& ar_sender, const socket_t ar_send_sock, Socket& ar_receiver, const socket_t ar_recv_sock, const std::string& ar_msg)
+{
+    if( !ar_sender.send(ar_send_sock, DataPacket{ "pwd@suite", "tester", ar_msg }).is_ok() )
+        return false;
+
+    DataPacket tm_in {};
+    return ar_receiver.recv(ar_recv_sock, tm_in).is_ok() && tm_in.m_msg == ar_msg;
+}
+
+/**
+ * @brief Check Pick
+ *
+ * Seçimin sırasını kontrol eder: iki tarafta da donanım ile
+ * çalışan yöntem öne geçer, yoksa yazılımda hızlı olan seçilir,
+ * ortakta AEAD varken doğrulamasız yöntem seçilmez, havuzda
+ * olmayan (nonce üretmeyen Xor) bit seçilmez
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_pick(Logger<Args...>& ar_logger)
+{
+    struct Case { suite_t m_common; suite_t m_accel; suite_t m_expect; };
+
+    const suite_t tm_simd = _SUITE_CHACHA20 | _SUITE_CHACHA20_POLY1305;
+    const suite_t tm_aesni = tm_simd | _SUITE_AES_CTR | _SUITE_AES_GCM;
+
+    const Case tm_cases[] = {
+        { _SUITE_AEAD, tm_aesni, _SUITE_AES_GCM },
+        { _SUITE_AEAD, tm_simd, _SUITE_CHACHA20_POLY1305 },
+        { _SUITE_AEAD, _SUITE_NULL, _SUITE_CHACHA20_POLY1305 },
+        { _SUITE_AES_GCM, tm_simd, _SUITE_AES_GCM },
+        { _SUITE_AES_GCM | _SUITE_CHACHA20, tm_aesni, _SUITE_AES_GCM },
+        { _SUITE_CHACHA20_POLY1305 | _SUITE_AES_CTR, tm_aesni, _SUITE_CHACHA20_POLY1305 },
+        { _SUITE_AES_CTR | _SUITE_CHACHA20, tm_aesni, _SUITE_AES_CTR },
+        { _SUITE_AES_CTR | _SUITE_CHACHA20, tm_simd, _SUITE_CHACHA20 },
+        { _SUITE_CHACHA20, _SUITE_NULL, _SUITE_CHACHA20 },
+        { static_cast<suite_t>(1 << 0), tm_aesni, _SUITE_NULL },
+        { _SUITE_NULL, tm_aesni, _SUITE_NULL }
+    };
+
+    bool tm_ok = true;
+    for(const Case& tm_case : tm_cases)
+    {
+        const suite_t tm_pick = pick_suite(tm_case.m_common, tm_case.m_accel);
+        const bool tm_pass = tm_pick == tm_case.m_expect;
+        tm_ok = tm_ok && tm_pass;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, "Common: " + suite_list(tm_case.m_common) + " | Accel: " + suite_list(tm_case.m_accel & tm_case.m_common)
+            + " | Pick: " + suite_name(tm_pick) + " | Result: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+    }
+
+    ar_logger.write(level_t::Info, "This Cpu Accel: " + suite_list(get_accel()), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Gcm Frame
+ *
+ * AES-GCM çerçeve arayüzü ile şifrelenen çerçevenin açıldığını,
+ * başlığı ya da verisi değişen çerçevenin reddedildiğini ve iki
+ * çerçevenin farklı nonce aldığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_gcm_frame(Logger<Args...>& ar_logger)
+{
+    AesGcm tm_cipher("gcm-frame", ss_key);
+
+    const std::string tm_text = "frame header|frame payload for aes-gcm";
+    const std::size_t tm_header = 12;
+
+    std::string tm_first = tm_text;
+    std::string tm_second = tm_text;
+    std::byte tm_trailer[2][AesGcm::_SIZE_SEAL] {};
+
+    const algorithm::Frame tm_frame_a { reinterpret_cast<std::byte*>(tm_first.data()), tm_header, tm_first.size() - tm_header };
+    const algorithm::Frame tm_frame_b { reinterpret_cast<std::byte*>(tm_second.data()), tm_header, tm_second.size() - tm_header };
+
+    const bool tm_sealed = tm_cipher.get_seal_size() == AesGcm::_SIZE_SEAL
+        && tm_cipher.seal(tm_frame_a, tm_trailer[0]) && tm_cipher.seal(tm_frame_b, tm_trailer[1]);
+    const bool tm_nonce = std::memcmp(tm_trailer[0], tm_trailer[1], AesGcm::_SIZE_NONCE) != 0 && tm_first != tm_second;
+
+    // HEADER IS AUTHENTICATED, NOT ENCRYPTED
+    std::string tm_header_bad = tm_first;
+    tm_header_bad[0] ^= 0x01;
+    const bool tm_header_reject = !tm_cipher.open(algorithm::Frame{ reinterpret_cast<std::byte*>(tm_header_bad.data()), tm_header, tm_header_bad.size() - tm_header }, tm_trailer[0]);
+
+    std::string tm_body_bad = tm_first;
+    tm_body_bad.back() ^= 0x01;
+    const bool tm_body_reject = !tm_cipher.open(algorithm::Frame{ reinterpret_cast<std::byte*>(tm_body_bad.data()), tm_header, tm_body_bad.size() - tm_header }, tm_trailer[0]);
+
+    const bool tm_opened = tm_cipher.open(tm_frame_a, tm_trailer[0]) && tm_first == tm_text;
+
+    const bool tm_ok = tm_sealed && tm_nonce && tm_header_reject && tm_body_reject && tm_opened;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("AES-GCM Frame | Seal/Open: ") + (tm_sealed && tm_opened ? "Passed" : "Failed")
+        + " | Nonce Per Frame: " + (tm_nonce ? "Passed" : "Failed")
+        + " | Header/Body Tamper Rejected: " + (tm_header_reject && tm_body_reject ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Stream
+ *
+ * Ortakta doğrulamalı yöntem olmayan iki uç akış yönteminde
+ * (ChaCha20, AES-CTR) anlaşır. Aynı mesaj iki kez gönderilir,
+ * çerçeveler kuyruktaki nonce ile farklı şifrelenir ve karşı
+ * uçta açılır. Xor sunan uç ile yöntem anlaşılmaz
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_stream(Logger<Args...>& ar_logger)
+{
+    const DataPacket tm_out { "pwd@suite", "tester", "same message on a stream suite" };
+
+    bool tm_ok = true;
+    for(const suite_t tm_suite : { _SUITE_CHACHA20, _SUITE_AES_CTR })
+    {
+        ChaCha20Poly1305 tm_server_cipher("stream-server", ss_key);
+        ChaCha20Poly1305 tm_client_cipher("stream-client", ss_key);
+
+        Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5117, ipv_t::ipv4, ss_flag);
+        Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5118, ipv_t::ipv4, ss_flag);
+
+        Link tm_link;
+        const bool tm_picked = tm_server.set_cipher_suite(tm_suite).is_ok() && tm_client.set_cipher_suite(tm_suite).is_ok()
+            && connect(tm_client, tm_server, tm_link)
+            && tm_client.get_session_suite(tm_link.m_pair[0]) == tm_suite && tm_server.get_session_suite(tm_link.m_pair[1]) == tm_suite;
+
+        // CAPTURE TWO FRAMES OF THE SAME MESSAGE, THEN FORWARD THEM
+        netpacket::buffer_t tm_plain {};
+        const std::size_t tm_len = netpacket::NetPacket::layout(tm_plain.data(), tm_plain.size(), tm_out.m_pwd, tm_out.m_name, tm_out.m_msg, netpacket::_FRAME_NULL)
+            + make_suite(tm_suite, "stream-size", ss_key)->get_seal_size();
+
+        std::string tm_wires[2];
+        bool tm_opened = tm_picked;
+        for(std::size_t tm_count = 0; tm_count < 2 && tm_opened; ++tm_count)
+        {
+            DataPacket tm_in {};
+            tm_opened = tm_client.send(tm_link.m_pair[0], tm_out).is_ok();
+            tm_wires[tm_count] = read_frame(tm_link.m_pair[1], tm_len);
+            tm_opened = tm_opened && tm_wires[tm_count].size() == tm_len && write_frame(tm_link.m_pair[0], tm_wires[tm_count])
+                && tm_server.recv(tm_link.m_pair[1], tm_in).is_ok() && tm_in.m_msg == tm_out.m_msg;
+        }
+
+        const bool tm_differ = tm_opened && tm_wires[0] != tm_wires[1];
+        const bool tm_pass = tm_picked && tm_opened && tm_differ;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, suite_name(tm_suite) + " Only | Picked: " + (tm_picked ? "Passed" : "Failed")
+            + " | Same Message, Frames Differ: " + (tm_differ ? "Passed" : "Failed") + " | Opened: " + (tm_opened ? "Passed" : "Failed"), GET_SOURCE);
+        disconnect(tm_client, tm_server, tm_link);
+
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // A PEER WHOSE OWN CIPHER IS XOR OFFERS ONLY THE AUTHENTICATED SUITES
+    Xor tm_xor_cipher("stream-xor", ss_key);
+    Socket tm_xor(tm_xor_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5119, ipv_t::ipv4, ss_flag);
+
+    const bool tm_no_xor = suite_of(tm_xor_cipher) == _SUITE_NULL && make_suite(static_cast<suite_t>(1 << 0), "stream-xor", ss_key) == nullptr
+        && get_suite_offer(tm_xor.get_feature()) == _SUITE_AEAD;
+
+    ar_logger.write(tm_no_xor ? level_t::Info : level_t::Err, std::string("Xor Not Offered | Result: ") + (tm_no_xor ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_no_xor;
+}
+
+/**
+ * @brief Check Negotiate
+ *
+ * Kendi şifreleyicisi ChaCha20-Poly1305 olan sunucu ile AES-GCM
+ * olan istemci iki tarafta da aynı yöntemi seçer ve iki yönde
+ * mesajlaşır. Anahtar değişiminden sonra yöntem korunur.
+ * İstemci sadece ChaCha20-Poly1305 sunarsa o seçilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_negotiate(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("suite-server", ss_key);
+    AesGcm tm_client_cipher("suite-client", ss_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5110, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5111, ipv_t::ipv4, ss_flag);
+
+    // SAME MACHINE, BOTH SIDES SHARE THE ACCEL MASK
+    const suite_t tm_expect = pick_suite(_SUITE_AEAD, get_accel());
+
+    Link tm_link;
+    bool tm_ok = connect(tm_client, tm_server, tm_link);
+
+    const suite_t tm_client_suite = tm_client.get_session_suite(tm_link.m_pair[0]);
+    const suite_t tm_server_suite = tm_server.get_session_suite(tm_link.m_pair[1]);
+    const bool tm_same = tm_ok && tm_client_suite == tm_expect && tm_server_suite == tm_expect;
+
+    const bool tm_talk = tm_same
+        && exchange(tm_client, tm_link.m_pair[0], tm_server, tm_link.m_pair[1], "client -> server")
+        && exchange(tm_server, tm_link.m_pair[1], tm_client, tm_link.m_pair[0], "server -> client");
+
+    ar_logger.write(tm_same && tm_talk ? level_t::Info : level_t::Err, "Own: ChaCha20-Poly1305 / AES-GCM | Client: " + suite_name(tm_client_suite)
+        + " | Server: " + suite_name(tm_server_suite) + " | Expected: " + suite_name(tm_expect)
+        + " | Exchange: " + (tm_talk ? "Passed" : "Failed"), GET_SOURCE);
+
+    // ROTATION KEEPS THE NEGOTIATED SUITE
+    const bool tm_rotate = tm_talk
+        && tm_server.rotate_key(ss_next_key).is_ok()
+        && exchange(tm_server, tm_link.m_pair[1], tm_client, tm_link.m_pair[0], "after rotate")
+        && exchange(tm_client, tm_link.m_pair[0], tm_server, tm_link.m_pair[1], "after rotate reply")
+        && tm_client.get_session_epoch(tm_link.m_pair[0]) == 1
+        && tm_client.get_session_suite(tm_link.m_pair[0]) == tm_expect;
+
+    ar_logger.write(tm_rotate ? level_t::Info : level_t::Err, std::string("Rotate Key | Suite Kept: ") + (tm_rotate ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_client, tm_server, tm_link);
+
+    // CLIENT NARROWS ITS OFFER, NEW KEY ON BOTH SIDES AFTER ROTATION
+    ChaCha20Poly1305 tm_narrow_cipher("suite-narrow", ss_next_key);
+    Socket tm_narrow(tm_narrow_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5112, ipv_t::ipv4, ss_flag);
+
+    const bool tm_set = tm_narrow.set_cipher_suite(_SUITE_CHACHA20_POLY1305).is_ok()
+        && tm_narrow.set_cipher_suite(_SUITE_NULL).get_code() == status::to_underlying(socket_code_t::cipher_suite_not_valid)
+        && tm_narrow.set_cipher_suite(static_cast<suite_t>(1 << 7)).get_code() == status::to_underlying(socket_code_t::cipher_suite_not_valid)
+        && tm_narrow.set_cipher_suite(static_cast<suite_t>(1 << 0)).get_code() == status::to_underlying(socket_code_t::cipher_suite_not_valid);
+
+    Link tm_narrow_link;
+    const bool tm_narrowed = tm_set && connect(tm_narrow, tm_server, tm_narrow_link)
+        && tm_narrow.get_session_suite(tm_narrow_link.m_pair[0]) == _SUITE_CHACHA20_POLY1305
+        && tm_server.get_session_suite(tm_narrow_link.m_pair[1]) == _SUITE_CHACHA20_POLY1305
+        && exchange(tm_narrow, tm_narrow_link.m_pair[0], tm_server, tm_narrow_link.m_pair[1], "narrow offer");
+
+    ar_logger.write(tm_narrowed ? level_t::Info : level_t::Err, std::string("Client Offers ChaCha20-Poly1305 Only | Picked: ") + (tm_narrowed ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_narrow, tm_server, tm_narrow_link);
+
+    return tm_same && tm_talk && tm_rotate && tm_narrowed;
+}
+
+/**
+ * @brief Check Legacy
+ *
+ * Yöntem sunmayan uç ile iki taraf da kendi şifreleyicisine
+ * döner. Farklı sürümden uç el sıkışmada kesilmez, daha yeni
+ * sürümleri de sunan uç ile ortak sürüme inilir. Karşı taraf
+ * sadece bilinmeyen bir çerçeve sürümü sunarsa oturum
+ * frame_version_not_match ile açılmaz, magic tutmazsa el
+ * sıkışma reddedilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_legacy(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("legacy-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("legacy-client", ss_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5113, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5114, ipv_t::ipv4, _FLAG_SOCKET_SESSION_KEY);
+
+    Link tm_link;
+    const bool tm_legacy = connect(tm_client, tm_server, tm_link)
+        && get_suite_offer(tm_client.get_feature()) == _SUITE_NULL
+        && tm_client.get_session_suite(tm_link.m_pair[0]) == _SUITE_NULL
+        && tm_server.get_session_suite(tm_link.m_pair[1]) == _SUITE_NULL
+        && exchange(tm_client, tm_link.m_pair[0], tm_server, tm_link.m_pair[1], "legacy peer")
+        && exchange(tm_server, tm_link.m_pair[1], tm_client, tm_link.m_pair[0], "legacy reply");
+
+    ar_logger.write(tm_legacy ? level_t::Info : level_t::Err, std::string("Peer Without Suites | Own Cipher Used: ") + (tm_legacy ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_client, tm_server, tm_link);
+
+    // PRE-CAPABILITY PEER HAS NO FRAME BITS, A FUTURE-ONLY PEER SHARES NONE
+    const flag::flag_t tm_future = flag::flag_t{1} << (_POS_FEATURE_FRAME + 1);
+
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    const bool tm_old = get_frame_version(_FEATURE_NULL) == 0 && tm_server.open_session(tm_pair[0], _FEATURE_NULL).is_ok();
+    const bool tm_reject = tm_server.open_session(tm_pair[1], tm_future).get_code() == status::to_underlying(socket_code_t::frame_version_not_match)
+        && tm_server.get_session_feature(tm_pair[1]) == _FEATURE_NULL
+        && get_frame_version(tm_future) == 2 && get_frame_version(tm_server.get_feature()) == _VERSION_FRAME;
+
+    // A NEWER PEER ALSO OFFERING THIS VERSION NEGOTIATES DOWN
+    int tm_down_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_down_pair) != 0 )
+        return false;
+
+    const bool tm_down = tm_server.open_session(tm_down_pair[0], tm_server.get_feature() | tm_future).is_ok()
+        && get_frame_version(tm_server.get_session_feature(tm_down_pair[0])) == _VERSION_FRAME;
+
+    // THE MAGIC ONLY COVERS THE RECORD, A FUTURE-ONLY OFFER STILL PASSES THE HANDSHAKE
+    flag::flag_t tm_seen = _FEATURE_NULL;
+    random_t tm_random {};
+    bool tm_magic = Socket::make_random(tm_random).is_ok()
+        && Socket::handshake_send_verify(tm_down_pair[1], tm_future, tm_random).is_ok()
+        && Socket::handshake_recv_verify(tm_down_pair[0], tm_seen, false).is_ok() && tm_seen == tm_future;
+
+    char tm_record[ss_hash_hex_size + ss_feature_size + ss_random_size] {};
+    std::memcpy(tm_record, "not-the-magic-00", ss_hash_hex_size);
+    tm_magic = tm_magic && ::send(tm_down_pair[1], tm_record, sizeof(tm_record), 0) == static_cast<ssize_t>(sizeof(tm_record))
+        && Socket::handshake_recv_verify(tm_down_pair[0], tm_seen, false).get_code() == status::to_underlying(socket_code_t::socket_hash_not_match);
+
+    ar_logger.write(tm_old && tm_reject ? level_t::Info : level_t::Err, std::string("Frame Version | Pre-Capability Peer: ") + (tm_old ? "Passed" : "Failed")
+        + " | No Common Version Rejected: " + (tm_reject ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_down && tm_magic ? level_t::Info : level_t::Err, std::string("Frame Version | Newer Peer Negotiated Down: ") + (tm_down ? "Passed" : "Failed")
+        + " | Magic Only Handshake: " + (tm_magic ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_server.close_session(tm_pair[0]);
+    tm_server.close_session(tm_down_pair[0]);
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+    Socket::close_socket(tm_down_pair[0]);
+    Socket::close_socket(tm_down_pair[1]);
+
+    return tm_legacy && tm_old && tm_reject && tm_down && tm_magic;
+}
+
+/**
+ * @brief Check Downgrade
+ *
+ * Aradaki biri iki tarafın açık giden kayıtlarından AEAD
+ * tekliflerini silerse iki uç da aynı doğrulamasız yöntemi
+ * seçer, ama kayıt özetleri farklı olduğundan yöntem anahtarları
+ * tutmaz ve mesaj karşıda açılmaz. Değiştirilmemiş kayıtlar
+ * ile AEAD seçilir ve mesajlaşılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_downgrade(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("downgrade-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("downgrade-client", ss_key);
+
+    // NO SESSION KEY, THE SUITE KEY ALONE MUST CARRY THE BINDING
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5122, ipv_t::ipv4, _FLAG_SOCKET_CIPHER_SUITE);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5123, ipv_t::ipv4, _FLAG_SOCKET_CIPHER_SUITE);
+
+    if( !tm_server.set_cipher_suite(_SUITE_ALL).is_ok() || !tm_client.set_cipher_suite(_SUITE_ALL).is_ok() )
+        return false;
+
+    Hello tm_client_hello { tm_client.get_feature(), {} };
+    Hello tm_server_hello { tm_server.get_feature(), {} };
+    if( !Socket::make_random(tm_client_hello.m_random).is_ok() || !Socket::make_random(tm_server_hello.m_random).is_ok() )
+        return false;
+
+    // UNTOUCHED RECORDS
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    const bool tm_clean = tm_client.open_session(tm_pair[0], tm_client_hello, tm_server_hello).is_ok()
+        && tm_server.open_session(tm_pair[1], tm_client_hello, tm_server_hello).is_ok()
+        && (tm_client.get_session_suite(tm_pair[0]) & _SUITE_AEAD)
+        && exchange(tm_client, tm_pair[0], tm_server, tm_pair[1], "clean records");
+
+    tm_client.close_session(tm_pair[0]);
+    tm_server.close_session(tm_pair[1]);
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    // EACH SIDE SEES THE OTHER'S RECORD WITHOUT THE AEAD OFFERS
+    const flag::flag_t tm_strip = ~(static_cast<flag::flag_t>(_SUITE_AEAD) << _POS_FEATURE_SUITE);
+
+    Hello tm_seen_client = tm_client_hello;
+    Hello tm_seen_server = tm_server_hello;
+    tm_seen_client.m_feature &= tm_strip;
+    tm_seen_server.m_feature &= tm_strip;
+
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    const bool tm_opened = tm_client.open_session(tm_pair[0], tm_client_hello, tm_seen_server).is_ok()
+        && tm_server.open_session(tm_pair[1], tm_seen_client, tm_server_hello).is_ok();
+
+    const suite_t tm_suite = tm_client.get_session_suite(tm_pair[0]);
+    const bool tm_stripped = tm_opened && tm_suite != _SUITE_NULL && !(tm_suite & _SUITE_AEAD)
+        && tm_server.get_session_suite(tm_pair[1]) == tm_suite;
+
+    const bool tm_refused = tm_stripped && !exchange(tm_client, tm_pair[0], tm_server, tm_pair[1], "stripped records");
+
+    ar_logger.write(tm_clean && tm_refused ? level_t::Info : level_t::Err, std::string("Clean Records | AEAD Exchange: ") + (tm_clean ? "Passed" : "Failed")
+        + " | Stripped Offers: " + suite_name(tm_suite) + " | Keys Differ: " + (tm_refused ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_client.close_session(tm_pair[0]);
+    tm_server.close_session(tm_pair[1]);
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    return tm_clean && tm_refused;
+}
+
+/**
+ * @brief Bench
+ *
+ * Her yöntem için önce çerçeve şifreleme hızı, sonra iki ucun
+ * da sadece o yöntemi sunduğu bağlantı üzerinden gönderme ve
+ * alma hızı ölçülür. Anlaşma ile seçilen yöntemin çerçeve hızı
+ * en hızlı olana yakın olmalıdır, soket hızı bilgi içindir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool bench(Logger<Args...>& ar_logger)
+{
+    const std::string tm_msg(netpacket::_SIZE_MESSAGE, 'k');
+    const suite_t tm_suites[] = { _SUITE_AES_GCM, _SUITE_CHACHA20_POLY1305 };
+    const suite_t tm_pick = pick_suite(_SUITE_AEAD, get_accel());
+
+    bool tm_ok = true;
+    double tm_best = 0.0;
+    double tm_picked = 0.0;
+
+    for(const suite_t tm_suite : tm_suites)
+    {
+        ChaCha20Poly1305 tm_server_cipher("bench-server", ss_key);
+        ChaCha20Poly1305 tm_client_cipher("bench-client", ss_key);
+
+        Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5115, ipv_t::ipv4, ss_flag);
+        Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "cipher-suite", "pwd@suite", 5116, ipv_t::ipv4, ss_flag);
+
+        Link tm_link;
+        tm_ok = tm_server.set_cipher_suite(tm_suite).is_ok() && tm_client.set_cipher_suite(tm_suite).is_ok()
+            && connect(tm_client, tm_server, tm_link)
+            && tm_client.get_session_suite(tm_link.m_pair[0]) == tm_suite && tm_ok;
+
+        // CIPHER ONLY: SEAL WHOLE FRAMES
+        auto tm_cipher = make_suite(tm_suite, "bench-seal", ss_key);
+        netpacket::buffer_t tm_frame {};
+        std::byte tm_trailer[netpacket::_SIZE_SEAL] {};
+
+        const auto tm_seal_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_count = 0; tm_count < ss_bench_count && tm_ok; ++tm_count)
+            tm_ok = tm_cipher->seal(algorithm::Frame{ tm_frame.data(), netpacket::_SIZE_HEADER, tm_msg.size() }, tm_trailer);
+        const double tm_seal_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_seal_start).count();
+
+        // SOCKET: SEND AND RECEIVE OVER THE NEGOTIATED SESSION
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_count = 0; tm_count < ss_bench_count && tm_ok; ++tm_count)
+            tm_ok = exchange(tm_client, tm_link.m_pair[0], tm_server, tm_link.m_pair[1], tm_msg);
+        const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+        const double tm_total = (static_cast<double>(ss_bench_count) * tm_msg.size()) / (1024.0 * 1024.0);
+        const double tm_seal_mbps = tm_total / tm_seal_sec;
+        const double tm_mbps = tm_total / tm_sec;
+
+        tm_best = std::max(tm_best, tm_seal_mbps);
+        if( tm_suite == tm_pick )
+            tm_picked = tm_seal_mbps;
+
+        std::ostringstream tm_line;
+        tm_line << std::fixed << std::setprecision(1)
+            << suite_name(tm_suite) << " | " << ss_bench_count << " x " << tm_msg.size() << " Byte | Seal: "
+            << tm_seal_mbps << " MB/s | Socket: " << tm_mbps << " MB/s" << (tm_suite == tm_pick ? " | Negotiated" : "");
+
+        ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_line.str(), GET_SOURCE);
+        disconnect(tm_client, tm_server, tm_link);
+    }
+
+    // ALLOW NOISE BETWEEN CLOSE SUITES
+    const bool tm_fast = tm_picked >= tm_best * 0.8;
+    ar_logger.write(tm_ok && tm_fast ? level_t::Info : level_t::Err, "Negotiated: " + suite_name(tm_pick) + " | Fastest Or Close: " + (tm_fast ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_fast;
+}
+
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_pick(vv_testlog);
+    vv_ok = check_gcm_frame(vv_testlog) && vv_ok;
+    vv_ok = check_stream(vv_testlog) && vv_ok;
+    vv_ok = check_negotiate(vv_testlog) && vv_ok;
+    vv_ok = check_legacy(vv_testlog) && vv_ok;
+    vv_ok = check_downgrade(vv_testlog) && vv_ok;
+    vv_ok = bench(vv_testlog) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
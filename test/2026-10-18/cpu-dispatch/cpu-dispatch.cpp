@@ -0,0 +1,404 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Cpu Dispatch (İşlemci Özellik Seçimi)
+ *
+ * İşlemci özelliklerinin bir kez sorgulandığını, seviye
+ * maskelerinin birbirini kapsadığını ve sürüm tablolarının
+ * yapay özellik kümelerinde beklenen çekirdeği seçtiğini
+ * kontrol edeceğiz. Her çekirdeğin seçimi merkezi tablo ile
+ * karşılaştırılır. KRIPTON_CPU_LEVEL ortam değişkeni ile
+ * başlatılan alt süreçlerde seviyenin sınırlandığı, geçersiz
+ * ismin varsayılan seviyeye düştüğü denenir. Her seviye için
+ * Xor ve CRC32C hızları (GB/s) ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cpu-dispatch.cpp -pthread -o bsd/cpu-dispatch.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 cpu-dispatch.cpp -pthread -o linux/cpu-dispatch.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/cpu-dispatch.bsd
+ *  Linux   :: ./linux/cpu-dispatch.linux
+ *
+ * Not: Alt süreç için posix popen arayüzü kullanıldığından
+ *  Windows üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <cipher/xor/xorkernel.hpp>
+#include <cipher/chacha20/chachakernel.hpp>
+#include <cipher/poly1305/polykernel.hpp>
+#include <cipher/aes/aeskernel.hpp>
+#include <cipher/aes/ghashkernel.hpp>
+#include <tools/hash/crc32c.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+namespace xorkernel = cipher::stream::xorkernel;
+namespace chachakernel = cipher::stream::chachakernel;
+namespace polykernel = cipher::mac::polykernel;
+namespace aeskernel = cipher::block::aeskernel;
+namespace ghashkernel = cipher::block::ghashkernel;
+namespace crc32c = tools::hash::crc32c;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "cpu-dispatch-" + ss_osname;
+
+static constexpr const char* ss_child = "child";
+
+// Struct
+struct Report
+{
+    std::map<std::string, std::string> m_values;
+
+    int get_int(const std::string& ar_key) const
+    {
+        const auto tm_iter = m_values.find(ar_key);
+        return tm_iter == m_values.end() ? -1 : std::atoi(tm_iter->second.c_str());
+    }
+
+    double get_double(const std::string& ar_key) const
+    {
+        const auto tm_iter = m_values.find(ar_key);
+        return tm_iter == m_values.end() ? 0.0 : std::atof(tm_iter->second.c_str());
+    }
+};
+
+/**
+ * @brief Feature Text
+ *
+ * @param cpu_t Cpu
+ * @return string
+ */
+std::string feature_text(const cpu_t ar_cpu)
+{
+    static constexpr std::pair<cpu_t, const char*> ss_names[] = {
+        { _CPU_SSE2, "sse2" }, { _CPU_SSSE3, "ssse3" }, { _CPU_SSE41, "sse4.1" },
+        { _CPU_SSE42, "sse4.2" }, { _CPU_AVX2, "avx2" }, { _CPU_AVX512F, "avx512f" },
+        { _CPU_AVX512BW, "avx512bw" }, { _CPU_AES, "aes" }, { _CPU_PCLMUL, "pclmul" },
+        { _CPU_SHA, "sha" }
+    };
+
+    std::string tm_text;
+    for(const auto& [tm_flag, tm_name] : ss_names)
+        if( ar_cpu & tm_flag )
+            tm_text += (tm_text.empty() ? "" : " ") + std::string(tm_name);
+
+    return tm_text.empty() ? "none" : tm_text;
+}
+
+/**
+ * @brief Bench Gbps
+ *
+ * Verilen işlemi 64 KB tampon üzerinde tekrar ederek
+ * saniyedeki gigabayt miktarını döndürür
+ *
+ * @tparam Func Function
+ * @param Func Function
+ * @return double
+ */
+template<class Func>
+double bench_gbps(Func&& ar_func)
+{
+    static constexpr std::size_t ss_size = 64 * 1024;
+    static constexpr std::size_t ss_rounds = 4096;
+
+    std::vector<unsigned char> tm_data(ss_size, 0x5A);
+    std::vector<unsigned char> tm_stream(ss_size, 0xA5);
+
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+        ar_func(tm_data.data(), tm_stream.data(), ss_size);
+    const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    return static_cast<double>(ss_rounds * ss_size) / tm_sec / 1e9;
+}
+
+/**
+ * @brief Run Child
+ *
+ * Alt süreç olarak çalışır; etkin seviyeyi, her çekirdeğin
+ * seçimini ve hızları tek satırda standart çıktıya yazar
+ *
+ * @return int
+ */
+int run_child()
+{
+    crc32c::crc_t tm_crc = 0;
+
+    const double tm_xor = bench_gbps([](unsigned char* ar_data, const unsigned char* ar_stream, const std::size_t ar_len) {
+        xorkernel::apply(ar_data, ar_stream, ar_len);
+    });
+
+    const double tm_crc32c = bench_gbps([&tm_crc](unsigned char* ar_data, const unsigned char*, const std::size_t ar_len) {
+        tm_crc = crc32c::crc32c(ar_data, ar_len, tm_crc);
+    });
+
+    std::printf("level=%s cpu=%u xor=%d chacha=%d poly=%d aes=%d ghash=%d crc=%d xorgbs=%.2f crcgbs=%.2f check=%u\n",
+        cpu_level_name(get_cpu_level()), static_cast<unsigned>(get_cpu()),
+        static_cast<int>(xorkernel::get_kernel()), static_cast<int>(chachakernel::get_kernel()),
+        static_cast<int>(polykernel::get_kernel()), static_cast<int>(aeskernel::get_kernel()),
+        static_cast<int>(ghashkernel::get_kernel()), static_cast<int>(crc32c::get_kernel()),
+        tm_xor, tm_crc32c, static_cast<unsigned>(tm_crc));
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Spawn Child
+ *
+ * Ortam değişkeni ile sınırlanmış alt süreç başlatıp
+ * çıktısını anahtar ve değer çiftlerine ayırır
+ *
+ * @param string Self
+ * @param string Level
+ * @return Report
+ */
+Report spawn_child(const std::string& ar_self, const std::string& ar_level)
+{
+    const std::string tm_command = std::string(ss_cpu_env) + "=" + ar_level + " " + ar_self + " " + ss_child;
+
+    Report tm_report;
+    FILE* tm_pipe = ::popen(tm_command.c_str(), "r");
+    if( tm_pipe == nullptr )
+        return tm_report;
+
+    char tm_line[512] {};
+    std::string tm_output;
+    while( std::fgets(tm_line, sizeof(tm_line), tm_pipe) != nullptr )
+        tm_output += tm_line;
+    ::pclose(tm_pipe);
+
+    std::istringstream tm_stream(tm_output);
+    std::string tm_pair;
+    while( tm_stream >> tm_pair )
+    {
+        const std::size_t tm_pos = tm_pair.find('=');
+        if( tm_pos != std::string::npos )
+            tm_report.m_values[tm_pair.substr(0, tm_pos)] = tm_pair.substr(tm_pos + 1);
+    }
+
+    return tm_report;
+}
+
+/**
+ * @brief Check Level
+ *
+ * Her seviyenin maskesinin bir önceki seviyeyi kapsadığını,
+ * isimlerin seviyeye geri çevrildiğini ve geçersiz ismin
+ * varsayılan seviyeye düştüğünü kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_level(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    for(int tm_level = static_cast<int>(CpuLevel::Scalar); tm_level < static_cast<int>(CpuLevel::Native); ++tm_level)
+    {
+        const cpu_t tm_low = cpu_level_mask(static_cast<CpuLevel>(tm_level));
+        const cpu_t tm_high = cpu_level_mask(static_cast<CpuLevel>(tm_level + 1));
+        tm_ok = tm_ok && (tm_low & tm_high) == tm_low && tm_low != tm_high;
+    }
+
+    for(int tm_level = static_cast<int>(CpuLevel::Scalar); tm_level <= static_cast<int>(CpuLevel::Native); ++tm_level)
+        tm_ok = tm_ok && to_cpu_level(cpu_level_name(static_cast<CpuLevel>(tm_level)), CpuLevel::Scalar) == static_cast<CpuLevel>(tm_level);
+
+    tm_ok = tm_ok && to_cpu_level("bogus", CpuLevel::Sse2) == CpuLevel::Sse2;
+    tm_ok = tm_ok && to_cpu_level("", CpuLevel::Avx2) == CpuLevel::Avx2;
+    tm_ok = tm_ok && to_cpu_level(nullptr) == CpuLevel::Native;
+    tm_ok = tm_ok && cpu_level_mask(CpuLevel::Scalar) == _CPU_NULL;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Level Mask And Name: ") + (tm_ok ? "Ok" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Select
+ *
+ * Sürüm tablolarının yapay özellik kümelerinde en iyi
+ * çalışabilen sürümü seçtiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_select(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    tm_ok = tm_ok && select_variant(xorkernel::ss_variants, _CPU_NULL) == xorkernel::kernel_t::scalar;
+    tm_ok = tm_ok && select_variant(xorkernel::ss_variants, _CPU_SSE2) == xorkernel::kernel_t::sse2;
+    tm_ok = tm_ok && select_variant(xorkernel::ss_variants, _CPU_SSE2 | _CPU_AVX2) == xorkernel::kernel_t::avx2;
+    tm_ok = tm_ok && select_variant(xorkernel::ss_variants, _CPU_SSE2 | _CPU_AVX2 | _CPU_AVX512F) == xorkernel::kernel_t::avx2;
+    tm_ok = tm_ok && select_variant(xorkernel::ss_variants, cpu_level_mask(CpuLevel::Avx512)) == xorkernel::kernel_t::avx512;
+
+    tm_ok = tm_ok && select_variant(aeskernel::ss_variants, _CPU_AES) == aeskernel::kernel_t::portable;
+    tm_ok = tm_ok && select_variant(aeskernel::ss_variants, cpu_level_mask(CpuLevel::Sse42)) == aeskernel::kernel_t::aesni;
+    tm_ok = tm_ok && select_variant(ghashkernel::ss_variants, cpu_level_mask(CpuLevel::Sse41)) == ghashkernel::kernel_t::portable;
+
+    tm_ok = tm_ok && select_variant(crc32c::ss_variants, _CPU_PCLMUL) == crc32c::kernel_t::table;
+    tm_ok = tm_ok && select_variant(crc32c::ss_variants, _CPU_SSE42) == crc32c::kernel_t::sse42;
+    tm_ok = tm_ok && select_variant(crc32c::ss_variants, _CPU_SSE42 | _CPU_PCLMUL) == crc32c::kernel_t::sse42_pclmul;
+
+    tm_ok = tm_ok && select_variant(chachakernel::ss_variants, cpu_level_mask(CpuLevel::Sse42)) == chachakernel::kernel_t::sse2;
+    tm_ok = tm_ok && select_variant(polykernel::ss_variants, cpu_level_mask(CpuLevel::Sse42)) == polykernel::kernel_t::scalar;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Synthetic Select: ") + (tm_ok ? "Ok" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Bind
+ *
+ * Her çekirdeğin kullandığı sürümün merkezi tablodan seçilen
+ * sürüm olduğunu ve destek sorgusunun özellik kümesi ile
+ * uyuştuğunu kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_bind(Logger<Args...>& ar_logger)
+{
+    const cpu_t tm_cpu = get_cpu();
+    bool tm_ok = true;
+
+    tm_ok = tm_ok && xorkernel::get_kernel() == select_variant(xorkernel::ss_variants, tm_cpu);
+    tm_ok = tm_ok && chachakernel::get_kernel() == select_variant(chachakernel::ss_variants, tm_cpu);
+    tm_ok = tm_ok && polykernel::get_kernel() == select_variant(polykernel::ss_variants, tm_cpu);
+    tm_ok = tm_ok && aeskernel::get_kernel() == select_variant(aeskernel::ss_variants, tm_cpu);
+    tm_ok = tm_ok && ghashkernel::get_kernel() == select_variant(ghashkernel::ss_variants, tm_cpu);
+    tm_ok = tm_ok && crc32c::get_kernel() == select_variant(crc32c::ss_variants, tm_cpu);
+
+    for(const auto& tm_variant : xorkernel::ss_variants)
+        tm_ok = tm_ok && xorkernel::is_supported(tm_variant.m_value) == ((tm_cpu & tm_variant.m_require) == tm_variant.m_require);
+
+    for(const auto& tm_variant : aeskernel::ss_variants)
+        tm_ok = tm_ok && aeskernel::is_supported(tm_variant.m_value) == has_cpu(tm_variant.m_require);
+
+    tm_ok = tm_ok && (detect_cpu() & tm_cpu) == tm_cpu;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Kernel Bind: ") + (tm_ok ? "Ok" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Env
+ *
+ * Her seviye ismi ve geçersiz bir isim ile alt süreç
+ * başlatır. Alt sürecin seçtiği çekirdeklerin algılanan
+ * özelliklerin seviye maskesi ile kesişiminden seçilmesi
+ * gereken sürümler olduğu kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string Self
+ * @return bool
+ */
+template<class... Args>
+bool check_env(Logger<Args...>& ar_logger, const std::string& ar_self)
+{
+    bool tm_ok = true;
+
+    std::vector<std::string> tm_names(std::begin(ss_cpu_level_names), std::end(ss_cpu_level_names));
+    tm_names.push_back("bogus");
+
+    for(const std::string& tm_name : tm_names)
+    {
+        const Report tm_report = spawn_child(ar_self, tm_name);
+        const CpuLevel tm_level = to_cpu_level(tm_name.c_str(), cpu_build_level);
+        const cpu_t tm_cpu = detect_cpu() & cpu_level_mask(tm_level);
+
+        bool tm_match = tm_report.m_values.count("level") && tm_report.m_values.at("level") == cpu_level_name(tm_level);
+        tm_match = tm_match && static_cast<cpu_t>(tm_report.get_int("cpu")) == tm_cpu;
+        tm_match = tm_match && tm_report.get_int("xor") == static_cast<int>(select_variant(xorkernel::ss_variants, tm_cpu));
+        tm_match = tm_match && tm_report.get_int("chacha") == static_cast<int>(select_variant(chachakernel::ss_variants, tm_cpu));
+        tm_match = tm_match && tm_report.get_int("poly") == static_cast<int>(select_variant(polykernel::ss_variants, tm_cpu));
+        tm_match = tm_match && tm_report.get_int("aes") == static_cast<int>(select_variant(aeskernel::ss_variants, tm_cpu));
+        tm_match = tm_match && tm_report.get_int("ghash") == static_cast<int>(select_variant(ghashkernel::ss_variants, tm_cpu));
+        tm_match = tm_match && tm_report.get_int("crc") == static_cast<int>(select_variant(crc32c::ss_variants, tm_cpu));
+
+        std::stringstream tm_sstream;
+        tm_sstream << "Env: " << std::left << std::setw(7) << tm_name << " | Level: " << std::setw(7) << cpu_level_name(tm_level)
+                   << " | Xor: " << tm_report.get_int("xor") << " | ChaCha20: " << tm_report.get_int("chacha")
+                   << " | Poly1305: " << tm_report.get_int("poly") << " | Aes: " << tm_report.get_int("aes")
+                   << " | Ghash: " << tm_report.get_int("ghash") << " | Crc32c: " << tm_report.get_int("crc")
+                   << " | " << (tm_match ? "Ok" : "Failed");
+
+        ar_logger.write(tm_match ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+        tm_ok = tm_ok && tm_match;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Seviyesi sınırlanmış alt süreçlerde Xor ve CRC32C
+ * hızlarını ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string Self
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::string& ar_self)
+{
+    for(const char* tm_name : { "scalar", "sse2", "sse42", "avx2", "native" })
+    {
+        const Report tm_report = spawn_child(ar_self, tm_name);
+
+        std::stringstream tm_sstream;
+        tm_sstream << std::fixed << std::setprecision(2) << "Level: " << std::left << std::setw(7) << tm_name
+                   << " | Xor: " << std::right << std::setw(6) << tm_report.get_double("xorgbs") << " GB/s"
+                   << " | Crc32c: " << std::setw(6) << tm_report.get_double("crcgbs") << " GB/s";
+
+        ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+    }
+}
+
+// main
+int main(int argc, char** argv)
+{
+    if( argc > 1 && std::string(argv[1]) == ss_child )
+        return run_child();
+
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Detected: " + feature_text(detect_cpu()), GET_SOURCE);
+    vv_testlog.write(level_t::Info, std::string("Level: ") + cpu_level_name(get_cpu_level()) + " | Usable: " + feature_text(get_cpu()), GET_SOURCE);
+
+    bool vv_ok = check_level(vv_testlog);
+    vv_ok = check_select(vv_testlog) && vv_ok;
+    vv_ok = check_bind(vv_testlog) && vv_ok;
+    vv_ok = check_env(vv_testlog, argv[0]) && vv_ok;
+
+    bench(vv_testlog, argv[0]);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
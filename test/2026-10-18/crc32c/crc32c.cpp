@@ -0,0 +1,254 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Crc32c (Castagnoli Döngüsel Artıklık Denetimi)
+ *
+ * Çerçeve sonuna eklenen CRC32C değerinin doğruluğunu RFC 3720
+ * test vektörleri ile kontrol edeceğiz. Donanımsal yol ile tablo
+ * yolunun farklı uzunluk ve hizalamalarda aynı sonucu verdiği,
+ * parçalı hesaplamanın tek seferde hesaplama ile eşit olduğu
+ * doğrulanır. Bayt başına geçen süre (ns/bayt) ölçülür. Posix
+ * sistemlerde bozulmuş çerçevenin çözmeden önce reddedildiği de
+ * kontrol edilir
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 crc32c.cpp -pthread -o bsd/crc32c.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 crc32c.cpp -pthread -o linux/crc32c.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 crc32c.cpp -o windows/crc32c.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/crc32c.bsd
+ *  Linux   :: ./linux/crc32c.linux
+ *  Windows :: ./windows/crc32c.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+#include <kits/hashkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+using namespace dev::test;
+
+using namespace tools::charset;
+using namespace tools::hash;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "crc32c-" + ss_osname;
+
+/**
+ * @brief Kernel Name
+ *
+ * @param kernel_t Kernel
+ * @return const char*
+ */
+const char* kernel_name(const crc32c::kernel_t ar_kernel)
+{
+    switch( ar_kernel )
+    {
+        case crc32c::kernel_t::sse42_pclmul: return "SSE4.2 + PCLMUL";
+        case crc32c::kernel_t::sse42: return "SSE4.2";
+        case crc32c::kernel_t::table:
+        default:
+            return "Table";
+    }
+}
+
+/**
+ * @brief Check Vectors
+ *
+ * RFC 3720 (B.4) test vektörleri
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_vectors(Logger<Args...>& ar_logger)
+{
+    unsigned char tm_zero[32] {};
+    unsigned char tm_ones[32];
+    unsigned char tm_inc[32];
+    unsigned char tm_dec[32];
+
+    for(uint8_t tm_count = 0; tm_count < 32; ++tm_count)
+    {
+        tm_ones[tm_count] = 0xFF;
+        tm_inc[tm_count] = tm_count;
+        tm_dec[tm_count] = static_cast<unsigned char>(31 - tm_count);
+    }
+
+    const bool tm_ok =
+        expect_eq(crc32c::crc32c("123456789", 9), 0xE3069283u)
+        && expect_eq(crc32c::crc32c(tm_zero, sizeof(tm_zero)), 0x8A9136AAu)
+        && expect_eq(crc32c::crc32c(tm_ones, sizeof(tm_ones)), 0x62A8AB43u)
+        && expect_eq(crc32c::crc32c(tm_inc, sizeof(tm_inc)), 0x46DD794Eu)
+        && expect_eq(crc32c::crc32c(tm_dec, sizeof(tm_dec)), 0x113FDB5Cu)
+        && expect_eq(crc32c::crc32c_table("123456789", 9), 0xE3069283u);
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("RFC 3720 Vectors: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Kernels
+ *
+ * Seçilen yol ile tablo yolunu rastgele uzunluk ve
+ * hizalamalarda karşılaştırır, parçalı hesaplamayı da dener
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_kernels(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(20261018);
+    std::vector<unsigned char> tm_data(16384 + 64);
+    for(auto& tm_byte : tm_data)
+        tm_byte = static_cast<unsigned char>(tm_rng());
+
+    uint32_t tm_failed = 0;
+    for(uint32_t tm_round = 0; tm_round < 4000; ++tm_round)
+    {
+        const std::size_t tm_off = tm_rng() % 64;
+        const std::size_t tm_len = tm_rng() % 16384;
+        const std::size_t tm_cut = tm_len ? tm_rng() % tm_len : 0;
+
+        const unsigned char* tm_ptr = tm_data.data() + tm_off;
+        const crc32c::crc_t tm_fast = crc32c::crc32c(tm_ptr, tm_len);
+        const crc32c::crc_t tm_slow = crc32c::crc32c_table(tm_ptr, tm_len);
+        const crc32c::crc_t tm_part = crc32c::crc32c(tm_ptr + tm_cut, tm_len - tm_cut, crc32c::crc32c(tm_ptr, tm_cut));
+
+        if( tm_fast != tm_slow || tm_fast != tm_part )
+            ++tm_failed;
+    }
+
+    ar_logger.write(tm_failed ? level_t::Err : level_t::Info, "Kernel Compare Failed: " + std::to_string(tm_failed) + "/4000", GET_SOURCE);
+    return tm_failed == 0;
+}
+
+/**
+ * @brief Bench
+ *
+ * Verilen boyuttaki veri üzerinde bayt başına süreyi ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Title
+ * @param size_t Size
+ * @param bool Table
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::string& ar_title, const std::size_t ar_size, const bool ar_table)
+{
+    std::vector<unsigned char> tm_data(ar_size, 0x5A);
+    const std::size_t tm_rounds = (std::size_t{ 256 } << 20) / ar_size;
+
+    crc32c::crc_t tm_crc = 0;
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+        tm_crc ^= ar_table ? crc32c::crc32c_table(tm_data.data(), ar_size, tm_crc) : crc32c::crc32c(tm_data.data(), ar_size, tm_crc);
+    const double tm_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count();
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(4)
+        << ar_title << " | Size: " << ar_size << " B"
+        << " | " << tm_ns / static_cast<double>(tm_rounds * ar_size) << " ns/byte"
+        << " | Check: " << std::hex << tm_crc;
+
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+#if __OS_POSIX__
+/**
+ * @brief Pipeline Check
+ *
+ * Anlaşılmış oturumda sağlam çerçeve alınır, tek baytı
+ * bozulmuş çerçeve ise çözmeden önce reddedilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool pipeline_check(Logger<Args...>& ar_logger)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    Xor tm_cipher("crc-cipher", utf::to_utf8(U"key-crc@20261018"));
+    Socket tm_socket(tm_cipher, "logs/socket-" + ss_logname, "crc32c", "pwd@crc", 5070, ipv_t::ipv4, _FLAG_SOCKET_CRC);
+
+    tm_socket.open_session(tm_pair[0], _FEATURE_CRC);
+    tm_socket.open_session(tm_pair[1], _FEATURE_CRC);
+
+    // VALID FRAME
+    DataPacket tm_out { "", "tester", "crc protected message" };
+    DataPacket tm_in;
+
+    const Status tm_send = tm_socket.send(tm_pair[0], tm_out);
+    const Status tm_recv = tm_socket.recv(tm_pair[1], tm_in);
+
+    // CORRUPTED FRAME
+    netpacket::NetPacket tm_packet("", "tester", "crc protected message", netpacket::_FRAME_CRC);
+    std::vector<std::byte> tm_raw = tm_packet.get();
+    tm_raw[netpacket::_SIZE_HEADER + 3] ^= std::byte{ 0x01 };
+
+    const Status tm_raw_send = Socket::send_all(tm_pair[0], tm_raw.data(), tm_raw.size());
+    const Status tm_raw_recv = tm_socket.recv(tm_pair[1], tm_in);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    const bool tm_ok = tm_send.is_ok() && tm_recv.is_ok() && tm_in.m_msg == tm_out.m_msg
+        && tm_raw_send.is_ok() && tm_raw_recv.get_code() == status::to_underlying(socket_code_t::packet_crc_mismatch);
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Socket Pipeline: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+#endif
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+    vv_testlog.write(level_t::Info, std::string("Kernel: ") + kernel_name(crc32c::get_kernel()), GET_SOURCE);
+
+    bool vv_ok = check_vectors(vv_testlog);
+    vv_ok = check_kernels(vv_testlog) && vv_ok;
+
+    bench(vv_testlog, "Table ", netpacket::_SIZE_SOCKET_TOTAL, true);
+    bench(vv_testlog, "Kernel", netpacket::_SIZE_SOCKET_TOTAL, false);
+    bench(vv_testlog, "Kernel", 64, false);
+    bench(vv_testlog, "Kernel", 1 << 20, false);
+
+    #if __OS_POSIX__
+        vv_ok = pipeline_check(vv_testlog) && vv_ok;
+    #endif
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,441 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Fast Hash (Hızlı Karma)
+ *
+ * Hızlı karmanın her uzunlukta aynı girdiye aynı, tohum ve
+ * tek bit değişiminde farklı sonuç verdiğini, 4 ve 16 baytlık
+ * açılmış yolların genel yol ile aynı olduğunu ve tek bit
+ * değişiminin çıktının yaklaşık yarısını değiştirdiğini
+ * (avalanche) kontrol edeceğiz. Ardışık IPv4/IPv6 metinlerinde
+ * ve soket numaralarında çakışma ve kova dağılımı std::hash ile
+ * karşılaştırılır. Karma ve tablo (ekleme + arama) hızları
+ * ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 fast-hash.cpp -pthread -o bsd/fast-hash.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 fast-hash.cpp -pthread -o linux/fast-hash.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 fast-hash.cpp -o windows/fast-hash.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/fast-hash.bsd
+ *  Linux   :: ./linux/fast-hash.linux
+ *  Windows :: ./windows/fast-hash.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+#include <kits/hashkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+using namespace tools::hash;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "fast-hash-" + ss_osname;
+
+/**
+ * @brief Make Ipv4
+ *
+ * @param size_t Count
+ * @return vector<string>
+ */
+std::vector<std::string> make_ipv4(const std::size_t ar_count)
+{
+    std::vector<std::string> tm_out;
+    tm_out.reserve(ar_count);
+
+    for(std::size_t tm_count = 0; tm_count < ar_count; ++tm_count)
+        tm_out.push_back("10." + std::to_string((tm_count >> 16) & 0xff) + "." + std::to_string((tm_count >> 8) & 0xff) + "." + std::to_string(tm_count & 0xff));
+
+    return tm_out;
+}
+
+/**
+ * @brief Make Ipv6
+ *
+ * @param size_t Count
+ * @return vector<string>
+ */
+std::vector<std::string> make_ipv6(const std::size_t ar_count)
+{
+    std::vector<std::string> tm_out;
+    tm_out.reserve(ar_count);
+
+    char tm_text[48] {};
+    for(std::size_t tm_count = 0; tm_count < ar_count; ++tm_count)
+    {
+        std::snprintf(tm_text, sizeof(tm_text), "2001:db8:85a3::8a2e:%x:%x", static_cast<unsigned>(tm_count >> 16), static_cast<unsigned>(tm_count & 0xffff));
+        tm_out.emplace_back(tm_text);
+    }
+
+    return tm_out;
+}
+
+/**
+ * @brief Check Basic
+ *
+ * 0-300 bayt arası her uzunlukta sonucun tekrar edilebilir
+ * olduğunu, son bayt, tohum ve uzunluk değişiminde farklı
+ * sonuç verdiğini ve açılmış yolların genel yol ile aynı
+ * olduğunu kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_basic(Logger<Args...>& ar_logger)
+{
+    std::mt19937_64 tm_rng(20261018);
+    std::vector<uint8_t> tm_data(320);
+    for(auto& tm_byte : tm_data)
+        tm_byte = static_cast<uint8_t>(tm_rng());
+
+    uint32_t tm_failed = 0;
+    std::unordered_set<fasthash::hash_t> tm_seen;
+
+    for(std::size_t tm_len = 0; tm_len <= 300; ++tm_len)
+    {
+        const fasthash::hash_t tm_hash = fasthash::hash(tm_data.data(), tm_len);
+        bool tm_ok = tm_hash == fasthash::hash(tm_data.data(), tm_len);
+        tm_ok = tm_ok && tm_hash != fasthash::hash(tm_data.data(), tm_len, 1);
+        tm_ok = tm_ok && tm_seen.insert(tm_hash).second;
+
+        if( tm_len )
+        {
+            std::vector<uint8_t> tm_copy(tm_data.begin(), tm_data.begin() + static_cast<std::ptrdiff_t>(tm_len));
+            tm_copy[tm_len - 1] ^= 0x80;
+            tm_ok = tm_ok && tm_hash != fasthash::hash(tm_copy.data(), tm_len);
+
+            // UNALIGNED INPUT GIVES THE SAME RESULT
+            std::vector<uint8_t> tm_shift(tm_len + 3);
+            std::memcpy(tm_shift.data() + 3, tm_data.data(), tm_len);
+            tm_ok = tm_ok && tm_hash == fasthash::hash(tm_shift.data() + 3, tm_len);
+        }
+
+        if( !tm_ok )
+            ++tm_failed;
+    }
+
+    bool tm_fast = true;
+    for(uint32_t tm_round = 0; tm_round < 10000; ++tm_round)
+    {
+        std::array<uint8_t, 16> tm_addr {};
+        for(auto& tm_byte : tm_addr)
+            tm_byte = static_cast<uint8_t>(tm_rng());
+
+        const fasthash::hash_t tm_seed = tm_rng();
+        tm_fast = tm_fast && fasthash::hash_addr4(tm_addr.data(), tm_seed) == fasthash::hash(tm_addr.data(), 4, tm_seed);
+        tm_fast = tm_fast && fasthash::hash_addr16(tm_addr.data(), tm_seed) == fasthash::hash(tm_addr.data(), 16, tm_seed);
+        tm_fast = tm_fast && fasthash::BytesHash<16>{}(tm_addr) == static_cast<std::size_t>(fasthash::hash(tm_addr.data(), 16, fasthash::get_process_seed()));
+    }
+
+    const std::string tm_text = "192.168.100.200";
+    tm_fast = tm_fast && fasthash::StringHash{}(tm_text) == static_cast<std::size_t>(fasthash::hash(tm_text.data(), tm_text.size(), fasthash::get_process_seed()));
+    tm_fast = tm_fast && fasthash::get_process_seed() == fasthash::get_process_seed() && fasthash::get_process_seed() != fasthash::_SEED;
+    tm_fast = tm_fast && fasthash::StringHash{}(std::string_view(tm_text)) == fasthash::StringHash{}(tm_text);
+
+    ar_logger.write(tm_failed ? level_t::Err : level_t::Info, "Length 0-300 Failed: " + std::to_string(tm_failed) + "/301", GET_SOURCE);
+    ar_logger.write(tm_fast ? level_t::Info : level_t::Err, std::string("Addr4/Addr16/String Fast Path Equal: ") + (tm_fast ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_failed == 0 && tm_fast;
+}
+
+/**
+ * @brief Check Avalanche
+ *
+ * Verilen uzunluktaki rastgele girdilerde her bitin tek tek
+ * değiştirilmesi ile çıktının kaç bitinin değiştiğini ölçer.
+ * Ortalama 32 bite yakın, her çıktı bitinin değişme oranı
+ * yarıya yakın olmalıdır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Length
+ * @return bool
+ */
+template<class... Args>
+bool check_avalanche(Logger<Args...>& ar_logger, const std::size_t ar_len)
+{
+    std::mt19937_64 tm_rng(ar_len);
+    std::vector<uint8_t> tm_data(ar_len);
+    std::array<uint32_t, 64> tm_flip {};
+
+    static constexpr uint32_t ss_rounds = 2000;
+    uint64_t tm_total = 0;
+
+    for(uint32_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+    {
+        for(auto& tm_byte : tm_data)
+            tm_byte = static_cast<uint8_t>(tm_rng());
+
+        const fasthash::hash_t tm_base = fasthash::hash(tm_data.data(), ar_len);
+        for(std::size_t tm_bit = 0; tm_bit < ar_len * 8; ++tm_bit)
+        {
+            tm_data[tm_bit / 8] ^= static_cast<uint8_t>(1u << (tm_bit % 8));
+            const fasthash::hash_t tm_diff = tm_base ^ fasthash::hash(tm_data.data(), ar_len);
+            tm_data[tm_bit / 8] ^= static_cast<uint8_t>(1u << (tm_bit % 8));
+
+            for(std::size_t tm_out = 0; tm_out < 64; ++tm_out)
+                tm_flip[tm_out] += static_cast<uint32_t>((tm_diff >> tm_out) & 1);
+            tm_total += static_cast<uint64_t>(__builtin_popcountll(tm_diff));
+        }
+    }
+
+    const double tm_samples = static_cast<double>(ss_rounds) * static_cast<double>(ar_len * 8);
+    const double tm_mean = static_cast<double>(tm_total) / tm_samples;
+
+    double tm_worst = 0.0;
+    for(const uint32_t tm_count : tm_flip)
+        tm_worst = std::max(tm_worst, std::abs(static_cast<double>(tm_count) / tm_samples - 0.5));
+
+    const bool tm_ok = tm_mean > 31.0 && tm_mean < 33.0 && tm_worst < 0.02;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(3) << "Avalanche | Length: " << std::setw(3) << ar_len
+               << " B | Mean Flipped Bits: " << tm_mean << "/64 | Worst Bit Bias: " << tm_worst;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bucket Spread
+ *
+ * Anahtarları 2^N kovaya alt bitler ile dağıtıp en dolu
+ * kovanın ortalamaya oranını döndürür
+ *
+ * @tparam Keys Keys
+ * @tparam Hasher Hasher
+ * @param Keys& Keys
+ * @param size_t Bits
+ * @return double
+ */
+template<class Keys, class Hasher>
+double bucket_spread(const Keys& ar_keys, const std::size_t ar_bits)
+{
+    std::vector<uint32_t> tm_buckets(std::size_t { 1 } << ar_bits, 0);
+    const Hasher tm_hasher {};
+
+    for(const auto& tm_key : ar_keys)
+        ++tm_buckets[tm_hasher(tm_key) & (tm_buckets.size() - 1)];
+
+    const double tm_mean = static_cast<double>(ar_keys.size()) / static_cast<double>(tm_buckets.size());
+    return static_cast<double>(*std::max_element(tm_buckets.begin(), tm_buckets.end())) / tm_mean;
+}
+
+/**
+ * @brief Check Distribution
+ *
+ * Ardışık ip metinlerinde ve soket numaralarında 64 bitlik
+ * çakışma olmadığını, alt bitlerle yapılan kova dağılımının
+ * dengeli olduğunu kontrol eder. std::hash değerleri bilgi
+ * için yazılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_distribution(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t ss_count = 1 << 20;
+    static constexpr std::size_t ss_bits = 16;
+
+    const std::vector<std::string> tm_ipv4 = make_ipv4(ss_count);
+    const std::vector<std::string> tm_ipv6 = make_ipv6(ss_count);
+
+    std::vector<int> tm_sockets(ss_count);
+    for(std::size_t tm_count = 0; tm_count < ss_count; ++tm_count)
+        tm_sockets[tm_count] = static_cast<int>(tm_count * 4 + 3);
+
+    auto tm_collisions = [](const std::vector<std::string>& ar_keys) {
+        std::vector<fasthash::hash_t> tm_hashes;
+        tm_hashes.reserve(ar_keys.size());
+        for(const auto& tm_key : ar_keys)
+            tm_hashes.push_back(fasthash::hash(tm_key.data(), tm_key.size()));
+
+        std::sort(tm_hashes.begin(), tm_hashes.end());
+        return static_cast<std::size_t>(tm_hashes.end() - std::unique(tm_hashes.begin(), tm_hashes.end()));
+    };
+
+    const std::size_t tm_col4 = tm_collisions(tm_ipv4);
+    const std::size_t tm_col6 = tm_collisions(tm_ipv6);
+
+    const double tm_fast4 = bucket_spread<std::vector<std::string>, fasthash::StringHash>(tm_ipv4, ss_bits);
+    const double tm_fast6 = bucket_spread<std::vector<std::string>, fasthash::StringHash>(tm_ipv6, ss_bits);
+    const double tm_fastsock = bucket_spread<std::vector<int>, fasthash::IntHash<int>>(tm_sockets, ss_bits);
+
+    const double tm_std4 = bucket_spread<std::vector<std::string>, std::hash<std::string>>(tm_ipv4, ss_bits);
+    const double tm_std6 = bucket_spread<std::vector<std::string>, std::hash<std::string>>(tm_ipv6, ss_bits);
+    const double tm_stdsock = bucket_spread<std::vector<int>, std::hash<int>>(tm_sockets, ss_bits);
+
+    // 16 KEYS PER BUCKET ON AVERAGE, RANDOM PLACEMENT GIVES ABOUT 2.2X
+    const bool tm_ok = tm_col4 == 0 && tm_col6 == 0 && tm_fast4 < 2.75 && tm_fast6 < 2.75 && tm_fastsock < 2.75;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Keys: " << ss_count << " | Collisions Ipv4/Ipv6: " << tm_col4 << "/" << tm_col6
+               << " | Max Bucket / Mean (2^" << ss_bits << ") | Fast Ipv4: " << tm_fast4 << " Ipv6: " << tm_fast6 << " Socket x4: " << tm_fastsock
+               << " | Std Ipv4: " << tm_std4 << " Ipv6: " << tm_std6 << " Socket x4: " << tm_stdsock;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Time Ns
+ *
+ * Verilen işlemin anahtar başına nanosaniye süresini ölçer
+ *
+ * @tparam Func Function
+ * @param size_t Count
+ * @param Func Function
+ * @return double
+ */
+template<class Func>
+double time_ns(const std::size_t ar_count, Func&& ar_func)
+{
+    const auto tm_start = std::chrono::steady_clock::now();
+    ar_func();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / static_cast<double>(ar_count);
+}
+
+/**
+ * @brief Bench Hash
+ *
+ * İp metinleri ve soket numaraları için anahtar başına karma
+ * süresini std::hash ile karşılaştırır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @tparam Keys Keys
+ * @tparam FastHash Fast
+ * @tparam StdHash Std
+ * @param string Name
+ * @param Keys& Keys
+ */
+template<class FastHash, class StdHash, class Keys, class... Args>
+void bench_hash(Logger<Args...>& ar_logger, const std::string& ar_name, const Keys& ar_keys)
+{
+    static constexpr std::size_t ss_rounds = 8;
+    std::size_t tm_sink = 0;
+
+    const double tm_fast = time_ns(ss_rounds * ar_keys.size(), [&]() {
+        const FastHash tm_hasher {};
+        for(std::size_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+            for(const auto& tm_key : ar_keys)
+                tm_sink += tm_hasher(tm_key);
+    });
+
+    const double tm_std = time_ns(ss_rounds * ar_keys.size(), [&]() {
+        const StdHash tm_hasher {};
+        for(std::size_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+            for(const auto& tm_key : ar_keys)
+                tm_sink += tm_hasher(tm_key);
+    });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Hash | " << std::left << std::setw(10) << ar_name << std::right
+               << " | Fast: " << std::setw(6) << tm_fast << " ns | Std: " << std::setw(6) << tm_std << " ns | Check: " << (tm_sink & 0xff);
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+/**
+ * @brief Bench Table
+ *
+ * Sunucudaki ip sayacı ve istemci tablosu gibi ekleme, arama
+ * ve silme yapan tablo işlemlerinin anahtar başına süresini
+ * std::hash ile karşılaştırır. Sıra etkisini azaltmak için
+ * iki taraf sıra ile birkaç kez çalıştırılır, en iyi süre
+ * yazılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @tparam Key Key
+ * @tparam FastHash Fast
+ * @param string Name
+ * @param vector<Key>& Keys
+ */
+template<class Key, class FastHash, class... Args>
+void bench_table(Logger<Args...>& ar_logger, const std::string& ar_name, const std::vector<Key>& ar_keys)
+{
+    auto tm_run = [&ar_keys](auto& ar_map) {
+        for(const auto& tm_key : ar_keys)
+            ++ar_map[tm_key];
+        std::size_t tm_found = 0;
+        for(std::size_t tm_round = 0; tm_round < 4; ++tm_round)
+            for(const auto& tm_key : ar_keys)
+                tm_found += ar_map.find(tm_key) != ar_map.end();
+        for(const auto& tm_key : ar_keys)
+            ar_map.erase(tm_key);
+        return tm_found;
+    };
+
+    std::size_t tm_found = 0;
+    double tm_fast = 0.0;
+    double tm_std = 0.0;
+
+    for(std::size_t tm_round = 0; tm_round < 5; ++tm_round)
+    {
+        const double tm_fastns = time_ns(ar_keys.size(), [&]() {
+            std::unordered_map<Key, std::size_t, FastHash> tm_map;
+            tm_found += tm_run(tm_map);
+        });
+
+        const double tm_stdns = time_ns(ar_keys.size(), [&]() {
+            std::unordered_map<Key, std::size_t> tm_map;
+            tm_found += tm_run(tm_map);
+        });
+
+        tm_fast = tm_round ? std::min(tm_fast, tm_fastns) : tm_fastns;
+        tm_std = tm_round ? std::min(tm_std, tm_stdns) : tm_stdns;
+    }
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Table (Insert + 4 Find + Erase) | " << std::left << std::setw(10) << ar_name << std::right
+               << " | Fast: " << std::setw(7) << tm_fast << " ns/key | Std: " << std::setw(7) << tm_std << " ns/key | Found: " << tm_found;
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+
+    bool vv_ok = check_basic(vv_testlog);
+    for(const std::size_t vv_len : { 4, 8, 15, 16, 39, 64 })
+        vv_ok = check_avalanche(vv_testlog, vv_len) && vv_ok;
+    vv_ok = check_distribution(vv_testlog) && vv_ok;
+
+    const std::vector<std::string> vv_ipv4 = make_ipv4(1 << 16);
+    const std::vector<std::string> vv_ipv6 = make_ipv6(1 << 16);
+    std::vector<int> vv_sockets(1 << 16);
+    for(std::size_t vv_count = 0; vv_count < vv_sockets.size(); ++vv_count)
+        vv_sockets[vv_count] = static_cast<int>(vv_count + 3);
+
+    bench_hash<fasthash::StringHash, std::hash<std::string>>(vv_testlog, "Ipv4 Text", vv_ipv4);
+    bench_hash<fasthash::StringHash, std::hash<std::string>>(vv_testlog, "Ipv6 Text", vv_ipv6);
+    bench_hash<fasthash::IntHash<int>, std::hash<int>>(vv_testlog, "Socket", vv_sockets);
+
+    bench_table<std::string, fasthash::StringHash>(vv_testlog, "Ipv4 Text", vv_ipv4);
+    bench_table<std::string, fasthash::StringHash>(vv_testlog, "Ipv6 Text", vv_ipv6);
+    bench_table<int, fasthash::IntHash<int>>(vv_testlog, "Socket", vv_sockets);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
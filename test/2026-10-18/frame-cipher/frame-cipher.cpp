@@ -0,0 +1,192 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Frame Cipher (Çerçeve Şifreleme)
+ *
+ * Paketlenmiş çerçevenin veri bölümünün gönderim tamponu içinde
+ * tek geçişte şifrelendiğini, başlığın açık kaldığını ve alım
+ * tarafında yerinde çözüldüğünü kontrol edeceğiz. Sadece metin
+ * arayüzünü tanımlayan bir algoritmanın tampon arayüzünde de
+ * doğru çalıştığı denenir. Alan alan metin şifreleme ile tüm
+ * çerçeveyi yerinde şifreleme arasındaki süre farkı ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 frame-cipher.cpp -pthread -o bsd/frame-cipher.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 frame-cipher.cpp -pthread -o linux/frame-cipher.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 frame-cipher.cpp -o windows/frame-cipher.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/frame-cipher.bsd
+ *  Linux   :: ./linux/frame-cipher.linux
+ *  Windows :: ./windows/frame-cipher.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "frame-cipher-" + ss_osname;
+
+static constexpr uint32_t ss_rounds = 200000;
+
+// Class
+class Shift final : public Algorithm
+{
+    public:
+        explicit Shift(const std::string& ar_name, const std::string& ar_key)
+        : Algorithm(ar_name, ar_key) {}
+
+        bool encrypt(std::string& ar_text) noexcept override
+        {
+            for(auto& tm_char : ar_text)
+                tm_char = static_cast<char>(tm_char + 1);
+            return true;
+        }
+
+        bool decrypt(std::string& ar_text) noexcept override
+        {
+            for(auto& tm_char : ar_text)
+                tm_char = static_cast<char>(tm_char - 1);
+            return true;
+        }
+};
+
+/**
+ * @brief Check Frame
+ *
+ * Verilen algoritma ile paketlenmiş çerçeve yerinde şifrelenir.
+ * Başlığın değişmediği, veri bölümünün beklenen şifreli metin
+ * olduğu ve çözme sonrası çerçevenin ilk haline döndüğü kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Title
+ * @param Algorithm& Cipher
+ * @param Algorithm& Reference
+ * @return bool
+ */
+template<class... Args>
+bool check_frame(Logger<Args...>& ar_logger, const std::string& ar_title, Algorithm& ar_cipher, Algorithm& ar_reference)
+{
+    const std::string tm_pwd = "pwd@frame";
+    const std::string tm_name = "tester";
+    const std::string tm_msg = "the whole body is processed in one pass";
+
+    netpacket::buffer_t tm_buffer {};
+    const std::size_t tm_len = netpacket::NetPacket::layout(tm_buffer.data(), tm_buffer.size(), tm_pwd, tm_name, tm_msg);
+    const netpacket::buffer_t tm_plain = tm_buffer;
+
+    const Frame tm_frame { tm_buffer.data(), netpacket::_SIZE_HEADER, tm_len - netpacket::_SIZE_HEADER };
+
+    // EXPECTED: BODY AS ONE TEXT THROUGH THE STRING INTERFACE
+    std::string tm_expect = tm_pwd + tm_name + tm_msg;
+    ar_reference.encrypt(tm_expect);
+
+    const bool tm_encrypted = ar_cipher.encrypt(tm_frame);
+    const bool tm_header = std::equal(tm_plain.begin(), tm_plain.begin() + netpacket::_SIZE_HEADER, tm_buffer.begin());
+    const bool tm_body = std::string_view(reinterpret_cast<const char*>(tm_frame.body()), tm_frame.m_payload) == tm_expect;
+    const bool tm_decrypted = ar_cipher.decrypt(tm_frame) && tm_buffer == tm_plain;
+
+    const bool tm_ok = tm_len != 0 && tm_encrypted && tm_header && tm_body && tm_decrypted;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, ar_title + std::string(" | Frame In Place: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Eski yöntemde olduğu gibi alanlar metne kopyalanıp ayrı
+ * ayrı şifrelenir ve paketlenir. Yeni yöntemde açık paket
+ * tampona yazılır ve veri bölümü tek çağrıda şifrelenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param Algorithm& Cipher
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, Algorithm& ar_cipher)
+{
+    const DataPacket tm_packet { "pwd@frame", "tester-with-a-long-enough-name", std::string(600, 'm') };
+    netpacket::buffer_t tm_buffer {};
+    std::size_t tm_check = 0;
+
+    // PER FIELD
+    auto tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+    {
+        std::string tm_pwd = tm_packet.m_pwd;
+        std::string tm_name = tm_packet.m_name;
+        std::string tm_msg = tm_packet.m_msg;
+
+        ar_cipher.encrypt(tm_pwd);
+        ar_cipher.encrypt(tm_name);
+        ar_cipher.encrypt(tm_msg);
+
+        tm_check += netpacket::NetPacket::encode(tm_buffer, tm_pwd, tm_name, tm_msg);
+    }
+    const double tm_field_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    // WHOLE FRAME
+    tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+    {
+        const std::size_t tm_len = netpacket::NetPacket::layout(tm_buffer.data(), tm_buffer.size(), tm_packet.m_pwd, tm_packet.m_name, tm_packet.m_msg);
+        ar_cipher.encrypt(Frame{ tm_buffer.data(), netpacket::_SIZE_HEADER, tm_len - netpacket::_SIZE_HEADER });
+        tm_check -= tm_len;
+    }
+    const double tm_frame_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(1)
+        << "Encrypt+Pack | Per Field: " << tm_field_ns << " ns"
+        << " | Whole Frame: " << tm_frame_ns << " ns"
+        << " | Check: " << (tm_check == 0 ? "Equal" : "Differ");
+
+    ar_logger.write(tm_check == 0 ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    Xor vv_xor("frame-xor", utf::to_utf8(U"key-frame@20261018"));
+    Xor vv_xor_ref("frame-xor", utf::to_utf8(U"key-frame@20261018"));
+    Shift vv_shift("frame-shift", "unused");
+    Shift vv_shift_ref("frame-shift", "unused");
+
+    bool vv_ok = check_frame(vv_testlog, "Xor  ", vv_xor, vv_xor_ref);
+    vv_ok = check_frame(vv_testlog, "Shift", vv_shift, vv_shift_ref) && vv_ok;
+
+    bench(vv_testlog, vv_xor);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
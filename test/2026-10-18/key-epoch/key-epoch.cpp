@@ -0,0 +1,559 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Key Epoch (Anahtar Dönemi)
+ *
+ * Çerçeve bayrağının üst bitlerine yazılan anahtar döneminin
+ * diğer bitleri bozmadığını, dönem anlaşılmayan alıcının
+ * dönem bitli çerçeveyi reddettiğini kontrol edeceğiz. Soket
+ * çifti üzerinden anahtar değiştirilir; duyurunun uygulamaya
+ * veri olarak ulaşmadığı, karşı tarafın yeni döneme geçtiği,
+ * duyuruyu henüz okumamış tarafın eski dönemdeki paketinin
+ * bekleme süresinde kabul edildiği, süre dolunca reddedildiği
+ * ve yeni bağlantıların yeni anahtarı kullandığı denenir.
+ * Gönderim sürerken birkaç kez anahtar değiştirilip tüm
+ * paketlerin alındığına bakılır. Tekrar edilen duyuru
+ * akınının ilk tekrarda hata ile sonlandığı denenir. İki uç aynı
+ * anda anahtar değiştirmeye çalışınca istemcinin reddedildiği,
+ * sunucunun karşıdan gelen duyuruyu uygulamadığı ve iki ucun
+ * aynı anahtarda kaldığı kontrol edilir. Bağlantı başına anahtar
+ * değiştirme ile yeniden el sıkışma süreleri ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 key-epoch.cpp -pthread -o bsd/key-epoch.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 key-epoch.cpp -pthread -o linux/key-epoch.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/key-epoch.bsd
+ *  Linux   :: ./linux/key-epoch.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+#include <socket/client/client.hpp>
+
+#include "../socket-link.hpp"
+
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "key-epoch-" + ss_osname;
+
+static const std::string ss_key = "0123456789abcdef0123456789abcdef";
+static const std::string ss_next_key = "fedcba9876543210fedcba9876543210";
+static const std::string ss_last_key = "00112233445566778899aabbccddeeff";
+
+static constexpr flag::flag_t ss_flag = _FLAG_SOCKET_KEY_EPOCH | _FLAG_SOCKET_SESSION_KEY;
+
+static constexpr std::size_t ss_stream_count = 2000;
+static constexpr std::size_t ss_stream_rotate = 5;
+static constexpr std::size_t ss_bench_count = 64;
+static constexpr std::size_t ss_replay_count = 20000;
+static constexpr std::size_t ss_chain_count = 200;
+
+// Class
+// SERVER END WITHOUT A LISTENER, TAKES NO KEY ANNOUNCEMENT LIKE SERVER
+class KeyOwner final : public Socket
+{
+    public:
+        using Socket::Socket;
+
+    protected:
+        bool can_accept_key() const noexcept override { return false; }
+};
+
+/**
+ * @brief Exchange
+ *
+ * Gönderen uçtan bir mesaj gönderip alan uçta aynı mesajın
+ * alındığını kontrol eder
+ *
+ * @param Socket& Sender
+ * @param socket_t Sender Socket
+ * @param Socket& Receiver
+ * @param socket_t Receiver Socket
+ * @param string& Message
+ * @return Status
+ */
+Status exchange(Socket& ar_sender, const socket_t ar_send_sock, Socket& ar_receiver, const socket_t ar_recv_sock, const std::string& ar_msg)
+{
+    const Status tm_send = ar_sender.send(ar_send_sock, DataPacket{ "pwd@epoch", "tester", ar_msg });
+    if( !tm_send.is_ok() )
+        return tm_send;
+
+    DataPacket tm_in {};
+    const Status tm_recv = ar_receiver.recv(ar_recv_sock, tm_in);
+    if( tm_recv.is_ok() && tm_in.m_msg != ar_msg )
+        return Status::err(domain_t::socket, status::to_underlying(socket_code_t::packet_corrupt));
+
+    return tm_recv;
+}
+
+/**
+ * @brief Check Frame
+ *
+ * Dönem bitlerinin diğer çerçeve bayraklarına dokunmadığını
+ * ve dönem anlaşılmayan alıcının dönem bitli başlığı
+ * packet_corrupt ile reddettiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_frame(Logger<Args...>& ar_logger)
+{
+    bool tm_bits = true;
+    for(uint8_t tm_epoch = 0; tm_epoch < netpacket::_SIZE_EPOCH; ++tm_epoch)
+    {
+        const netpacket::frame_t tm_base = netpacket::_FRAME_AEAD | netpacket::_FRAME_CRC | netpacket::_FRAME_REKEY;
+        const netpacket::frame_t tm_frame = netpacket::set_epoch(tm_base, tm_epoch);
+        tm_bits = tm_bits && netpacket::get_epoch(tm_frame) == tm_epoch && (tm_frame & ~netpacket::_FRAME_EPOCH) == tm_base;
+    }
+
+    ar_logger.write(tm_bits ? level_t::Info : level_t::Err, "Epoch Bits x " + std::to_string(netpacket::_SIZE_EPOCH) + std::string(" | Other Flags Kept: ") + (tm_bits ? "Passed" : "Failed"), GET_SOURCE);
+
+    // LEGACY PAIR, EPOCH BITS FORGED INTO THE HEADER
+    ChaCha20Poly1305 tm_cipher("legacy", ss_key);
+    Socket tm_sender(tm_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5100, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+    Socket tm_receiver(tm_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5101, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    netpacket::buffer_t tm_plain {};
+    const std::size_t tm_len = netpacket::NetPacket::layout(tm_plain.data(), tm_plain.size(), "pwd@epoch", "tester", "legacy frame", netpacket::_FRAME_AEAD) + ChaCha20Poly1305::_SIZE_SEAL;
+
+    std::string tm_raw(tm_len, '\0');
+    const bool tm_sent = tm_sender.send(tm_pair[0], DataPacket{ "pwd@epoch", "tester", "legacy frame" }).is_ok()
+        && ::read(tm_pair[1], tm_raw.data(), tm_len) == static_cast<ssize_t>(tm_len);
+
+    // HIGH HEX DIGIT OF THE FRAME FIELD IS THE EPOCH
+    tm_raw[netpacket::_PACK_START_LEN_FRAME] = '1';
+
+    DataPacket tm_in {};
+    const bool tm_written = ::write(tm_pair[0], tm_raw.data(), tm_raw.size()) == static_cast<ssize_t>(tm_raw.size());
+    const Status tm_status = tm_receiver.recv(tm_pair[1], tm_in);
+    const bool tm_rejected = tm_sent && tm_written && tm_status.get_code() == status::to_underlying(socket_code_t::packet_corrupt);
+
+    ar_logger.write(tm_rejected ? level_t::Info : level_t::Err, std::string("Epoch Without Negotiation | Rejected: ") + (tm_rejected ? "Passed" : "Failed"), GET_SOURCE);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    return tm_bits && tm_rejected;
+}
+
+/**
+ * @brief Check Rotate
+ *
+ * Sunucu ucu anahtarı değiştirir. Duyurudan sonra gelen
+ * mesajı alan istemci ucu duyuruyu uygulayıp yeni döneme
+ * geçer, duyuruyu okumadan gönderdiği eski dönem paketi
+ * sunucuda bekleme süresi içinde açılır. Süre dolunca eski
+ * dönem packet_epoch_unknown ile reddedilir. Değişimden sonra
+ * açılan bağlantı yeni anahtarla el sıkışır, eski anahtarlı
+ * istemci ile açılan bağlantının paketi doğrulanamaz
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_rotate(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("epoch-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("epoch-client", ss_key);
+    ChaCha20Poly1305 tm_fresh_cipher("epoch-fresh", ss_next_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5102, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5103, ipv_t::ipv4, ss_flag);
+    Socket tm_fresh(tm_fresh_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5104, ipv_t::ipv4, ss_flag);
+
+    Link tm_link;
+    if( !connect(tm_client, tm_server, tm_link) )
+        return false;
+
+    const socket_t tm_cli_sock = tm_link.m_pair[0];
+    const socket_t tm_srv_sock = tm_link.m_pair[1];
+
+    const bool tm_negotiated = (tm_server.get_session_feature(tm_srv_sock) & _FEATURE_KEY_EPOCH) != 0;
+    bool tm_ok = tm_negotiated && exchange(tm_server, tm_srv_sock, tm_client, tm_cli_sock, "before rotation").is_ok();
+
+    // ROTATE, CLIENT HAS NOT READ THE ANNOUNCEMENT YET AND STILL SENDS ON EPOCH 0
+    const bool tm_rotated = tm_server.rotate_key(ss_next_key).is_ok() && tm_server.get_session_epoch(tm_srv_sock) == 1;
+    const bool tm_in_flight = exchange(tm_client, tm_cli_sock, tm_server, tm_srv_sock, "old epoch in flight").is_ok();
+
+    // NEXT MESSAGE CARRIES THE ANNOUNCEMENT IN FRONT OF IT
+    const bool tm_followed = exchange(tm_server, tm_srv_sock, tm_client, tm_cli_sock, "after rotation").is_ok()
+        && tm_client.get_session_epoch(tm_cli_sock) == 1
+        && exchange(tm_client, tm_cli_sock, tm_server, tm_srv_sock, "client on new epoch").is_ok();
+
+    ar_logger.write(tm_ok && tm_rotated ? level_t::Info : level_t::Err, std::string("Negotiated: ") + (tm_negotiated ? "Passed" : "Failed") + " | Rotate: " + (tm_rotated ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_in_flight ? level_t::Info : level_t::Err, std::string("Old Epoch In Grace | Accepted: ") + (tm_in_flight ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_followed ? level_t::Info : level_t::Err, std::string("Announcement Not Delivered As Data | Peer Follows: ") + (tm_followed ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_ok = tm_ok && tm_rotated && tm_in_flight && tm_followed;
+
+    // NEW CONNECTIONS USE THE ROTATED KEY
+    Link tm_new_link;
+    const bool tm_new_ok = connect(tm_fresh, tm_server, tm_new_link)
+        && exchange(tm_fresh, tm_new_link.m_pair[0], tm_server, tm_new_link.m_pair[1], "fresh client on new key").is_ok();
+    disconnect(tm_fresh, tm_server, tm_new_link);
+
+    Link tm_old_link;
+    const bool tm_old_rejected = connect(tm_client, tm_server, tm_old_link)
+        && exchange(tm_client, tm_old_link.m_pair[0], tm_server, tm_old_link.m_pair[1], "stale client on old key").get_code() == status::to_underlying(socket_code_t::packet_not_auth);
+    disconnect(tm_client, tm_server, tm_old_link);
+
+    ar_logger.write(tm_new_ok && tm_old_rejected ? level_t::Info : level_t::Err, std::string("New Connection | New Key: ") + (tm_new_ok ? "Passed" : "Failed") + " | Old Key Rejected: " + (tm_old_rejected ? "Passed" : "Failed"), GET_SOURCE);
+    tm_ok = tm_ok && tm_new_ok && tm_old_rejected;
+
+    // GRACE WINDOW RUNS OUT, LAST STEP SINCE THE REJECTED FRAME STAYS IN THE STREAM
+    const bool tm_grace_set = tm_server.set_key_grace(_MIN_KEY_GRACE).is_ok();
+    const bool tm_second = tm_server.rotate_key(ss_last_key).is_ok() && tm_server.get_session_epoch(tm_srv_sock) == 2;
+    const bool tm_grace_ok = tm_second && exchange(tm_client, tm_cli_sock, tm_server, tm_srv_sock, "inside grace").is_ok();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(_MIN_KEY_GRACE * 1000 + 100));
+
+    const Status tm_expired = exchange(tm_client, tm_cli_sock, tm_server, tm_srv_sock, "after grace");
+    const bool tm_expired_ok = tm_expired.get_code() == status::to_underlying(socket_code_t::packet_epoch_unknown);
+
+    ar_logger.write(tm_grace_set && tm_grace_ok && tm_expired_ok ? level_t::Info : level_t::Err, std::string("Grace ") + std::to_string(_MIN_KEY_GRACE) + " s | Inside: " + (tm_grace_ok ? "Passed" : "Failed") + " | Expired Rejected: " + (tm_expired_ok ? "Passed" : "Failed"), GET_SOURCE);
+    tm_ok = tm_ok && tm_grace_set && tm_grace_ok && tm_expired_ok;
+
+    disconnect(tm_client, tm_server, tm_link);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Stream
+ *
+ * Bir iş parçacığı sürekli gönderirken anahtar birkaç kez
+ * değiştirilir. Eski dönemde hazırlanıp duyurudan sonra
+ * yola çıkan paketler de dahil hepsinin sırasıyla alındığı
+ * kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_stream(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("stream-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("stream-client", ss_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5105, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5106, ipv_t::ipv4, ss_flag);
+
+    Link tm_link;
+    if( !connect(tm_client, tm_server, tm_link) )
+        return false;
+
+    std::atomic<std::size_t> tm_received { 0 };
+    std::atomic<bool> tm_failed { false };
+
+    std::thread tm_reader([&]{
+        for(std::size_t tm_count = 0; tm_count < ss_stream_count; ++tm_count)
+        {
+            DataPacket tm_in {};
+            if( !tm_client.recv(tm_link.m_pair[0], tm_in).is_ok() || tm_in.m_msg != "stream-" + std::to_string(tm_count) ) {
+                tm_failed.store(true);
+                return;
+            }
+            tm_received.fetch_add(1);
+        }
+    });
+
+    std::thread tm_writer([&]{
+        for(std::size_t tm_count = 0; tm_count < ss_stream_count && !tm_failed.load(); ++tm_count)
+            if( !tm_server.send(tm_link.m_pair[1], DataPacket{ "pwd@epoch", "tester", "stream-" + std::to_string(tm_count) }).is_ok() )
+                tm_failed.store(true);
+    });
+
+    std::size_t tm_rotations = 0;
+    for(std::size_t tm_count = 0; tm_count < ss_stream_rotate; ++tm_count)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if( tm_server.rotate_key(tm_count % 2 ? ss_key : ss_next_key).is_ok() )
+            ++tm_rotations;
+    }
+
+    tm_writer.join();
+    tm_reader.join();
+
+    // A LAST ANNOUNCEMENT MAY STILL WAIT IN THE STREAM, ONE MORE MESSAGE CARRIES IT
+    const bool tm_final = exchange(tm_server, tm_link.m_pair[1], tm_client, tm_link.m_pair[0], "final").is_ok();
+
+    const bool tm_ok = !tm_failed.load() && tm_final && tm_received.load() == ss_stream_count && tm_rotations == ss_stream_rotate
+        && tm_client.get_session_epoch(tm_link.m_pair[0]) == tm_server.get_session_epoch(tm_link.m_pair[1]);
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, "Stream " + std::to_string(tm_received.load()) + "/" + std::to_string(ss_stream_count) + " Messages, " + std::to_string(tm_rotations) + " Rotations | Epoch " + std::to_string(tm_server.get_session_epoch(tm_link.m_pair[1])) + " | Result: " + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    disconnect(tm_client, tm_server, tm_link);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Replay
+ *
+ * Sunucu ucunun anahtar değişimi duyurusu hattan ham olarak
+ * alınır. İstemciye asıl duyuru ve ardından aynı duyurunun
+ * binlerce tekrarı art arda yazılır; istemci asıl duyuruyu
+ * uygular, ilk tekrarda key_epoch_not_match ile döner ve
+ * yığın büyümez. Ardından anahtar mesaj göndermeden birçok
+ * kez değiştirilir, istemci tüm duyuruları tek alımda
+ * uygulayıp mesajı alır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_replay(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("replay-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("replay-client", ss_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5109, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5110, ipv_t::ipv4, ss_flag);
+
+    Link tm_link;
+    if( !connect(tm_client, tm_server, tm_link) )
+        return false;
+
+    // RAW ANNOUNCEMENT, ALREADY WRITTEN WHEN ROTATE RETURNS
+    std::string tm_announce;
+    const bool tm_rotated = tm_server.rotate_key(ss_next_key).is_ok();
+
+    char tm_chunk[512];
+    ssize_t tm_count = 0;
+    while( (tm_count = ::recv(tm_link.m_pair[0], tm_chunk, sizeof(tm_chunk), MSG_DONTWAIT)) > 0 )
+        tm_announce.append(tm_chunk, static_cast<std::size_t>(tm_count));
+
+    // GENUINE ANNOUNCEMENT FOLLOWED BY A BURST OF REPLAYS
+    int tm_inject[2] { -1, -1 };
+    if( !tm_rotated || tm_announce.empty() || ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_inject) != 0 )
+        return false;
+
+    std::thread tm_writer([&]{
+        for(std::size_t tm_replay = 0; tm_replay <= ss_replay_count; ++tm_replay)
+            if( ::send(tm_inject[0], tm_announce.data(), tm_announce.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(tm_announce.size()) )
+                break;
+        Socket::close_socket(tm_inject[0]);
+    });
+
+    // CLIENT SESSION READS FROM THE INJECTED STREAM
+    const socket_t tm_client_sock = tm_link.m_pair[0];
+    tm_link.m_pair[0] = ::dup2(tm_inject[1], tm_client_sock) == tm_client_sock ? tm_client_sock : -1;
+    Socket::close_socket(tm_inject[1]);
+
+    DataPacket tm_in {};
+    const Status tm_status = tm_client.recv(tm_client_sock, tm_in);
+    const bool tm_replay_ok = tm_link.m_pair[0] >= 0
+        && tm_status.get_code() == status::to_underlying(socket_code_t::key_epoch_not_match)
+        && tm_client.get_session_epoch(tm_client_sock) == 1 && tm_in.m_msg.empty();
+
+    // UNBLOCK THE WRITER, THE REST OF THE BURST IS NOT READ
+    ::shutdown(tm_client_sock, SHUT_RDWR);
+    tm_writer.join();
+
+    ar_logger.write(tm_replay_ok ? level_t::Info : level_t::Err, "Announcement + " + std::to_string(ss_replay_count) + std::string(" Replays | Applied Once, Rejected: ") + (tm_replay_ok ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_client, tm_server, tm_link);
+
+    // MANY ANNOUNCEMENTS IN A ROW ARE APPLIED IN ONE RECEIVE
+    ChaCha20Poly1305 tm_chain_server_cipher("chain-server", ss_key);
+    ChaCha20Poly1305 tm_chain_client_cipher("chain-client", ss_key);
+
+    Socket tm_chain_server(tm_chain_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5111, ipv_t::ipv4, ss_flag);
+    Socket tm_chain_client(tm_chain_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5112, ipv_t::ipv4, ss_flag);
+
+    Link tm_chain_link;
+    bool tm_chain_ok = connect(tm_chain_client, tm_chain_server, tm_chain_link);
+    for(std::size_t tm_rotate = 0; tm_chain_ok && tm_rotate < ss_chain_count; ++tm_rotate)
+        tm_chain_ok = tm_chain_server.rotate_key(tm_rotate % 2 ? ss_key : ss_next_key).is_ok();
+
+    std::thread tm_reader([&]{
+        DataPacket tm_chain_in {};
+        tm_chain_ok = tm_chain_ok && tm_chain_client.recv(tm_chain_link.m_pair[0], tm_chain_in).is_ok() && tm_chain_in.m_msg == "after chain";
+    });
+
+    const bool tm_chain_sent = tm_chain_server.send(tm_chain_link.m_pair[1], DataPacket{ "pwd@epoch", "tester", "after chain" }).is_ok();
+    tm_reader.join();
+
+    tm_chain_ok = tm_chain_ok && tm_chain_sent
+        && tm_chain_client.get_session_epoch(tm_chain_link.m_pair[0]) == tm_chain_server.get_session_epoch(tm_chain_link.m_pair[1]);
+
+    ar_logger.write(tm_chain_ok ? level_t::Info : level_t::Err, std::to_string(ss_chain_count) + std::string(" Announcements In A Row | One Receive: ") + (tm_chain_ok ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_chain_client, tm_chain_server, tm_chain_link);
+
+    return tm_replay_ok && tm_chain_ok;
+}
+
+/**
+ * @brief Check Concurrent
+ *
+ * Sunucu ve istemci uçları aynı anda anahtar değiştirmeye
+ * çalışır. İstemci key_not_rotate ile reddedilir, sunucunun
+ * duyurusu uygulanır ve iki uç aynı dönemde iki yönde de
+ * mesajlaşır. Buna uymayan eski bir uç yine de duyurursa
+ * sunucu ucu duyuruyu key_not_accept ile reddeder ve kendi
+ * döneminde kalır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_concurrent(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("concurrent-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("concurrent-client", ss_key);
+
+    KeyOwner tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5113, ipv_t::ipv4, ss_flag);
+    client::Client tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5114, ipv_t::ipv4, "127.0.0.1", [](client::Client&){}, ss_flag);
+
+    Link tm_link;
+    if( !connect(tm_client, tm_server, tm_link) )
+        return false;
+
+    const socket_t tm_cli_sock = tm_link.m_pair[0];
+    const socket_t tm_srv_sock = tm_link.m_pair[1];
+
+    // BOTH ENDS ROTATE AT ONCE
+    std::atomic<bool> tm_go { false };
+    Status tm_client_rotate;
+
+    std::thread tm_other([&]{
+        while( !tm_go.load() )
+            std::this_thread::yield();
+        tm_client_rotate = tm_client.rotate_key(ss_last_key);
+    });
+
+    tm_go.store(true);
+    const bool tm_server_rotated = tm_server.rotate_key(ss_next_key).is_ok();
+    tm_other.join();
+
+    const bool tm_refused = tm_client_rotate.get_code() == status::to_underlying(socket_code_t::key_not_rotate);
+    const bool tm_agreed = tm_server_rotated
+        && exchange(tm_server, tm_srv_sock, tm_client, tm_cli_sock, "server after rotation").is_ok()
+        && exchange(tm_client, tm_cli_sock, tm_server, tm_srv_sock, "client after rotation").is_ok()
+        && tm_client.get_session_epoch(tm_cli_sock) == 1 && tm_server.get_session_epoch(tm_srv_sock) == 1;
+
+    ar_logger.write(tm_refused && tm_agreed ? level_t::Info : level_t::Err, std::string("Concurrent Rotate | Client Refused: ") + (tm_refused ? "Passed" : "Failed")
+        + " | Same Key Both Ends: " + (tm_agreed ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_client, tm_server, tm_link);
+
+    // AN OLD PEER ANNOUNCES ANYWAY, THE SERVER END KEEPS ITS KEY
+    ChaCha20Poly1305 tm_old_cipher("concurrent-old", ss_next_key);
+    Socket tm_old(tm_old_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5115, ipv_t::ipv4, ss_flag);
+
+    Link tm_old_link;
+    const bool tm_old_sent = connect(tm_old, tm_server, tm_old_link)
+        && tm_old.rotate_key(ss_key).is_ok() && tm_old.send(tm_old_link.m_pair[0], DataPacket{ "pwd@epoch", "tester", "old peer" }).is_ok();
+
+    DataPacket tm_in {};
+    const bool tm_not_taken = tm_old_sent
+        && tm_server.recv(tm_old_link.m_pair[1], tm_in).get_code() == status::to_underlying(socket_code_t::key_not_accept)
+        && tm_server.get_session_epoch(tm_old_link.m_pair[1]) == 0 && tm_in.m_msg.empty();
+
+    ar_logger.write(tm_not_taken ? level_t::Info : level_t::Err, std::string("Peer Announcement | Server End Rejected: ") + (tm_not_taken ? "Passed" : "Failed"), GET_SOURCE);
+    disconnect(tm_old, tm_server, tm_old_link);
+
+    return tm_refused && tm_agreed && tm_not_taken;
+}
+
+/**
+ * @brief Bench
+ *
+ * Açık bağlantıların anahtarını değiştirmek ile aynı sayıda
+ * bağlantının yeniden el sıkışıp oturum açmasının bağlantı
+ * başına süresini ölçer. Duyurular karşı uçta okunur
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool bench(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_server_cipher("bench-server", ss_key);
+    ChaCha20Poly1305 tm_client_cipher("bench-client", ss_key);
+
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5107, ipv_t::ipv4, ss_flag);
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "key-epoch", "pwd@epoch", 5108, ipv_t::ipv4, ss_flag);
+
+    std::vector<Link> tm_links(ss_bench_count);
+
+    // RECONNECT: HANDSHAKE BOTH WAYS AND OPEN BOTH SESSIONS
+    bool tm_ok = true;
+    const auto tm_conn_start = std::chrono::steady_clock::now();
+    for(auto& tm_link : tm_links)
+        tm_ok = connect(tm_client, tm_server, tm_link) && tm_ok;
+    const double tm_conn_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_conn_start).count() / ss_bench_count;
+
+    // ROTATE: ONE ANNOUNCEMENT PER CONNECTION, PEER APPLIES IT ON ITS NEXT READ
+    const auto tm_rot_start = std::chrono::steady_clock::now();
+    tm_ok = tm_server.rotate_key(ss_next_key).is_ok() && tm_ok;
+    for(auto& tm_link : tm_links)
+        tm_ok = exchange(tm_server, tm_link.m_pair[1], tm_client, tm_link.m_pair[0], "ping").is_ok() && tm_ok;
+    const double tm_rot_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_rot_start).count() / ss_bench_count;
+
+    for(auto& tm_link : tm_links)
+    {
+        tm_ok = tm_ok && tm_client.get_session_epoch(tm_link.m_pair[0]) == 1;
+        disconnect(tm_client, tm_server, tm_link);
+    }
+
+    std::ostringstream tm_line;
+    tm_line << std::fixed << std::setprecision(1)
+        << ss_bench_count << " Connections | Reconnect: " << tm_conn_us << " us/conn"
+        << " | Rotate + First Message: " << tm_rot_us << " us/conn"
+        << " | Result: " << (tm_ok ? "Passed" : "Failed");
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_line.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_frame(vv_testlog);
+    vv_ok = check_rotate(vv_testlog) && vv_ok;
+    vv_ok = check_stream(vv_testlog) && vv_ok;
+    vv_ok = check_replay(vv_testlog) && vv_ok;
+    vv_ok = check_concurrent(vv_testlog) && vv_ok;
+    vv_ok = bench(vv_testlog) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,221 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Packet Alloc (Paket Bellek Ayırma)
+ *
+ * Genel operator new yeniden tanımlanarak bellek ayırma sayısı
+ * tutulur. Paketin verilen alana yazılmasının (encode) ve
+ * ısınma sonrası soket gönderiminin hiç bellek ayırmadığını,
+ * eski pack yolunun ise mesaj başına kaç kez bellek ayırdığını
+ * ölçeceğiz. Düz, toplu ve sıkıştırma + CRC gönderimleri
+ * ayrı ayrı denenir
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-alloc.cpp -pthread -o bsd/packet-alloc.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-alloc.cpp -pthread -o linux/packet-alloc.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/packet-alloc.bsd
+ *  Linux   :: ./linux/packet-alloc.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Allocation Counter
+// GCC, malloc ile açılan alanın free ile silindiğini göremediği için yanlış uyarı verir
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::atomic<uint64_t> ss_alloc_count { 0 };
+
+void* operator new(std::size_t ar_size)
+{
+    ss_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if( void* tm_ptr = std::malloc(ar_size ? ar_size : 1) )
+        return tm_ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ar_ptr) noexcept { std::free(ar_ptr); }
+void operator delete(void* ar_ptr, std::size_t) noexcept { std::free(ar_ptr); }
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "packet-alloc-" + ss_osname;
+
+static constexpr uint32_t ss_warmup = 64;
+static constexpr uint32_t ss_rounds = 20000;
+
+/**
+ * @brief Report
+ *
+ * Ölçülen sayıyı kayda yazar, beklenen üst sınırı
+ * aşarsa hata olarak işaretler
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Title
+ * @param uint64_t Allocations
+ * @param bool Must Be Zero
+ * @return bool
+ */
+template<class... Args>
+bool report(Logger<Args...>& ar_logger, const std::string& ar_title, const uint64_t ar_allocs, const bool ar_zero)
+{
+    const bool tm_ok = !ar_zero || ar_allocs == 0;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err,
+        ar_title + " | Allocations: " + std::to_string(ar_allocs) + " / " + std::to_string(ss_rounds) + " messages", GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Encode
+ *
+ * Eski pack yolu ile yeni encode yolunu karşılaştırır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_encode(Logger<Args...>& ar_logger)
+{
+    const std::string tm_name = "tester-with-a-long-enough-name";
+    const std::string tm_msg(200, 'm');
+    const std::u32string tm_u32_name = U"kullanıcı-adı-uzun-bir-örnek";
+    const std::u32string tm_u32_msg(200, U'ç');
+
+    netpacket::buffer_t tm_buffer {};
+    std::size_t tm_check = 0;
+
+    // LEGACY PACK
+    uint64_t tm_start = ss_alloc_count.load();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+    {
+        netpacket::NetPacket tm_packet("", tm_name, tm_msg);
+        tm_check += tm_packet.get().size();
+    }
+    report(ar_logger, "Legacy pack      ", ss_alloc_count.load() - tm_start, false);
+
+    // ENCODE UTF-8
+    tm_start = ss_alloc_count.load();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+        tm_check -= netpacket::NetPacket::encode(tm_buffer, "", tm_name, tm_msg);
+    bool tm_ok = report(ar_logger, "Encode utf-8     ", ss_alloc_count.load() - tm_start, true);
+
+    // ENCODE UTF-32
+    tm_start = ss_alloc_count.load();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+        tm_check += netpacket::NetPacket::encode(tm_buffer, U"", tm_u32_name, tm_u32_msg, netpacket::_FRAME_CRC);
+    tm_ok = report(ar_logger, "Encode utf-32+crc", ss_alloc_count.load() - tm_start, true) && tm_ok;
+
+    // SAME BYTES AS PACK
+    netpacket::NetPacket tm_packet(U"", tm_u32_name, tm_u32_msg);
+    const std::size_t tm_len = netpacket::NetPacket::encode(tm_buffer, U"", tm_u32_name, tm_u32_msg);
+    tm_ok = tm_ok && tm_check != 0 && tm_len == tm_packet.get().size()
+        && std::equal(tm_packet.get().begin(), tm_packet.get().end(), tm_buffer.begin())
+        && tm_packet.getMessage() == utf::to_utf8(tm_u32_msg);
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Send
+ *
+ * Isınma sonrası soket gönderiminde bellek ayrılıp
+ * ayrılmadığını ölçer. Karşı uç ham okuma ile boşaltılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Title
+ * @param flag_t Flag
+ * @return bool
+ */
+template<class... Args>
+bool check_send(Logger<Args...>& ar_logger, const std::string& ar_title, const flag::flag_t ar_flag)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    Xor tm_cipher("alloc-cipher", utf::to_utf8(U"key-alloc@20261018"));
+    Socket tm_socket(tm_cipher, "logs/socket-" + ss_logname, "packet-alloc", "pwd@alloc", 5070, ipv_t::ipv4, ar_flag);
+    tm_socket.open_session(tm_pair[0], tm_socket.get_feature());
+
+    std::thread tm_drain([&]{
+        static char ss_sink[64 * 1024];
+        while( ::read(tm_pair[1], ss_sink, sizeof(ss_sink)) > 0 ) {}
+    });
+
+    DataPacket tm_out { "pwd@alloc", "tester-with-a-long-enough-name", std::string(300, 'a') };
+
+    bool tm_sent = true;
+    for(uint32_t tm_count = 0; tm_count < ss_warmup; ++tm_count)
+        tm_sent = tm_socket.send(tm_pair[0], tm_out).is_ok() && tm_sent;
+
+    // LET THE BATCH DEADLINE FIRE ONCE SO THE FLUSHER IS WARM TOO
+    std::this_thread::sleep_for(std::chrono::microseconds(tm_socket.get_batch_delay() * 4));
+    tm_socket.flush(tm_pair[0]);
+
+    const uint64_t tm_start = ss_alloc_count.load();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+        tm_sent = tm_socket.send(tm_pair[0], tm_out).is_ok() && tm_sent;
+    tm_socket.flush(tm_pair[0]);
+    const uint64_t tm_allocs = ss_alloc_count.load() - tm_start;
+
+    tm_socket.close_session(tm_pair[0]);
+    ::shutdown(tm_pair[0], SHUT_WR);
+    tm_drain.join();
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    return report(ar_logger, ar_title, tm_allocs, true) && tm_sent;
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_encode(vv_testlog);
+    vv_ok = check_send(vv_testlog, "Send direct      ", _FLAG_SOCKET_NULL) && vv_ok;
+    vv_ok = check_send(vv_testlog, "Send batch       ", _FLAG_SOCKET_BATCH) && vv_ok;
+    vv_ok = check_send(vv_testlog, "Send compress+crc", _FLAG_SOCKET_COMPRESS | _FLAG_SOCKET_CRC) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,194 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Packet Batch (Paket Toplu Gönderim)
+ *
+ * Yoğun odalarda her istemci milisaniyede birçok küçük mesaj
+ * gönderir. Toplu gönderim açık olduğunda paketler bağlantı başına
+ * tamponda birleşir ve boyut ya da mikrosaniye süre dolunca tek
+ * seferde gönderilir. Yerel TCP bağlantısı üzerinden toplu gönderim
+ * kapalı ve açıkken saniyedeki mesaj sayısını ölçüp, alınan
+ * mesajların sırasının ve içeriğinin bozulmadığını kontrol edeceğiz
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-batch.cpp -pthread -o bsd/packet-batch.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-batch.cpp -pthread -o linux/packet-batch.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/packet-batch.bsd
+ *  Linux   :: ./linux/packet-batch.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "packet-batch-" + ss_osname;
+
+static constexpr uint32_t ss_msg_count = 100000;
+
+/**
+ * @brief Tcp Pair
+ *
+ * Yerel adres üzerinde dinleyen bir soket açar, ona bağlanır
+ * ve bağlantının iki ucunu döndürür
+ *
+ * @param socket_t& Sender
+ * @param socket_t& Receiver
+ * @return bool
+ */
+bool tcp_pair(socket_t& ar_send, socket_t& ar_recv)
+{
+    socket_t tm_listen = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if( !Socket::is_valid_socket(tm_listen) )
+        return false;
+
+    sockaddr_in tm_addr {};
+    tm_addr.sin_family = AF_INET;
+    tm_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    tm_addr.sin_port = 0;
+
+    socklen_t tm_len = sizeof(tm_addr);
+    if( ::bind(tm_listen, reinterpret_cast<sockaddr*>(&tm_addr), sizeof(tm_addr)) != 0
+        || ::listen(tm_listen, 1) != 0
+        || ::getsockname(tm_listen, reinterpret_cast<sockaddr*>(&tm_addr), &tm_len) != 0 )
+    {
+        Socket::close_socket(tm_listen);
+        return false;
+    }
+
+    ar_send = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if( ::connect(ar_send, reinterpret_cast<sockaddr*>(&tm_addr), sizeof(tm_addr)) != 0 )
+    {
+        Socket::close_socket(tm_listen);
+        return false;
+    }
+
+    ar_recv = ::accept(tm_listen, nullptr, nullptr);
+    Socket::close_socket(tm_listen);
+
+    return Socket::is_valid_socket(ar_send) && Socket::is_valid_socket(ar_recv);
+}
+
+/**
+ * @brief Run
+ *
+ * Belirlenen sayıda küçük mesajı gönderir, karşı tarafta ayrı
+ * bir işlem ile alır. Alınan her mesajın sıra numarası kontrol
+ * edilir. Saniyedeki mesaj sayısı kayda yazılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Title
+ * @param flag_t Flag
+ * @return bool
+ */
+template<class... Args>
+bool run(Logger<Args...>& ar_logger, const std::string& ar_title, const flag::flag_t ar_flag)
+{
+    socket_t tm_send_sock = ss_inv_socket;
+    socket_t tm_recv_sock = ss_inv_socket;
+
+    if( !tcp_pair(tm_send_sock, tm_recv_sock) )
+        return false;
+
+    Xor tm_cipher("batch-cipher", utf::to_utf8(U"key-batch@20261018"));
+    Socket tm_socket(tm_cipher, "logs/socket-" + ss_logname, "packet-batch", "pwd@batch", 5070, ipv_t::ipv4, ar_flag);
+
+    // BOTH ENDS OFFER THE SAME FEATURES
+    tm_socket.open_session(tm_send_sock, tm_socket.get_feature());
+    tm_socket.open_session(tm_recv_sock, tm_socket.get_feature());
+
+    uint32_t tm_received = 0;
+    bool tm_order = true;
+
+    std::thread tm_reader([&]{
+        DataPacket tm_in;
+        while( tm_received < ss_msg_count )
+        {
+            if( !tm_socket.recv(tm_recv_sock, tm_in).is_ok() )
+                break;
+
+            if( tm_in.m_msg != "msg-" + std::to_string(tm_received) )
+                tm_order = false;
+
+            ++tm_received;
+        }
+    });
+
+    DataPacket tm_out { "", "tester", "" };
+
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_msg_count; ++tm_count)
+    {
+        tm_out.m_msg = "msg-" + std::to_string(tm_count);
+        if( !tm_socket.send(tm_send_sock, tm_out).is_ok() )
+            break;
+    }
+
+    tm_socket.flush(tm_send_sock);
+    tm_reader.join();
+
+    const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    tm_socket.close_session(tm_send_sock);
+    tm_socket.close_session(tm_recv_sock);
+    Socket::close_socket(tm_send_sock);
+    Socket::close_socket(tm_recv_sock);
+
+    const bool tm_ok = tm_received == ss_msg_count && tm_order;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(0)
+        << ar_title
+        << " | Messages: " << tm_received << '/' << ss_msg_count
+        << " | Order: " << (tm_order ? "Kept" : "Broken")
+        << " | Rate: " << (tm_sec > 0 ? static_cast<double>(tm_received) / tm_sec : 0.0) << " msg/s";
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = run(vv_testlog, "Direct", _FLAG_SOCKET_NULL);
+    vv_ok = run(vv_testlog, "Batch ", _FLAG_SOCKET_BATCH) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,314 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Packet Compress (Paket Sıkıştırma)
+ *
+ * Sohbet trafiğine benzeyen yapay bir mesaj kümesi üzerinde
+ * LZ sıkıştırıcının oranını ve hızını (MB/s) ölçeceğiz. Mesajlar
+ * tek tek sıkıştırılır çünkü soket de her mesajı ayrı sıkıştırır.
+ * Farklı eşik değerleri için toplam kazanç da raporlanır. Posix
+ * sistemlerde soket çifti ile el sıkışmada anlaşılmış sıkıştırmanın
+ * gönderme/alma hattında doğru çalıştığı da kontrol edilir
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-compress.cpp -pthread -o bsd/packet-compress.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-compress.cpp -o linux/packet-compress.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-compress.cpp -o windows/packet-compress.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/packet-compress.bsd
+ *  Linux   :: ./linux/packet-compress.linux
+ *  Windows :: ./windows/packet-compress.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+using namespace tools::compress;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "packet-compress-" + ss_osname;
+
+static constexpr uint32_t ss_msg_count = 20000;
+static constexpr uint32_t ss_round = 10;
+
+/**
+ * @brief Make Corpus
+ *
+ * Kullanıcı adları, sık kullanılan kalıplar, emojiler, bağlantılar
+ * ve ara sıra yapıştırılmış uzun log/kod parçaları ile sohbet
+ * odasına benzeyen mesajlar üretir
+ *
+ * @param uint32_t Count
+ * @return vector<string>
+ */
+std::vector<std::string> make_corpus(const uint32_t ar_count)
+{
+    static const char* tm_users[] = { "kadir", "ayse", "mehmet", "zeynep", "bot-room", "tester" };
+    static const char* tm_words[] = {
+        "merhaba", "selam", "nasılsın", "iyiyim", "teşekkürler", "sunucu", "bağlantı", "tamam",
+        "hello", "thanks", "server", "restart", "deploy", "build", "failed", "passed", "ok", "lol",
+        "yarın", "toplantı", "saat", "mesaj", "dosya", "güncelleme", "hata", "düzeldi", "👍", "😂", "🔥"
+    };
+    static const char* tm_pastes[] = {
+        "[Info] [2026-10-18 12:00:01:120|server.hpp:server_runner:733] 127.0.0.1 Added To Client List\n",
+        "[Debug] [2026-10-18 12:00:01:121|socket.hpp:send:1010] 127.0.0.1 Sent\n",
+        "    if( !Socket::is_valid_socket(ar_target_sock) )\n        return Status::err(domain_t::socket, code);\n",
+        "https://github.com/AKadirUzmali/Kripton/blob/main/include/socket/socket.hpp#L959\n"
+    };
+
+    std::mt19937 tm_rng(20261018);
+    std::vector<std::string> tm_corpus;
+    tm_corpus.reserve(ar_count);
+
+    for(uint32_t tm_count = 0; tm_count < ar_count; ++tm_count)
+    {
+        std::string tm_msg;
+        const uint32_t tm_kind = tm_rng() % 100;
+
+        // LONG PASTE (LOG OR CODE)
+        if( tm_kind < 8 )
+        {
+            const uint32_t tm_lines = 3 + tm_rng() % 20;
+            for(uint32_t tm_line = 0; tm_line < tm_lines && tm_msg.size() < netpacket::_SIZE_MESSAGE - 128; ++tm_line)
+                tm_msg += tm_pastes[tm_rng() % std::size(tm_pastes)];
+        }
+        // NORMAL CHAT LINE
+        else
+        {
+            tm_msg = std::string("@") + tm_users[tm_rng() % std::size(tm_users)] + ' ';
+            const uint32_t tm_words_count = 2 + tm_rng() % (tm_kind < 40 ? 6 : 40);
+            for(uint32_t tm_word = 0; tm_word < tm_words_count; ++tm_word)
+                tm_msg += std::string(tm_words[tm_rng() % std::size(tm_words)]) + ' ';
+        }
+
+        tm_corpus.push_back(std::move(tm_msg));
+    }
+
+    return tm_corpus;
+}
+
+/**
+ * @brief To MBps
+ *
+ * Bayt ve geçen süreden saniye başına megabayt hesaplar
+ *
+ * @param size_t Bytes
+ * @param double Seconds
+ * @return double
+ */
+double to_mbps(const std::size_t ar_bytes, const double ar_sec)
+{
+    return ar_sec > 0 ? (static_cast<double>(ar_bytes) / (1024.0 * 1024.0)) / ar_sec : 0.0;
+}
+
+/**
+ * @brief Bench Codec
+ *
+ * Mesajları tek tek sıkıştırıp açar, çıktının aynı olduğunu
+ * doğrular ve oran ile hızı kayda yazar
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param vector<string>& Corpus
+ * @return bool
+ */
+template<class... Args>
+bool bench_codec(Logger<Args...>& ar_logger, const std::vector<std::string>& ar_corpus)
+{
+    std::vector<std::string> tm_packed(ar_corpus.size());
+    std::string tm_unpacked;
+
+    std::size_t tm_raw = 0;
+    for(const auto& tm_msg : ar_corpus)
+        tm_raw += tm_msg.size();
+
+    // COMPRESS
+    std::size_t tm_out = 0;
+    const auto tm_cstart = std::chrono::steady_clock::now();
+    for(uint32_t tm_round = 0; tm_round < ss_round; ++tm_round)
+    {
+        tm_out = 0;
+        for(std::size_t tm_count = 0; tm_count < ar_corpus.size(); ++tm_count)
+        {
+            if( !lz::compress(ar_corpus[tm_count], tm_packed[tm_count]) )
+                tm_packed[tm_count].clear();
+
+            tm_out += tm_packed[tm_count].empty() ? ar_corpus[tm_count].size() : tm_packed[tm_count].size();
+        }
+    }
+    const double tm_csec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_cstart).count();
+
+    // DECOMPRESS AND VERIFY
+    std::size_t tm_failed = 0;
+    const auto tm_dstart = std::chrono::steady_clock::now();
+    for(uint32_t tm_round = 0; tm_round < ss_round; ++tm_round)
+    {
+        for(std::size_t tm_count = 0; tm_count < ar_corpus.size(); ++tm_count)
+        {
+            if( tm_packed[tm_count].empty() )
+                continue;
+
+            if( !lz::decompress(tm_packed[tm_count], tm_unpacked, netpacket::_SIZE_MESSAGE) || tm_unpacked != ar_corpus[tm_count] )
+                ++tm_failed;
+        }
+    }
+    const double tm_dsec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_dstart).count();
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(3)
+        << "Messages: " << ar_corpus.size()
+        << " | Raw: " << tm_raw << " B"
+        << " | Packed: " << tm_out << " B"
+        << " | Ratio: " << (tm_out ? static_cast<double>(tm_raw) / static_cast<double>(tm_out) : 0.0)
+        << " | Compress: " << to_mbps(tm_raw * ss_round, tm_csec) << " MB/s"
+        << " | Decompress: " << to_mbps(tm_raw * ss_round, tm_dsec) << " MB/s";
+
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+
+    if( tm_failed )
+        ar_logger.write(level_t::Err, "Round Trip Failed: " + std::to_string(tm_failed), GET_SOURCE);
+
+    return tm_failed == 0;
+}
+
+/**
+ * @brief Bench Threshold
+ *
+ * Soketin uyguladığı kuralı taklit eder: eşik altındaki mesajlar
+ * ve küçülmeyen mesajlar ham gönderilir. Her eşik için ağa çıkan
+ * toplam bayt raporlanır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param vector<string>& Corpus
+ */
+template<class... Args>
+void bench_threshold(Logger<Args...>& ar_logger, const std::vector<std::string>& ar_corpus)
+{
+    static constexpr buff_size_t tm_thresholds[] = { _MIN_COMPRESS_THRESHOLD, 64, _DEF_COMPRESS_THRESHOLD, 256, 512 };
+
+    std::string tm_packed;
+    for(const buff_size_t tm_threshold : tm_thresholds)
+    {
+        std::size_t tm_raw = 0;
+        std::size_t tm_wire = 0;
+        std::size_t tm_compressed = 0;
+
+        for(const auto& tm_msg : ar_corpus)
+        {
+            tm_raw += tm_msg.size();
+
+            if( tm_msg.size() >= tm_threshold && lz::compress(tm_msg, tm_packed) ) {
+                tm_wire += tm_packed.size();
+                ++tm_compressed;
+            }
+            else
+                tm_wire += tm_msg.size();
+        }
+
+        std::stringstream tm_sstream;
+        tm_sstream << std::fixed << std::setprecision(3)
+            << "Threshold: " << std::setw(4) << tm_threshold
+            << " | Compressed Messages: " << tm_compressed
+            << " | Wire: " << tm_wire << " B"
+            << " | Saved: " << (100.0 - 100.0 * static_cast<double>(tm_wire) / static_cast<double>(tm_raw)) << " %";
+
+        ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+    }
+}
+
+#if __OS_POSIX__
+/**
+ * @brief Pipeline Check
+ *
+ * Soket çifti üzerinde iki oturum açar, biri sıkıştırmayı
+ * destekler diğeri desteklemez. Anlaşılan oturumda mesaj
+ * sıkıştırılmış gider ve aynı şekilde geri açılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param string& Message
+ * @return bool
+ */
+template<class... Args>
+bool pipeline_check(Logger<Args...>& ar_logger, const std::string& ar_msg)
+{
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    Xor tm_cipher("compress-cipher", utf::to_utf8(U"key-compress@20261018"));
+    Socket tm_socket(tm_cipher, "logs/socket-" + ss_logname, "packet-compress", "pwd@compress", 5070, ipv_t::ipv4, _FLAG_SOCKET_COMPRESS);
+
+    // BOTH SIDES OFFER COMPRESSION
+    tm_socket.open_session(tm_pair[0], _FEATURE_COMPRESS);
+    tm_socket.open_session(tm_pair[1], _FEATURE_COMPRESS);
+
+    DataPacket tm_out { "", "tester", ar_msg };
+    DataPacket tm_in;
+
+    const Status tm_send = tm_socket.send(tm_pair[0], tm_out);
+    const Status tm_recv = tm_socket.recv(tm_pair[1], tm_in);
+
+    // PEER WITHOUT COMPRESSION MUST GET RAW FRAMES
+    tm_socket.open_session(tm_pair[0], _FEATURE_NULL);
+
+    DataPacket tm_raw_in;
+    const Status tm_raw_send = tm_socket.send(tm_pair[0], tm_out);
+    const Status tm_raw_recv = tm_socket.recv(tm_pair[1], tm_raw_in);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    const bool tm_ok = tm_send.is_ok() && tm_recv.is_ok() && tm_in.m_msg == ar_msg
+        && tm_raw_send.is_ok() && tm_raw_recv.is_ok() && tm_raw_in.m_msg == ar_msg;
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Socket Pipeline: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+#endif
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    const std::vector<std::string> vv_corpus = make_corpus(ss_msg_count);
+
+    bool vv_ok = bench_codec(vv_testlog, vv_corpus);
+    bench_threshold(vv_testlog, vv_corpus);
+
+    #if __OS_POSIX__
+        vv_ok = pipeline_check(vv_testlog, vv_corpus.front() + vv_corpus.front() + vv_corpus.front() + vv_corpus.front()) && vv_ok;
+    #endif
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,260 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Packet Schema (Paket Şeması)
+ *
+ * Paket başlığı yerleşiminin alan listesinden derleme zamanında
+ * üretildiğini, üretilen sabitlerin eski elle yazılmış değerler
+ * ile aynı olduğunu ve yazıcının eski snprintf biçimi ile bayt
+ * bayt aynı başlığı ürettiğini kontrol edeceğiz. Bozuk başlıkların
+ * reddedildiği, yeni paket türlerinin (durum, onay) ek kod
+ * yazmadan çalıştığı ve snprintf/sscanf ile hız farkı ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-schema.cpp -pthread -o bsd/packet-schema.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-schema.cpp -pthread -o linux/packet-schema.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 packet-schema.cpp -o windows/packet-schema.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/packet-schema.bsd
+ *  Linux   :: ./linux/packet-schema.linux
+ *  Windows :: ./windows/packet-schema.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <socket/socket.hpp>
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace netsocket;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "packet-schema-" + ss_osname;
+
+static constexpr uint32_t ss_rounds = 1000000;
+
+// Schema
+using PresenceSchema = netschema::Schema<
+    netschema::Text<netpacket::_SIZE_USERNAME>,
+    netschema::Value<uint8_t>,
+    netschema::Value<uint32_t>
+>;
+
+using AckSchema = netschema::Schema<
+    netschema::Value<uint32_t>
+>;
+
+// LAYOUT MUST MATCH THE OLD HAND WRITTEN CONSTANTS
+static_assert(netpacket::_PACK_LEN_PASSWORD == 3 && netpacket::_PACK_LEN_USERNAME == 3);
+static_assert(netpacket::_PACK_LEN_MESSAGE == 4 && netpacket::_PACK_LEN_FRAME == 2);
+static_assert(netpacket::_PACK_START_LEN_USERNAME == 3 && netpacket::_PACK_START_LEN_MESSAGE == 6);
+static_assert(netpacket::_PACK_START_LEN_FRAME == 10 && netpacket::_PACK_START_LEN_TOTAL == 12);
+static_assert(netpacket::_SIZE_SOCKET_TOTAL == 12 + 384 + 128 + 2048);
+static_assert(netpacket::_POS_START_USERNAME == 12 + 384 && netpacket::_POS_START_MESSAGE == 12 + 384 + 128);
+
+static_assert(PresenceSchema::size_header == 3 + 2 + 8 && AckSchema::size_header == 8);
+static_assert(PresenceSchema::hash != AckSchema::hash && AckSchema::hash != netpacket::DataSchema::hash);
+
+/**
+ * @brief Check Reference
+ *
+ * Rastgele alan değerleri için şemanın ürettiği başlık ile
+ * eski snprintf biçiminin ürettiği başlık karşılaştırılır,
+ * okunan değerlerin yazılan değerler ile aynı olduğu kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_reference(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(20261018);
+    uint32_t tm_failed = 0;
+
+    for(uint32_t tm_round = 0; tm_round < 100000; ++tm_round)
+    {
+        netpacket::DataSchema::values_t tm_values {
+            static_cast<uint32_t>(tm_rng() % (netpacket::_SIZE_PASSWORD + 1)),
+            static_cast<uint32_t>(tm_rng() % (netpacket::_SIZE_USERNAME + 1)),
+            static_cast<uint32_t>(tm_rng() % (netpacket::_SIZE_MESSAGE + 1)),
+            static_cast<uint32_t>(tm_rng() % 256)
+        };
+
+        char tm_old[netpacket::_SIZE_HEADER + 1] {};
+        std::snprintf(tm_old, sizeof(tm_old), "%03u%03u%04u%02x", tm_values[0], tm_values[1], tm_values[2], tm_values[3]);
+
+        char tm_new[netpacket::_SIZE_HEADER] {};
+        netpacket::DataSchema::values_t tm_back {};
+
+        if( !netpacket::DataSchema::write_header(tm_new, tm_values)
+            || std::memcmp(tm_old, tm_new, netpacket::_SIZE_HEADER) != 0
+            || !netpacket::DataSchema::read_header(tm_old, tm_back)
+            || tm_back != tm_values )
+            ++tm_failed;
+    }
+
+    ar_logger.write(tm_failed ? level_t::Err : level_t::Info, "Reference Compare Failed: " + std::to_string(tm_failed) + "/100000", GET_SOURCE);
+    return tm_failed == 0;
+}
+
+/**
+ * @brief Check Reject
+ *
+ * Geçersiz karakter, sınırı aşan uzunluk ve yetersiz alan
+ * durumlarının reddedildiği kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_reject(Logger<Args...>& ar_logger)
+{
+    netpacket::DataSchema::values_t tm_values {};
+
+    const bool tm_bad_char = !netpacket::DataSchema::read_header("00a004000101", tm_values);
+    const bool tm_bad_sign = !netpacket::DataSchema::read_header("-01004000101", tm_values);
+    const bool tm_over_max = !netpacket::DataSchema::read_header("999004000101", tm_values);
+    const bool tm_over_msg = !netpacket::DataSchema::read_header("000004999901", tm_values);
+    const bool tm_bad_hex = !netpacket::DataSchema::read_header("0000040001zz", tm_values);
+    const bool tm_upper_hex = netpacket::DataSchema::read_header("0000040001FF", tm_values) && tm_values[netpacket::_FIELD_FRAME] == 0xFF;
+
+    std::array<std::byte, 16> tm_small {};
+    netpacket::DataSchema::texts_t tm_texts { "", "tester", "message too long for buffer", "" };
+    const bool tm_no_room = netpacket::DataSchema::encode(tm_small.data(), tm_small.size(), tm_values, tm_texts) == 0;
+
+    const std::string tm_long(netpacket::_SIZE_USERNAME + 1, 'x');
+    std::vector<std::byte> tm_big(netpacket::_SIZE_SOCKET_TOTAL);
+    tm_texts = { "", tm_long, "message", "" };
+    const bool tm_too_long = netpacket::DataSchema::encode(tm_big.data(), tm_big.size(), tm_values, tm_texts) == 0;
+
+    const bool tm_ok = tm_bad_char && tm_bad_sign && tm_over_max && tm_over_msg && tm_bad_hex && tm_upper_hex && tm_no_room && tm_too_long;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Corrupt Header Reject: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Check Types
+ *
+ * Sadece alan listesi yazılarak oluşturulan durum ve onay
+ * paketleri yazılıp okunur
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_types(Logger<Args...>& ar_logger)
+{
+    // PRESENCE
+    std::array<std::byte, PresenceSchema::size_total> tm_buffer {};
+    PresenceSchema::values_t tm_values { 0, 2, 1760745600 };
+    const PresenceSchema::texts_t tm_texts { "tester", "", "" };
+
+    const size_t tm_size = PresenceSchema::encode(tm_buffer.data(), tm_buffer.size(), tm_values, tm_texts);
+    const char* tm_raw = reinterpret_cast<const char*>(tm_buffer.data());
+
+    PresenceSchema::values_t tm_back {};
+    PresenceSchema::texts_t tm_back_texts {};
+    const bool tm_presence = tm_size == PresenceSchema::size_header + 6
+        && PresenceSchema::read_header(tm_raw, tm_back)
+        && PresenceSchema::decode(tm_raw + PresenceSchema::size_header, tm_size - PresenceSchema::size_header, tm_back, tm_back_texts)
+        && tm_back == tm_values && tm_back_texts[0] == "tester";
+
+    // ACK
+    char tm_ack[AckSchema::size_header] {};
+    AckSchema::values_t tm_ack_values { 0xDEADBEEF };
+    AckSchema::values_t tm_ack_back {};
+    const bool tm_acked = AckSchema::write_header(tm_ack, tm_ack_values)
+        && std::string_view(tm_ack, sizeof(tm_ack)) == "deadbeef"
+        && AckSchema::read_header(tm_ack, tm_ack_back) && tm_ack_back == tm_ack_values;
+
+    const bool tm_ok = tm_presence && tm_acked;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Presence/Ack Schema: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Başlık yazma ve okuma süresi şema ile snprintf/sscanf
+ * arasında karşılaştırılır
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    char tm_header[netpacket::_SIZE_HEADER + 1] {};
+    netpacket::DataSchema::values_t tm_values {};
+    uint64_t tm_check = 0;
+
+    // SNPRINTF / SSCANF
+    auto tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+    {
+        unsigned short tm_pwd = 0, tm_name = 0, tm_msg = 0;
+        unsigned int tm_frame = 0;
+
+        std::snprintf(tm_header, sizeof(tm_header), "%03u%03u%04u%02x", tm_count % 385, tm_count % 129, tm_count % 2049, tm_count % 256);
+        std::sscanf(tm_header, "%03hu%03hu%04hu%02x", &tm_pwd, &tm_name, &tm_msg, &tm_frame);
+        tm_check += tm_pwd + tm_name + tm_msg + tm_frame;
+    }
+    const double tm_old_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    // SCHEMA
+    tm_start = std::chrono::steady_clock::now();
+    for(uint32_t tm_count = 0; tm_count < ss_rounds; ++tm_count)
+    {
+        tm_values = { tm_count % 385, tm_count % 129, tm_count % 2049, tm_count % 256 };
+        netpacket::DataSchema::write_header(tm_header, tm_values);
+        netpacket::DataSchema::read_header(tm_header, tm_values);
+        tm_check -= tm_values[0] + tm_values[1] + tm_values[2] + tm_values[3];
+    }
+    const double tm_new_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / ss_rounds;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(1)
+        << "Header Write+Read | snprintf/sscanf: " << tm_old_ns << " ns"
+        << " | Schema: " << tm_new_ns << " ns"
+        << " | Check: " << (tm_check == 0 ? "Equal" : "Differ");
+
+    ar_logger.write(tm_check == 0 ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+    vv_testlog.write(level_t::Info, "Schema Header: " + std::to_string(netpacket::DataSchema::size_header) + " B | Total: " + std::to_string(netpacket::DataSchema::size_total) + " B", GET_SOURCE);
+
+    bool vv_ok = check_reference(vv_testlog);
+    vv_ok = check_reject(vv_testlog) && vv_ok;
+    vv_ok = check_types(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,270 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Parallel Cipher
+ *
+ * Büyük tamponların parçalara bölünüp ThreadPool üzerinde
+ * şifrelenmesinin tek geçişte şifrelemek ile aynı sonucu
+ * verdiğini ChaCha20 ve AES-CTR için kontrol edeceğiz.
+ * Eşik sınırındaki boyutlar, blok katı olmayan uzunluklar ve
+ * sayacın taştığı noktalar da denenir. Çalışan sayısına göre
+ * hız (GB/s) ve tek iş parçacığına göre hızlanma ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 parallel-cipher.cpp -pthread -o bsd/parallel-cipher.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 parallel-cipher.cpp -pthread -o linux/parallel-cipher.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 parallel-cipher.cpp -o windows/parallel-cipher.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/parallel-cipher.bsd
+ *  Linux   :: ./linux/parallel-cipher.linux
+ *  Windows :: ./windows/parallel-cipher.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+#include <pool/parallelpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+using namespace pool::threadpool;
+
+namespace parallelpool = pool::parallelpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "parallel-cipher-" + ss_osname;
+
+static const std::size_t ss_sizes[] =
+{
+    0,
+    1000,
+    parallelpool::_MIN_LEN_PARALLEL - 1,
+    parallelpool::_MIN_LEN_PARALLEL,
+    parallelpool::_MIN_LEN_PARALLEL + 17,
+    3 * 1024 * 1024 + 5,
+    8 * 1024 * 1024
+};
+
+/**
+ * @brief Random Bytes
+ *
+ * @param mt19937& Random
+ * @param size_t Length
+ * @return string
+ */
+std::string random_bytes(std::mt19937& ar_rng, const std::size_t ar_len)
+{
+    std::string tm_out(ar_len, '\0');
+    for(auto& tm_char : tm_out)
+        tm_char = static_cast<char>(ar_rng());
+    return tm_out;
+}
+
+/**
+ * @brief Check Cipher
+ *
+ * Verilen şifreleyici ile her boyutta paralel sonucu tek
+ * geçiş ile karşılaştırır, ardından paralel şifre çözme ile
+ * düz metne dönüldüğünü kontrol eder
+ *
+ * @tparam Cipher Cipher
+ * @tparam Logger<Args...>& Logger
+ * @param ThreadPool& Pool
+ * @param Cipher& Cipher
+ * @param string& Title
+ * @return bool
+ */
+template<class Cipher, class... Args>
+bool check_cipher(Logger<Args...>& ar_logger, ThreadPool& ar_pool, const Cipher& ar_cipher, const std::string& ar_title)
+{
+    std::mt19937 tm_rng(1018);
+
+    bool tm_ok = true;
+    for(const std::size_t tm_size : ss_sizes)
+    {
+        const std::string tm_plain = random_bytes(tm_rng, tm_size);
+
+        std::string tm_serial = tm_plain;
+        std::string tm_parallel = tm_plain;
+
+        bool tm_pass = ar_cipher.apply(reinterpret_cast<unsigned char*>(tm_serial.data()), tm_size);
+        tm_pass = tm_pass && parallelpool::encrypt(ar_pool, ar_cipher, reinterpret_cast<std::byte*>(tm_parallel.data()), tm_size);
+        tm_pass = tm_pass && tm_parallel == tm_serial;
+        tm_pass = tm_pass && parallelpool::decrypt(ar_pool, ar_cipher, reinterpret_cast<std::byte*>(tm_parallel.data()), tm_size);
+        tm_pass = tm_pass && tm_parallel == tm_plain;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, ar_title + " | Size: " + std::to_string(tm_size) + " | " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Seek
+ *
+ * Tamponun iki parçaya bölünüp ikinci parçanın blok konumu
+ * ile şifrelenmesinin tek geçiş ile aynı olduğunu ve hatalı
+ * şifreleyicinin reddedildiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param ThreadPool& Pool
+ * @return bool
+ */
+template<class... Args>
+bool check_seek(Logger<Args...>& ar_logger, ThreadPool& ar_pool)
+{
+    std::mt19937 tm_rng(2026);
+    bool tm_ok = true;
+
+    for(uint32_t tm_round = 0; tm_round < 200; ++tm_round)
+    {
+        ChaCha20 tm_chacha("chacha20", random_bytes(tm_rng, 32), ChaCha20::nonce_t{ static_cast<uint8_t>(tm_round) }, 0xFFFFFFFFu - (tm_rng() % 64));
+
+        AesCtr::nonce_t tm_counter {};
+        for(auto& tm_byte : tm_counter)
+            tm_byte = static_cast<uint8_t>(tm_rng());
+        std::fill(tm_counter.begin() + 8, tm_counter.end(), 0xFF);
+        AesCtr tm_aes("aes-ctr", random_bytes(tm_rng, 32), tm_counter);
+
+        const std::size_t tm_len = 1 + tm_rng() % 20000;
+        const std::size_t tm_split = (tm_rng() % (tm_len / 64 + 1)) * 64;
+        const std::string tm_plain = random_bytes(tm_rng, tm_len);
+
+        std::string tm_whole = tm_plain, tm_parts = tm_plain;
+        tm_chacha.apply(reinterpret_cast<unsigned char*>(tm_whole.data()), tm_len);
+        tm_chacha.apply(reinterpret_cast<unsigned char*>(tm_parts.data()), tm_split);
+        tm_chacha.apply(reinterpret_cast<unsigned char*>(tm_parts.data()) + tm_split, tm_len - tm_split, tm_split / ChaCha20::_SIZE_BLOCK);
+        tm_ok = tm_ok && tm_whole == tm_parts;
+
+        tm_whole = tm_plain, tm_parts = tm_plain;
+        tm_aes.apply(reinterpret_cast<uint8_t*>(tm_whole.data()), tm_len);
+        tm_aes.apply(reinterpret_cast<uint8_t*>(tm_parts.data()), tm_split);
+        tm_aes.apply(reinterpret_cast<uint8_t*>(tm_parts.data()) + tm_split, tm_len - tm_split, tm_split / AesCtr::_SIZE_BLOCK);
+        tm_ok = tm_ok && tm_whole == tm_parts;
+    }
+
+    ChaCha20 tm_short("chacha20", std::string(16, 'k'));
+    std::string tm_text(parallelpool::_MIN_LEN_PARALLEL * 2, 'x');
+    tm_ok = tm_ok && !parallelpool::encrypt(ar_pool, tm_short, reinterpret_cast<std::byte*>(tm_text.data()), tm_text.size());
+    tm_ok = tm_ok && tm_text == std::string(tm_text.size(), 'x');
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Seek And Invalid Key: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Measure
+ *
+ * Verilen işlemin saniyedeki gigabayt miktarını döndürür
+ *
+ * @tparam Func Function
+ * @param size_t Size
+ * @param size_t Rounds
+ * @param Func Function
+ * @return double
+ */
+template<class Func>
+double measure(const std::size_t ar_size, const std::size_t ar_rounds, Func&& ar_func)
+{
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_round = 0; tm_round < ar_rounds; ++tm_round)
+        ar_func();
+    const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    return static_cast<double>(ar_rounds * ar_size) / tm_sec / 1e9;
+}
+
+/**
+ * @brief Bench
+ *
+ * Verilen boyuttaki tamponu tek iş parçacığında ve artan
+ * çalışan sayılı havuzlarda şifreler. Çağıran iş parçacığı
+ * da çalıştığı için toplam iş parçacığı çalışan sayısının
+ * bir fazlasıdır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    std::vector<unsigned char> tm_data(ar_size, 0x5A);
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 29) / ar_size);
+
+    const ChaCha20 tm_chacha("chacha20", std::string(32, 'k'));
+    const AesCtr tm_aes("aes-ctr", std::string(16, 'k'));
+
+    const double tm_chacha_serial = measure(ar_size, tm_rounds, [&]{ tm_chacha.apply(tm_data.data(), ar_size); });
+    const double tm_aes_serial = measure(ar_size, tm_rounds, [&]{ tm_aes.apply(tm_data.data(), ar_size); });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: " << std::setw(8) << ar_size << " B | Threads: 1"
+        << " | ChaCha20: " << tm_chacha_serial << " GB/s | AES-CTR: " << tm_aes_serial << " GB/s";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+
+    const std::size_t tm_cores = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for(std::size_t tm_threads = 2; tm_threads <= std::max<std::size_t>(2, tm_cores); tm_threads *= 2)
+    {
+        ThreadPool tm_pool(tm_threads - 1);
+
+        const double tm_chacha_speed = measure(ar_size, tm_rounds, [&]{ parallelpool::apply(tm_pool, tm_chacha, tm_data.data(), ar_size); });
+        const double tm_aes_speed = measure(ar_size, tm_rounds, [&]{ parallelpool::apply(tm_pool, tm_aes, tm_data.data(), ar_size); });
+
+        tm_sstream.str("");
+        tm_sstream << "Size: " << std::setw(8) << ar_size << " B | Threads: " << tm_threads
+            << " | ChaCha20: " << tm_chacha_speed << " GB/s (x" << tm_chacha_speed / tm_chacha_serial << ")"
+            << " | AES-CTR: " << tm_aes_speed << " GB/s (x" << tm_aes_speed / tm_aes_serial << ")";
+        ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+    }
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    ThreadPool vv_pool(4);
+
+    std::mt19937 vv_rng(1);
+    AesCtr::nonce_t vv_counter {};
+    std::fill(vv_counter.begin() + 12, vv_counter.end(), 0xFF);
+
+    const ChaCha20 vv_chacha("chacha20", random_bytes(vv_rng, 32), ChaCha20::nonce_t{ 7 }, 0xFFFFFF00u);
+    const AesCtr vv_aes128("aes-ctr", random_bytes(vv_rng, 16), vv_counter);
+    const AesCtr vv_aes256("aes-ctr", random_bytes(vv_rng, 32));
+
+    bool vv_ok = check_cipher(vv_testlog, vv_pool, vv_chacha, "ChaCha20");
+    vv_ok = check_cipher(vv_testlog, vv_pool, vv_aes128, "AES-128-CTR") && vv_ok;
+    vv_ok = check_cipher(vv_testlog, vv_pool, vv_aes256, "AES-256-CTR") && vv_ok;
+    vv_ok = check_seek(vv_testlog, vv_pool) && vv_ok;
+
+    for(const std::size_t vv_size : { 1024 * 1024, 16 * 1024 * 1024 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,350 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Password Policy (Şifre Politikası)
+ *
+ * PBKDF2-HMAC-SHA256 için RFC 7914 test vektörlerini, erişim
+ * politikasının şifreleri tuzlu özet olarak sakladığını ve
+ * doğru, eski ve yanlış şifreyi ayırdığını kontrol edeceğiz.
+ * Bağlantı önbelleğinin aynı şifre sürümünde girişi kabul
+ * ettiği; şifre, izin listesi ya da şifre gerekliliği değişince
+ * ve farklı şifre geldiğinde yeniden doğrulandığı, yasaklamanın
+ * önbelleği bozmadığı denenir. Sadece doğrulayan ucun açık
+ * şifre tutmadığı kontrol edilir. Tam doğrulama ile bağlantının
+ * katılma, önbellekli ve yanlış şifreli mesajının süresi ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 password-policy.cpp -pthread -o bsd/password-policy.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 password-policy.cpp -pthread -o linux/password-policy.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 password-policy.cpp -o windows/password-policy.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/password-policy.bsd
+ *  Linux   :: ./linux/password-policy.linux
+ *  Windows :: ./windows/password-policy.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <socket/policy.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+using namespace core::status;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+using namespace tools::hash;
+
+using namespace netsocket::policy;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "password-policy-" + ss_osname;
+
+static const std::string ss_ipaddr = "127.0.0.1";
+
+// Struct
+struct Vector
+{
+    const char* m_password;
+    const char* m_salt;
+    uint32_t m_rounds;
+    const char* m_hex;
+};
+
+// RFC 7914 (11) AND COMMON PBKDF2-HMAC-SHA256 VECTORS
+static const Vector ss_vectors[] =
+{
+    { "passwd", "salt", 1, "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783" },
+    { "Password", "NaCl", 80000, "4ddcd8f60b98be21830cee5ef22701f9641a4418d04c0414aeff08876b34ab56a1d425a1225833549adb841b51c9b3176a272bdebba1d078478f62b397f33c8d" },
+    { "password", "salt", 1, "120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b" },
+    { "password", "salt", 2, "ae4d0c95af6b46d32d0adff928f06dd02a303f8ef3c251dfd6e2d85a95474c43" },
+    { "password", "salt", 4096, "c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a" }
+};
+
+/**
+ * @brief To Hex
+ *
+ * @param uint8_t* Data
+ * @param size_t Length
+ * @return string
+ */
+std::string to_hex(const uint8_t* ar_data, const std::size_t ar_len)
+{
+    static constexpr char ss_digits[] = "0123456789abcdef";
+
+    std::string tm_hex;
+    for(std::size_t tm_count = 0; tm_count < ar_len; ++tm_count)
+    {
+        tm_hex += ss_digits[ar_data[tm_count] >> 4];
+        tm_hex += ss_digits[ar_data[tm_count] & 0x0f];
+    }
+
+    return tm_hex;
+}
+
+/**
+ * @brief Is Code
+ *
+ * @param Status& Status
+ * @param policy_e Code
+ * @return bool
+ */
+bool is_code(const Status& ar_status, const policy_e ar_code)
+{
+    return ar_status.get_code() == to_underlying(ar_code);
+}
+
+/**
+ * @brief Check Vectors
+ *
+ * Türetilen anahtarın test vektörleri ile aynı olduğunu ve
+ * sabit zamanlı karşılaştırmanın her konumdaki farkı
+ * yakaladığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_vectors(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    for(const Vector& tm_vector : ss_vectors)
+    {
+        const std::size_t tm_len = std::strlen(tm_vector.m_hex) / 2;
+        std::vector<uint8_t> tm_out(tm_len, 0);
+
+        const bool tm_derived = sha256::pbkdf2(tm_vector.m_password, tm_vector.m_salt, tm_vector.m_rounds, tm_out.data(), tm_len);
+        const bool tm_match = tm_derived && to_hex(tm_out.data(), tm_len) == tm_vector.m_hex;
+
+        ar_logger.write(tm_match ? level_t::Info : level_t::Err, std::string("Pbkdf2 | ") + tm_vector.m_password + " / " + tm_vector.m_salt
+            + " / " + std::to_string(tm_vector.m_rounds) + " | " + (tm_match ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_match;
+    }
+
+    uint8_t tm_left[sha256::_SIZE_DIGEST] {};
+    uint8_t tm_right[sha256::_SIZE_DIGEST] {};
+    bool tm_verify = sha256::verify(tm_left, tm_right, sizeof(tm_left)) && !sha256::pbkdf2("password", "salt", 0, tm_left, sizeof(tm_left));
+    for(std::size_t tm_count = 0; tm_verify && tm_count < sizeof(tm_right); ++tm_count)
+    {
+        tm_right[tm_count] = 0x01;
+        tm_verify = !sha256::verify(tm_left, tm_right, sizeof(tm_left));
+        tm_right[tm_count] = 0x00;
+    }
+
+    ar_logger.write(tm_verify ? level_t::Info : level_t::Err, std::string("Verify And Zero Rounds: ") + (tm_verify ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok && tm_verify;
+}
+
+/**
+ * @brief Check Store
+ *
+ * Aynı şifrenin iki politikada farklı tuz ve özet ile
+ * saklandığını, özetin tur sayısı ile eşleştiğini, doğru,
+ * eski ve yanlış şifrenin ayrıldığını kontrol eder. Sadece
+ * doğrulayan uç açık şifreyi siler, sonraki şifreleri de
+ * saklamaz ama doğrulamaya devam eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_store(Logger<Args...>& ar_logger)
+{
+    AccessPolicy tm_first("policy", "pwd@first");
+    AccessPolicy tm_second("policy", "pwd@first");
+
+    const PasswordHash tm_hash_first = tm_first.get_password_hash();
+    const PasswordHash tm_hash_second = tm_second.get_password_hash();
+
+    // CACHE KEY CAME FROM THE RANDOM DEVICE
+    bool tm_ok = !tm_first.has_error() && !tm_second.has_error();
+    tm_ok = tm_ok && tm_hash_first.m_rounds == _DEF_ROUNDS_PASSWORD && tm_first.get_old_password_hash().m_rounds == 0;
+    tm_ok = tm_ok && tm_hash_first.m_salt != tm_hash_second.m_salt && tm_hash_first.m_digest != tm_hash_second.m_digest;
+    tm_ok = tm_ok && AccessPolicy::is_password_match(tm_hash_first, "pwd@first") && !AccessPolicy::is_password_match(tm_hash_first, "pwd@First");
+    tm_ok = tm_ok && !AccessPolicy::is_password_match(PasswordHash {}, "");
+
+    tm_ok = tm_ok && is_code(tm_first.set_password_rounds(_MIN_ROUNDS_PASSWORD - 1), policy_e::value_under_min);
+    tm_ok = tm_ok && is_code(tm_first.set_password_rounds(_MIN_ROUNDS_PASSWORD), policy_e::set_password_rounds);
+    tm_ok = tm_ok && tm_first.set_password("pwd@second").is_ok() && tm_first.get_password_hash().m_rounds == _MIN_ROUNDS_PASSWORD;
+    tm_ok = tm_ok && tm_first.get_old_password_hash().m_digest == tm_hash_first.m_digest;
+
+    tm_ok = tm_ok && is_code(tm_first.can_auth(ss_ipaddr, "pwd@first"), policy_e::can_auth_no_password_require);
+    tm_ok = tm_ok && tm_first.set_require_password(true).is_ok();
+    tm_ok = tm_ok && is_code(tm_first.can_auth(ss_ipaddr, "pwd@second"), policy_e::can_auth_with_password);
+    tm_ok = tm_ok && is_code(tm_first.can_auth(ss_ipaddr, "pwd@first"), policy_e::cannot_auth_with_old_password);
+    tm_ok = tm_ok && is_code(tm_first.can_auth(ss_ipaddr, "pwd@third"), policy_e::cannot_auth_password_not_matched);
+    tm_ok = tm_ok && is_code(tm_first.can_auth(ss_ipaddr, ""), policy_e::cannot_auth_password_not_matched);
+    tm_ok = tm_ok && is_code(tm_first.set_password("abc"), policy_e::not_valid_password);
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Salted Store And Compare: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    // SENDING END KEEPS ITS PASSWORD, VERIFYING END KEEPS ONLY THE HASH
+    AccessPolicy tm_verifier("policy", "pwd@verify");
+    tm_verifier.set_password_rounds(_MIN_ROUNDS_PASSWORD);
+
+    bool tm_verify_ok = tm_first.get_password() == "pwd@second" && !tm_first.is_verify_only();
+    tm_verify_ok = tm_verify_ok && is_code(tm_verifier.set_verify_only(), policy_e::set_verify_only) && tm_verifier.is_verify_only() && tm_verifier.get_password().empty();
+    tm_verify_ok = tm_verify_ok && is_code(tm_verifier.set_verify_only(), policy_e::same_value);
+    tm_verify_ok = tm_verify_ok && tm_verifier.set_password("pwd@verify-next").is_ok() && tm_verifier.get_password().empty();
+    tm_verify_ok = tm_verify_ok && tm_verifier.set_require_password(true).is_ok();
+    tm_verify_ok = tm_verify_ok && is_code(tm_verifier.can_auth(ss_ipaddr, "pwd@verify-next"), policy_e::can_auth_with_password);
+    tm_verify_ok = tm_verify_ok && is_code(tm_verifier.can_auth(ss_ipaddr, "pwd@verify"), policy_e::cannot_auth_with_old_password);
+
+    ar_logger.write(tm_verify_ok ? level_t::Info : level_t::Err, std::string("Verify Only | No Cleartext, Still Verifies: ") + (tm_verify_ok ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok && tm_verify_ok;
+}
+
+/**
+ * @brief Check Cache
+ *
+ * Bağlantı önbelleğinin aynı şifre sürümünde kullanıldığını,
+ * farklı şifrede temizlendiğini, şifre ve izin değişikliklerinde
+ * geçersiz kaldığını, yasaklamada ise korunduğunu kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_cache(Logger<Args...>& ar_logger)
+{
+    AccessPolicy tm_policy("policy", "pwd@cache");
+    tm_policy.set_require_password(true);
+
+    AuthCache tm_cache {};
+    bool tm_ok = true;
+
+    // FIRST MESSAGE DERIVES, NEXT ONES HIT THE CACHE
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@cache", tm_cache), policy_e::can_auth_with_password) && tm_cache.m_verified;
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@cache", tm_cache), policy_e::can_auth_with_cache);
+
+    // A DIFFERENT PASSWORD NEVER PASSES ON THE CACHE
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@other", tm_cache), policy_e::cannot_auth_password_not_matched) && !tm_cache.m_verified;
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@cache", tm_cache), policy_e::can_auth_with_password);
+    const bool tm_mismatch = tm_ok;
+
+    // BANNING ANOTHER SOCKET KEEPS THE CACHE
+    tm_ok = tm_ok && tm_policy.set_ban(static_cast<socket_t>(42)).is_ok() && tm_policy.set_ban(static_cast<socket_t>(42), false).is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@cache", tm_cache), policy_e::can_auth_with_cache);
+    const bool tm_ban = tm_ok;
+
+    // PASSWORD CHANGE
+    tm_ok = tm_ok && tm_policy.set_password("pwd@change").is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@cache", tm_cache), policy_e::cannot_auth_with_old_password) && !tm_cache.m_verified;
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@change", tm_cache), policy_e::can_auth_with_password);
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@change", tm_cache), policy_e::can_auth_with_cache);
+    const bool tm_change = tm_ok;
+
+    // ALLOW LIST CHANGE
+    tm_ok = tm_ok && tm_policy.set_allow("10.0.0.1").is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@change", tm_cache), policy_e::not_allow_ipaddr_not_in_list) && !tm_cache.m_verified;
+    tm_ok = tm_ok && tm_policy.set_allow(ss_ipaddr).is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "pwd@change", tm_cache), policy_e::can_auth_with_password);
+
+    // REQUIRE PASSWORD CHANGE
+    tm_ok = tm_ok && tm_policy.set_require_password(false).is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "", tm_cache), policy_e::can_auth_no_password_require);
+    tm_ok = tm_ok && tm_policy.set_require_password(true).is_ok();
+    tm_ok = tm_ok && is_code(tm_policy.can_auth(ss_ipaddr, "", tm_cache), policy_e::cannot_auth_password_not_matched);
+    const bool tm_policy_change = tm_ok;
+
+    ar_logger.write(tm_mismatch ? level_t::Info : level_t::Err, std::string("Cache Hit And Mismatch: ") + (tm_mismatch ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_ban ? level_t::Info : level_t::Err, std::string("Cache After Ban/Unban: ") + (tm_ban ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_change ? level_t::Info : level_t::Err, std::string("Cache After Password Change: ") + (tm_change ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_policy_change ? level_t::Info : level_t::Err, std::string("Cache After Policy Change: ") + (tm_policy_change ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Önbelleksiz girişin, bağlantının katıldığı ilk mesajın,
+ * önbellekli ve yanlış şifreli mesajın süresini ölçer.
+ * Katılmanın tam doğrulama yaptığı, önbellekli mesajın
+ * türetme yapmadığı ve tam doğrulamadan en az yüz kat hızlı
+ * olduğu kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool bench(Logger<Args...>& ar_logger)
+{
+    AccessPolicy tm_policy("policy", "pwd@bench");
+    tm_policy.set_require_password(true);
+
+    static constexpr std::size_t ss_full = 5;
+    static constexpr std::size_t ss_cached = 200000;
+
+    bool tm_ok = true;
+
+    auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_count = 0; tm_count < ss_full; ++tm_count)
+        tm_ok = tm_policy.can_auth(ss_ipaddr, "pwd@bench").is_ok() && tm_ok;
+    const double tm_full_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / ss_full;
+
+    // JOIN, A NEW CONNECTION EVERY TIME, ONE FULL DERIVATION EACH
+    tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_count = 0; tm_count < ss_full; ++tm_count)
+    {
+        AuthCache tm_join {};
+        tm_ok = is_code(tm_policy.can_auth(ss_ipaddr, "pwd@bench", tm_join), policy_e::can_auth_with_password) && tm_ok;
+    }
+    const double tm_join_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / ss_full;
+
+    // WRONG PASSWORD NEVER REACHES THE CACHE, DERIVES EVERY TIME
+    AuthCache tm_wrong {};
+    tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_count = 0; tm_count < ss_full; ++tm_count)
+        tm_ok = is_code(tm_policy.can_auth(ss_ipaddr, "pwd@wrong", tm_wrong), policy_e::cannot_auth_password_not_matched) && tm_ok;
+    const double tm_wrong_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / ss_full;
+
+    AuthCache tm_cache {};
+    tm_ok = tm_policy.can_auth(ss_ipaddr, "pwd@bench", tm_cache).is_ok() && tm_ok;
+
+    tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_count = 0; tm_count < ss_cached; ++tm_count)
+        tm_ok = is_code(tm_policy.can_auth(ss_ipaddr, "pwd@bench", tm_cache), policy_e::can_auth_with_cache) && tm_ok;
+    const double tm_cached_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / ss_cached;
+
+    tm_ok = tm_ok && tm_cached_us * 100.0 < tm_full_us && tm_join_us * 2.0 > tm_full_us;
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(3) << "Rounds: " << _DEF_ROUNDS_PASSWORD
+               << " | Full: " << tm_full_us / 1000.0 << " ms/msg | Join: " << tm_join_us / 1000.0 << " ms/msg | Cached: " << tm_cached_us << " us/msg"
+               << " | Wrong: " << tm_wrong_us / 1000.0 << " ms/msg"
+               << " | Speedup: " << std::setprecision(0) << tm_full_us / tm_cached_us << "x";
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+
+    bool vv_ok = check_vectors(vv_testlog);
+    vv_ok = check_store(vv_testlog) && vv_ok;
+    vv_ok = check_cache(vv_testlog) && vv_ok;
+    vv_ok = bench(vv_testlog) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
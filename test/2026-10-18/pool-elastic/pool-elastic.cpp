@@ -0,0 +1,235 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Pool Elastic (Esnek Havuz)
+ *
+ * ThreadPool'un esnek boyutunu kontrol edeceğiz. Havuzun
+ * kurulurken iş parçacığı başlatmadığı, ilk görevde en az
+ * sayıda çalışanın başladığı, uzun görevler kuyrukta beklerken
+ * en çok sayıya kadar büyüdüğü, boşta kalınca en az sayıya
+ * küçüldüğü ve en az sayı 0 iken yeniden başladığı denenir.
+ * Çok sayıda havuzun kurulup kapatılma süresi ve başlayan
+ * iş parçacığı sayısı sabit havuz ile karşılaştırılır
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-elastic.cpp -pthread -o bsd/pool-elastic.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-elastic.cpp -pthread -o linux/pool-elastic.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-elastic.cpp -o windows/pool-elastic.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/pool-elastic.bsd
+ *  Linux   :: ./linux/pool-elastic.linux
+ *  Windows :: ./windows/pool-elastic.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/threadpool.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::threadpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "pool-elastic-" + ss_osname;
+
+/**
+ * @brief Wait Until
+ *
+ * Koşul sağlanana ya da süre dolana kadar bekler
+ *
+ * @tparam Cond Condition
+ * @param Cond&& Condition
+ * @return bool
+ */
+template<class Cond>
+bool wait_until(Cond&& ar_cond)
+{
+    const auto tm_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while( !ar_cond() )
+    {
+        if( std::chrono::steady_clock::now() > tm_deadline )
+            return false;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check Lazy
+ *
+ * Havuzların kurulurken iş parçacığı başlatmadığını, ilk
+ * görevde esnek havuzun en az sayıda, sabit havuzun tüm
+ * çalışanlarını başlattığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_lazy(Logger<Args...>& ar_logger)
+{
+    ThreadPool tm_default;
+    ThreadPool tm_elastic(1, 4);
+    ThreadPool tm_fixed(3);
+
+    const bool tm_idle = tm_default.get_live_count() == 0 && tm_elastic.get_live_count() == 0 && tm_fixed.get_live_count() == 0;
+    const bool tm_bounds = tm_default.get_thread_count() == std::max<std::size_t>(1, std::thread::hardware_concurrency())
+        && tm_elastic.get_thread_count() == 4 && tm_fixed.get_thread_count() == 3;
+
+    const bool tm_elastic_run = tm_elastic.submit([]{ return 7; }).get() == 7 && tm_elastic.get_live_count() == 1;
+    const bool tm_fixed_run = tm_fixed.submit([]{ return 9; }).get() == 9 && tm_fixed.get_live_count() == 3;
+
+    const bool tm_pass = tm_idle && tm_bounds && tm_elastic_run && tm_fixed_run;
+    std::stringstream tm_sstream;
+    tm_sstream << "Lazy Start | No Thread Before Demand: " << (tm_idle ? "Passed" : "Failed") << " | Bounds: " << (tm_bounds ? "Passed" : "Failed")
+        << " | Elastic (1..4) After First Task: " << tm_elastic.get_live_count() << " | Fixed (3) After First Task: " << tm_fixed.get_live_count()
+        << " | " << (tm_pass ? "Passed" : "Failed");
+    ar_logger.write(tm_pass ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+
+    return tm_pass;
+}
+
+/**
+ * @brief Check Elastic
+ *
+ * Uzun görevler kuyrukta beklerken havuzun en çok sayıya kadar
+ * büyüdüğünü ve aşmadığını, boşta kalınca en az sayıya
+ * küçüldüğünü ve en az sayı 0 iken yeniden başladığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_elastic(Logger<Args...>& ar_logger)
+{
+    // GROW UNDER BLOCKING TASKS
+    ThreadPool tm_pool(1, 4);
+    tm_pool.set_idle_time(std::chrono::milliseconds(100));
+
+    std::atomic<std::size_t> tm_started { 0 };
+    std::atomic<bool> tm_release { false };
+    TaskGroup tm_group;
+
+    for(std::size_t tm_index = 0; tm_index < 6; ++tm_index)
+    {
+        tm_pool.enqueue(tm_group, [&tm_started, &tm_release]{
+            tm_started.fetch_add(1);
+            while( !tm_release.load() )
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+    }
+
+    const bool tm_grow = wait_until([&]{ return tm_started.load() == 4; }) && tm_pool.get_live_count() == 4;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const std::size_t tm_peak = tm_pool.get_live_count();
+    const bool tm_bound = tm_peak == 4 && tm_started.load() == 4;
+
+    tm_release.store(true);
+    tm_group.wait();
+
+    // SHRINK AFTER IDLE
+    const bool tm_shrink = wait_until([&]{ return tm_pool.get_live_count() == 1; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    const bool tm_floor = tm_pool.get_live_count() == 1 && tm_pool.submit([]{ return 1; }).get() == 1;
+
+    // MIN 0, EVERY WORKER LEAVES AND COMES BACK ON DEMAND
+    ThreadPool tm_zero(0, 2);
+    tm_zero.set_idle_time(std::chrono::milliseconds(50));
+
+    const bool tm_zero_first = tm_zero.submit([]{ return 3; }).get() == 3;
+    const bool tm_zero_empty = wait_until([&]{ return tm_zero.get_live_count() == 0; });
+    const bool tm_zero_again = tm_zero.submit([]{ return 5; }).get() == 5 && tm_zero.get_live_count() >= 1;
+
+    const bool tm_pass = tm_grow && tm_bound && tm_shrink && tm_floor && tm_zero_first && tm_zero_empty && tm_zero_again;
+    std::stringstream tm_sstream;
+    tm_sstream << "Elastic (1..4) | Grow To Max: " << (tm_grow ? "Passed" : "Failed") << " | Peak: " << tm_peak
+        << " | Shrink To Min: " << (tm_shrink && tm_floor ? "Passed" : "Failed")
+        << " | Min 0 Restart: " << (tm_zero_first && tm_zero_empty && tm_zero_again ? "Passed" : "Failed")
+        << " | " << (tm_pass ? "Passed" : "Failed");
+    ar_logger.write(tm_pass ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+
+    return tm_pass;
+}
+
+/**
+ * @brief Bench
+ *
+ * Bağlantı başına havuz kuran süreç gibi 64 havuz kurar, her
+ * birine tek görev ekler ve kapatır. Çekirdek sayısı kadar
+ * sabit havuz ile esnek havuzun süresini ve başlayan iş
+ * parçacığı sayısını ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t tm_pool_count = 64;
+    static constexpr std::size_t tm_thread_count = 8;
+    using clock_t = std::chrono::steady_clock;
+
+    auto tm_measure = [&](const std::size_t ar_min_count) {
+        const auto tm_start = clock_t::now();
+
+        std::vector<std::unique_ptr<ThreadPool>> tm_pools;
+        for(std::size_t tm_index = 0; tm_index < tm_pool_count; ++tm_index)
+        {
+            tm_pools.emplace_back(std::make_unique<ThreadPool>(ar_min_count, tm_thread_count));
+            tm_pools.back()->submit([]{}).get();
+        }
+
+        std::size_t tm_live = 0;
+        for(const auto& tm_pool : tm_pools)
+            tm_live += tm_pool->get_live_count();
+
+        tm_pools.clear();
+        return std::make_pair(std::chrono::duration<double, std::milli>(clock_t::now() - tm_start).count(), tm_live);
+    };
+
+    const auto [tm_fixed_time, tm_fixed_live] = tm_measure(tm_thread_count);
+    const auto [tm_elastic_time, tm_elastic_live] = tm_measure(1);
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Start + Stop " << tm_pool_count << " Pools (Max " << tm_thread_count << ") | Fixed: "
+        << tm_fixed_time << " ms, " << tm_fixed_live << " Threads | Elastic: " << tm_elastic_time << " ms, " << tm_elastic_live
+        << " Threads (x" << tm_fixed_time / tm_elastic_time << ")";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    bool vv_ok = check_lazy(vv_testlog);
+    vv_ok = check_elastic(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
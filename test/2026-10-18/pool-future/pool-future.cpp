@@ -0,0 +1,351 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Pool Future (Havuz Sonucu)
+ *
+ * ThreadPool'un submit, enqueue_bulk ve TaskGroup eklerini
+ * kontrol edeceğiz. submit ile dönen Future'ın değer, void ve
+ * move-only sonuçları taşıdığı, görev hatasını get ile
+ * çağırana geçirdiği ve durmuş havuzda broken_promise verdiği
+ * denenir. Tek çalışanlı havuzda çalışanın kendi eklediği
+ * görevi beklerken kilitlenmediği, toplu eklemenin dışarıdan
+ * ve çalışan içinden tüm görevleri çalıştırdığı ve TaskGroup
+ * hatalarının wait ile alındığı kontrol edilir. Görev başına
+ * ekleme + elle yazılmış koşul değişkeni ile enqueue_bulk +
+ * TaskGroup arasındaki fark ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-future.cpp -pthread -o bsd/pool-future.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-future.cpp -pthread -o linux/pool-future.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-future.cpp -o windows/pool-future.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/pool-future.bsd
+ *  Linux   :: ./linux/pool-future.linux
+ *  Windows :: ./windows/pool-future.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/threadpool.hpp>
+#include <pool/parallelpool.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <numeric>
+#include <stdexcept>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::threadpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "pool-future-" + ss_osname;
+
+static constexpr std::size_t ss_count = 10000;
+
+/**
+ * @brief Fib
+ *
+ * Alt görevleri submit ile ekleyip sonuçlarını get ile
+ * bekleyen özyinelemeli görev. Tek çalışanlı havuzda ancak
+ * bekleyen çalışan bekleyen görevleri çalıştırırsa biter
+ *
+ * @param ThreadPool& Pool
+ * @param uint32_t Value
+ * @return uint64_t
+ */
+uint64_t fib(ThreadPool& ar_pool, const uint32_t ar_value)
+{
+    if( ar_value < 2 )
+        return ar_value;
+
+    Future<uint64_t> tm_left = ar_pool.submit([&ar_pool, ar_value]{ return fib(ar_pool, ar_value - 1); });
+    const uint64_t tm_right = fib(ar_pool, ar_value - 2);
+
+    return tm_left.get() + tm_right;
+}
+
+/**
+ * @brief Error Name
+ *
+ * Future'dan alınan hatanın kısa adını döndürür
+ *
+ * @param Func Function
+ * @return string
+ */
+template<class Func>
+std::string error_name(Func&& ar_func)
+{
+    try {
+        ar_func();
+    } catch(const std::future_error& ar_error) {
+        return ar_error.code() == std::future_errc::broken_promise ? "broken_promise" : "future_error";
+    } catch(const std::exception& ar_error) {
+        return ar_error.what();
+    }
+
+    return "none";
+}
+
+/**
+ * @brief Check Future
+ *
+ * submit sonuçlarını, hata aktarımını, durmuş havuzu ve
+ * çalışan içinden iç içe beklemeyi kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_future(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    for(const std::size_t tm_threads : { 1, 4 })
+    {
+        ThreadPool tm_pool(tm_threads);
+
+        // VALUES
+        Future<int> tm_int = tm_pool.submit([]{ return 42; });
+        Future<std::string> tm_text = tm_pool.submit([]{ return std::string(64, 'x'); });
+        std::atomic<int> tm_flag { 0 };
+        Future<void> tm_void = tm_pool.submit([&tm_flag]{ tm_flag.store(7); });
+        Future<std::unique_ptr<int>> tm_owned = tm_pool.submit([tm_value = std::make_unique<int>(9)]() mutable { return std::move(tm_value); });
+
+        tm_void.get();
+        const bool tm_values = tm_int.get() == 42 && tm_text.get() == std::string(64, 'x') && tm_flag.load() == 7
+            && *tm_owned.get() == 9 && !tm_int.is_valid();
+
+        // ERRORS
+        Future<int> tm_throw = tm_pool.submit([]() -> int { throw std::runtime_error("task error"); });
+        const bool tm_error = error_name([&]{ tm_throw.get(); }) == "task error";
+
+        // NESTED WAIT INSIDE WORKERS
+        const bool tm_nested = tm_pool.submit([&tm_pool]{ return fib(tm_pool, 18); }).get() == 2584;
+
+        // WAIT FOR
+        Future<int> tm_slow = tm_pool.submit([]{ std::this_thread::sleep_for(std::chrono::milliseconds(50)); return 1; });
+        const bool tm_timed = !tm_slow.wait_for(std::chrono::milliseconds(1)) && tm_slow.wait_for(std::chrono::seconds(10)) && tm_slow.get() == 1;
+
+        // STOPPED POOL
+        tm_pool.stop();
+        Future<int> tm_stopped = tm_pool.submit([]{ return 1; });
+        const bool tm_broken = tm_stopped.is_ready() && error_name([&]{ tm_stopped.get(); }) == "broken_promise";
+
+        const bool tm_pass = tm_values && tm_error && tm_nested && tm_timed && tm_broken;
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, "Workers: " + std::to_string(tm_threads)
+            + " | Values: " + (tm_values ? "Passed" : "Failed") + " | Error: " + (tm_error ? "Passed" : "Failed")
+            + " | Nested fib(18): " + (tm_nested ? "Passed" : "Failed") + " | Wait For: " + (tm_timed ? "Passed" : "Failed")
+            + " | Stopped Pool: " + (tm_broken ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // PENDING TASKS DROPPED AT STOP
+    ThreadPool tm_pool(1);
+    std::atomic<bool> tm_started { false };
+    std::atomic<bool> tm_release { false };
+    Future<void> tm_block = tm_pool.submit([&tm_started, &tm_release]{
+        tm_started.store(true);
+        while( !tm_release.load() )
+            std::this_thread::yield();
+    });
+    Future<int> tm_pending = tm_pool.submit([]{ return 1; });
+
+    while( !tm_started.load() )
+        std::this_thread::yield();
+
+    std::thread tm_stopper([&tm_pool]{ tm_pool.stop(); });
+    while( tm_pool.is_running() )
+        std::this_thread::yield();
+    tm_release.store(true);
+    tm_stopper.join();
+    tm_block.get();
+
+    const bool tm_dropped = tm_pending.is_ready() && error_name([&]{ tm_pending.get(); }) == "broken_promise";
+    ar_logger.write(tm_dropped ? level_t::Info : level_t::Err, std::string("Pending Future At Stop: ") + (tm_dropped ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_dropped;
+}
+
+/**
+ * @brief Check Group
+ *
+ * enqueue_bulk ile dışarıdan ve çalışan içinden eklenen
+ * görevleri, TaskGroup hata aktarımını, kümenin yeniden
+ * kullanılmasını ve parallelpool::for_each'i kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_group(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    for(const std::size_t tm_threads : { 1, 4 })
+    {
+        ThreadPool tm_pool(tm_threads);
+        std::vector<uint32_t> tm_hits(ss_count, 0);
+
+        // EXTERNAL BULK WITH GROUP
+        TaskGroup tm_group;
+        tm_group.wait();
+
+        const std::size_t tm_pushed = tm_pool.enqueue_bulk(tm_group, ss_count, [&tm_hits](const std::size_t ar_index) { ++tm_hits[ar_index]; });
+        tm_group.wait();
+        const bool tm_external = tm_pushed == ss_count && tm_group.is_done()
+            && std::all_of(tm_hits.begin(), tm_hits.end(), [](const uint32_t ar_hit) { return ar_hit == 1; });
+
+        // TASK ARRAY, MOVED OUT
+        std::atomic<std::size_t> tm_counter { 0 };
+        std::vector<task_t> tm_tasks;
+        for(std::size_t tm_index = 0; tm_index < ss_count; ++tm_index)
+            tm_tasks.emplace_back([&tm_counter]{ tm_counter.fetch_add(1, std::memory_order_release); });
+
+        const bool tm_array = tm_pool.enqueue_bulk(tm_tasks.data(), tm_tasks.size()) == ss_count
+            && std::none_of(tm_tasks.begin(), tm_tasks.end(), [](const task_t& ar_task) { return static_cast<bool>(ar_task); });
+        while( tm_counter.load(std::memory_order_acquire) < ss_count )
+            std::this_thread::yield();
+
+        // FROM WORKER, NESTED GROUPS
+        tm_pool.enqueue(tm_group, [&tm_pool, &tm_hits]{
+            TaskGroup tm_inner;
+            tm_pool.enqueue_bulk(tm_inner, ss_count, [&tm_hits](const std::size_t ar_index) { ++tm_hits[ar_index]; });
+            tm_inner.wait();
+        });
+        tm_group.wait();
+        const bool tm_worker = std::all_of(tm_hits.begin(), tm_hits.end(), [](const uint32_t ar_hit) { return ar_hit == 2; });
+
+        // ERRORS, FIRST ONE WINS AND GROUP IS REUSABLE
+        tm_pool.enqueue_bulk(tm_group, 64, [](const std::size_t ar_index) {
+            if( ar_index % 8 == 3 )
+                throw std::runtime_error("group error");
+        });
+        const bool tm_error = error_name([&]{ tm_group.wait(); }) == "group error" && error_name([&]{ tm_group.wait(); }) == "none";
+
+        // FOR EACH ON GROUP
+        std::vector<uint64_t> tm_values(ss_count, 0);
+        auto tm_square = [&tm_values](const std::size_t ar_index) noexcept { tm_values[ar_index] = ar_index * ar_index; };
+        pool::parallelpool::for_each(tm_pool, ss_count, tm_square);
+        uint64_t tm_sum = 0;
+        for(std::size_t tm_index = 0; tm_index < ss_count; ++tm_index)
+            tm_sum += tm_values[tm_index] == tm_index * tm_index;
+        const bool tm_each = tm_sum == ss_count;
+
+        // STOPPED POOL
+        tm_pool.stop();
+        const bool tm_stopped = tm_pool.enqueue_bulk(tm_group, 16, [](std::size_t) {}) == 0 && tm_group.is_done();
+
+        const bool tm_pass = tm_external && tm_array && tm_worker && tm_error && tm_each && tm_stopped;
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, "Workers: " + std::to_string(tm_threads)
+            + " | External Bulk: " + (tm_external ? "Passed" : "Failed") + " | Task Array: " + (tm_array ? "Passed" : "Failed") + " | Worker Bulk: " + (tm_worker ? "Passed" : "Failed")
+            + " | Group Error: " + (tm_error ? "Passed" : "Failed") + " | for_each: " + (tm_each ? "Passed" : "Failed")
+            + " | Stopped Pool: " + (tm_stopped ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * N görevlik dağıtımda görev başına enqueue ve elle yazılmış
+ * koşul değişkeni ile enqueue_bulk ve TaskGroup sürelerini,
+ * submit + get gidiş dönüş süresini ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t tm_rounds = 200;
+    const std::size_t tm_threads = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+    ThreadPool tm_pool(tm_threads);
+    std::vector<uint64_t> tm_values(ss_count, 0);
+
+    auto tm_measure = [&](auto&& ar_func) {
+        ar_func();
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            ar_func();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / tm_rounds;
+    };
+
+    const double tm_manual = tm_measure([&]{
+        std::mutex tm_mtx;
+        std::condition_variable tm_convar;
+        std::size_t tm_done = 0;
+
+        for(std::size_t tm_index = 0; tm_index < ss_count; ++tm_index)
+        {
+            tm_pool.enqueue([&, tm_index]{
+                tm_values[tm_index] += tm_index;
+
+                std::lock_guard<std::mutex> tm_lock(tm_mtx);
+                if( ++tm_done == ss_count )
+                    tm_convar.notify_all();
+            });
+        }
+
+        std::unique_lock<std::mutex> tm_lock(tm_mtx);
+        tm_convar.wait(tm_lock, [&]{ return tm_done == ss_count; });
+    });
+
+    const double tm_bulk = tm_measure([&]{
+        TaskGroup tm_group;
+        tm_pool.enqueue_bulk(tm_group, ss_count, [&tm_values](const std::size_t ar_index) { tm_values[ar_index] += ar_index; });
+        tm_group.wait();
+    });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Fan-Out " << ss_count << " Tasks (" << tm_threads << " Workers) | enqueue + condvar: "
+        << tm_manual << " us | enqueue_bulk + TaskGroup: " << tm_bulk << " us (x" << tm_manual / tm_bulk << ")";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+
+    static constexpr std::size_t tm_calls = 20000;
+    const auto tm_start = std::chrono::steady_clock::now();
+    uint64_t tm_sum = 0;
+    for(std::size_t tm_call = 0; tm_call < tm_calls; ++tm_call)
+        tm_sum += tm_pool.submit([tm_call]{ return tm_call; }).get();
+    const double tm_round_trip = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_start).count() / tm_calls;
+
+    tm_sstream.str("");
+    tm_sstream << std::fixed << std::setprecision(2) << "submit + get Round Trip: " << tm_round_trip << " us"
+        << (tm_sum == tm_calls * (tm_calls - 1) / 2 ? "" : " (Wrong Sum)");
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    bool vv_ok = check_future(vv_testlog);
+    vv_ok = check_group(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
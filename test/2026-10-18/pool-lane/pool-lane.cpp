@@ -0,0 +1,289 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Pool Lane (Havuz Şeridi)
+ *
+ * ThreadPool'un öncelik şeritlerini kontrol edeceğiz. Tek
+ * çalışan bir görev ile meşgul edilirken şeritlere görevler
+ * eklenir ve çalışma sırası kaydedilir. Katı kipte Control
+ * görevlerinin önce çalıştığı, Bulk şeridinin dolu üst
+ * şeritler karşısında aç kalmadığı, ağırlıklı kipte şeritlerin
+ * ağırlıkları oranında seçildiği ve şerit başına kuyruk
+ * derinliğinin doğru okunduğu denenir. Toplu iş yükü altında
+ * Control görevlerinin başlama gecikmesi (p50/p99) tek şerit
+ * ile karşılaştırılır
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-lane.cpp -pthread -o bsd/pool-lane.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-lane.cpp -pthread -o linux/pool-lane.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 pool-lane.cpp -o windows/pool-lane.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/pool-lane.bsd
+ *  Linux   :: ./linux/pool-lane.linux
+ *  Windows :: ./windows/pool-lane.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/threadpool.hpp>
+
+#include <chrono>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::threadpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "pool-lane-" + ss_osname;
+
+// Struct
+struct Recorder
+{
+    std::vector<lane_t> m_order;
+    std::atomic<bool> m_started { false };
+    std::atomic<bool> m_release { false };
+    TaskGroup m_group;
+};
+
+/**
+ * @brief Fill
+ *
+ * Tek çalışanı meşgul eden görevi ekler, çalışan onu aldıktan
+ * sonra verilen şeritlere verilen sayıda görev ekler. Görevler
+ * şeritlerini tek çalışanın yazdığı sıraya kaydeder
+ *
+ * @param ThreadPool& Pool
+ * @param Recorder& Recorder
+ * @param vector<pair<lane_t, size_t>> Lanes
+ */
+void fill(ThreadPool& ar_pool, Recorder& ar_recorder, const std::vector<std::pair<lane_t, std::size_t>>& ar_lanes)
+{
+    ar_pool.enqueue(ar_recorder.m_group, [&ar_recorder]{
+        ar_recorder.m_started.store(true);
+        while( !ar_recorder.m_release.load() )
+            std::this_thread::yield();
+    });
+
+    while( !ar_recorder.m_started.load() )
+        std::this_thread::yield();
+
+    for(const auto& [tm_lane, tm_count] : ar_lanes)
+    {
+        ar_pool.enqueue_bulk(ar_recorder.m_group, tm_count, [&ar_recorder, tm_lane = tm_lane](std::size_t) {
+            ar_recorder.m_order.push_back(tm_lane);
+        }, tm_lane);
+    }
+}
+
+/**
+ * @brief Count
+ *
+ * Kaydın ilk verilen sayıdaki elemanında şeridin kaç kez
+ * seçildiğini döndürür
+ *
+ * @param vector<lane_t>& Order
+ * @param size_t Prefix
+ * @param lane_t Lane
+ * @return size_t
+ */
+std::size_t count(const std::vector<lane_t>& ar_order, const std::size_t ar_prefix, const lane_t ar_lane)
+{
+    return static_cast<std::size_t>(std::count(ar_order.begin(), ar_order.begin() + std::min(ar_prefix, ar_order.size()), ar_lane));
+}
+
+/**
+ * @brief Check Strict
+ *
+ * Katı kipte çalışma sırasını, kuyruk derinliğini, çalışan
+ * içinden eklenen görevlerin şeridini ve Bulk şeridinin aç
+ * kalmadığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_strict(Logger<Args...>& ar_logger)
+{
+    // ORDER AND DEPTH
+    ThreadPool tm_pool(1);
+    Recorder tm_first;
+    fill(tm_pool, tm_first, { { lane_t::Bulk, 100 }, { lane_t::Normal, 20 }, { lane_t::Control, 10 } });
+
+    const LaneStats tm_control = tm_pool.get_lane_stats(lane_t::Control);
+    const LaneStats tm_normal = tm_pool.get_lane_stats(lane_t::Normal);
+    const LaneStats tm_bulk = tm_pool.get_lane_stats(lane_t::Bulk);
+    const bool tm_depth = tm_control.m_queued == 10 && tm_normal.m_queued == 20 && tm_bulk.m_queued == 100;
+
+    tm_first.m_release.store(true);
+    tm_first.m_group.wait();
+
+    // ONE STARVATION PICK MAY GO TO A LOWER LANE
+    const bool tm_order = tm_first.m_order.size() == 130 && count(tm_first.m_order, 11, lane_t::Control) == 10
+        && count(tm_first.m_order, 31, lane_t::Normal) == 20;
+    const bool tm_done = tm_pool.get_lane_stats(lane_t::Control).m_done == 10 && tm_pool.get_lane_stats(lane_t::Bulk).m_done == 100
+        && tm_pool.get_lane_stats(lane_t::Bulk).m_queued == 0;
+
+    // FROM WORKER, CONTROL JUMPS AHEAD OF QUEUED BULK
+    std::vector<lane_t> tm_inner;
+    TaskGroup tm_group;
+    tm_pool.enqueue(tm_group, [&tm_pool, &tm_inner, &tm_group]{
+        for(std::size_t tm_index = 0; tm_index < 50; ++tm_index)
+            tm_pool.enqueue(tm_group, [&tm_inner]{ tm_inner.push_back(lane_t::Bulk); }, lane_t::Bulk);
+        for(std::size_t tm_index = 0; tm_index < 5; ++tm_index)
+            tm_pool.enqueue(tm_group, [&tm_inner]{ tm_inner.push_back(lane_t::Control); }, lane_t::Control);
+    });
+    tm_group.wait();
+    const bool tm_worker = tm_inner.size() == 55 && count(tm_inner, 6, lane_t::Control) == 5;
+
+    // STARVATION, BULK STILL RUNS UNDER A CONTROL FLOOD
+    Recorder tm_flood;
+    fill(tm_pool, tm_flood, { { lane_t::Bulk, 20 }, { lane_t::Control, 320 } });
+    tm_flood.m_release.store(true);
+    tm_flood.m_group.wait();
+
+    const auto tm_first_bulk = std::find(tm_flood.m_order.begin(), tm_flood.m_order.end(), lane_t::Bulk) - tm_flood.m_order.begin();
+    const bool tm_starve = static_cast<std::size_t>(tm_first_bulk) <= _DEF_LANE_STARVE && count(tm_flood.m_order, 320, lane_t::Bulk) >= 320 / _DEF_LANE_STARVE - 1;
+
+    const bool tm_pass = tm_depth && tm_order && tm_done && tm_worker && tm_starve;
+    std::stringstream tm_sstream;
+    tm_sstream << "Strict | Depth (C/N/B): " << tm_control.m_queued << "/" << tm_normal.m_queued << "/" << tm_bulk.m_queued
+        << " | Order: " << (tm_order ? "Passed" : "Failed") << " | Done: " << (tm_done ? "Passed" : "Failed")
+        << " | From Worker: " << (tm_worker ? "Passed" : "Failed") << " | First Bulk Under Flood: #" << tm_first_bulk
+        << " | Bulk In First 320: " << count(tm_flood.m_order, 320, lane_t::Bulk) << " | " << (tm_pass ? "Passed" : "Failed");
+    ar_logger.write(tm_pass ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+
+    return tm_pass;
+}
+
+/**
+ * @brief Check Weighted
+ *
+ * Ağırlıklı kipte şeritlerin ağırlıkları oranında seçildiğini
+ * ve ağırlığın değiştirilebildiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_weighted(Logger<Args...>& ar_logger)
+{
+    ThreadPool tm_pool(1);
+    tm_pool.set_schedule(schedule_t::Weighted);
+
+    Recorder tm_default;
+    fill(tm_pool, tm_default, { { lane_t::Bulk, 260 }, { lane_t::Normal, 260 }, { lane_t::Control, 260 } });
+    tm_default.m_release.store(true);
+    tm_default.m_group.wait();
+
+    const std::size_t tm_control = count(tm_default.m_order, 260, lane_t::Control);
+    const std::size_t tm_normal = count(tm_default.m_order, 260, lane_t::Normal);
+    const std::size_t tm_bulk = count(tm_default.m_order, 260, lane_t::Bulk);
+
+    // 8:4:1 OF 260 PICKS IS 160:80:20
+    const bool tm_ratio = tm_control >= 150 && tm_control <= 170 && tm_normal >= 72 && tm_normal <= 88 && tm_bulk >= 16 && tm_bulk <= 24;
+
+    tm_pool.set_weight(lane_t::Control, 1);
+    tm_pool.set_weight(lane_t::Normal, 1);
+    tm_pool.set_weight(lane_t::Bulk, 0);
+
+    Recorder tm_equal;
+    fill(tm_pool, tm_equal, { { lane_t::Bulk, 90 }, { lane_t::Normal, 90 }, { lane_t::Control, 90 } });
+    tm_equal.m_release.store(true);
+    tm_equal.m_group.wait();
+
+    const std::size_t tm_equal_bulk = count(tm_equal.m_order, 90, lane_t::Bulk);
+    const bool tm_fair = tm_equal_bulk >= 24 && tm_equal_bulk <= 36;
+
+    const bool tm_pass = tm_pool.get_schedule() == schedule_t::Weighted && tm_ratio && tm_fair;
+    std::stringstream tm_sstream;
+    tm_sstream << "Weighted | First 260 Picks (C/N/B), 8:4:1: " << tm_control << "/" << tm_normal << "/" << tm_bulk
+        << " | First 90 Picks Bulk, 1:1:0 -> 1: " << tm_equal_bulk << " | " << (tm_pass ? "Passed" : "Failed");
+    ar_logger.write(tm_pass ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+
+    return tm_pass;
+}
+
+/**
+ * @brief Bench
+ *
+ * Toplu görevler havuzu doldururken eklenen Control
+ * görevlerinin eklenmeden başlamaya kadar geçen süresini
+ * (us) tek şerit ve Control şeridi ile ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t tm_bulk_count = 20000;
+    static constexpr std::size_t tm_probe_count = 200;
+    using clock_t = std::chrono::steady_clock;
+
+    auto tm_measure = [&](const lane_t ar_probe_lane) {
+        ThreadPool tm_pool(2);
+        TaskGroup tm_group;
+        std::vector<double> tm_latency(tm_probe_count, 0.0);
+
+        tm_pool.enqueue_bulk(tm_group, tm_bulk_count, [](std::size_t) {
+            const auto tm_until = clock_t::now() + std::chrono::microseconds(20);
+            while( clock_t::now() < tm_until ) {}
+        }, lane_t::Bulk);
+
+        for(std::size_t tm_probe = 0; tm_probe < tm_probe_count; ++tm_probe)
+        {
+            const auto tm_start = clock_t::now();
+            tm_pool.enqueue(tm_group, [&tm_latency, tm_probe, tm_start]{
+                tm_latency[tm_probe] = std::chrono::duration<double, std::micro>(clock_t::now() - tm_start).count();
+            }, ar_probe_lane);
+
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+
+        tm_group.wait();
+        std::sort(tm_latency.begin(), tm_latency.end());
+        return std::make_pair(tm_latency[tm_probe_count / 2], tm_latency[tm_probe_count * 99 / 100]);
+    };
+
+    const auto [tm_single_p50, tm_single_p99] = tm_measure(lane_t::Bulk);
+    const auto [tm_lane_p50, tm_lane_p99] = tm_measure(lane_t::Control);
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(1) << "Control Start Latency Under " << tm_bulk_count << " Bulk Tasks (2 Workers) | Single Lane p50/p99: "
+        << tm_single_p50 << "/" << tm_single_p99 << " us | Control Lane p50/p99: " << tm_lane_p50 << "/" << tm_lane_p99 << " us";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    bool vv_ok = check_strict(vv_testlog);
+    vv_ok = check_weighted(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
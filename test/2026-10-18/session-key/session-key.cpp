@@ -0,0 +1,503 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Session Key (Bağlantıya Ait Anahtar)
+ *
+ * SHA-256, HMAC-SHA256 ve HKDF-SHA256 için bilinen test
+ * vektörlerini, her şifreleyicinin clone ile verilen anahtarı
+ * kullanan yeni nesne ürettiğini kontrol edeceğiz. Soket çifti
+ * üzerinden el sıkışma yapılıp rastgele değerlerin karşıya
+ * ulaştığı, rastgele değer üretiminin durum döndürdüğü,
+ * aynı ana anahtar ile açılan iki bağlantıda aynı mesajın
+ * farklı şifrelendiği, yanlış rastgele değer ile
+ * türetilen anahtarın çerçeveyi açamadığı ve özellik
+ * anlaşılmazsa paylaşılan şifreleyiciye dönüldüğü denenir.
+ * Oturum açma maliyeti ve birden fazla iş parçacığının kendi
+ * bağlantısında aynı anda gönderip alması ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 session-key.cpp -pthread -o bsd/session-key.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 session-key.cpp -pthread -o linux/session-key.linux
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/session-key.bsd
+ *  Linux   :: ./linux/session-key.linux
+ *
+ * Not: Soket çifti için posix arayüzü kullanıldığından Windows
+ *  üzerinde derlenmez
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <socket/socket.hpp>
+
+#include "../socket-link.hpp"
+
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+using namespace netsocket;
+
+namespace sha256 = tools::hash::sha256;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "session-key-" + ss_osname;
+
+static const std::string ss_key = "0123456789abcdef0123456789abcdef";
+static const std::string ss_other_key = "fedcba9876543210fedcba9876543210";
+
+static constexpr std::size_t ss_thread_count = 4;
+static constexpr std::size_t ss_message_count = 2000;
+
+/**
+ * @brief From Hex
+ *
+ * @param char* Hex
+ * @return string
+ */
+std::string from_hex(const char* ar_hex)
+{
+    std::string tm_out;
+    for(std::size_t tm_count = 0; ar_hex[tm_count] && ar_hex[tm_count + 1]; tm_count += 2)
+        tm_out.push_back(static_cast<char>(std::stoi(std::string(ar_hex + tm_count, 2), nullptr, 16)));
+    return tm_out;
+}
+
+/**
+ * @brief Check Hash
+ *
+ * FIPS 180-2 "abc", RFC 4231 #1 ve RFC 5869 #1 vektörlerini
+ * kontrol eder. Parçalar halinde verilen veri ile tek
+ * seferde verilen verinin aynı özeti verdiği de denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_hash(Logger<Args...>& ar_logger)
+{
+    // SHA-256
+    const sha256::digest_t tm_abc = sha256::digest("abc", 3);
+    const bool tm_sha_ok = std::string(reinterpret_cast<const char*>(tm_abc.data()), tm_abc.size())
+        == from_hex("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+    std::string tm_long(1000, '\0');
+    for(std::size_t tm_count = 0; tm_count < tm_long.size(); ++tm_count)
+        tm_long[tm_count] = static_cast<char>(tm_count * 31 + 7);
+
+    sha256::Sha256 tm_sha;
+    for(std::size_t tm_offset = 0; tm_offset < tm_long.size(); tm_offset += 37)
+        tm_sha.update(tm_long.data() + tm_offset, std::min<std::size_t>(37, tm_long.size() - tm_offset));
+
+    sha256::digest_t tm_split {};
+    tm_sha.finish(tm_split.data());
+    const bool tm_split_ok = tm_split == sha256::digest(tm_long.data(), tm_long.size());
+
+    // HMAC-SHA256
+    const std::string tm_hmac_key(20, '\x0b');
+    sha256::Hmac tm_hmac(tm_hmac_key.data(), tm_hmac_key.size());
+    tm_hmac.update("Hi There", 8);
+
+    sha256::digest_t tm_mac {};
+    tm_hmac.finish(tm_mac.data());
+    const bool tm_hmac_ok = std::string(reinterpret_cast<const char*>(tm_mac.data()), tm_mac.size())
+        == from_hex("b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7");
+
+    // HKDF-SHA256
+    const std::string tm_ikm(22, '\x0b');
+    const std::string tm_salt = from_hex("000102030405060708090a0b0c");
+    const std::string tm_info = from_hex("f0f1f2f3f4f5f6f7f8f9");
+
+    std::string tm_okm(42, '\0');
+    const bool tm_hkdf_ok = sha256::hkdf(tm_ikm, tm_salt, tm_info, reinterpret_cast<uint8_t*>(tm_okm.data()), tm_okm.size())
+        && tm_okm == from_hex("3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865");
+
+    const bool tm_hkdf_limit = !sha256::hkdf(tm_ikm, tm_salt, tm_info, reinterpret_cast<uint8_t*>(tm_okm.data()), sha256::_MAX_LEN_EXPAND + 1);
+
+    ar_logger.write(tm_sha_ok && tm_split_ok ? level_t::Info : level_t::Err, std::string("SHA-256 | Vector: ") + (tm_sha_ok ? "Passed" : "Failed") + " | Split Update: " + (tm_split_ok ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_hmac_ok ? level_t::Info : level_t::Err, std::string("HMAC-SHA256 | RFC 4231 #1: ") + (tm_hmac_ok ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_hkdf_ok && tm_hkdf_limit ? level_t::Info : level_t::Err, std::string("HKDF-SHA256 | RFC 5869 #1: ") + (tm_hkdf_ok ? "Passed" : "Failed") + " | Length Limit: " + (tm_hkdf_limit ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_sha_ok && tm_split_ok && tm_hmac_ok && tm_hkdf_ok && tm_hkdf_limit;
+}
+
+/**
+ * @brief Check Clone
+ *
+ * Kopyanın aynı isme ve verilen anahtara sahip olduğunu,
+ * ayrıca aynı anahtar ile doğrudan oluşturulan nesne ile aynı
+ * sonucu verdiğini kontrol eder. Doğrulamalı şifreleyicilerde
+ * kopyanın kendi mühürlediğini açabildiği ve ana anahtarlı
+ * nesnenin açamadığı denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_clone(Logger<Args...>& ar_logger)
+{
+    const std::string tm_text = "per-connection cipher state must not leak between sessions";
+
+    ChaCha20::nonce_t tm_chacha_nonce {};
+    tm_chacha_nonce[3] = 0x4A;
+
+    AesCtr::nonce_t tm_aes_nonce {};
+    tm_aes_nonce[7] = 0x21;
+
+    Xor tm_xor("clone-xor", ss_key);
+    ChaCha20 tm_chacha("clone-chacha", ss_key, tm_chacha_nonce, 7);
+    AesCtr tm_ctr("clone-ctr", ss_key, tm_aes_nonce);
+
+    Xor tm_xor_ref("clone-xor", ss_other_key);
+    ChaCha20 tm_chacha_ref("clone-chacha", ss_other_key, tm_chacha_nonce, 7);
+    AesCtr tm_ctr_ref("clone-ctr", ss_other_key, tm_aes_nonce);
+
+    struct Case { const char* m_title; Algorithm* m_src; Algorithm* m_ref; };
+    const Case tm_cases[] =
+    {
+        { "Xor     ", &tm_xor, &tm_xor_ref },
+        { "ChaCha20", &tm_chacha, &tm_chacha_ref },
+        { "AES-CTR ", &tm_ctr, &tm_ctr_ref }
+    };
+
+    bool tm_ok = true;
+    for(const auto& tm_case : tm_cases)
+    {
+        const auto tm_copy = tm_case.m_src->clone(ss_other_key);
+
+        std::string tm_copy_text = tm_text;
+        std::string tm_ref_text = tm_text;
+        const bool tm_pass = tm_copy && !tm_copy->has_error()
+            && tm_copy->get_name() == tm_case.m_src->get_name()
+            && tm_copy->get_key() == ss_other_key
+            && tm_case.m_src->get_key() == ss_key
+            && tm_copy->encrypt(tm_copy_text) && tm_case.m_ref->encrypt(tm_ref_text)
+            && tm_copy_text == tm_ref_text && tm_copy_text != tm_text;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("Clone ") + tm_case.m_title + " | Same As Fresh: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    // CHACHA20-POLY1305 SEALS THROUGH THE FRAME INTERFACE
+    ChaCha20Poly1305 tm_aead("clone-aead", ss_key);
+    const auto tm_aead_copy = tm_aead.clone(ss_other_key);
+
+    std::string tm_data = tm_text;
+    std::vector<std::byte> tm_trailer(tm_aead.get_seal_size());
+    const Frame tm_frame { reinterpret_cast<std::byte*>(tm_data.data()), 0, tm_data.size() };
+
+    const bool tm_aead_sealed = tm_aead_copy && !tm_aead_copy->has_error()
+        && tm_aead_copy->get_name() == tm_aead.get_name()
+        && tm_aead_copy->seal(tm_frame, tm_trailer.data());
+
+    // MASTER KEY MUST NOT OPEN WHAT THE SESSION KEY SEALED
+    std::string tm_foreign = tm_data;
+    const Frame tm_foreign_frame { reinterpret_cast<std::byte*>(tm_foreign.data()), 0, tm_foreign.size() };
+    const bool tm_aead_rejects = tm_aead_sealed && !tm_aead.open(tm_foreign_frame, tm_trailer.data());
+    const bool tm_aead_opens = tm_aead_sealed && tm_aead_copy->open(tm_frame, tm_trailer.data()) && tm_data == tm_text;
+
+    // AES-GCM SEALS WITH ITS OWN TAG INTERFACE
+    AesGcm tm_gcm("clone-gcm", ss_key);
+    const auto tm_gcm_base = tm_gcm.clone(ss_other_key);
+    const AesGcm* tm_gcm_copy = dynamic_cast<const AesGcm*>(tm_gcm_base.get());
+
+    std::string tm_gcm_data = tm_text;
+    AesGcm::tag_t tm_tag {};
+    const bool tm_gcm_sealed = tm_gcm_copy && !tm_gcm_copy->has_error()
+        && tm_gcm_copy->get_name() == tm_gcm.get_name()
+        && tm_gcm_copy->seal(reinterpret_cast<uint8_t*>(tm_gcm_data.data()), tm_gcm_data.size(), nullptr, 0, tm_tag);
+
+    std::string tm_gcm_foreign = tm_gcm_data;
+    const bool tm_gcm_rejects = tm_gcm_sealed && !tm_gcm.open(reinterpret_cast<uint8_t*>(tm_gcm_foreign.data()), tm_gcm_foreign.size(), nullptr, 0, tm_tag);
+    const bool tm_gcm_opens = tm_gcm_sealed && tm_gcm_copy->open(reinterpret_cast<uint8_t*>(tm_gcm_data.data()), tm_gcm_data.size(), nullptr, 0, tm_tag) && tm_gcm_data == tm_text;
+
+    const bool tm_aead_pass = tm_aead_rejects && tm_aead_opens;
+    const bool tm_gcm_pass = tm_gcm_rejects && tm_gcm_opens;
+
+    ar_logger.write(tm_aead_pass ? level_t::Info : level_t::Err, std::string("Clone ChaCha20-Poly1305 | Own Seal: ") + (tm_aead_opens ? "Passed" : "Failed") + " | Master Rejects: " + (tm_aead_rejects ? "Passed" : "Failed"), GET_SOURCE);
+    ar_logger.write(tm_gcm_pass ? level_t::Info : level_t::Err, std::string("Clone AES-GCM           | Own Seal: ") + (tm_gcm_opens ? "Passed" : "Failed") + " | Master Rejects: " + (tm_gcm_rejects ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_ok = tm_ok && tm_aead_pass && tm_gcm_pass;
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Session
+ *
+ * Aynı ana anahtar ile iki bağlantı açılır. Çerçeve nonce
+ * değeri her mesajda yenilendiğinden aynı mesaj iki
+ * bağlantıda da farklı baytlar ile görülür. Oturum anahtarı
+ * anlaşılınca bir bağlantının çerçevesi diğerinde açılmaz,
+ * anlaşılmayınca iki bağlantı da aynı paylaşılan anahtarı
+ * kullandığından açılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_session(Logger<Args...>& ar_logger)
+{
+    const DataPacket tm_out { "pwd@session", "tester", "same message on two connections" };
+
+    bool tm_ok = true;
+    for(const bool tm_session_key : { true, false })
+    {
+        const flag::flag_t tm_flag = tm_session_key ? _FLAG_SOCKET_SESSION_KEY : _FLAG_SOCKET_NULL;
+
+        ChaCha20 tm_client_cipher("session-client", ss_key);
+        ChaCha20 tm_server_cipher("session-server", ss_key);
+
+        Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5090, ipv_t::ipv4, tm_flag);
+        Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5091, ipv_t::ipv4, tm_flag);
+
+        Link tm_links[2];
+        std::string tm_wires[2];
+        bool tm_round_trip = true;
+        bool tm_negotiated = true;
+
+        for(std::size_t tm_count = 0; tm_count < 2; ++tm_count)
+        {
+            Link& tm_link = tm_links[tm_count];
+            if( !connect(tm_client, tm_server, tm_link) )
+            {
+                tm_round_trip = false;
+                continue;
+            }
+
+            const bool tm_has_key = (tm_client.get_session_feature(tm_link.m_pair[0]) & _FEATURE_SESSION_KEY)
+                && (tm_server.get_session_feature(tm_link.m_pair[1]) & _FEATURE_SESSION_KEY);
+            tm_negotiated = tm_negotiated && tm_has_key == tm_session_key;
+
+            // SEND, CAPTURE, FORWARD TO THE SERVER END
+            netpacket::buffer_t tm_plain {};
+            const std::size_t tm_len = netpacket::NetPacket::layout(tm_plain.data(), tm_plain.size(), tm_out.m_pwd, tm_out.m_name, tm_out.m_msg, netpacket::_FRAME_NULL)
+                + tm_client_cipher.get_seal_size();
+
+            DataPacket tm_in {};
+            const bool tm_sent = tm_client.send(tm_link.m_pair[0], tm_out).is_ok();
+            tm_wires[tm_count] = read_frame(tm_link.m_pair[1], tm_len);
+
+            // SAME BYTES ARE REPLAYED INTO THE SERVER END THROUGH ITS OWN SESSION
+            const bool tm_opened = write_frame(tm_link.m_pair[0], tm_wires[tm_count])
+                && tm_server.recv(tm_link.m_pair[1], tm_in).is_ok() && tm_in.m_msg == tm_out.m_msg;
+
+            tm_round_trip = tm_round_trip && tm_sent && tm_wires[tm_count].size() == tm_len && tm_opened;
+        }
+
+        // FIRST CONNECTION'S FRAME INTO THE SECOND CONNECTION
+        DataPacket tm_cross_in {};
+        const bool tm_cross = tm_round_trip && write_frame(tm_links[1].m_pair[0], tm_wires[0])
+            && tm_server.recv(tm_links[1].m_pair[1], tm_cross_in).is_ok() && tm_cross_in.m_msg == tm_out.m_msg;
+
+        const bool tm_differ = tm_wires[0] != tm_wires[1];
+        const bool tm_pass = tm_round_trip && tm_negotiated && tm_differ && tm_cross != tm_session_key;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err,
+            std::string(tm_session_key ? "Session Key" : "Shared Key ")
+            + " | Round Trip: " + (tm_round_trip ? "Passed" : "Failed")
+            + " | Negotiated: " + (tm_negotiated ? "Passed" : "Failed")
+            + " | Wire Differs: " + (tm_differ ? "Passed" : "Failed")
+            + " | Cross " + (tm_cross ? "Opens   " : "Rejected") + ": " + (tm_cross != tm_session_key ? "Passed" : "Failed"), GET_SOURCE);
+
+        for(auto& tm_link : tm_links)
+            disconnect(tm_client, tm_server, tm_link);
+
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Mismatch
+ *
+ * Sunucu ucu yanlış istemci rastgele değeri ile oturum açarsa
+ * türetilen anahtar farklı olur ve doğrulamalı çerçeve
+ * packet_not_auth ile reddedilir. Tek taraf oturum anahtarı
+ * istemezse iki taraf da paylaşılan şifreleyiciye döner
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_mismatch(Logger<Args...>& ar_logger)
+{
+    const DataPacket tm_out { "pwd@session", "tester", "derived keys must match on both ends" };
+
+    ChaCha20Poly1305 tm_client_cipher("mismatch-client", ss_key);
+    ChaCha20Poly1305 tm_server_cipher("mismatch-server", ss_key);
+
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5092, ipv_t::ipv4, _FLAG_SOCKET_SESSION_KEY);
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5093, ipv_t::ipv4, _FLAG_SOCKET_SESSION_KEY);
+    Socket tm_legacy(tm_server_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5094, ipv_t::ipv4, _FLAG_SOCKET_NULL);
+
+    // WRONG CLIENT RANDOM ON THE SERVER END
+    int tm_pair[2] {};
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, tm_pair) != 0 )
+        return false;
+
+    // RANDOM SOURCE REPORTS SUCCESS, NEVER AN ALL ZERO SALT
+    random_t tm_client_random {};
+    random_t tm_server_random {};
+    const Status tm_make = Socket::make_random(tm_client_random);
+    const bool tm_random_ok = tm_make.get_code() == status::to_underlying(socket_code_t::random_make)
+        && Socket::make_random(tm_server_random).is_ok()
+        && tm_client_random != random_t{} && tm_client_random != tm_server_random;
+
+    ar_logger.write(tm_random_ok ? level_t::Info : level_t::Err, std::string("Session Random | Status And Fresh Value: ") + (tm_random_ok ? "Passed" : "Failed"), GET_SOURCE);
+    if( !tm_random_ok )
+        return false;
+
+    const Hello tm_client_hello { tm_client.get_feature(), tm_client_random };
+    const Hello tm_server_hello { tm_server.get_feature(), tm_server_random };
+    Hello tm_wrong_hello = tm_client_hello;
+    tm_wrong_hello.m_random[0] ^= 0x01;
+
+    bool tm_opened = tm_client.open_session(tm_pair[0], tm_client_hello, tm_server_hello).is_ok()
+        && tm_server.open_session(tm_pair[1], tm_wrong_hello, tm_server_hello).is_ok();
+
+    DataPacket tm_in {};
+    const bool tm_sent = tm_opened && tm_client.send(tm_pair[0], tm_out).is_ok();
+    const Status tm_status = tm_server.recv(tm_pair[1], tm_in);
+    const bool tm_rejected = tm_sent && tm_status.get_code() == status::to_underlying(socket_code_t::packet_not_auth) && tm_in.m_msg.empty();
+
+    ar_logger.write(tm_rejected ? level_t::Info : level_t::Err, std::string("Wrong Random | Rejected: ") + (tm_rejected ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_client.close_session(tm_pair[0]);
+    tm_server.close_session(tm_pair[1]);
+
+    // ONE SIDE DOES NOT ASK FOR SESSION KEYS, BOTH USE THE SHARED CIPHER
+    const Hello tm_legacy_hello { tm_legacy.get_feature(), tm_server_random };
+    tm_opened = tm_client.open_session(tm_pair[0], tm_client_hello, tm_legacy_hello).is_ok()
+        && tm_legacy.open_session(tm_pair[1], tm_client_hello, tm_legacy_hello).is_ok();
+
+    tm_in = {};
+    const bool tm_legacy_ok = tm_opened
+        && !(tm_client.get_session_feature(tm_pair[0]) & _FEATURE_SESSION_KEY)
+        && tm_client.send(tm_pair[0], tm_out).is_ok()
+        && tm_legacy.recv(tm_pair[1], tm_in).is_ok() && tm_in.m_msg == tm_out.m_msg;
+
+    ar_logger.write(tm_legacy_ok ? level_t::Info : level_t::Err, std::string("Peer Without Session Key | Shared Cipher: ") + (tm_legacy_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    tm_client.close_session(tm_pair[0]);
+    tm_legacy.close_session(tm_pair[1]);
+
+    Socket::close_socket(tm_pair[0]);
+    Socket::close_socket(tm_pair[1]);
+
+    return tm_rejected && tm_legacy_ok;
+}
+
+/**
+ * @brief Check Parallel
+ *
+ * Her iş parçacığı kendi bağlantısını açar ve aynı istemci ve
+ * sunucu nesneleri üzerinden mesajları gönderip alır.
+ * Şifreleme durumu oturuma ait olduğundan iş parçacıkları
+ * arasında paylaşılan değişken şifreleyici yoktur. Oturum
+ * açma (HKDF + clone) süresi ve toplam mesaj hızı ölçülür
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_parallel(Logger<Args...>& ar_logger)
+{
+    ChaCha20Poly1305 tm_client_cipher("parallel-client", ss_key);
+    ChaCha20Poly1305 tm_server_cipher("parallel-server", ss_key);
+
+    Socket tm_client(tm_client_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5095, ipv_t::ipv4, _FLAG_SOCKET_SESSION_KEY);
+    Socket tm_server(tm_server_cipher, "logs/socket-" + ss_logname, "session-key", "pwd@session", 5096, ipv_t::ipv4, _FLAG_SOCKET_SESSION_KEY);
+
+    Link tm_links[ss_thread_count];
+    std::atomic<std::size_t> tm_failed { 0 };
+
+    // SESSION OPEN COST
+    const auto tm_open_start = std::chrono::steady_clock::now();
+    for(auto& tm_link : tm_links)
+        if( !connect(tm_client, tm_server, tm_link) )
+            tm_failed.fetch_add(1);
+    const double tm_open_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tm_open_start).count() / ss_thread_count;
+
+    const auto tm_start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::thread> tm_threads;
+        for(std::size_t tm_index = 0; tm_index < ss_thread_count; ++tm_index)
+        {
+            tm_threads.emplace_back([&, tm_index]{
+                const Link& tm_link = tm_links[tm_index];
+                const DataPacket tm_out { "pwd@session", "worker-" + std::to_string(tm_index), "message from an independent session" };
+
+                for(std::size_t tm_count = 0; tm_count < ss_message_count; ++tm_count)
+                {
+                    DataPacket tm_in {};
+                    if( !tm_client.send(tm_link.m_pair[0], tm_out).is_ok() || !tm_server.recv(tm_link.m_pair[1], tm_in).is_ok() || tm_in.m_msg != tm_out.m_msg || tm_in.m_name != tm_out.m_name )
+                    {
+                        tm_failed.fetch_add(1);
+                        return;
+                    }
+                }
+            });
+        }
+
+        for(auto& tm_thread : tm_threads)
+            tm_thread.join();
+    }
+    const double tm_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    for(auto& tm_link : tm_links)
+        disconnect(tm_client, tm_server, tm_link);
+
+    const bool tm_ok = tm_failed.load() == 0;
+    const double tm_rate = static_cast<double>(ss_thread_count * ss_message_count) / tm_seconds;
+
+    std::ostringstream tm_line;
+    tm_line << std::fixed << std::setprecision(1)
+        << "Parallel " << ss_thread_count << " Sessions x " << ss_message_count << " Messages"
+        << " | Open: " << tm_open_us << " us/session"
+        << " | Rate: " << std::setprecision(0) << tm_rate << " msg/s"
+        << " | Result: " << (tm_ok ? "Passed" : "Failed");
+
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_line.str(), GET_SOURCE);
+    return tm_ok;
+}
+
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Version Hash: " + std::string(ss_ver_hash.c_str()), GET_SOURCE);
+
+    bool vv_ok = check_hash(vv_testlog);
+    vv_ok = check_clone(vv_testlog) && vv_ok;
+    vv_ok = check_session(vv_testlog) && vv_ok;
+    vv_ok = check_mismatch(vv_testlog) && vv_ok;
+    vv_ok = check_parallel(vv_testlog) && vv_ok;
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
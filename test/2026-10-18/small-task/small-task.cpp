@@ -0,0 +1,435 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Small Task (Küçük Görev)
+ *
+ * ThreadPool görevlerini tutan, sadece taşınabilen Task
+ * nesnesini kontrol edeceğiz. Genel operator new yeniden
+ * tanımlanarak bellek ayırma sayısı tutulur. Sunucunun
+ * bağlantı görevi gibi yakalamaların bellek ayırmadan
+ * görevin içinde tutulduğu, büyük ya da taşınırken hata
+ * fırlatabilen nesnelerin dışarıda tutulduğu, unique_ptr
+ * yakalayan görevlerin çalıştığı ve nesnelerin bir kez
+ * silindiği, boş görev çağrısının std::bad_function_call
+ * fırlattığı ve havuza eklenen boş görevlerin havuzu
+ * durdurmadığı denenir. Isınmadan sonra havuza görev eklemenin
+ * bellek ayırmadığı ve std::function ile farkı ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 small-task.cpp -pthread -o bsd/small-task.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 small-task.cpp -pthread -o linux/small-task.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 small-task.cpp -o windows/small-task.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/small-task.bsd
+ *  Linux   :: ./linux/small-task.linux
+ *  Windows :: ./windows/small-task.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/threadpool.hpp>
+
+#include <new>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <functional>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::threadpool;
+using namespace pool::task;
+
+// Allocation Counter
+// GCC, malloc ile açılan alanın free ile silindiğini göremediği için yanlış uyarı verir
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::atomic<uint64_t> ss_alloc_count { 0 };
+
+void* operator new(std::size_t ar_size)
+{
+    ss_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if( void* tm_ptr = std::malloc(ar_size ? ar_size : 1) )
+        return tm_ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ar_ptr) noexcept { std::free(ar_ptr); }
+void operator delete(void* ar_ptr, std::size_t) noexcept { std::free(ar_ptr); }
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "small-task-" + ss_osname;
+
+static const std::string ss_ip = "192.168.100.200";
+static constexpr std::size_t ss_rounds = 20000;
+static constexpr uint32_t ss_depth = 14;
+
+// Struct
+struct Tracked
+{
+    static inline std::atomic<int> s_live { 0 };
+    static inline std::atomic<int> s_calls { 0 };
+
+    Tracked() noexcept { ++s_live; }
+    Tracked(Tracked&&) noexcept { ++s_live; }
+    Tracked(const Tracked&) = delete;
+    ~Tracked() { --s_live; }
+
+    void operator()() const noexcept { ++s_calls; }
+};
+
+struct Throwing
+{
+    Throwing() = default;
+    Throwing(Throwing&&) {}
+
+    void operator()() const noexcept {}
+};
+
+/**
+ * @brief Server Task
+ *
+ * Sunucunun bağlantı görevi ile aynı yakalamaları (this,
+ * soket, ip metni) olan görev üretir
+ *
+ * @param atomic<size_t>& Counter
+ * @param int Socket
+ * @param string Ip
+ * @return auto
+ */
+auto server_task(std::atomic<std::size_t>& ar_counter, const int ar_socket, std::string ar_ip)
+{
+    return [&ar_counter, ar_socket, tm_ip = std::move(ar_ip)]{
+        if( ar_socket >= 0 && !tm_ip.empty() )
+            ar_counter.fetch_add(1, std::memory_order_release);
+    };
+}
+
+/**
+ * @brief Spawn
+ *
+ * Verilen derinlikte iki çocuk görev ekleyen görev ağacı
+ * oluşturur. Toplam görev sayısı 2^(depth+1)-1 olur
+ *
+ * @param ThreadPool& Pool
+ * @param atomic<size_t>& Counter
+ * @param uint32_t Depth
+ */
+void spawn(ThreadPool& ar_pool, std::atomic<std::size_t>& ar_counter, const uint32_t ar_depth)
+{
+    if( ar_depth > 0 )
+    {
+        ar_pool.enqueue([&ar_pool, &ar_counter, ar_depth]{ spawn(ar_pool, ar_counter, ar_depth - 1); });
+        ar_pool.enqueue([&ar_pool, &ar_counter, ar_depth]{ spawn(ar_pool, ar_counter, ar_depth - 1); });
+    }
+
+    ar_counter.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * @brief Wait Count
+ *
+ * @param atomic<size_t>& Counter
+ * @param size_t Count
+ * @return bool
+ */
+bool wait_count(const std::atomic<std::size_t>& ar_counter, const std::size_t ar_count)
+{
+    const auto tm_limit = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+    while( ar_counter.load(std::memory_order_acquire) < ar_count )
+    {
+        if( std::chrono::steady_clock::now() > tm_limit )
+            return false;
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check Task
+ *
+ * Nesnenin görevin içinde ya da dışında tutulmasını, taşıma,
+ * boşaltma ve silinme sayılarını ve move-only yakalamayı
+ * kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_task(Logger<Args...>& ar_logger)
+{
+    std::atomic<std::size_t> tm_counter { 0 };
+    std::array<char, _SIZE_TASK_INLINE - sizeof(void*)> tm_fit {};
+    std::array<char, _SIZE_TASK_INLINE + 1> tm_big {};
+
+    auto tm_server = server_task(tm_counter, 7, ss_ip);
+
+    Task tm_empty;
+    Task tm_small([&tm_counter]{ ++tm_counter; });
+    Task tm_srv(server_task(tm_counter, 7, ss_ip));
+    Task tm_full([tm_fit, &tm_counter]{ tm_counter += tm_fit.size(); });
+    Task tm_heap([tm_big, &tm_counter]{ tm_counter += tm_big.size(); });
+    Task tm_throw(Throwing{});
+
+    bool tm_ok = !tm_empty && tm_small.is_inline() && tm_srv.is_inline() && tm_full.is_inline()
+        && !tm_heap.is_inline() && tm_heap && !tm_throw.is_inline() && tm_throw;
+
+    std::stringstream tm_sstream;
+    tm_sstream << "Task: " << sizeof(Task) << " B | Inline: " << _SIZE_TASK_INLINE << " B | Server Capture: " << sizeof(tm_server)
+        << " B | std::function: " << sizeof(std::function<void()>) << " B | Placement: " << (tm_ok ? "Passed" : "Failed");
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+
+    // MOVE, ASSIGN, RUN
+    Task tm_moved(std::move(tm_srv));
+    tm_moved();
+    tm_full = std::move(tm_moved);
+    tm_full();
+    tm_heap();
+    Task tm_heap_moved(std::move(tm_heap));
+    tm_heap_moved();
+
+    const bool tm_move = !tm_srv && !tm_moved && !tm_heap && tm_full && tm_counter.load() == 2 + 2 * tm_big.size();
+
+    // OBJECT LIFETIME
+    {
+        Task tm_first(Tracked{});
+        Task tm_second(std::move(tm_first));
+        tm_second();
+
+        Task tm_third;
+        tm_third = std::move(tm_second);
+        tm_third();
+
+        tm_third = nullptr;
+    }
+    const bool tm_life = Tracked::s_live.load() == 0 && Tracked::s_calls.load() == 2;
+
+    // MOVE ONLY CAPTURE
+    auto tm_buffer = std::make_unique<std::array<uint8_t, 4096>>();
+    tm_buffer->fill(3);
+
+    int tm_sum = 0;
+    Task tm_unique([tm_data = std::move(tm_buffer), &tm_sum]{
+        for(const uint8_t tm_byte : *tm_data)
+            tm_sum += tm_byte;
+    });
+    Task tm_unique_moved(std::move(tm_unique));
+    tm_unique_moved();
+
+    const bool tm_owned = tm_unique_moved.is_inline() && tm_sum == 3 * 4096;
+
+    // EMPTY AND MOVED FROM TASKS THROW
+    std::size_t tm_throws = 0;
+    for(Task* tm_task : { &tm_empty, &tm_srv, &tm_unique })
+    {
+        try {
+            (*tm_task)();
+        } catch( const std::bad_function_call& ) {
+            ++tm_throws;
+        }
+    }
+    const bool tm_null = tm_throws == 3;
+
+    tm_ok = tm_ok && tm_move && tm_life && tm_owned && tm_null;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Move/Assign: ") + (tm_move ? "Passed" : "Failed")
+        + " | Destroy Once: " + (tm_life ? "Passed" : "Failed") + " | unique_ptr Capture: " + (tm_owned ? "Passed" : "Failed")
+        + " | Empty Call: " + (tm_null ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Pool
+ *
+ * Havuza dışarıdan ve çalışan içinden eklenen görevlerin
+ * ısınmadan sonra bellek ayırmadığını, std::function ile
+ * eklemenin ise görev başına bellek ayırdığını kontrol eder.
+ * unique_ptr yakalayan görevin havuzda çalıştığı denenir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_pool(Logger<Args...>& ar_logger)
+{
+    bool tm_ok = true;
+
+    for(const std::size_t tm_threads : { 1, 4 })
+    {
+        ThreadPool tm_pool(tm_threads);
+        std::atomic<std::size_t> tm_counter { 0 };
+
+        // EXTERNAL, SERVER LIKE
+        auto tm_external = [&]{
+            tm_counter.store(0);
+            for(std::size_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+                tm_pool.enqueue(server_task(tm_counter, static_cast<int>(tm_round), ss_ip));
+            return wait_count(tm_counter, ss_rounds);
+        };
+
+        bool tm_pass = tm_external();
+        uint64_t tm_start = ss_alloc_count.load();
+        tm_pass = tm_external() && tm_pass;
+        const uint64_t tm_task_allocs = ss_alloc_count.load() - tm_start;
+
+        // EXTERNAL, STD::FUNCTION
+        tm_counter.store(0);
+        tm_start = ss_alloc_count.load();
+        for(std::size_t tm_round = 0; tm_round < ss_rounds; ++tm_round)
+            tm_pool.enqueue(std::function<void()>(server_task(tm_counter, static_cast<int>(tm_round), ss_ip)));
+        tm_pass = wait_count(tm_counter, ss_rounds) && tm_pass;
+        const uint64_t tm_function_allocs = ss_alloc_count.load() - tm_start;
+
+        // NESTED, FROM WORKER
+        auto tm_nested = [&]{
+            tm_counter.store(0);
+            tm_pool.enqueue([&]{ spawn(tm_pool, tm_counter, ss_depth); });
+            return wait_count(tm_counter, (std::size_t{ 1 } << (ss_depth + 1)) - 1);
+        };
+
+        tm_pass = tm_nested() && tm_pass;
+        tm_start = ss_alloc_count.load();
+        tm_pass = tm_nested() && tm_pass;
+        const uint64_t tm_nested_allocs = ss_alloc_count.load() - tm_start;
+
+        // MOVE ONLY
+        auto tm_owned = std::make_unique<std::size_t>(ss_rounds);
+        tm_counter.store(0);
+        tm_pool.enqueue([tm_value = std::move(tm_owned), &tm_counter]{ tm_counter.store(*tm_value); });
+        tm_pass = wait_count(tm_counter, ss_rounds) && tm_pass;
+
+        // EMPTY TASKS ARE DROPPED OR SKIPPED, POOL KEEPS RUNNING
+        std::array<Task, 4> tm_bulk;
+        tm_bulk[1] = Task([&tm_counter]{ ++tm_counter; });
+        tm_bulk[3] = Task([&tm_counter]{ ++tm_counter; });
+        Task tm_gone([&tm_counter]{ ++tm_counter; });
+        Task tm_taken(std::move(tm_gone));
+
+        tm_counter.store(0);
+        tm_pool.enqueue(nullptr);
+        tm_pool.enqueue(Task{});
+        tm_pool.enqueue(std::move(tm_gone));
+        tm_pool.enqueue_bulk(tm_bulk.data(), tm_bulk.size());
+        tm_pool.enqueue(std::move(tm_taken));
+        tm_pass = wait_count(tm_counter, 3) && tm_pass;
+
+        // ONLY INBOX GROWTH, ONE WORKER NEVER LOSES NODES TO THIEVES
+        tm_pass = tm_pass && tm_task_allocs * 1000 < ss_rounds && tm_function_allocs >= ss_rounds && (tm_threads > 1 || tm_nested_allocs == 0);
+
+        std::stringstream tm_sstream;
+        tm_sstream << "Workers: " << tm_threads << " | Allocations Per " << ss_rounds << " Tasks | External Task: " << tm_task_allocs
+            << " | External std::function: " << tm_function_allocs << " | Nested " << (std::size_t{ 1 } << (ss_depth + 1)) - 1 << " Tasks: " << tm_nested_allocs
+            << " | Move Only: " << (tm_pass ? "Passed" : "Failed");
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, tm_sstream.str(), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Sunucu görevi için oluşturma + taşıma + çalıştırma süresini
+ * (ns) ve tek çalışanlı havuzda saniyedeki görev sayısını
+ * std::function ve Task ile ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t tm_rounds = 2000000;
+    std::atomic<std::size_t> tm_counter { 0 };
+
+    auto tm_measure = [&](auto&& ar_func) {
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            ar_func(tm_round);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tm_start).count() / tm_rounds;
+    };
+
+    const double tm_function = tm_measure([&](const std::size_t ar_round) {
+        std::function<void()> tm_first(server_task(tm_counter, static_cast<int>(ar_round), ss_ip));
+        std::function<void()> tm_second(std::move(tm_first));
+        tm_second();
+    });
+
+    const double tm_task = tm_measure([&](const std::size_t ar_round) {
+        Task tm_first(server_task(tm_counter, static_cast<int>(ar_round), ss_ip));
+        Task tm_second(std::move(tm_first));
+        tm_second();
+    });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Server Task Make + Move + Run | std::function: " << tm_function
+        << " ns | Task: " << tm_task << " ns (x" << tm_function / tm_task << ")";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+
+    ThreadPool tm_pool(1);
+    auto tm_throughput = [&](const bool ar_function) {
+        static constexpr std::size_t tm_count = 200000;
+        tm_counter.store(0);
+
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_count; ++tm_round)
+        {
+            if( ar_function )
+                tm_pool.enqueue(std::function<void()>(server_task(tm_counter, static_cast<int>(tm_round), ss_ip)));
+            else
+                tm_pool.enqueue(server_task(tm_counter, static_cast<int>(tm_round), ss_ip));
+        }
+        wait_count(tm_counter, tm_count);
+
+        return tm_count / std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count() / 1e6;
+    };
+
+    tm_throughput(false);
+    const double tm_pool_function = tm_throughput(true);
+    const double tm_pool_task = tm_throughput(false);
+
+    tm_sstream.str("");
+    tm_sstream << "Pool Enqueue + Run (1 Worker) | std::function: " << tm_pool_function << " Mtask/s | Task: " << tm_pool_task
+        << " Mtask/s (x" << tm_pool_task / tm_pool_function << ")";
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    bool vv_ok = check_task(vv_testlog);
+    vv_ok = check_pool(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,137 @@
+// Abdulkadir U. - 2026/10/18
+#pragma once
+
+/**
+ * Socket Link (Soket Bağlantısı)
+ *
+ * Soket testlerinin ortak yardımcıları. Soket çiftinin iki
+ * ucu arasında istemci ve sunucu gibi el sıkışıp oturumları
+ * açar, kapatır ve karşı uçtan ham çerçeve okuyup yazar.
+ * El sıkışma sırası tek yerde tutulur
+ */
+
+// Include
+#include <socket/socket.hpp>
+
+#include <string>
+
+// Struct
+struct Link
+{
+    int m_pair[2] { -1, -1 };
+    netsocket::random_t m_client {};
+    netsocket::random_t m_server {};
+    netsocket::flag::flag_t m_client_feature { netsocket::_FEATURE_NULL };
+    netsocket::flag::flag_t m_server_feature { netsocket::_FEATURE_NULL };
+};
+
+/**
+ * @brief Connect
+ *
+ * Soket çiftinin iki ucu arasında istemci ve sunucu gibi
+ * el sıkışır: önce istemci, sonra sunucu doğrulama değeri,
+ * özellikleri ve rastgele değerini gönderir. İki taraf da
+ * kendi kaydı ve karşıdan gelen kayıt ile oturumunu açar
+ *
+ * @param Socket& Client
+ * @param Socket& Server
+ * @param Link& Link
+ * @return bool
+ */
+inline bool connect(netsocket::Socket& ar_client, netsocket::Socket& ar_server, Link& ar_link)
+{
+    using netsocket::Socket;
+
+    netsocket::Hello tm_client { ar_client.get_feature(), {} };
+    netsocket::Hello tm_server { ar_server.get_feature(), {} };
+    if( !Socket::make_random(tm_client.m_random).is_ok() || !Socket::make_random(tm_server.m_random).is_ok() )
+        return false;
+
+    if( ::socketpair(AF_UNIX, SOCK_STREAM, 0, ar_link.m_pair) != 0 )
+        return false;
+
+    // CLIENT -> SERVER
+    if( !Socket::handshake_send_verify(ar_link.m_pair[0], tm_client.m_feature, tm_client.m_random).is_ok() )
+        return false;
+    if( !Socket::handshake_recv_verify(ar_link.m_pair[1], ar_link.m_client_feature, ar_link.m_client, false).is_ok() )
+        return false;
+
+    // SERVER -> CLIENT
+    if( !Socket::handshake_send_verify(ar_link.m_pair[1], tm_server.m_feature, tm_server.m_random).is_ok() )
+        return false;
+    if( !Socket::handshake_recv_verify(ar_link.m_pair[0], ar_link.m_server_feature, ar_link.m_server, false).is_ok() )
+        return false;
+
+    if( ar_link.m_client != tm_client.m_random || ar_link.m_server != tm_server.m_random )
+        return false;
+
+    // EACH SIDE PAIRS ITS OWN RECORD WITH THE ONE IT RECEIVED
+    return ar_client.open_session(ar_link.m_pair[0], tm_client, netsocket::Hello{ ar_link.m_server_feature, ar_link.m_server }).is_ok()
+        && ar_server.open_session(ar_link.m_pair[1], netsocket::Hello{ ar_link.m_client_feature, ar_link.m_client }, tm_server).is_ok();
+}
+
+/**
+ * @brief Disconnect
+ *
+ * @param Socket& Client
+ * @param Socket& Server
+ * @param Link& Link
+ */
+inline void disconnect(netsocket::Socket& ar_client, netsocket::Socket& ar_server, Link& ar_link)
+{
+    ar_client.close_session(ar_link.m_pair[0]);
+    ar_server.close_session(ar_link.m_pair[1]);
+
+    netsocket::Socket::close_socket(ar_link.m_pair[0]);
+    netsocket::Socket::close_socket(ar_link.m_pair[1]);
+}
+
+/**
+ * @brief Read Frame
+ *
+ * Karşı uçtan verilen uzunlukta ham bayt okur
+ *
+ * @param socket_t Socket
+ * @param size_t Length
+ * @return string
+ */
+inline std::string read_frame(const netsocket::socket_t ar_sock, const std::size_t ar_len)
+{
+    std::string tm_raw(ar_len, '\0');
+    std::size_t tm_read = 0;
+
+    while( tm_read < ar_len )
+    {
+        const ssize_t tm_count = ::read(ar_sock, tm_raw.data() + tm_read, ar_len - tm_read);
+        if( tm_count <= 0 )
+            break;
+        tm_read += static_cast<std::size_t>(tm_count);
+    }
+
+    tm_raw.resize(tm_read);
+    return tm_raw;
+}
+
+/**
+ * @brief Write Frame
+ *
+ * Ham baytları karşı uca yazar
+ *
+ * @param socket_t Socket
+ * @param string& Raw
+ * @return bool
+ */
+inline bool write_frame(const netsocket::socket_t ar_sock, const std::string& ar_raw)
+{
+    std::size_t tm_written = 0;
+
+    while( tm_written < ar_raw.size() )
+    {
+        const ssize_t tm_count = ::write(ar_sock, ar_raw.data() + tm_written, ar_raw.size() - tm_written);
+        if( tm_count <= 0 )
+            return false;
+        tm_written += static_cast<std::size_t>(tm_count);
+    }
+
+    return true;
+}
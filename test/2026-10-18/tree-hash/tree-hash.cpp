@@ -0,0 +1,422 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Tree Hash (Ağaç Yapılı Özet)
+ *
+ * BLAKE3 özetinin resmi test vektörlerini (girdi i % 251)
+ * anahtarsız, anahtarlı ve uzun çıktı (XOF) için her çekirdek
+ * (portable, SSE4.1, AVX2) ile kontrol edeceğiz. Verinin
+ * rastgele boyutlu parçalar halinde eklenmesinin, sonuç
+ * alındıktan sonra eklemeye devam edilmesinin ve ThreadPool
+ * ile paralel eklemenin tek seferde eklemek ile aynı sonucu
+ * verdiği denenir. Çekirdek ve çalışan sayısına göre hız
+ * (GB/s) SHA-256 ile birlikte ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 tree-hash.cpp -pthread -o bsd/tree-hash.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 tree-hash.cpp -pthread -o linux/tree-hash.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 tree-hash.cpp -o windows/tree-hash.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/tree-hash.bsd
+ *  Linux   :: ./linux/tree-hash.linux
+ *  Windows :: ./windows/tree-hash.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+#include <kits/hashkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/parallelpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+using namespace tools::hash;
+
+using namespace pool::threadpool;
+namespace parallelpool = pool::parallelpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "tree-hash-" + ss_osname;
+
+static const std::string ss_key = "whats the Elvish word for friend";
+
+// Struct
+struct Vector
+{
+    std::size_t m_len;
+    const char* m_hash;
+    const char* m_keyed;
+};
+
+static const Vector ss_vectors[] =
+{
+    { 0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262", "92b2b75604ed3c761f9d6f62392c8a9227ad0ea3f09573e783f1498a4ed60d26" },
+    { 1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213", "6d7878dfff2f485635d39013278ae14f1454b8c0a3a2d34bc1ab38228a80c95b" },
+    { 1023, "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11", "c951ecdf03288d0fcc96ee3413563d8a6d3589547f2c2fb36d9786470f1b9d6e" },
+    { 1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7", "75c46f6f3d9eb4f55ecaaee480db732e6c2105546f1e675003687c31719c7ba4" },
+    { 1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444", "357dc55de0c7e382c900fd6e320acc04146be01db6a8ce7210b7189bd664ea69" },
+    { 2048, "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a", "879cf1fa2ea0e79126cb1063617a05b6ad9d0b696d0d757cf053439f60a99dd1" },
+    { 2049, "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030", "9f29700902f7c86e514ddc4df1e3049f258b2472b6dd5267f61bf13983b78dd5" },
+    { 3072, "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2", "044a0e7b172a312dc02a4c9a818c036ffa2776368d7f528268d2e6b5df191770" },
+    { 3073, "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3", "68dede9bef00ba89e43f31a6825f4cf433389fedae75c04ee9f0cf16a427c95a" },
+    { 4096, "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969", "befc660aea2f1718884cd8deb9902811d332f4fc4a38cf7c7300d597a081bfc0" },
+    { 4097, "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995", "00df940cd36bb9fa7cbbc3556744e0dbc8191401afe70520ba292ee3ca80abbc" },
+    { 5120, "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833", "2c493e48e9b9bf31e0553a22b23503c0a3388f035cece68eb438d22fa1943e20" },
+    { 5121, "628bd2cb2004694adaab7bbd778a25df25c47b9d4155a55f8fbd79f2fe154cff", "6ccf1c34753e7a044db80798ecd0782a8f76f33563accaddbfbb2e0ea4b2d024" },
+    { 6144, "3e2e5b74e048f3add6d21faab3f83aa44d3b2278afb83b80b3c35164ebeca205", "3d6b6d21281d0ade5b2b016ae4034c5dec10ca7e475f90f76eac7138e9bc8f1d" },
+    { 6145, "f1323a8631446cc50536a9f705ee5cb619424d46887f3c376c695b70e0f0507f", "9ac301e9e39e45e3250a7e3b3df701aa0fb6889fbd80eeecf28dbc6300fbc539" },
+    { 7168, "61da957ec2499a95d6b8023e2b0e604ec7f6b50e80a9678b89d2628e99ada77a", "b42835e40e9d4a7f42ad8cc04f85a963a76e18198377ed84adddeaecacc6f3fc" },
+    { 7169, "a003fc7a51754a9b3c7fae0367ab3d782dccf28855a03d435f8cfe74605e7817", "ed9b1a922c046fdb3d423ae34e143b05ca1bf28b710432857bf738bcedbfa511" },
+    { 8192, "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63", "dc9637c8845a770b4cbf76b8daec0eebf7dc2eac11498517f08d44c8fc00d58a" },
+    { 8193, "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b", "954a2a75420c8d6547e3ba5b98d963e6fa6491addc8c023189cc519821b4a1f5" },
+    { 16384, "f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4", "9e9fc4eb7cf081ea7c47d1807790ed211bfec56aa25bb7037784c13c4b707b0d" },
+    { 31744, "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47", "efa53b389ab67c593dba624d898d0f7353ab99e4ac9d42302ee64cbf9939a419" },
+    { 102400, "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085", "1c35d1a5811083fd7119f5d5d1ba027b4d01c0c6c49fb6ff2cf75393ea5db4a7" }
+};
+
+// 1025 BYTES, 131 BYTES OF OUTPUT
+static const std::string ss_xof =
+    "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444"
+    "f4c4a22b4b399155358a994e52bf255de60035742ec71bd08ac275a1b51cc6bf"
+    "e332b0ef84b409108cda080e6269ed4b3e2c3f7d722aa4cdc98d16deb554e562"
+    "7be8f955c98e1d5f9565a9194cad0c4285f93700062d9595adb992ae68ff1280"
+    "0ab67a";
+
+// 4 MB + 4097 BYTES
+static constexpr std::size_t ss_large_len = (std::size_t{ 1 } << 22) + 4097;
+static const std::string ss_large = "579aa4b04ebe012b3d8692c16d5aa6b95d918ae047907e50472daf8e369a27de";
+
+static const std::pair<blake3::kernel_t, const char*> ss_kernels[] =
+{
+    { blake3::kernel_t::portable, "Portable" },
+    { blake3::kernel_t::sse41, "SSE4.1" },
+    { blake3::kernel_t::avx2, "AVX2" }
+};
+
+/**
+ * @brief Make Input
+ *
+ * Test vektörlerinin girdisi, i % 251
+ *
+ * @param size_t Length
+ * @return vector<uint8_t>
+ */
+std::vector<uint8_t> make_input(const std::size_t ar_len)
+{
+    std::vector<uint8_t> tm_out(ar_len);
+    for(std::size_t tm_count = 0; tm_count < ar_len; ++tm_count)
+        tm_out[tm_count] = static_cast<uint8_t>(tm_count % 251);
+    return tm_out;
+}
+
+/**
+ * @brief To Hex
+ *
+ * @param uint8_t* Data
+ * @param size_t Length
+ * @return string
+ */
+std::string to_hex(const uint8_t* ar_data, const std::size_t ar_len)
+{
+    static constexpr char ss_digits[] = "0123456789abcdef";
+
+    std::string tm_out;
+    tm_out.reserve(ar_len * 2);
+    for(std::size_t tm_count = 0; tm_count < ar_len; ++tm_count)
+    {
+        tm_out.push_back(ss_digits[ar_data[tm_count] >> 4]);
+        tm_out.push_back(ss_digits[ar_data[tm_count] & 0x0f]);
+    }
+    return tm_out;
+}
+
+/**
+ * @brief Check Vectors
+ *
+ * Her çekirdek ile anahtarsız ve anahtarlı vektörleri, uzun
+ * çıktıyı ve çıktının ortasından (seek) okumayı kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_vectors(Logger<Args...>& ar_logger)
+{
+    blake3::key_t tm_key {};
+    std::memcpy(tm_key.data(), ss_key.data(), tm_key.size());
+
+    bool tm_ok = true;
+    for(const auto& [tm_kernel, tm_name] : ss_kernels)
+    {
+        if( !blake3::is_supported(tm_kernel) )
+        {
+            ar_logger.write(level_t::Warn, std::string("Kernel: ") + tm_name + " | Not Supported, Skipped", GET_SOURCE);
+            continue;
+        }
+
+        std::size_t tm_failed = 0;
+        for(const Vector& tm_vector : ss_vectors)
+        {
+            const std::vector<uint8_t> tm_input = make_input(tm_vector.m_len);
+
+            blake3::Hasher tm_hasher;
+            tm_hasher.set_kernel(tm_kernel);
+            tm_hasher.update(tm_input.data(), tm_input.size());
+
+            blake3::Hasher tm_keyed(tm_key);
+            tm_keyed.set_kernel(tm_kernel);
+            tm_keyed.update(tm_input.data(), tm_input.size());
+
+            const blake3::digest_t tm_hash = tm_hasher.finish();
+            const blake3::digest_t tm_mac = tm_keyed.finish();
+
+            if( to_hex(tm_hash.data(), tm_hash.size()) != tm_vector.m_hash || to_hex(tm_mac.data(), tm_mac.size()) != tm_vector.m_keyed )
+                ++tm_failed;
+        }
+
+        // EXTENDED OUTPUT AND SEEK INTO IT
+        const std::vector<uint8_t> tm_input = make_input(1025);
+        blake3::Hasher tm_hasher;
+        tm_hasher.set_kernel(tm_kernel);
+        tm_hasher.update(tm_input.data(), tm_input.size());
+
+        uint8_t tm_xof[131];
+        tm_hasher.finish(tm_xof, sizeof(tm_xof));
+
+        uint8_t tm_tail[67];
+        tm_hasher.finish(tm_tail, sizeof(tm_tail), 64);
+
+        const bool tm_xof_ok = to_hex(tm_xof, sizeof(tm_xof)) == ss_xof && to_hex(tm_tail, sizeof(tm_tail)) == ss_xof.substr(128);
+        const bool tm_pass = tm_failed == 0 && tm_xof_ok;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, std::string("Kernel: ") + tm_name + " | Hash/Keyed Failed: " + std::to_string(tm_failed)
+            + "/" + std::to_string(std::size(ss_vectors)) + " | Xof + Seek: " + (tm_xof_ok ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Stream
+ *
+ * Verinin rastgele boyutlu parçalar halinde eklenmesinin ve
+ * ara sonuç alındıktan sonra eklemeye devam edilmesinin tek
+ * seferde eklemek ile aynı sonucu verdiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_stream(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(1018);
+    std::size_t tm_failed = 0;
+    std::size_t tm_total = 0;
+
+    for(const std::size_t tm_len : { std::size_t{ 0 }, std::size_t{ 64 }, std::size_t{ 1025 }, std::size_t{ 65537 }, std::size_t{ 1000000 } })
+    {
+        const std::vector<uint8_t> tm_input = make_input(tm_len);
+        const blake3::digest_t tm_whole = blake3::digest(tm_input.data(), tm_input.size());
+
+        for(const std::size_t tm_max : { 1, 63, 1024, 5000, 300000 })
+        {
+            blake3::Hasher tm_hasher;
+            std::size_t tm_pos = 0;
+
+            while( tm_pos < tm_len )
+            {
+                const std::size_t tm_take = std::min(tm_len - tm_pos, static_cast<std::size_t>(tm_rng() % tm_max) + 1);
+                tm_hasher.update(tm_input.data() + tm_pos, tm_take);
+                tm_pos += tm_take;
+
+                // FINISH DOES NOT CHANGE THE STATE
+                if( (tm_rng() & 7) == 0 )
+                    (void)tm_hasher.finish();
+            }
+
+            ++tm_total;
+            if( tm_hasher.finish() != tm_whole )
+                ++tm_failed;
+        }
+    }
+
+    ar_logger.write(tm_failed ? level_t::Err : level_t::Info, "Stream Random Splits Failed: " + std::to_string(tm_failed) + "/" + std::to_string(tm_total), GET_SOURCE);
+    return tm_failed == 0;
+}
+
+/**
+ * @brief Check Parallel
+ *
+ * Havuz ile paralel eklemenin tek iş parçacığında eklemek
+ * ile aynı olduğunu, önünde yarım parça bulunan (hizasız)
+ * girdilerde de kontrol eder. Büyük vektör paralel yoldan
+ * doğrulanır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param ThreadPool& Pool
+ * @return bool
+ */
+template<class... Args>
+bool check_parallel(Logger<Args...>& ar_logger, ThreadPool& ar_pool)
+{
+    bool tm_ok = true;
+
+    for(const std::size_t tm_len : { parallelpool::_MIN_LEN_PARALLEL - 1, parallelpool::_MIN_LEN_PARALLEL, std::size_t{ 3 * 1024 * 1024 + 5 }, std::size_t{ 8 * 1024 * 1024 }, std::size_t{ 17 * 1024 * 1024 + 1000 } })
+    {
+        for(const std::size_t tm_prefix : { std::size_t{ 0 }, std::size_t{ 777 }, std::size_t{ 200000 } })
+        {
+            const std::vector<uint8_t> tm_input = make_input(tm_prefix + tm_len);
+
+            blake3::Hasher tm_serial;
+            tm_serial.update(tm_input.data(), tm_input.size());
+
+            blake3::Hasher tm_parallel;
+            tm_parallel.update(tm_input.data(), tm_prefix);
+            parallelpool::hash(ar_pool, tm_parallel, tm_input.data() + tm_prefix, tm_len);
+
+            const bool tm_pass = tm_parallel.finish() == tm_serial.finish();
+            if( !tm_pass )
+                ar_logger.write(level_t::Err, "Parallel | Size: " + std::to_string(tm_len) + " | Prefix: " + std::to_string(tm_prefix) + " | Failed", GET_SOURCE);
+
+            tm_ok = tm_ok && tm_pass;
+        }
+    }
+
+    const std::vector<uint8_t> tm_input = make_input(ss_large_len);
+    blake3::Hasher tm_hasher;
+    parallelpool::hash(ar_pool, tm_hasher, tm_input.data(), tm_input.size());
+
+    const blake3::digest_t tm_digest = tm_hasher.finish();
+    const bool tm_large = to_hex(tm_digest.data(), tm_digest.size()) == ss_large;
+
+    ar_logger.write(tm_ok && tm_large ? level_t::Info : level_t::Err, std::string("Parallel Equal To Serial: ") + (tm_ok ? "Passed" : "Failed")
+        + " | Vector " + std::to_string(ss_large_len) + " B: " + (tm_large ? "Passed" : "Failed"), GET_SOURCE);
+    return tm_ok && tm_large;
+}
+
+/**
+ * @brief Measure
+ *
+ * Verilen işlemin saniyedeki gigabayt miktarını döndürür
+ *
+ * @tparam Func Function
+ * @param size_t Size
+ * @param size_t Rounds
+ * @param Func Function
+ * @return double
+ */
+template<class Func>
+double measure(const std::size_t ar_size, const std::size_t ar_rounds, Func&& ar_func)
+{
+    const auto tm_start = std::chrono::steady_clock::now();
+    for(std::size_t tm_round = 0; tm_round < ar_rounds; ++tm_round)
+        ar_func();
+    const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    return static_cast<double>(ar_rounds * ar_size) / tm_sec / 1e9;
+}
+
+/**
+ * @brief Bench
+ *
+ * Verilen boyuttaki tamponun özetini her çekirdek ile tek iş
+ * parçacığında ve en hızlı çekirdek ile artan çalışan sayılı
+ * havuzlarda hesaplar. Karşılaştırma için SHA-256 hızı da
+ * yazılır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    const std::vector<uint8_t> tm_data = make_input(ar_size);
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 28) / ar_size);
+    uint8_t tm_sink = 0;
+
+    const double tm_sha = measure(ar_size, std::max<std::size_t>(1, tm_rounds / 8), [&]{
+        tm_sink ^= sha256::digest(tm_data.data(), ar_size)[0];
+    });
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: " << std::setw(8) << ar_size << " B | Threads: 1 | SHA-256: " << tm_sha << " GB/s";
+
+    double tm_best = 0.0;
+    for(const auto& [tm_kernel, tm_name] : ss_kernels)
+    {
+        if( !blake3::is_supported(tm_kernel) )
+            continue;
+
+        const double tm_speed = measure(ar_size, tm_rounds, [&]{
+            blake3::Hasher tm_hasher;
+            tm_hasher.set_kernel(tm_kernel);
+            tm_hasher.update(tm_data.data(), ar_size);
+            tm_sink ^= tm_hasher.finish()[0];
+        });
+
+        tm_best = std::max(tm_best, tm_speed);
+        tm_sstream << " | " << tm_name << ": " << tm_speed << " GB/s";
+    }
+
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+
+    const std::size_t tm_cores = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for(std::size_t tm_threads = 2; tm_threads <= std::max<std::size_t>(2, tm_cores); tm_threads *= 2)
+    {
+        ThreadPool tm_pool(tm_threads - 1);
+
+        const double tm_speed = measure(ar_size, tm_rounds, [&]{
+            blake3::Hasher tm_hasher;
+            parallelpool::hash(tm_pool, tm_hasher, tm_data.data(), ar_size);
+            tm_sink ^= tm_hasher.finish()[0];
+        });
+
+        tm_sstream.str("");
+        tm_sstream << "Size: " << std::setw(8) << ar_size << " B | Threads: " << tm_threads
+            << " | BLAKE3: " << tm_speed << " GB/s (x" << tm_speed / tm_best << ")";
+        ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+    }
+
+    if( tm_sink == 0xFF )
+        ar_logger.write(level_t::Debug, "Sink", GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    ThreadPool vv_pool(4);
+
+    bool vv_ok = check_vectors(vv_testlog);
+    vv_ok = check_stream(vv_testlog) && vv_ok;
+    vv_ok = check_parallel(vv_testlog, vv_pool) && vv_ok;
+
+    for(const std::size_t vv_size : { 64 * 1024, 16 * 1024 * 1024 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,461 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Work Steal (İş Çalma)
+ *
+ * ThreadPool görevlerinin her çalışanın kendi kuyruğu ve iş
+ * çalma ile dağıtıldığı yapıyı kontrol edeceğiz. Dışarıdan ve
+ * çalışanların içinden eklenen her görevin bir kez çalıştığı,
+ * bir çalışanın eklediği görevlerin diğer çalışanlar tarafından
+ * çalındığı, hata fırlatan görevin çalışanı durdurmadığı ve
+ * durdurulan havuzun bekleyen görevleri çalıştırmadan
+ * sonlandığı denenir. Tek kilitli kuyruk kullanan eski havuz
+ * ile saniyedeki görev sayısı karşılaştırılır
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 work-steal.cpp -pthread -o bsd/work-steal.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 work-steal.cpp -pthread -o linux/work-steal.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 work-steal.cpp -o windows/work-steal.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/work-steal.bsd
+ *  Linux   :: ./linux/work-steal.linux
+ *  Windows :: ./windows/work-steal.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/parallelpool.hpp>
+
+#include <set>
+#include <queue>
+#include <functional>
+#include <chrono>
+#include <vector>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::threadpool;
+namespace parallelpool = pool::parallelpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "work-steal-" + ss_osname;
+
+// Class
+class LockedPool final
+{
+    private:
+        std::vector<std::thread> m_workers;
+        std::queue<std::function<void()>> m_tasks;
+
+        std::mutex m_mtx;
+        std::condition_variable m_convar;
+        bool m_stop { false };
+
+    public:
+        /**
+         * @brief LockedPool
+         *
+         * Karşılaştırma için eski havuz; tüm görevler tek bir
+         * kilitli kuyruktan alınır
+         *
+         * @param size_t Thread Count
+         */
+        explicit LockedPool(const std::size_t ar_thread_count)
+        {
+            for(std::size_t tm_count = 0; tm_count < ar_thread_count; ++tm_count)
+            {
+                this->m_workers.emplace_back([this]{
+                    while( true )
+                    {
+                        std::function<void()> tm_task;
+
+                        {
+                            std::unique_lock<std::mutex> tm_lock(this->m_mtx);
+                            this->m_convar.wait(tm_lock, [this]{ return this->m_stop || !this->m_tasks.empty(); });
+
+                            if( this->m_stop )
+                                return;
+
+                            tm_task = std::move(this->m_tasks.front());
+                            this->m_tasks.pop();
+                        }
+
+                        tm_task();
+                    }
+                });
+            }
+        }
+
+        ~LockedPool()
+        {
+            {
+                std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+                this->m_stop = true;
+            }
+
+            this->m_convar.notify_all();
+            for(auto& tm_worker : this->m_workers)
+                tm_worker.join();
+        }
+
+        void enqueue(std::function<void()> ar_func)
+        {
+            {
+                std::lock_guard<std::mutex> tm_lock(this->m_mtx);
+                this->m_tasks.emplace(std::move(ar_func));
+            }
+
+            this->m_convar.notify_one();
+        }
+};
+
+/**
+ * @brief Wait Count
+ *
+ * Sayaç verilen değere ulaşana ya da süre dolana kadar bekler
+ *
+ * @param atomic<size_t>& Counter
+ * @param size_t Count
+ * @return bool
+ */
+bool wait_count(const std::atomic<std::size_t>& ar_counter, const std::size_t ar_count)
+{
+    const auto tm_limit = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+    while( ar_counter.load(std::memory_order_acquire) < ar_count )
+    {
+        if( std::chrono::steady_clock::now() > tm_limit )
+            return false;
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Spawn
+ *
+ * Verilen derinlikte iki çocuk görev ekleyen görev ağacı
+ * oluşturur. Toplam görev sayısı 2^(depth+1)-1 olur
+ *
+ * @tparam Pool Pool
+ * @param Pool& Pool
+ * @param atomic<size_t>& Counter
+ * @param uint32_t Depth
+ */
+template<class Pool>
+void spawn(Pool& ar_pool, std::atomic<std::size_t>& ar_counter, const uint32_t ar_depth)
+{
+    if( ar_depth > 0 )
+    {
+        ar_pool.enqueue([&ar_pool, &ar_counter, ar_depth]{ spawn(ar_pool, ar_counter, ar_depth - 1); });
+        ar_pool.enqueue([&ar_pool, &ar_counter, ar_depth]{ spawn(ar_pool, ar_counter, ar_depth - 1); });
+    }
+
+    ar_counter.fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * @brief Check Once
+ *
+ * Dışarıdan ve birden fazla üreticiden eklenen görevlerin
+ * her birinin tam olarak bir kez çalıştığını kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_once(Logger<Args...>& ar_logger)
+{
+    static constexpr std::size_t tm_count = 100000;
+    static constexpr std::size_t tm_producers = 4;
+
+    bool tm_ok = true;
+    for(const std::size_t tm_threads : { 1, 2, 4, 7 })
+    {
+        ThreadPool tm_pool(tm_threads);
+        std::vector<std::atomic<uint8_t>> tm_flags(tm_count);
+        std::atomic<std::size_t> tm_done { 0 };
+
+        std::vector<std::thread> tm_producer;
+        for(std::size_t tm_index = 0; tm_index < tm_producers; ++tm_index)
+        {
+            tm_producer.emplace_back([&, tm_index]{
+                for(std::size_t tm_task = tm_index; tm_task < tm_count; tm_task += tm_producers)
+                {
+                    tm_pool.enqueue([&tm_flags, &tm_done, tm_task]{
+                        tm_flags[tm_task].fetch_add(1, std::memory_order_relaxed);
+                        tm_done.fetch_add(1, std::memory_order_release);
+                    });
+                }
+            });
+        }
+
+        for(auto& tm_thread : tm_producer)
+            tm_thread.join();
+
+        bool tm_pass = wait_count(tm_done, tm_count);
+        for(const auto& tm_flag : tm_flags)
+            tm_pass = tm_pass && tm_flag.load() == 1;
+
+        std::atomic<std::size_t> tm_tree { 0 };
+        tm_pool.enqueue([&tm_pool, &tm_tree]{ spawn(tm_pool, tm_tree, 13); });
+        tm_pass = wait_count(tm_tree, (std::size_t{ 1 } << 14) - 1) && tm_pass;
+
+        ar_logger.write(tm_pass ? level_t::Info : level_t::Err, "Workers: " + std::to_string(tm_threads) + " | External " + std::to_string(tm_count) + " + Nested " + std::to_string(tm_tree.load()) + " Tasks Once: " + (tm_pass ? "Passed" : "Failed"), GET_SOURCE);
+        tm_ok = tm_ok && tm_pass;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Check Steal
+ *
+ * Bir çalışanın kendi kuyruğuna eklediği görevlerin diğer
+ * çalışanlar tarafından çalındığını, hata fırlatan görevlerin
+ * çalışanı durdurmadığını ve çalışan içinden paralel for_each
+ * çağrılabildiğini kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_steal(Logger<Args...>& ar_logger)
+{
+    ThreadPool tm_pool(4);
+
+    std::mutex tm_mtx;
+    std::set<std::thread::id> tm_ids;
+    std::atomic<std::size_t> tm_done { 0 };
+
+    tm_pool.enqueue([&]{
+        for(uint32_t tm_task = 0; tm_task < 64; ++tm_task)
+        {
+            tm_pool.enqueue([&]{
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                {
+                    std::lock_guard<std::mutex> tm_lock(tm_mtx);
+                    tm_ids.insert(std::this_thread::get_id());
+                }
+                tm_done.fetch_add(1, std::memory_order_release);
+            });
+        }
+    });
+
+    bool tm_ok = wait_count(tm_done, 64) && tm_ids.size() > 1;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, "Local Tasks Stolen By " + std::to_string(tm_ids.size()) + " Workers: " + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    std::atomic<std::size_t> tm_after { 0 };
+    for(uint32_t tm_task = 0; tm_task < 16; ++tm_task)
+        tm_pool.enqueue([]{ throw std::runtime_error("task"); });
+    for(uint32_t tm_task = 0; tm_task < 16; ++tm_task)
+        tm_pool.enqueue([&tm_after]{ tm_after.fetch_add(1, std::memory_order_release); });
+
+    const bool tm_throw = wait_count(tm_after, 16);
+    ar_logger.write(tm_throw ? level_t::Info : level_t::Err, std::string("Throwing Tasks Keep Workers: ") + (tm_throw ? "Passed" : "Failed"), GET_SOURCE);
+
+    std::atomic<std::size_t> tm_sum { 0 }, tm_nested { 0 };
+    tm_pool.enqueue([&]{
+        auto tm_task = [&tm_sum](const std::size_t ar_index) noexcept { tm_sum.fetch_add(ar_index, std::memory_order_relaxed); };
+        parallelpool::for_each(tm_pool, 1000, tm_task);
+        tm_nested.store(1, std::memory_order_release);
+    });
+
+    const bool tm_each = wait_count(tm_nested, 1) && tm_sum.load() == 999 * 1000 / 2;
+    ar_logger.write(tm_each ? level_t::Info : level_t::Err, std::string("Nested For Each: ") + (tm_each ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok && tm_throw && tm_each;
+}
+
+/**
+ * @brief Check Stop
+ *
+ * Çalışanlar meşgul iken durdurulan havuzun bekleyen görevleri
+ * çalıştırmadığını, durduktan sonra eklenen görevleri kabul
+ * etmediğini ve bekleyen görevlerin havuz ile silindiğini
+ * kontrol eder
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_stop(Logger<Args...>& ar_logger)
+{
+    auto tm_token = std::make_shared<int>(0);
+    std::atomic<std::size_t> tm_started { 0 }, tm_ran { 0 };
+    std::atomic<bool> tm_release { false };
+
+    bool tm_ok = true;
+    {
+        ThreadPool tm_pool(2);
+
+        for(uint32_t tm_task = 0; tm_task < 2; ++tm_task)
+        {
+            tm_pool.enqueue([&]{
+                tm_started.fetch_add(1, std::memory_order_release);
+                while( !tm_release.load(std::memory_order_acquire) )
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            });
+        }
+
+        tm_ok = wait_count(tm_started, 2);
+        for(uint32_t tm_task = 0; tm_task < 100; ++tm_task)
+            tm_pool.enqueue([tm_token, &tm_ran]{ tm_ran.fetch_add(1); });
+
+        std::thread tm_releaser([&tm_release]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            tm_release.store(true, std::memory_order_release);
+        });
+
+        tm_pool.stop();
+        tm_releaser.join();
+
+        tm_pool.enqueue([tm_token, &tm_ran]{ tm_ran.fetch_add(1); });
+        tm_ok = tm_ok && !tm_pool.is_running() && tm_ran.load() == 0;
+    }
+
+    tm_ok = tm_ok && tm_token.use_count() == 1;
+    ar_logger.write(tm_ok ? level_t::Info : level_t::Err, std::string("Stop Drops Pending Tasks: ") + (tm_ok ? "Passed" : "Failed"), GET_SOURCE);
+
+    return tm_ok;
+}
+
+/**
+ * @brief Measure
+ *
+ * Verilen sayıda görev için saniyedeki görev sayısını
+ * (milyon) döndürür. İşlem verilen sayaç dolunca biter
+ *
+ * @tparam Func Function
+ * @param atomic<size_t>& Counter
+ * @param size_t Count
+ * @param Func Function
+ * @return double
+ */
+template<class Func>
+double measure(std::atomic<std::size_t>& ar_counter, const std::size_t ar_count, Func&& ar_func)
+{
+    ar_counter.store(0);
+
+    const auto tm_start = std::chrono::steady_clock::now();
+    ar_func();
+    wait_count(ar_counter, ar_count);
+    const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+    return static_cast<double>(ar_count) / tm_sec / 1e6;
+}
+
+/**
+ * @brief Bench Pool
+ *
+ * Tek üretici, dört üretici ve çalışanların içinden eklenen
+ * görev ağacı için saniyedeki görev sayısını ölçer
+ *
+ * @tparam Pool Pool
+ * @param Pool& Pool
+ * @return array<double, 3>
+ */
+template<class Pool>
+std::array<double, 3> bench_pool(Pool& ar_pool)
+{
+    static constexpr std::size_t tm_count = 200000;
+    static constexpr uint32_t tm_depth = 17;
+
+    std::atomic<std::size_t> tm_counter { 0 };
+    auto tm_task = [&tm_counter]{ tm_counter.fetch_add(1, std::memory_order_release); };
+
+    const double tm_single = measure(tm_counter, tm_count, [&]{
+        for(std::size_t tm_index = 0; tm_index < tm_count; ++tm_index)
+            ar_pool.enqueue(tm_task);
+    });
+
+    const double tm_multi = measure(tm_counter, tm_count, [&]{
+        std::vector<std::thread> tm_producer;
+        for(std::size_t tm_index = 0; tm_index < 4; ++tm_index)
+        {
+            tm_producer.emplace_back([&]{
+                for(std::size_t tm_index = 0; tm_index < tm_count / 4; ++tm_index)
+                    ar_pool.enqueue(tm_task);
+            });
+        }
+
+        for(auto& tm_thread : tm_producer)
+            tm_thread.join();
+    });
+
+    const double tm_tree = measure(tm_counter, (std::size_t{ 1 } << (tm_depth + 1)) - 1, [&]{
+        ar_pool.enqueue([&]{ spawn(ar_pool, tm_counter, tm_depth); });
+    });
+
+    return { tm_single, tm_multi, tm_tree };
+}
+
+/**
+ * @brief Bench
+ *
+ * Artan çalışan sayılarında eski havuz ve iş çalan havuz
+ * için saniyedeki görev sayısını (milyon) ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger)
+{
+    const std::size_t tm_cores = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    for(std::size_t tm_threads = 1; tm_threads <= std::max<std::size_t>(4, tm_cores); tm_threads *= 2)
+    {
+        std::array<double, 3> tm_locked {}, tm_steal {};
+        {
+            LockedPool tm_pool(tm_threads);
+            tm_locked = bench_pool(tm_pool);
+        }
+        {
+            ThreadPool tm_pool(tm_threads);
+            tm_steal = bench_pool(tm_pool);
+        }
+
+        std::stringstream tm_sstream;
+        tm_sstream << std::fixed << std::setprecision(2) << "Workers: " << tm_threads << " | Mtask/s Locked/Steal"
+            << " | 1 Producer: " << tm_locked[0] << "/" << tm_steal[0]
+            << " | 4 Producers: " << tm_locked[1] << "/" << tm_steal[1]
+            << " | Nested Tree: " << tm_locked[2] << "/" << tm_steal[2] << " (x" << tm_steal[2] / tm_locked[2] << ")";
+        ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+    }
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, "Hardware Threads: " + std::to_string(std::thread::hardware_concurrency()), GET_SOURCE);
+
+    bool vv_ok = check_once(vv_testlog);
+    vv_ok = check_steal(vv_testlog) && vv_ok;
+    vv_ok = check_stop(vv_testlog) && vv_ok;
+
+    bench(vv_testlog);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,253 @@
+// Abdulkadir U. - 2026/10/18
+
+/**
+ * Xor Kernel (Xor Çekirdeği)
+ *
+ * Xor şifrelemenin her bayt için (konum + sıra) mod anahtar
+ * uzunluğu indeksini kullandığını, 65535 bayttan uzun verilerde
+ * kesilme olmadığını ve desteklenen her vektör çekirdeğin
+ * (SSE2, AVX2, AVX-512) yazılımsal yol ile aynı sonucu verdiğini
+ * kontrol edeceğiz. Farklı boyutlarda her çekirdek için hız
+ * (GB/s) ölçülür
+ *
+ * Derleme:
+ *  Bsd     :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 xor-kernel.cpp -pthread -o bsd/xor-kernel.bsd
+ *  Linux   :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 xor-kernel.cpp -pthread -o linux/xor-kernel.linux
+ *  Windows :: g++ -I../../../include -std=c++17 -Wall -Werror -Wextra -O2 xor-kernel.cpp -o windows/xor-kernel.exe -lws2_32
+ *
+ * Çalıştırma:
+ *  Bsd     :: ./bsd/xor-kernel.bsd
+ *  Linux   :: ./linux/xor-kernel.linux
+ *  Windows :: ./windows/xor-kernel.exe
+ */
+
+// Include
+#include <kits/corekit.hpp>
+#include <kits/toolkit.hpp>
+
+#include <dev/developer.hpp>
+
+#include <pool/cipherpool.hpp>
+
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <sstream>
+
+// Using Namespace
+using namespace core::platform;
+using namespace core::version;
+
+using namespace dev::output::file;
+using namespace dev::output::console;
+using namespace dev::log;
+
+using namespace tools::charset;
+
+using namespace pool::cipherpool;
+
+// Static
+static constexpr Version ss_ver(0, 8, 9);
+static const std::string ss_osname = utf::to_lower(current_os_name());
+static const std::string ss_logname = "xor-kernel-" + ss_osname;
+
+static constexpr xorkernel::kernel_t ss_kernels[] =
+{
+    xorkernel::kernel_t::scalar,
+    xorkernel::kernel_t::sse2,
+    xorkernel::kernel_t::avx2,
+    xorkernel::kernel_t::avx512
+};
+
+/**
+ * @brief Kernel Name
+ *
+ * @param kernel_t Kernel
+ * @return const char*
+ */
+const char* kernel_name(const xorkernel::kernel_t ar_kernel)
+{
+    switch( ar_kernel )
+    {
+        case xorkernel::kernel_t::avx512: return "AVX-512";
+        case xorkernel::kernel_t::avx2: return "AVX2   ";
+        case xorkernel::kernel_t::sse2: return "SSE2   ";
+        case xorkernel::kernel_t::scalar:
+        default:
+            return "Scalar ";
+    }
+}
+
+/**
+ * @brief Random Bytes
+ *
+ * @param mt19937& Generator
+ * @param size_t Length
+ * @return string
+ */
+std::string random_bytes(std::mt19937& ar_rng, const std::size_t ar_len)
+{
+    std::string tm_out(ar_len, '\0');
+    for(auto& tm_char : tm_out)
+        tm_char = static_cast<char>(ar_rng());
+    return tm_out;
+}
+
+/**
+ * @brief Check Reference
+ *
+ * Farklı anahtar uzunluklarında, 65535 bayttan uzun veriler
+ * dahil olmak üzere sonucu bayt bayt hesaplanan referans ile
+ * karşılaştırır. Şifre çözmenin veriyi geri getirdiği ve
+ * konumlu işlemin parçalı uygulandığında aynı sonucu verdiği
+ * kontrol edilir
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_reference(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(20261018);
+    uint32_t tm_failed = 0;
+    uint32_t tm_total = 0;
+
+    for(const std::size_t tm_keylen : { 1, 3, 16, 17, 64, 1000, 1025, 4096 })
+    {
+        const std::string tm_key = random_bytes(tm_rng, tm_keylen);
+        Xor tm_xor("xor-kernel", tm_key);
+
+        for(const std::size_t tm_len : { 0, 1, 15, 63, 64, 65, 1023, 4097, 65535, 65536, 70001, 300000 })
+        {
+            ++tm_total;
+
+            const std::string tm_plain = random_bytes(tm_rng, tm_len);
+            std::string tm_text = tm_plain;
+
+            bool tm_ok = tm_xor.encrypt(tm_text);
+            for(std::size_t tm_count = 0; tm_ok && tm_count < tm_len; ++tm_count)
+                tm_ok = tm_text[tm_count] == static_cast<char>(tm_plain[tm_count] ^ tm_key[tm_count % tm_keylen]);
+
+            // SPLIT AT A RANDOM POINT WITH OFFSET
+            std::string tm_split = tm_plain;
+            const std::size_t tm_cut = tm_len ? tm_rng() % tm_len : 0;
+            auto* tm_raw = reinterpret_cast<unsigned char*>(tm_split.data());
+            tm_ok = tm_ok && tm_xor.apply(tm_raw, tm_cut, 0) && tm_xor.apply(tm_raw + tm_cut, tm_len - tm_cut, tm_cut);
+            tm_ok = tm_ok && tm_split == tm_text;
+
+            tm_ok = tm_ok && tm_xor.decrypt(tm_text) && tm_text == tm_plain;
+
+            if( !tm_ok )
+                ++tm_failed;
+        }
+    }
+
+    ar_logger.write(tm_failed ? level_t::Err : level_t::Info, "Reference Compare Failed: " + std::to_string(tm_failed) + "/" + std::to_string(tm_total), GET_SOURCE);
+    return tm_failed == 0;
+}
+
+/**
+ * @brief Check Kernels
+ *
+ * Desteklenen her çekirdeği yazılımsal yol ile rastgele
+ * uzunluk ve hizalamalarda karşılaştırır
+ *
+ * @tparam Logger<Args...>& Logger
+ * @return bool
+ */
+template<class... Args>
+bool check_kernels(Logger<Args...>& ar_logger)
+{
+    std::mt19937 tm_rng(1018);
+    const std::string tm_stream = random_bytes(tm_rng, 8192 + 64);
+    const std::string tm_plain = random_bytes(tm_rng, 8192 + 64);
+
+    bool tm_ok = true;
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !xorkernel::is_supported(tm_kernel) )
+        {
+            ar_logger.write(level_t::Info, std::string(kernel_name(tm_kernel)) + " | Not Supported", GET_SOURCE);
+            continue;
+        }
+
+        const xorkernel::xor_fn_t tm_fn = xorkernel::get_function(tm_kernel);
+        uint32_t tm_failed = 0;
+
+        for(uint32_t tm_round = 0; tm_round < 2000; ++tm_round)
+        {
+            const std::size_t tm_off = tm_rng() % 64;
+            const std::size_t tm_len = tm_rng() % 8192;
+
+            std::string tm_fast = tm_plain;
+            std::string tm_slow = tm_plain;
+
+            tm_fn(reinterpret_cast<unsigned char*>(tm_fast.data()) + tm_off, reinterpret_cast<const unsigned char*>(tm_stream.data()) + tm_off, tm_len);
+            for(std::size_t tm_count = 0; tm_count < tm_len; ++tm_count)
+                tm_slow[tm_off + tm_count] ^= tm_stream[tm_off + tm_count];
+
+            if( tm_fast != tm_slow )
+                ++tm_failed;
+        }
+
+        ar_logger.write(tm_failed ? level_t::Err : level_t::Info, std::string(kernel_name(tm_kernel)) + " | Compare Failed: " + std::to_string(tm_failed) + "/2000", GET_SOURCE);
+        tm_ok = tm_ok && tm_failed == 0;
+    }
+
+    return tm_ok;
+}
+
+/**
+ * @brief Bench
+ *
+ * Desteklenen her çekirdek için verilen boyutta
+ * saniyedeki gigabayt miktarını ölçer
+ *
+ * @tparam Logger<Args...>& Logger
+ * @param size_t Size
+ */
+template<class... Args>
+void bench(Logger<Args...>& ar_logger, const std::size_t ar_size)
+{
+    std::vector<unsigned char> tm_data(ar_size, 0x5A);
+    std::vector<unsigned char> tm_stream(ar_size, 0xA5);
+    const std::size_t tm_rounds = std::max<std::size_t>(1, (std::size_t{ 1 } << 30) / ar_size);
+
+    std::stringstream tm_sstream;
+    tm_sstream << std::fixed << std::setprecision(2) << "Size: " << std::setw(8) << ar_size << " B";
+
+    for(const auto tm_kernel : ss_kernels)
+    {
+        if( !xorkernel::is_supported(tm_kernel) )
+            continue;
+
+        const xorkernel::xor_fn_t tm_fn = xorkernel::get_function(tm_kernel);
+
+        const auto tm_start = std::chrono::steady_clock::now();
+        for(std::size_t tm_round = 0; tm_round < tm_rounds; ++tm_round)
+            tm_fn(tm_data.data(), tm_stream.data(), ar_size);
+        const double tm_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - tm_start).count();
+
+        tm_sstream << " | " << kernel_name(tm_kernel) << ": " << static_cast<double>(tm_rounds * ar_size) / tm_sec / 1e9 << " GB/s";
+    }
+
+    tm_sstream << " | Check: " << static_cast<int>(tm_data[ar_size / 2]);
+    ar_logger.write(level_t::Info, tm_sstream.str(), GET_SOURCE);
+}
+
+// main
+int main(void)
+{
+    tools::console::enable_utf8_console();
+
+    Logger<FileOut, ConsoleOut> vv_testlog("logs/" + ss_logname, "console-" + ss_logname);
+    vv_testlog.write(level_t::Info, std::string("Kernel: ") + kernel_name(xorkernel::get_kernel()), GET_SOURCE);
+
+    bool vv_ok = check_reference(vv_testlog);
+    vv_ok = check_kernels(vv_testlog) && vv_ok;
+
+    for(const std::size_t vv_size : { 64, 2048, 64 * 1024, 16 * 1024 * 1024 })
+        bench(vv_testlog, vv_size);
+
+    return vv_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}